@@ -83,6 +83,8 @@ namespace std {
 %ignore sgpp::base::HashGridStorage::operator[];
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridStorage.hpp"
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridIterator.hpp"
+%include "base/src/sgpp/base/grid/storage/compact/CompactGridStorage.hpp"
+%include "base/src/sgpp/base/grid/storage/compact/CompactGridIterator.hpp"
 %include "base/src/sgpp/base/grid/GridStorage.hpp"
 
 %include "base/src/sgpp/base/grid/generation/functors/RefinementFunctor.hpp"
@@ -133,6 +135,8 @@ namespace std {
 %include "base/src/sgpp/base/grid/generation/functors/SurplusVolumeRefinementFunctor.hpp"
 %include "base/src/sgpp/base/grid/generation/PeriodicGridGenerator.hpp"
 %include "base/src/sgpp/base/grid/GridDataBase.hpp"
+%include "base/src/sgpp/base/grid/serialization/BinaryGridSerializer.hpp"
+%include "base/src/sgpp/base/grid/serialization/BinaryGridView.hpp"
 
 %include "base/src/sgpp/base/algorithm/AlgorithmDGEMV.hpp"
 %include "base/src/sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp"
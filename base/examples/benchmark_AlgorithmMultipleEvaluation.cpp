@@ -0,0 +1,97 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+
+/**
+ * Strong scaling of the transposed mass evaluation (AlgorithmMultipleEvaluation::mult_transpose)
+ * on a regular linear grid. The number of threads is doubled from 1 to omp_get_max_threads().
+ *
+ * usage: benchmark_AlgorithmMultipleEvaluation [dim] [level] [data points] [repetitions]
+ */
+
+int main(int argc, char* argv[]) {
+  const size_t dim = (argc > 1) ? std::atoi(argv[1]) : 5;
+  const size_t level = (argc > 2) ? std::atoi(argv[2]) : 7;
+  const size_t numberOfDataPoints = (argc > 3) ? std::atoi(argv[3]) : 100000;
+  const size_t repetitions = (argc > 4) ? std::atoi(argv[4]) : 3;
+  const int maxThreads = omp_get_max_threads();
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  const size_t gridSize = grid->getSize();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numberOfDataPoints, dim);
+  sgpp::base::DataVector source(numberOfDataPoints);
+
+  for (size_t i = 0; i < numberOfDataPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, distribution(generator));
+    }
+
+    source[i] = distribution(generator);
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+  std::cout << "dim = " << dim << ", level = " << level << ", grid points = " << gridSize
+            << ", data points = " << numberOfDataPoints << "\n\n";
+  std::cout << "threads\ttime [s]\tspeedup\tefficiency\n";
+
+  sgpp::base::DataVector result(gridSize);
+  sgpp::base::DataVector reference(gridSize);
+  double serialTime = 0.0;
+  double maxDifference = 0.0;
+
+  for (int threads = 1;; threads = std::min(2 * threads, maxThreads)) {
+    omp_set_num_threads(threads);
+    double bestTime = 0.0;
+
+    for (size_t r = 0; r < repetitions; r++) {
+      auto begin = std::chrono::high_resolution_clock::now();
+      op->multTranspose(source, result);
+      const double time = std::chrono::duration<double>(
+          std::chrono::high_resolution_clock::now() - begin).count();
+      bestTime = ((r == 0) || (time < bestTime)) ? time : bestTime;
+    }
+
+    if (threads == 1) {
+      serialTime = bestTime;
+      reference = result;
+    }
+
+    for (size_t i = 0; i < gridSize; i++) {
+      maxDifference = std::max(maxDifference, std::abs(result[i] - reference[i]));
+    }
+
+    const double speedup = serialTime / bestTime;
+    std::cout << threads << "\t" << bestTime << "\t" << speedup << "\t"
+              << speedup / static_cast<double>(threads) << "\n";
+
+    if (threads == maxThreads) {
+      break;
+    }
+  }
+
+  std::cout << "\nmaximal difference to the serial result: " << maxDifference << "\n";
+  return 0;
+}
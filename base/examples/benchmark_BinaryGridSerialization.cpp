@@ -0,0 +1,115 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/serialization/BinaryGridSerializer.hpp>
+#include <sgpp/base/grid/serialization/BinaryGridView.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * Compares loading a grid with coefficients from the text format (Grid::unserialize and
+ * DataVector::fromString) with the binary format (streaming reader and
+ * memory-mapped view). Reports the load time and the increase of the resident set size.
+ *
+ * usage: benchmark_BinaryGridSerialization [dim] [level]
+ */
+
+double secondsSince(const std::chrono::high_resolution_clock::time_point& begin) {
+  return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin)
+      .count();
+}
+
+/// current resident set size in MB (Linux only, 0 otherwise)
+double residentSetSize() {
+  std::ifstream statm("/proc/self/statm");
+  size_t pages = 0;
+  size_t residentPages = 0;
+  statm >> pages >> residentPages;
+  return static_cast<double>(residentPages) * 4096.0 / 1048576.0;
+}
+
+int main(int argc, char* argv[]) {
+  const size_t dim = (argc > 1) ? std::atoi(argv[1]) : 12;
+  const size_t level = (argc > 2) ? std::atoi(argv[2]) : 6;
+  const std::string textFile = "benchmark_BinaryGridSerialization.txt";
+  const std::string binaryFile = "benchmark_BinaryGridSerialization.bin";
+
+  {
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(level);
+    sgpp::base::DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = 1.0 / static_cast<double>(i + 1);
+    }
+
+    std::cout << "dim = " << dim << ", level = " << level << ", grid points = " << grid->getSize()
+              << "\n\n";
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    {
+      std::ofstream ostr(textFile);
+      grid->serialize(ostr);
+      ostr << alpha.toString() << std::endl;
+    }
+    std::cout << "write text:   " << secondsSince(begin) << " s\n";
+
+    begin = std::chrono::high_resolution_clock::now();
+    sgpp::base::BinaryGridSerializer::writeGrid(*grid, binaryFile, &alpha);
+    std::cout << "write binary: " << secondsSince(begin) << " s\n\n";
+  }
+
+  std::cout << "                 time [s]   RSS increase [MB]\n";
+
+  {
+    const double rss = residentSetSize();
+    auto begin = std::chrono::high_resolution_clock::now();
+    std::ifstream istr(textFile);
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::unserialize(istr));
+    std::string alphaString;
+    std::getline(istr, alphaString);
+    std::getline(istr, alphaString);
+    sgpp::base::DataVector alpha = sgpp::base::DataVector::fromString(alphaString);
+    std::cout << "text             " << secondsSince(begin) << "\t" << residentSetSize() - rss
+              << "\n";
+  }
+
+  {
+    const double rss = residentSetSize();
+    auto begin = std::chrono::high_resolution_clock::now();
+    sgpp::base::DataVector alpha;
+    std::unique_ptr<sgpp::base::Grid> grid(
+        sgpp::base::BinaryGridSerializer::readGrid(binaryFile, &alpha));
+    std::cout << "binary (stream)  " << secondsSince(begin) << "\t" << residentSetSize() - rss
+              << "\n";
+  }
+
+  {
+    const double rss = residentSetSize();
+    auto begin = std::chrono::high_resolution_clock::now();
+    sgpp::base::BinaryGridView view(binaryFile);
+    // touch all coefficients and levels to include the page faults
+    double sum = 0.0;
+
+    for (size_t i = 0; i < view.getSize(); i++) {
+      sum += view.getCoefficients()[i] * static_cast<double>(view.getLevel(i, 0));
+    }
+
+    std::cout << "binary (mmap)    " << secondsSince(begin) << "\t" << residentSetSize() - rss
+              << "\t(checksum " << sum << ")\n";
+  }
+
+  std::remove(textFile.c_str());
+  std::remove(binaryFile.c_str());
+  return 0;
+}
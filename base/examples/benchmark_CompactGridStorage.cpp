@@ -0,0 +1,150 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
+#include <sgpp/base/grid/storage/compact/CompactGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/**
+ * Compares lookup, insertion and iteration throughput and the memory footprint of
+ * HashGridStorage and CompactGridStorage on a regular sparse grid.
+ *
+ * usage: benchmark_CompactGridStorage [dim] [level]
+ */
+
+double secondsSince(const std::chrono::high_resolution_clock::time_point& begin) {
+  return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin)
+      .count();
+}
+
+int main(int argc, char* argv[]) {
+  const size_t dim = (argc > 1) ? std::atoi(argv[1]) : 10;
+  const size_t level = (argc > 2) ? std::atoi(argv[2]) : 6;
+
+  sgpp::base::HashGridStorage hashStorage(dim);
+  sgpp::base::HashGenerator generator;
+  generator.regular(hashStorage, static_cast<sgpp::base::level_t>(level));
+  const size_t n = hashStorage.getSize();
+
+  std::cout << "dim = " << dim << ", level = " << level << ", grid points = " << n << "\n\n";
+
+  // insertion
+  auto begin = std::chrono::high_resolution_clock::now();
+  sgpp::base::HashGridStorage hashCopy(dim);
+
+  for (size_t i = 0; i < n; i++) {
+    hashCopy.insert(hashStorage[i]);
+  }
+
+  const double hashInsertTime = secondsSince(begin);
+
+  begin = std::chrono::high_resolution_clock::now();
+  sgpp::base::CompactGridStorage compactStorage(dim);
+
+  for (size_t i = 0; i < n; i++) {
+    compactStorage.insert(hashStorage[i]);
+  }
+
+  const double compactInsertTime = secondsSince(begin);
+
+  // lookup of all children (about half of them are not contained)
+  size_t hashFound = 0;
+  size_t compactFound = 0;
+  sgpp::base::HashGridPoint point(dim);
+  std::vector<sgpp::base::CompactGridStorage::level_type> l(dim);
+  std::vector<sgpp::base::CompactGridStorage::index_type> idx(dim);
+
+  begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t i = 0; i < n; i++) {
+    point = hashStorage[i];
+
+    for (size_t d = 0; d < dim; d++) {
+      const sgpp::base::HashGridPoint::level_type curLevel = point.getLevel(d);
+      const sgpp::base::HashGridPoint::index_type curIndex = point.getIndex(d);
+      point.set(d, curLevel + 1, 2 * curIndex - 1);
+      hashFound += hashStorage.isContaining(point) ? 1 : 0;
+      point.set(d, curLevel, curIndex);
+    }
+  }
+
+  const double hashLookupTime = secondsSince(begin);
+  begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      compactStorage.get(i, d, l[d], idx[d]);
+    }
+
+    for (size_t d = 0; d < dim; d++) {
+      const sgpp::base::CompactGridStorage::level_type curLevel = l[d];
+      const sgpp::base::CompactGridStorage::index_type curIndex = idx[d];
+      l[d] = curLevel + 1;
+      idx[d] = 2 * curIndex - 1;
+      compactFound += compactStorage.isInvalidSequenceNumber(
+                          compactStorage.getSequenceNumber(l.data(), idx.data()))
+                          ? 0
+                          : 1;
+      l[d] = curLevel;
+      idx[d] = curIndex;
+    }
+  }
+
+  const double compactLookupTime = secondsSince(begin);
+
+  // iteration (sum of all levels)
+  size_t hashSum = 0;
+  size_t compactSum = 0;
+  begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      hashSum += hashStorage[i].getLevel(d);
+    }
+  }
+
+  const double hashIterationTime = secondsSince(begin);
+  begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t i = 0; i < n; i++) {
+    const sgpp::base::CompactGridStorage::packed_level_type* levels =
+        compactStorage.getLevelArray(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      compactSum += levels[d];
+    }
+  }
+
+  const double compactIterationTime = secondsSince(begin);
+
+  // rough estimate of the HashGridStorage footprint: point object, three arrays,
+  // list entry and unordered_map node (key, value, next pointer, cached hash)
+  const size_t hashFootprint =
+      n * (sizeof(sgpp::base::HashGridPoint) + dim * 3 * sizeof(uint32_t) +
+           sizeof(void*) + 4 * sizeof(size_t));
+
+  std::cout << "                 HashGridStorage   CompactGridStorage\n";
+  std::cout << "insert [Mpts/s]  " << 1e-6 * static_cast<double>(n) / hashInsertTime << "\t\t"
+            << 1e-6 * static_cast<double>(n) / compactInsertTime << "\n";
+  std::cout << "lookup [Mpts/s]  " << 1e-6 * static_cast<double>(n * dim) / hashLookupTime
+            << "\t\t" << 1e-6 * static_cast<double>(n * dim) / compactLookupTime << "\n";
+  std::cout << "iterate [Mpts/s] " << 1e-6 * static_cast<double>(n) / hashIterationTime << "\t\t"
+            << 1e-6 * static_cast<double>(n) / compactIterationTime << "\n";
+  std::cout << "memory [MB]      ~" << static_cast<double>(hashFootprint) / 1048576.0 << "\t\t"
+            << static_cast<double>(compactStorage.getMemoryFootprint()) / 1048576.0 << "\n";
+
+  if ((hashFound != compactFound) || (hashSum != compactSum)) {
+    std::cout << "ERROR: results of the storages differ\n";
+    return 1;
+  }
+
+  return 0;
+}
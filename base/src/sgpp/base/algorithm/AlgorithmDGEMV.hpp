@@ -157,6 +157,111 @@ class AlgorithmDGEMV {
       }
     }
   }
+
+  /**
+   * Performs the DGEMV Operation on the grid for several coefficient vectors at once,
+   * see mult. The affected basis functions are determined once per data point and
+   * applied to all columns of source.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source matrix with one coefficient vector per column (one row per grid point)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix (one row per data point, one column per column of source)
+   */
+  void mult_block(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+                  DataMatrix& x, DataMatrix& result) {
+    typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+    size_t result_size = x.getNrows();
+    size_t columns = source.getNcols();
+
+    result.resizeRowsCols(result_size, columns);
+    result.setAll(0.0);
+
+    #pragma omp parallel
+    {
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule (static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        double* resultRow = result.getPointer() + i * columns;
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          const double* sourceRow = source.getPointer() + iter->first * columns;
+
+          for (size_t j = 0; j < columns; j++) {
+            resultRow[j] += iter->second * sourceRow[j];
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Performs the transposed DGEMV Operation on the grid for several vectors at once,
+   * see mult_transposed. The affected basis functions are determined once per data point
+   * and applied to all columns of source.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source matrix with one vector per column (one row per data point)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix (one row per grid point, one column per column of source)
+   */
+  void mult_transposed_block(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+                             DataMatrix& x, DataMatrix& result) {
+    typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+    size_t columns = source.getNcols();
+
+    result.resizeRowsCols(storage.getSize(), columns);
+    result.setAll(0.0);
+
+    #pragma omp parallel
+    {
+      size_t source_size = source.getNrows();
+      DataMatrix privateResult(result.getNrows(), columns, 0.0);
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule(static)
+
+      for (size_t i = 0; i < source_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        const double* sourceRow = source.getPointer() + i * columns;
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          double* resultRow = privateResult.getPointer() + iter->first * columns;
+
+          for (size_t j = 0; j < columns; j++) {
+            resultRow[j] += iter->second * sourceRow[j];
+          }
+        }
+      }
+
+      #pragma omp critical
+      {
+        result.add(privateResult);
+      }
+    }
+  }
 };
 
 }  // namespace base
@@ -7,13 +7,16 @@
 #define ALGORITHMEVALUATION_HPP
 
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearStretchedBoundaryBasis.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 
 namespace sgpp {
@@ -51,8 +54,19 @@ namespace base {
 template<class BASIS>
 class AlgorithmEvaluation {
  public:
+  /// number of points that are evaluated together by one thread in the batched evaluation
+  static const size_t BLOCK_SIZE = 64;
+
+  /**
+   * Constructor. Allocates the workspace (grid iterator, transformed point and
+   * index bits), which is reused for all subsequent evaluations.
+   * Therefore, an instance must not be used by multiple threads concurrently.
+   *
+   * @param storage grid storage
+   */
   explicit AlgorithmEvaluation(GridStorage& storage) :
-    storage(storage) {
+    storage(storage), working(storage), newPoint(storage.getDimension()),
+    source(storage.getDimension()) {
   }
 
   ~AlgorithmEvaluation() {
@@ -72,14 +86,11 @@ class AlgorithmEvaluation {
    * @result result result of the function evaluation
    */
   double operator()(BASIS& basis, const DataVector& point, const DataVector& alpha) {
-    GridStorage::grid_iterator working(storage);
-
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
     const size_t dim = storage.getDimension();
 
     // Check for bounding box
     BoundingBox* bb = storage.getBoundingBox();
-    DataVector newPoint(dim);
 
     for (size_t d = 0; d < dim; d++) {
       if (!bb->isContainingPoint(d, point[d])) {
@@ -89,8 +100,6 @@ class AlgorithmEvaluation {
       newPoint[d] = bb->transformPointToUnitCube(d, point[d]);
     }
 
-    index_t* source = new index_t[dim];
-
     for (size_t d = 0; d < dim; d++) {
       // This does not really work on grids with borders.
       const double temp = std::floor(newPoint[d] * static_cast<double>(1 << (bits - 2))) * 2.0;
@@ -102,15 +111,59 @@ class AlgorithmEvaluation {
       }
     }
 
+    // the iterator is at level one in all dimensions after each traversal,
+    // but the grid might have been changed since the last evaluation
+    working.resetToLevelOne(dim - 1);
+
     double result = 0.0;
-    rec(basis, newPoint, 0, 1.0, working, source, alpha, result);
-    delete[] source;
+    rec(basis, newPoint, 0, 1.0, working, source.data(), alpha, result);
 
     return result;
   }
 
+  /**
+   * Evaluates the sparse grid function at multiple points.
+   * The points are split into blocks of BLOCK_SIZE consecutive points, which are distributed
+   * among the OpenMP threads. Each thread uses its own workspace for all of its blocks.
+   *
+   * @param basis     a sparse grid basis (has to support concurrent calls of eval)
+   * @param points    evaluation points (row-wise)
+   * @param alpha     the sparse grid's coefficients
+   * @param[out] result  function values at the points (resized to the number of points)
+   */
+  void operator()(BASIS& basis, const DataMatrix& points, const DataVector& alpha,
+                  DataVector& result) {
+    const size_t numberOfPoints = points.getNrows();
+    const size_t numberOfBlocks = (numberOfPoints + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    result.resize(numberOfPoints);
+
+#pragma omp parallel
+    {
+      AlgorithmEvaluation<BASIS> algoEval(storage);
+      DataVector point(points.getNcols());
+
+#pragma omp for schedule(dynamic)
+
+      for (size_t block = 0; block < numberOfBlocks; block++) {
+        const size_t end = std::min((block + 1) * BLOCK_SIZE, numberOfPoints);
+
+        for (size_t i = block * BLOCK_SIZE; i < end; i++) {
+          points.getRow(i, point);
+          result[i] = algoEval(basis, point, alpha);
+        }
+      }
+    }
+  }
+
  protected:
   GridStorage& storage;
+  /// iterator used for the traversal
+  GridStorage::grid_iterator working;
+  /// evaluation point transformed to the unit cube
+  DataVector newPoint;
+  /// index bits of the evaluation point for each dimension
+  std::vector<index_t> source;
 
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
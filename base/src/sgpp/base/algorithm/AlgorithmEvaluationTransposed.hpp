@@ -13,6 +13,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <utility>
+#include <vector>
 
 
 namespace sgpp {
@@ -46,6 +47,33 @@ class AlgorithmEvaluationTransposed {
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
   void operator()(BASIS& basis, const DataVector& point, double alpha, DataVector& result) {
+    evaluate(basis, point, alpha, result);
+  }
+
+  /**
+   * Appends the weighted evaluations of all basis functions that are non-zero at a given
+   * evaluation point as tuples \f$(i,\alpha \phi_i(x))\f$ to the result vector instead of
+   * accumulating them in a full-size vector.
+   * This allows callers to distribute the contributions to the owners of the grid points.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param alpha the coefficient of the regarded ansatzfunction
+   * @param result vector the contributions are appended to (it is not cleared)
+   */
+  void operator()(BASIS& basis, const DataVector& point, double alpha,
+                  std::vector<std::pair<size_t, double>>& result) {
+    evaluate(basis, point, alpha, result);
+  }
+
+ protected:
+  GridStorage& storage;
+
+  /**
+   * Implementation of operator() for both result types.
+   */
+  template <class RESULT>
+  void evaluate(BASIS& basis, const DataVector& point, double alpha, RESULT& result) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -80,8 +108,15 @@ class AlgorithmEvaluationTransposed {
     delete[] source;
   }
 
- protected:
-  GridStorage& storage;
+  /// adds a contribution to a full-size result vector
+  static void accumulate(DataVector& result, size_t seq, double value) { result[seq] += value; }
+
+  /// appends a contribution to a list of (sequence number, value) tuples
+
+  static void accumulate(std::vector<std::pair<size_t, double>>& result, size_t seq,
+                         double value) {
+    result.push_back(std::make_pair(seq, value));
+  }
 
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
@@ -97,10 +132,11 @@ class AlgorithmEvaluationTransposed {
    * @param alpha the coefficient of current ansatzfunction
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
+  template <class RESULT>
   void rec(BASIS& basis, DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
            index_t* source, double alpha,
-           DataVector& result) {
+           RESULT& result) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -125,7 +161,7 @@ class AlgorithmEvaluationTransposed {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result[seq] += alpha * new_value;
+          accumulate(result, seq, alpha * new_value);
         } else {
           rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
           if (!hint) working.resetToLevelOne(current_dim+1);
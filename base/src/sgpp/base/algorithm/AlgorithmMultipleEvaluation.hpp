@@ -15,8 +15,14 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -35,9 +41,19 @@ namespace base {
 template <class BASIS>
 class AlgorithmMultipleEvaluation {
  public:
+  /// number of data points each thread evaluates per round of mult_transpose
+  static const size_t DATA_POINTS_PER_ROUND = 256;
+
   /**
    * Performs a transposed mass evaluation
    *
+   * The result vector is partitioned into contiguous ranges of grid points, one per thread
+   * (owner computes). The data points are processed in rounds: first, each thread evaluates
+   * DATA_POINTS_PER_ROUND data points and sorts the non-zero contributions by the owner of the
+   * respective grid point; after a barrier, each thread adds the contributions for the grid points
+   * it owns. Therefore, no thread-private copies of the result vector and no critical sections
+   * are needed, and the memory overhead is independent of the grid size.
+   *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
@@ -47,54 +63,41 @@ class AlgorithmMultipleEvaluation {
   void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
                       DataVector& result) {
     result.setAll(0.0);
-    size_t source_size = source.getSize();
-
-#pragma omp parallel
-    {
-      DataVector privateResult(result.getSize());
-      privateResult.setAll(0.0);
-
-      DataVector line(x.getNcols());
-      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
 
-      privateResult.setAll(0.0);
+    ownerComputes(storage, basis, x, source.getSize(), result.getSize(),
+                  [&source, &result](size_t seq, size_t point, double value) {
+                    result[seq] += value * source[point];
+                  });
+  }
 
-#pragma omp for schedule(static)
+  /**
+   * Performs a transposed mass evaluation for several vectors at once, see mult_transpose.
+   * The non-zero basis functions are determined once per data point and applied to all
+   * columns of source.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source matrix with one vector per column (one row per data point)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix (one row per grid point, one column per column of source)
+   */
+  void mult_transpose_block(GridStorage& storage, BASIS& basis, DataMatrix& source,
+                            DataMatrix& x, DataMatrix& result) {
+    const size_t numberOfColumns = source.getNcols();
 
-      for (size_t i = 0; i < source_size; i++) {
-        x.getRow(i, line);
+    result.resizeRowsCols(storage.getSize(), numberOfColumns);
+    result.setAll(0.0);
 
-        AlgoEvalTrans(basis, line, source[i], privateResult);
-      }
+    ownerComputes(storage, basis, x, source.getNrows(), result.getNrows(),
+                  [&source, &result, numberOfColumns](size_t seq, size_t point, double value) {
+                    const double* sourceRow = source.getPointer() + point * numberOfColumns;
+                    double* resultRow = result.getPointer() + seq * numberOfColumns;
 
-#pragma omp critical
-      { result.add(privateResult); }
-    }
+                    for (size_t j = 0; j < numberOfColumns; j++) {
+                      resultRow[j] += value * sourceRow[j];
+                    }
+                  });
   }
-  // implementation requires OpenMP 4.0 support
-  //        void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source,
-  //                            DataMatrix& x, DataVector& result) {
-  //          result.setAll(0.0);
-  //          size_t source_size = source.getSize();
-  //
-  //          #pragma omp declare reduction(accumulate :
-  // ...      sgpp::base::DataVector : omp_out.add(omp_in))
-  // ...      initializer ( omp_priv = DataVector(omp_orig.getSize(), 0))
-  //
-  //          #pragma omp parallel
-  //          {
-  //            DataVector line(x.getNcols());
-  //            AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
-  //
-  //            #pragma omp for reduction(accumulate:result) schedule(static)
-  //
-  //            for (size_t i = 0; i < source_size; i++) {
-  //              x.getRow(i, line);
-  //
-  //              AlgoEvalTrans(basis, line, source[i], result);
-  //            }
-  //          }
-  //        }
 
   /**
    * Performs a mass evaluation
@@ -107,20 +110,145 @@ class AlgorithmMultipleEvaluation {
    */
   void mult(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
             DataVector& result) {
+    AlgorithmEvaluation<BASIS> AlgoEval(storage);
+    AlgoEval(basis, x, source, result);
+  }
+
+  /**
+   * Performs a mass evaluation for several coefficient vectors at once.
+   * The non-zero basis functions are determined once per data point and applied to all
+   * columns of source.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source matrix with one coefficient vector per column (one row per grid point)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix (one row per data point, one column per column of source)
+   */
+  void mult_block(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+                  DataMatrix& result) {
+    typedef std::vector<std::pair<size_t, double>> IndexValVector;
+
+    const size_t numberOfPoints = x.getNrows();
+    const size_t numberOfColumns = source.getNcols();
+
+    result.resizeRowsCols(numberOfPoints, numberOfColumns);
     result.setAll(0.0);
-    size_t result_size = result.getSize();
 
 #pragma omp parallel
     {
       DataVector line(x.getNcols());
-      AlgorithmEvaluation<BASIS> AlgoEval(storage);
+      IndexValVector basisValues;
+      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
 
 #pragma omp for schedule(static)
 
-      for (size_t i = 0; i < result_size; i++) {
+      for (size_t i = 0; i < numberOfPoints; i++) {
         x.getRow(i, line);
 
-        result[i] = AlgoEval(basis, line, source);
+        basisValues.clear();
+        AlgoEvalTrans(basis, line, 1.0, basisValues);
+
+        double* resultRow = result.getPointer() + i * numberOfColumns;
+
+        for (const std::pair<size_t, double>& basisValue : basisValues) {
+          const double* sourceRow = source.getPointer() + basisValue.first * numberOfColumns;
+
+          for (size_t j = 0; j < numberOfColumns; j++) {
+            resultRow[j] += basisValue.second * sourceRow[j];
+          }
+        }
+      }
+    }
+  }
+
+ protected:
+  /// contribution of a data point to a grid point
+  struct Contribution {
+    /// sequence number of the grid point
+    size_t seq;
+    /// index of the data point
+    size_t point;
+    /// value of the basis function of the grid point at the data point
+    double value;
+  };
+
+  /**
+   * Evaluates the non-zero basis functions at all data points and passes each
+   * contribution (grid point, data point, value) to the thread that owns the grid point
+   * (see mult_transpose). Hence, accumulate may write to the result of the grid point without
+   * synchronization.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param numberOfPoints number of data points
+   * @param numberOfGridPoints number of grid points
+   * @param accumulate function called with the sequence number of the grid point, the index of
+   *                   the data point and the value of the basis function
+   */
+  template <class ACCUMULATE>
+  void ownerComputes(GridStorage& storage, BASIS& basis, DataMatrix& x, size_t numberOfPoints,
+                     size_t numberOfGridPoints, ACCUMULATE accumulate) {
+    size_t numThreads = 1;
+    // contributions[p * numThreads + o]: contributions of thread p to grid points owned by o
+    std::vector<std::vector<Contribution>> contributions;
+
+#pragma omp parallel
+    {
+#pragma omp single
+      {
+#ifdef _OPENMP
+        numThreads = static_cast<size_t>(omp_get_num_threads());
+#endif
+        contributions.resize(numThreads * numThreads);
+      }
+
+#ifdef _OPENMP
+      const size_t threadId = static_cast<size_t>(omp_get_thread_num());
+#else
+      const size_t threadId = 0;
+#endif
+      const size_t ownedRangeSize =
+          std::max<size_t>((numberOfGridPoints + numThreads - 1) / numThreads, 1);
+      const size_t roundSize = numThreads * DATA_POINTS_PER_ROUND;
+      const size_t numberOfRounds = (numberOfPoints + roundSize - 1) / roundSize;
+
+      DataVector line(x.getNcols());
+      std::vector<std::pair<size_t, double>> basisValues;
+      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
+
+      for (size_t round = 0; round < numberOfRounds; round++) {
+        const size_t begin =
+            std::min(round * roundSize + threadId * DATA_POINTS_PER_ROUND, numberOfPoints);
+        const size_t end = std::min(begin + DATA_POINTS_PER_ROUND, numberOfPoints);
+
+        for (size_t i = begin; i < end; i++) {
+          x.getRow(i, line);
+
+          basisValues.clear();
+          AlgoEvalTrans(basis, line, 1.0, basisValues);
+
+          for (const std::pair<size_t, double>& basisValue : basisValues) {
+            contributions[threadId * numThreads + basisValue.first / ownedRangeSize].push_back(
+                Contribution{basisValue.first, i, basisValue.second});
+          }
+        }
+
+#pragma omp barrier
+
+        // accumulate the contributions of all threads to the grid points owned by this thread
+        for (size_t p = 0; p < numThreads; p++) {
+          std::vector<Contribution>& ownedContributions = contributions[p * numThreads + threadId];
+
+          for (const Contribution& contribution : ownedContributions) {
+            accumulate(contribution.seq, contribution.point, contribution.value);
+          }
+
+          ownedContributions.clear();
+        }
+
+#pragma omp barrier
       }
     }
   }
@@ -686,6 +686,8 @@ Grid::~Grid() {}
 
 GridStorage& Grid::getStorage() { return storage; }
 
+CompactGridStorage* Grid::createCompactStorage() { return new CompactGridStorage(storage); }
+
 BoundingBox& Grid::getBoundingBox() { return *storage.getBoundingBox(); }
 
 Stretching& Grid::getStretching() {
@@ -638,6 +638,14 @@ class Grid {
    */
   virtual GridStorage& getStorage();
 
+  /**
+   * creates a CompactGridStorage containing the grid points of the grid's storage
+   * with the same sequence numbers, e.g., for lookup-heavy algorithms on large grids
+   *
+   * @return pointer to the new compact storage (has to be deleted by the caller)
+   */
+  CompactGridStorage* createCompactStorage();
+
   /**
    * gets a reference to the GridStorage's BoundingsBox object
    *
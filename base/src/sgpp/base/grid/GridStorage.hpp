@@ -10,6 +10,8 @@
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridIterator.hpp>
+#include <sgpp/base/grid/storage/compact/CompactGridStorage.hpp>
+#include <sgpp/base/grid/storage/compact/CompactGridIterator.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -27,6 +29,12 @@ typedef HashGridPoint GridPoint;
  */
 typedef HashGridStorage GridStorage;
 
+/**
+ * Typedef for the compact (structure-of-arrays, open-addressing) storage backend,
+ * see Grid::createCompactStorage
+ */
+typedef CompactGridStorage CompactStorage;
+
 }  // namespace base
 }  // namespace sgpp
 
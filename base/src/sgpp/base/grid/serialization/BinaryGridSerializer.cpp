@@ -0,0 +1,319 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/serialization/BinaryGridSerializer.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+const char MAGIC[8] = {'S', 'G', 'P', 'P', 'B', 'I', 'N', '\0'};
+
+/// number of grid points that are converted and written at once
+const size_t CHUNK_SIZE = 4096;
+
+uint64_t align(uint64_t offset) {
+  return (offset + BinaryGridSerializer::ALIGNMENT - 1) / BinaryGridSerializer::ALIGNMENT *
+         BinaryGridSerializer::ALIGNMENT;
+}
+
+void writePadding(std::ostream& ostr, uint64_t& position, uint64_t target) {
+  const char zeros[BinaryGridSerializer::ALIGNMENT] = {};
+
+  while (position < target) {
+    const uint64_t n = std::min<uint64_t>(target - position, BinaryGridSerializer::ALIGNMENT);
+    ostr.write(zeros, static_cast<std::streamsize>(n));
+    position += n;
+  }
+}
+
+void readBytes(std::istream& istr, uint64_t& position, void* data, uint64_t size) {
+  istr.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(size));
+
+  if (static_cast<uint64_t>(istr.gcount()) != size) {
+    throw file_exception("BinaryGridSerializer: unexpected end of stream");
+  }
+
+  position += size;
+}
+
+void skipTo(std::istream& istr, uint64_t& position, uint64_t target) {
+  char buffer[BinaryGridSerializer::ALIGNMENT];
+
+  if (target < position) {
+    throw file_exception("BinaryGridSerializer: invalid offset in header");
+  }
+
+  while (position < target) {
+    readBytes(istr, position, buffer,
+              std::min<uint64_t>(target - position, BinaryGridSerializer::ALIGNMENT));
+  }
+}
+
+}  // namespace
+
+const uint64_t BinaryGridSerializer::ALIGNMENT;
+const uint32_t BinaryGridSerializer::BYTE_ORDER_MARK;
+
+void BinaryGridSerializer::writeGrid(Grid& grid, std::ostream& ostr, const DataVector* alpha) {
+  // the meta data is the text serialization of an empty grid of the same type,
+  // which contains the grid type, the bounding box/stretching and type-specific
+  // parameters like the degree
+  std::unique_ptr<Grid> emptyGrid(grid.createGridOfEquivalentType(grid.getDimension()));
+  HashGridStorage& storage = grid.getStorage();
+
+  if (storage.getStretching() != nullptr) {
+    emptyGrid->setStretching(*storage.getStretching());
+  } else {
+    emptyGrid->setBoundingBox(*storage.getBoundingBox());
+  }
+
+  std::ostringstream meta;
+  emptyGrid->serialize(meta);
+  write(storage, meta.str(), true, ostr, alpha);
+}
+
+void BinaryGridSerializer::writeGrid(Grid& grid, const std::string& filename,
+                                     const DataVector* alpha) {
+  std::ofstream ostr(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!ostr) {
+    throw file_exception("BinaryGridSerializer::writeGrid: cannot open file");
+  }
+
+  writeGrid(grid, ostr, alpha);
+}
+
+void BinaryGridSerializer::writeStorage(HashGridStorage& storage, std::ostream& ostr,
+                                        const DataVector* alpha) {
+  HashGridStorage emptyStorage(storage.getDimension());
+
+  if (storage.getStretching() != nullptr) {
+    emptyStorage.setStretching(*storage.getStretching());
+  } else {
+    emptyStorage.setBoundingBox(*storage.getBoundingBox());
+  }
+
+  write(storage, emptyStorage.serialize(), false, ostr, alpha);
+}
+
+void BinaryGridSerializer::write(HashGridStorage& storage, const std::string& meta,
+                                 bool containsGrid, std::ostream& ostr, const DataVector* alpha) {
+  const size_t dim = storage.getDimension();
+  const size_t n = storage.getSize();
+
+  if ((alpha != nullptr) && (alpha->getSize() != n)) {
+    throw file_exception("BinaryGridSerializer: size of coefficient vector does not match");
+  }
+
+  BinaryGridHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = BINARY_SERIALIZATION_VERSION;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.containsGrid = containsGrid ? 1 : 0;
+  header.dimension = dim;
+  header.numberOfPoints = n;
+  header.metaOffset = sizeof(BinaryGridHeader);
+  header.metaSize = meta.size();
+  header.levelOffset = align(header.metaOffset + header.metaSize);
+  header.indexOffset = align(header.levelOffset + n * dim * sizeof(uint32_t));
+  header.leafOffset = align(header.indexOffset + n * dim * sizeof(uint32_t));
+  header.coefficientOffset = (alpha == nullptr) ? 0 : align(header.leafOffset + n);
+
+  uint64_t position = 0;
+  ostr.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  position += sizeof(header);
+  ostr.write(meta.data(), static_cast<std::streamsize>(meta.size()));
+  position += meta.size();
+
+  std::vector<uint32_t> buffer(CHUNK_SIZE * dim);
+
+  // levels and indices
+  for (int array = 0; array < 2; array++) {
+    writePadding(ostr, position, (array == 0) ? header.levelOffset : header.indexOffset);
+
+    for (size_t chunkStart = 0; chunkStart < n; chunkStart += CHUNK_SIZE) {
+      const size_t chunkEnd = std::min(chunkStart + CHUNK_SIZE, n);
+
+      for (size_t i = chunkStart; i < chunkEnd; i++) {
+        const HashGridPoint& point = storage.getPoint(i);
+        uint32_t* dst = &buffer[(i - chunkStart) * dim];
+
+        for (size_t d = 0; d < dim; d++) {
+          dst[d] = (array == 0) ? point.getLevel(d) : point.getIndex(d);
+        }
+      }
+
+      const uint64_t size = (chunkEnd - chunkStart) * dim * sizeof(uint32_t);
+      ostr.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(size));
+      position += size;
+    }
+  }
+
+  // leaf flags
+  writePadding(ostr, position, header.leafOffset);
+  std::vector<uint8_t> leaves(n);
+
+  for (size_t i = 0; i < n; i++) {
+    leaves[i] = storage.getPoint(i).isLeaf() ? 1 : 0;
+  }
+
+  ostr.write(reinterpret_cast<const char*>(leaves.data()), static_cast<std::streamsize>(n));
+  position += n;
+
+  // coefficients
+  if (alpha != nullptr) {
+    writePadding(ostr, position, header.coefficientOffset);
+    ostr.write(reinterpret_cast<const char*>(alpha->getPointer()),
+               static_cast<std::streamsize>(n * sizeof(double)));
+    position += n * sizeof(double);
+  }
+
+  if (!ostr) {
+    throw file_exception("BinaryGridSerializer: error while writing");
+  }
+}
+
+void BinaryGridSerializer::checkHeader(const BinaryGridHeader& header) {
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw file_exception("BinaryGridSerializer: not a binary SG++ grid");
+  }
+
+  if (header.byteOrderMark != BYTE_ORDER_MARK) {
+    throw file_exception("BinaryGridSerializer: file was written with a different byte order");
+  }
+
+  if (header.version > BINARY_SERIALIZATION_VERSION) {
+    throw file_exception("BinaryGridSerializer: version of serialized grid is too new");
+  }
+}
+
+void BinaryGridSerializer::readHeader(std::istream& istr, BinaryGridHeader& header) {
+  uint64_t position = 0;
+  readBytes(istr, position, &header, sizeof(header));
+  checkHeader(header);
+}
+
+std::string BinaryGridSerializer::read(std::istream& istr, BinaryGridHeader& header,
+                                       std::vector<uint32_t>& levels,
+                                       std::vector<uint32_t>& indices,
+                                       std::vector<uint8_t>& leaves, DataVector* alpha) {
+  readHeader(istr, header);
+  uint64_t position = sizeof(header);
+
+  const size_t n = static_cast<size_t>(header.numberOfPoints);
+  const size_t dim = static_cast<size_t>(header.dimension);
+
+  if ((alpha != nullptr) && (header.coefficientOffset == 0)) {
+    throw file_exception("BinaryGridSerializer: stream does not contain coefficients");
+  }
+
+  std::string meta(static_cast<size_t>(header.metaSize), '\0');
+  skipTo(istr, position, header.metaOffset);
+  readBytes(istr, position, &meta[0], header.metaSize);
+
+  levels.resize(n * dim);
+  indices.resize(n * dim);
+  leaves.resize(n);
+
+  skipTo(istr, position, header.levelOffset);
+  readBytes(istr, position, levels.data(), n * dim * sizeof(uint32_t));
+  skipTo(istr, position, header.indexOffset);
+  readBytes(istr, position, indices.data(), n * dim * sizeof(uint32_t));
+  skipTo(istr, position, header.leafOffset);
+  readBytes(istr, position, leaves.data(), n);
+
+  if (alpha != nullptr) {
+    alpha->resize(n);
+    skipTo(istr, position, header.coefficientOffset);
+    readBytes(istr, position, alpha->getPointer(), n * sizeof(double));
+  }
+
+  return meta;
+}
+
+Grid* BinaryGridSerializer::readGrid(std::istream& istr, DataVector* alpha) {
+  BinaryGridHeader header;
+  std::vector<uint32_t> levels;
+  std::vector<uint32_t> indices;
+  std::vector<uint8_t> leaves;
+  const std::string meta = read(istr, header, levels, indices, leaves, alpha);
+
+  if (header.containsGrid == 0) {
+    throw file_exception("BinaryGridSerializer::readGrid: stream contains no grid");
+  }
+
+  std::unique_ptr<Grid> grid(Grid::unserialize(meta));
+  insertPoints(grid->getStorage(), static_cast<size_t>(header.dimension),
+               static_cast<size_t>(header.numberOfPoints), levels.data(), indices.data(),
+               leaves.data());
+  return grid.release();
+}
+
+Grid* BinaryGridSerializer::readGrid(const std::string& filename, DataVector* alpha) {
+  std::ifstream istr(filename, std::ios::in | std::ios::binary);
+
+  if (!istr) {
+    throw file_exception("BinaryGridSerializer::readGrid: cannot open file");
+  }
+
+  return readGrid(istr, alpha);
+}
+
+HashGridStorage* BinaryGridSerializer::readStorage(std::istream& istr, DataVector* alpha) {
+  BinaryGridHeader header;
+  std::vector<uint32_t> levels;
+  std::vector<uint32_t> indices;
+  std::vector<uint8_t> leaves;
+  std::string meta = read(istr, header, levels, indices, leaves, alpha);
+
+  if (header.containsGrid != 0) {
+    // skip the grid type, the storage description follows
+    meta = meta.substr(meta.find('\n') + 1);
+  }
+
+  std::unique_ptr<HashGridStorage> storage(new HashGridStorage(meta));
+  insertPoints(*storage, static_cast<size_t>(header.dimension),
+               static_cast<size_t>(header.numberOfPoints), levels.data(), indices.data(),
+               leaves.data());
+  return storage.release();
+}
+
+void BinaryGridSerializer::insertPoints(HashGridStorage& storage, size_t dimension,
+                                        size_t numberOfPoints, const uint32_t* levels,
+                                        const uint32_t* indices, const uint8_t* leaves) {
+  const size_t dim = storage.getDimension();
+
+  if (dimension != dim) {
+    throw file_exception("BinaryGridSerializer: dimension of the grid points does not match");
+  }
+
+  HashGridPoint point(dim);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      point.push(d, levels[i * dim + d], indices[i * dim + d]);
+    }
+
+    point.setLeaf(leaves[i] != 0);
+    point.rehash();
+    storage.insert(point);
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,197 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BINARYGRIDSERIALIZER_HPP
+#define BINARYGRIDSERIALIZER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * This specifies the available binary serialization versions
+ *
+ * Version 1: header, textual meta data (grid type, bounding box/stretching, grid parameters),
+ *            level, index and leaf arrays, optional coefficient vector
+ */
+#define BINARY_SERIALIZATION_VERSION 1
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Header of the binary grid format. All offsets are relative to the beginning of the file
+ * and aligned to BinaryGridSerializer::ALIGNMENT bytes, such that the arrays can be used
+ * directly after mapping the file into memory.
+ *
+ * Layout of the file:
+ * - header
+ * - meta data: text serialization of the grid (or the grid storage) without grid points
+ * - levels:       uint32_t[numberOfPoints * dimension], point-major
+ * - indices:      uint32_t[numberOfPoints * dimension], point-major
+ * - leaf flags:   uint8_t[numberOfPoints]
+ * - coefficients: double[numberOfPoints] (optional, coefficientOffset == 0 if missing)
+ *
+ * The data is stored in the byte order of the writing machine, which is checked when reading.
+ */
+struct BinaryGridHeader {
+  /// magic number "SGPPBIN"
+  char magic[8];
+  /// binary serialization version
+  uint32_t version;
+  /// byte order mark (BinaryGridSerializer::BYTE_ORDER_MARK)
+  uint32_t byteOrderMark;
+  /// 1 if the meta data describes a Grid, 0 if it describes a HashGridStorage
+  uint32_t containsGrid;
+  /// unused, set to zero
+  uint32_t reserved;
+  /// dimension of the grid
+  uint64_t dimension;
+  /// number of grid points
+  uint64_t numberOfPoints;
+  /// offset of the meta data
+  uint64_t metaOffset;
+  /// size of the meta data in bytes
+  uint64_t metaSize;
+  /// offset of the level array
+  uint64_t levelOffset;
+  /// offset of the index array
+  uint64_t indexOffset;
+  /// offset of the leaf flags
+  uint64_t leafOffset;
+  /// offset of the coefficient vector (0 if the file does not contain coefficients)
+  uint64_t coefficientOffset;
+};
+
+/**
+ * Reads and writes grids, grid storages and coefficient vectors in a versioned binary format.
+ * In contrast to the text serialization (Grid::serialize), the grid points are stored as
+ * contiguous level and index arrays, which can be written and read in large chunks or
+ * memory-mapped (see BinaryGridView).
+ *
+ * The readers in this class work on arbitrary streams (e.g., pipes or compressed streams)
+ * and are the fallback if the file cannot be memory-mapped.
+ */
+class BinaryGridSerializer {
+ public:
+  /// alignment of the arrays in the file in bytes
+  static const uint64_t ALIGNMENT = 64;
+  /// byte order mark to detect files written on machines with a different byte order
+  static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+  /**
+   * Writes a grid and, optionally, its coefficient vector.
+   *
+   * @param grid    grid to write
+   * @param ostr    output stream (should be opened in binary mode)
+   * @param alpha   coefficient vector (optional, size has to match the grid size)
+   */
+  static void writeGrid(Grid& grid, std::ostream& ostr, const DataVector* alpha = nullptr);
+
+  /**
+   * Writes a grid and, optionally, its coefficient vector to a file.
+   *
+   * @param grid      grid to write
+   * @param filename  name of the file
+   * @param alpha     coefficient vector (optional, size has to match the grid size)
+   */
+  static void writeGrid(Grid& grid, const std::string& filename,
+                        const DataVector* alpha = nullptr);
+
+  /**
+   * Writes a grid storage.
+   *
+   * @param storage grid storage to write
+   * @param ostr    output stream (should be opened in binary mode)
+   * @param alpha   coefficient vector (optional, size has to match the storage size)
+   */
+  static void writeStorage(HashGridStorage& storage, std::ostream& ostr,
+                           const DataVector* alpha = nullptr);
+
+  /**
+   * Reads a grid written by writeGrid.
+   *
+   * @param istr        input stream
+   * @param[out] alpha  if not nullptr, the coefficient vector is read into alpha
+   *                    (throws if the stream does not contain coefficients)
+   * @return new grid (has to be deleted by the caller)
+   */
+  static Grid* readGrid(std::istream& istr, DataVector* alpha = nullptr);
+
+  /**
+   * Reads a grid written by writeGrid from a file.
+   *
+   * @param filename    name of the file
+   * @param[out] alpha  if not nullptr, the coefficient vector is read into alpha
+   * @return new grid (has to be deleted by the caller)
+   */
+  static Grid* readGrid(const std::string& filename, DataVector* alpha = nullptr);
+
+  /**
+   * Reads a grid storage written by writeStorage.
+   *
+   * @param istr        input stream
+   * @param[out] alpha  if not nullptr, the coefficient vector is read into alpha
+   * @return new grid storage (has to be deleted by the caller)
+   */
+  static HashGridStorage* readStorage(std::istream& istr, DataVector* alpha = nullptr);
+
+  /**
+   * Reads and checks the header.
+   *
+   * @param istr          input stream
+   * @param[out] header   header
+   */
+  static void readHeader(std::istream& istr, BinaryGridHeader& header);
+
+  /**
+   * Checks magic number, version and byte order of a header.
+   *
+   * @param header header
+   */
+  static void checkHeader(const BinaryGridHeader& header);
+
+  /**
+   * Inserts the grid points given by level, index and leaf arrays into a grid storage.
+   * Throws a file_exception if the dimension of the arrays does not match the storage.
+   *
+   * @param storage         empty grid storage
+   * @param dimension       dimension of the grid points in the arrays
+   * @param numberOfPoints  number of grid points
+   * @param levels          levels (numberOfPoints * dimension, point-major)
+   * @param indices         indices (numberOfPoints * dimension, point-major)
+   * @param leaves          leaf flags (numberOfPoints)
+   */
+  static void insertPoints(HashGridStorage& storage, size_t dimension, size_t numberOfPoints,
+                           const uint32_t* levels, const uint32_t* indices,
+                           const uint8_t* leaves);
+
+ protected:
+  /**
+   * Writes header, meta data and arrays.
+   */
+  static void write(HashGridStorage& storage, const std::string& meta, bool containsGrid,
+                    std::ostream& ostr, const DataVector* alpha);
+
+  /**
+   * Reads header, meta data and arrays and returns the meta data.
+   */
+  static std::string read(std::istream& istr, BinaryGridHeader& header,
+                          std::vector<uint32_t>& levels, std::vector<uint32_t>& indices,
+                          std::vector<uint8_t>& leaves, DataVector* alpha);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* BINARYGRIDSERIALIZER_HPP */
@@ -0,0 +1,106 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/serialization/BinaryGridView.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+BinaryGridView::BinaryGridView(const std::string& filename)
+    : file(filename),
+      data(file.getData()),
+      header(nullptr),
+      levels(nullptr),
+      indices(nullptr),
+      leaves(nullptr),
+      coefficients(nullptr) {
+  const size_t fileSize = file.getSize();
+
+  if (fileSize < sizeof(BinaryGridHeader)) {
+    throw file_exception("BinaryGridView: file too small");
+  }
+
+  header = reinterpret_cast<const BinaryGridHeader*>(data);
+
+  BinaryGridSerializer::checkHeader(*header);
+
+  const uint64_t n = header->numberOfPoints;
+  const uint64_t dim = header->dimension;
+  const uint64_t end = (header->coefficientOffset != 0)
+                           ? header->coefficientOffset + n * sizeof(double)
+                           : header->leafOffset + n;
+
+  if ((end > fileSize) || (header->levelOffset + n * dim * sizeof(uint32_t) > fileSize) ||
+      (header->indexOffset + n * dim * sizeof(uint32_t) > fileSize) ||
+      (header->metaOffset + header->metaSize > fileSize)) {
+    throw file_exception("BinaryGridView: file is truncated");
+  }
+
+  levels = reinterpret_cast<const uint32_t*>(data + header->levelOffset);
+  indices = reinterpret_cast<const uint32_t*>(data + header->indexOffset);
+  leaves = reinterpret_cast<const uint8_t*>(data + header->leafOffset);
+
+  if (header->coefficientOffset != 0) {
+    coefficients = reinterpret_cast<const double*>(data + header->coefficientOffset);
+  }
+}
+
+void BinaryGridView::getPoint(size_t seq, HashGridPoint& point) const {
+  const size_t dim = getDimension();
+
+  for (size_t d = 0; d < dim; d++) {
+    point.push(d, getLevel(seq, d), getIndex(seq, d));
+  }
+
+  point.setLeaf(leaves[seq] != 0);
+  point.rehash();
+}
+
+void BinaryGridView::getCoefficients(DataVector& alpha) const {
+  if (coefficients == nullptr) {
+    throw file_exception("BinaryGridView::getCoefficients: file does not contain coefficients");
+  }
+
+  alpha.resize(getSize());
+  std::memcpy(alpha.getPointer(), coefficients, getSize() * sizeof(double));
+}
+
+std::string BinaryGridView::getMeta() const {
+  return std::string(data + header->metaOffset, static_cast<size_t>(header->metaSize));
+}
+
+Grid* BinaryGridView::createGrid() const {
+  if (!containsGrid()) {
+    throw file_exception("BinaryGridView::createGrid: file contains no grid");
+  }
+
+  std::unique_ptr<Grid> grid(Grid::unserialize(getMeta()));
+  BinaryGridSerializer::insertPoints(grid->getStorage(), getDimension(), getSize(), levels,
+                                     indices, leaves);
+  return grid.release();
+}
+
+HashGridStorage* BinaryGridView::createStorage() const {
+  std::string meta = getMeta();
+
+  if (containsGrid()) {
+    // skip the grid type, the storage description follows
+    meta = meta.substr(meta.find('\n') + 1);
+  }
+
+  std::unique_ptr<HashGridStorage> storage(new HashGridStorage(meta));
+  BinaryGridSerializer::insertPoints(*storage, getDimension(), getSize(), levels, indices,
+                                     leaves);
+  return storage.release();
+}
+
+}  // namespace base
+}  // namespace sgpp
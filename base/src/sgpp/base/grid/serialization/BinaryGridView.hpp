@@ -0,0 +1,164 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BINARYGRIDVIEW_HPP
+#define BINARYGRIDVIEW_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/serialization/BinaryGridSerializer.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only view of a file written by BinaryGridSerializer.
+ * On POSIX systems, the file is memory-mapped, i.e., opening the view does not parse or copy
+ * the grid points; the level, index and coefficient arrays are used directly from the page
+ * cache. If the file cannot be mapped, it is read into memory instead.
+ *
+ * A Grid or HashGridStorage can be created from the view if hash-based lookups are needed.
+ */
+class BinaryGridView {
+ public:
+  /**
+   * Constructor, maps the file into memory.
+   *
+   * @param filename name of a file written by BinaryGridSerializer
+   */
+  explicit BinaryGridView(const std::string& filename);
+
+  /**
+   * @return dimension of the grid
+   */
+  size_t getDimension() const { return static_cast<size_t>(header->dimension); }
+
+  /**
+   * @return number of grid points
+   */
+  size_t getSize() const { return static_cast<size_t>(header->numberOfPoints); }
+
+  /**
+   * @return whether the file has been memory-mapped (or read into memory as fallback)
+   */
+  bool isMapped() const { return file.isMapped(); }
+
+  /**
+   * @return whether the file contains a Grid (or only a HashGridStorage)
+   */
+  bool containsGrid() const { return header->containsGrid != 0; }
+
+  /**
+   * @return whether the file contains a coefficient vector
+   */
+  bool hasCoefficients() const { return header->coefficientOffset != 0; }
+
+  /**
+   * @return levels of all grid points (getSize() * getDimension(), point-major)
+   */
+  const uint32_t* getLevels() const { return levels; }
+
+  /**
+   * @return indices of all grid points (getSize() * getDimension(), point-major)
+   */
+  const uint32_t* getIndices() const { return indices; }
+
+  /**
+   * @return leaf flags of all grid points
+   */
+  const uint8_t* getLeaves() const { return leaves; }
+
+  /**
+   * @return coefficients (nullptr if the file does not contain coefficients)
+   */
+  const double* getCoefficients() const { return coefficients; }
+
+  /**
+   * @param seq sequence number
+   * @param d   dimension
+   * @return level of the grid point in dimension d
+   */
+  uint32_t getLevel(size_t seq, size_t d) const {
+    return levels[seq * static_cast<size_t>(header->dimension) + d];
+  }
+
+  /**
+   * @param seq sequence number
+   * @param d   dimension
+   * @return index of the grid point in dimension d
+   */
+  uint32_t getIndex(size_t seq, size_t d) const {
+    return indices[seq * static_cast<size_t>(header->dimension) + d];
+  }
+
+  /**
+   * Copies a grid point into a HashGridPoint.
+   *
+   * @param seq         sequence number
+   * @param[out] point  grid point (dimension has to match)
+   */
+  void getPoint(size_t seq, HashGridPoint& point) const;
+
+  /**
+   * Copies the coefficients into a DataVector.
+   *
+   * @param[out] alpha coefficient vector
+   */
+  void getCoefficients(DataVector& alpha) const;
+
+  /**
+   * Creates a grid containing the grid points of the view.
+   *
+   * @return new grid (has to be deleted by the caller)
+   */
+  Grid* createGrid() const;
+
+  /**
+   * Creates a grid storage containing the grid points of the view.
+   *
+   * @return new grid storage (has to be deleted by the caller)
+   */
+  HashGridStorage* createStorage() const;
+
+ protected:
+  /// mapped file
+  MemoryMappedFile file;
+  /// beginning of the file in memory
+  const char* data;
+
+  /// header
+  const BinaryGridHeader* header;
+  /// level array
+  const uint32_t* levels;
+  /// index array
+  const uint32_t* indices;
+  /// leaf flags
+  const uint8_t* leaves;
+  /// coefficients
+  const double* coefficients;
+
+  /**
+   * @return meta data
+   */
+  std::string getMeta() const;
+
+ private:
+  BinaryGridView(const BinaryGridView&) = delete;
+  BinaryGridView& operator=(const BinaryGridView&) = delete;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* BINARYGRIDVIEW_HPP */
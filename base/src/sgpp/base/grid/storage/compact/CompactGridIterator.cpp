@@ -0,0 +1,161 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/compact/CompactGridIterator.hpp>
+
+#include <sstream>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+CompactGridIterator::CompactGridIterator(CompactGridStorage& storage)
+    : storage(storage),
+      level(storage.getDimension(), 1),
+      index(storage.getDimension(), 1),
+      seq_(0) {
+  rehash();
+}
+
+CompactGridIterator::CompactGridIterator(const CompactGridIterator& copy)
+    : storage(copy.storage), level(copy.level), index(copy.index), seq_(copy.seq_) {}
+
+CompactGridIterator::~CompactGridIterator() {}
+
+void CompactGridIterator::resetToLevelZero() {
+  for (size_t d = 0; d < level.size(); d++) {
+    level[d] = 0;
+    index[d] = 0;
+  }
+
+  rehash();
+}
+
+void CompactGridIterator::resetToLeftLevelZero(size_t dim) { set(dim, 0, 0); }
+
+void CompactGridIterator::resetToRightLevelZero(size_t dim) { set(dim, 0, 1); }
+
+void CompactGridIterator::resetToLevelOne(size_t d) { set(d, 1, 1); }
+
+void CompactGridIterator::leftChild(size_t dim) {
+  set(dim, level[dim] + 1, 2 * index[dim] - 1);
+}
+
+void CompactGridIterator::rightChild(size_t dim) {
+  set(dim, level[dim] + 1, 2 * index[dim] + 1);
+}
+
+void CompactGridIterator::up(size_t d) {
+  index_t i = index[d];
+
+  i /= 2;
+  i += i % 2 == 0 ? 1 : 0;
+
+  set(d, level[d] - 1, i);
+}
+
+void CompactGridIterator::stepLeft(size_t d) { set(d, level[d], index[d] - 2); }
+
+void CompactGridIterator::stepRight(size_t d) { set(d, level[d], index[d] + 2); }
+
+bool CompactGridIterator::isInnerPoint() const {
+  for (size_t d = 0; d < level.size(); d++) {
+    if (level[d] == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool CompactGridIterator::hint() const { return storage.isLeaf(seq_); }
+
+bool CompactGridIterator::contains(size_t d, level_t l, index_t i) {
+  const level_t oldLevel = level[d];
+  const index_t oldIndex = index[d];
+
+  level[d] = l;
+  index[d] = i;
+  const bool result = !storage.isInvalidSequenceNumber(
+      storage.getSequenceNumber(level.data(), index.data()));
+  level[d] = oldLevel;
+  index[d] = oldIndex;
+
+  return result;
+}
+
+bool CompactGridIterator::hintLeft(size_t d) {
+  return contains(d, level[d] + 1, 2 * index[d] - 1);
+}
+
+bool CompactGridIterator::hintRight(size_t d) {
+  return contains(d, level[d] + 1, 2 * index[d] + 1);
+}
+
+CompactGridIterator::level_t CompactGridIterator::getGridDepth(size_t dim) {
+  level_t depth = 1;
+  const level_t origLevel = level[dim];
+  const index_t origIndex = index[dim];
+
+  while (true) {
+    if (hintLeft(dim)) {
+      depth++;
+      leftChild(dim);
+    } else if (hintRight(dim)) {
+      depth++;
+      rightChild(dim);
+    } else {
+      const level_t curLevel = level[dim];
+      const index_t curIndex = index[dim];
+      bool hasFound = false;
+
+      // no more children, slide from left to right on the same level
+      // to see if there are adaptive refinements
+      for (index_t i = curIndex + 2; i < (static_cast<index_t>(1) << depth); i += 2) {
+        set(dim, curLevel, i);
+
+        if (!storage.isInvalidSequenceNumber(seq_)) {
+          if (hintLeft(dim)) {
+            depth++;
+            leftChild(dim);
+            hasFound = true;
+            break;
+          } else if (hintRight(dim)) {
+            depth++;
+            rightChild(dim);
+            hasFound = true;
+            break;
+          }
+        }
+      }
+
+      if (!hasFound) {
+        break;
+      }
+    }
+  }
+
+  set(dim, origLevel, origIndex);
+  return depth;
+}
+
+std::string CompactGridIterator::toString() const {
+  std::ostringstream stream;
+  stream << "[";
+
+  for (size_t d = 0; d < level.size(); d++) {
+    if (d != 0) {
+      stream << ",";
+    }
+
+    stream << " " << level[d] << ", " << index[d];
+  }
+
+  stream << " ]";
+  return stream.str();
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,226 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMPACTGRIDITERATOR_HPP
+#define COMPACTGRIDITERATOR_HPP
+
+#include <sgpp/base/grid/storage/compact/CompactGridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Iterator for CompactGridStorage with the same semantics as HashGridIterator.
+ * The current position is kept in plain level and index arrays, so moving the iterator
+ * neither allocates nor touches any other grid point than the one that is looked up.
+ */
+class CompactGridIterator {
+ public:
+  /// index type
+  typedef CompactGridStorage::index_type index_t;
+  /// level type
+  typedef CompactGridStorage::level_type level_t;
+
+  /**
+   * Constructor of the griditerator object
+   *
+   * @param storage reference to the storage that stores the grid points
+   */
+  explicit CompactGridIterator(CompactGridStorage& storage);
+
+  /**
+   * Copy Constructor of the griditerator object
+   *
+   * @param copy a CompactGridIterator object that is used to build this instance
+   */
+  CompactGridIterator(const CompactGridIterator& copy);
+
+  /**
+   * Destructor
+   */
+  ~CompactGridIterator();
+
+  /**
+   *  Sets 0,0 in every dimension (Left Level zero ansatzfunction)
+   */
+  void resetToLevelZero();
+
+  /**
+   * left level zero ansatz function for a given dimension
+   *
+   * @param dim dimension in which we should step to level zero
+   */
+  void resetToLeftLevelZero(size_t dim);
+
+  /**
+   * right level zero ansatz function for a given dimension
+   *
+   * @param dim dimension in which we should step to level zero
+   */
+  void resetToRightLevelZero(size_t dim);
+
+  /**
+   * resets the iterator to the top if dimension d
+   *
+   * @param d the moving direction
+   */
+  void resetToLevelOne(size_t d);
+
+  /**
+   * left child in direction dim
+   *
+   * @param dim dimension in which we should step to the left child
+   */
+  void leftChild(size_t dim);
+
+  /**
+   * right child in direction dim
+   *
+   * @param dim dimension in which we should step to the right child
+   */
+  void rightChild(size_t dim);
+
+  /**
+   * hierarchical parent in direction dim
+   *
+   * @param d the moving direction
+   */
+  void up(size_t d);
+
+  /**
+   * step left in direction dim
+   *
+   * @param d the moving direction
+   */
+  void stepLeft(size_t d);
+
+  /**
+   * step right in direction dim
+   *
+   * @param d the moving direction
+   */
+  void stepRight(size_t d);
+
+  /**
+   * determines if the grid point is an inner grid point
+   *
+   * @return true if the grid point is an inner grid point
+   */
+  bool isInnerPoint() const;
+
+  /**
+   * returns true if there are no more children in any dimension
+   *
+   * @return returns true if there are no more children in any dimension
+   */
+  bool hint() const;
+
+  /**
+   * returns true if there are more left children in dimension d
+   *
+   * @param d the moving direction
+   * @return true if there are more left children in dimension d
+   */
+  bool hintLeft(size_t d);
+
+  /**
+   * returns true if there are more right children in dimension d
+   *
+   * @param d the moving direction
+   * @return true if there are more right children in dimension d
+   */
+  bool hintRight(size_t d);
+
+  /**
+   * Gets level @c l and index @c i in dimension @c d of the current grid point
+   *
+   * @param d the dimension of interest
+   * @param l the ansatz function's level
+   * @param i the ansatz function's index
+   */
+  inline void get(size_t d, level_t& l, index_t& i) const {
+    l = level[d];
+    i = index[d];
+  }
+
+  /**
+   * Sets level @c l and index @c i in dimension @c d of the current grid point.
+   * Looks up the new sequence number.
+   *
+   * @param d the dimension of interest
+   * @param l the ansatz function's level
+   * @param i the ansatz function's index
+   */
+  inline void set(size_t d, level_t l, index_t i) {
+    level[d] = l;
+    index[d] = i;
+    seq_ = storage.getSequenceNumber(level.data(), index.data());
+  }
+
+  /**
+   * Sets level @c l and index @c i in dimension @c d of the current grid point.
+   * Does not look up the new sequence number.
+   *
+   * @param d the dimension of the gridpoint
+   * @param l the ansatz function's level
+   * @param i the ansatz function's index
+   */
+  inline void push(size_t d, level_t l, index_t i) {
+    level[d] = l;
+    index[d] = i;
+  }
+
+  /**
+   * Looks up the sequence number of the current grid point
+   * (needed after calls of push).
+   */
+  inline void rehash() { seq_ = storage.getSequenceNumber(level.data(), index.data()); }
+
+  /**
+   * returns the current sequence number
+   *
+   * @return the current sequence number
+   */
+  inline size_t seq() const { return seq_; }
+
+  /**
+   * Returns the the maximal level of the grid in the given dimension.
+   *
+   * @param dim the dimension
+   */
+  level_t getGridDepth(size_t dim);
+
+  /**
+   * Generates a string with level and index of the gridpoint.
+   *
+   * @returns string into which the gridpoint is written
+   */
+  std::string toString() const;
+
+ private:
+  /// reference the the storage that stores the gridpoints
+  CompactGridStorage& storage;
+  /// levels of the current position
+  std::vector<level_t> level;
+  /// indices of the current position
+  std::vector<index_t> index;
+  /// the current gridpoint's index
+  size_t seq_;
+
+  /**
+   * checks if the current position, modified in dimension d, is contained in the storage
+   */
+  bool contains(size_t d, level_t l, index_t i);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* COMPACTGRIDITERATOR_HPP */
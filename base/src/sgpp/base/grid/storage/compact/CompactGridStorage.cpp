@@ -0,0 +1,269 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/compact/CompactGridStorage.hpp>
+
+#include <sgpp/base/exception/generation_exception.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+const CompactGridStorage::level_type CompactGridStorage::MAX_LEVEL;
+const uint32_t CompactGridStorage::EMPTY_SLOT;
+const size_t CompactGridStorage::MAX_LOAD_NUMERATOR;
+const size_t CompactGridStorage::MAX_LOAD_DENOMINATOR;
+
+CompactGridStorage::CompactGridStorage(size_t dimension)
+    : dimension(dimension),
+      levels(),
+      indices(),
+      leaf(),
+      hashes(),
+      table(16, EMPTY_SLOT),
+      tableMask(15) {}
+
+CompactGridStorage::CompactGridStorage(const HashGridStorage& storage)
+    : CompactGridStorage(storage.getDimension()) {
+  const size_t n = storage.getSize();
+
+  reserve(n);
+
+  for (size_t seq = 0; seq < n; seq++) {
+    insert(storage[seq]);
+  }
+}
+
+CompactGridStorage::~CompactGridStorage() {}
+
+void CompactGridStorage::clear() {
+  levels.clear();
+  indices.clear();
+  leaf.clear();
+  hashes.clear();
+  std::fill(table.begin(), table.end(), EMPTY_SLOT);
+}
+
+void CompactGridStorage::reserve(size_t numberOfPoints) {
+  levels.reserve(numberOfPoints * dimension);
+  indices.reserve(numberOfPoints * dimension);
+  leaf.reserve(numberOfPoints);
+  hashes.reserve(numberOfPoints);
+
+  size_t capacity = table.size();
+
+  while (capacity * MAX_LOAD_NUMERATOR < numberOfPoints * MAX_LOAD_DENOMINATOR) {
+    capacity *= 2;
+  }
+
+  if (capacity != table.size()) {
+    rehash(capacity);
+  }
+}
+
+void CompactGridStorage::getPoint(size_t seq, HashGridPoint& point) const {
+  for (size_t d = 0; d < dimension; d++) {
+    point.push(d, getLevel(seq, d), getIndex(seq, d));
+  }
+
+  point.setLeaf(isLeaf(seq));
+  point.rehash();
+}
+
+size_t CompactGridStorage::insert(const HashGridPoint& point) {
+  return insertPoint(point, const_cast<HashGridPoint&>(point).isLeaf());
+}
+
+size_t CompactGridStorage::insert(const level_type* level, const index_type* index,
+                                  bool isLeaf) {
+  return insertPoint(PointArrays{level, index}, isLeaf);
+}
+
+void CompactGridStorage::insert(HashGridPoint& point, std::vector<size_t>& insertedPoints) {
+  level_type sourceLevel;
+  index_type sourceIndex;
+
+  if (!isContaining(point)) {
+    // insert the current node
+    insertedPoints.push_back(insert(point));
+
+    // insert all ancestors if they are missing
+    for (size_t d = 0; d < dimension; d++) {
+      point.get(d, sourceLevel, sourceIndex);
+
+      // go up to the parent node
+      point.getParent(d);
+
+      // insert all the parents until we find one which does already exist
+      while (!isContaining(point)) {
+        insert(point, insertedPoints);
+        point.getParent(d);
+      }
+
+      // reset index
+      point.set(d, sourceLevel, sourceIndex);
+    }
+  }
+}
+
+size_t CompactGridStorage::getSequenceNumber(const HashGridPoint& point) const {
+  return find(point);
+}
+
+size_t CompactGridStorage::getSequenceNumber(const level_type* level,
+                                             const index_type* index) const {
+  return find(PointArrays{level, index});
+}
+
+template <class Point>
+size_t CompactGridStorage::insertPoint(const Point& point, bool isLeaf) {
+  const size_t seq = getSize();
+  level_type l;
+  index_type i;
+
+  if (seq >= static_cast<size_t>(std::numeric_limits<uint32_t>::max() - 1)) {
+    throw generation_exception("CompactGridStorage::insert: too many grid points");
+  }
+
+  // validate before modifying anything, so that the storage stays consistent on failure
+  for (size_t d = 0; d < dimension; d++) {
+    point.get(d, l, i);
+
+    if (l > MAX_LEVEL) {
+      throw generation_exception("CompactGridStorage::insert: level exceeds maximal level");
+    }
+  }
+
+  for (size_t d = 0; d < dimension; d++) {
+    point.get(d, l, i);
+    levels.push_back(static_cast<packed_level_type>(l));
+    indices.push_back(i);
+  }
+
+  const size_t h = hashPoint(point, dimension);
+  leaf.push_back(isLeaf ? 1 : 0);
+  hashes.push_back(h);
+
+  if ((seq + 1) * MAX_LOAD_DENOMINATOR > table.size() * MAX_LOAD_NUMERATOR) {
+    // rehash inserts the new point, too
+    rehash(2 * table.size());
+  } else {
+    size_t slot = h & tableMask;
+
+    while (table[slot] != EMPTY_SLOT) {
+      slot = (slot + 1) & tableMask;
+    }
+
+    table[slot] = static_cast<uint32_t>(seq + 1);
+  }
+
+  return seq;
+}
+
+template <class Point>
+size_t CompactGridStorage::find(const Point& point) const {
+  const size_t h = hashPoint(point, dimension);
+  size_t slot = h & tableMask;
+
+  while (table[slot] != EMPTY_SLOT) {
+    const size_t seq = table[slot] - 1;
+
+    if ((hashes[seq] == h) && equals(seq, point)) {
+      return seq;
+    }
+
+    slot = (slot + 1) & tableMask;
+  }
+
+  return getSize() + 1;
+}
+
+void CompactGridStorage::rehash(size_t capacity) {
+  table.assign(capacity, EMPTY_SLOT);
+  tableMask = capacity - 1;
+
+  for (size_t seq = 0; seq < hashes.size(); seq++) {
+    size_t slot = hashes[seq] & tableMask;
+
+    while (table[slot] != EMPTY_SLOT) {
+      slot = (slot + 1) & tableMask;
+    }
+
+    table[slot] = static_cast<uint32_t>(seq + 1);
+  }
+}
+
+void CompactGridStorage::recalcLeafProperty() {
+  std::vector<level_type> l(dimension);
+  std::vector<index_type> i(dimension);
+
+  for (size_t seq = 0; seq < getSize(); seq++) {
+    bool isLeaf = true;
+
+    for (size_t d = 0; d < dimension; d++) {
+      get(seq, d, l[d], i[d]);
+    }
+
+    for (size_t d = 0; (d < dimension) && isLeaf; d++) {
+      const level_type curLevel = l[d];
+      const index_type curIndex = i[d];
+
+      if (curLevel > 0) {
+        // test left and right child
+        l[d] = curLevel + 1;
+        i[d] = 2 * curIndex - 1;
+        isLeaf = isLeaf && (getSequenceNumber(l.data(), i.data()) >= getSize());
+        i[d] = 2 * curIndex + 1;
+        isLeaf = isLeaf && (getSequenceNumber(l.data(), i.data()) >= getSize());
+      } else {
+        // test level 1
+        l[d] = 1;
+        i[d] = 1;
+        isLeaf = isLeaf && (getSequenceNumber(l.data(), i.data()) >= getSize());
+      }
+
+      l[d] = curLevel;
+      i[d] = curIndex;
+    }
+
+    setLeaf(seq, isLeaf);
+  }
+}
+
+void CompactGridStorage::copyTo(HashGridStorage& storage) const {
+  if (storage.getDimension() != dimension) {
+    throw generation_exception("CompactGridStorage::copyTo: dimension mismatch");
+  }
+
+  HashGridPoint point(dimension);
+  storage.clear();
+
+  for (size_t seq = 0; seq < getSize(); seq++) {
+    getPoint(seq, point);
+    storage.insert(point);
+  }
+}
+
+size_t CompactGridStorage::getMaxLevel() const {
+  packed_level_type maxLevel = 0;
+
+  for (size_t k = 0; k < levels.size(); k++) {
+    maxLevel = std::max(maxLevel, levels[k]);
+  }
+
+  return static_cast<size_t>(maxLevel);
+}
+
+size_t CompactGridStorage::getMemoryFootprint() const {
+  return levels.capacity() * sizeof(packed_level_type) +
+         indices.capacity() * sizeof(index_type) + leaf.capacity() * sizeof(uint8_t) +
+         hashes.capacity() * sizeof(size_t) + table.capacity() * sizeof(uint32_t);
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,392 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMPACTGRIDSTORAGE_HPP
+#define COMPACTGRIDSTORAGE_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+class CompactGridIterator;
+
+/**
+ * Compact storage of grid points.
+ *
+ * In contrast to HashGridStorage, which keeps one heap-allocated HashGridPoint per grid point
+ * and a pointer-keyed std::unordered_map, this storage keeps all levels and indices in two
+ * contiguous structure-of-arrays blocks (levels bit-packed into one byte per dimension) and
+ * resolves lookups with a flat open-addressing hash table (linear probing, power-of-two
+ * capacity). A grid point is therefore identified solely by its sequence number and lookups
+ * do not allocate.
+ *
+ * The storage only stores the point set (including the leaf property); bounding box and
+ * stretching stay with the HashGridStorage the points were copied from. Sequence numbers are
+ * the same as in the HashGridStorage the compact storage was created from.
+ */
+class CompactGridStorage {
+ public:
+  /// level type used in the interface (same as for HashGridPoint)
+  typedef HashGridPoint::level_type level_type;
+  /// index type used in the interface (same as for HashGridPoint)
+  typedef HashGridPoint::index_type index_type;
+  /// internal (bit-packed) level type
+  typedef uint8_t packed_level_type;
+  /// iterator for grid points
+  typedef CompactGridIterator grid_iterator;
+
+  /// maximal level that can be stored in a packed level
+  static const level_type MAX_LEVEL = 31;
+
+  /**
+   * Constructor
+   *
+   * @param dimension the dimension of the sparse grid
+   */
+  explicit CompactGridStorage(size_t dimension);
+
+  /**
+   * Constructor that copies all grid points from a HashGridStorage,
+   * preserving the sequence numbers
+   *
+   * @param storage storage whose grid points should be copied
+   */
+  explicit CompactGridStorage(const HashGridStorage& storage);
+
+  /**
+   * Destructor
+   */
+  ~CompactGridStorage();
+
+  /**
+   * deletes all grid points in the storage
+   */
+  void clear();
+
+  /**
+   * reserves memory for a given number of grid points (avoids rehashing during insertion)
+   *
+   * @param numberOfPoints expected number of grid points
+   */
+  void reserve(size_t numberOfPoints);
+
+  /**
+   * gets the number of grid points
+   *
+   * @return the number of grid points
+   */
+  inline size_t getSize() const { return leaf.size(); }
+
+  /**
+   * gets the dimension of the grid
+   *
+   * @return the dimension of the grid
+   */
+  inline size_t getDimension() const { return dimension; }
+
+  /**
+   * gets the level of a grid point in a given dimension
+   *
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return level of the grid point in dimension d
+   */
+  inline level_type getLevel(size_t seq, size_t d) const {
+    return static_cast<level_type>(levels[seq * dimension + d]);
+  }
+
+  /**
+   * gets the index of a grid point in a given dimension
+   *
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @return index of the grid point in dimension d
+   */
+  inline index_type getIndex(size_t seq, size_t d) const {
+    return indices[seq * dimension + d];
+  }
+
+  /**
+   * gets the level and index of a grid point in a given dimension
+   *
+   * @param seq sequence number of the grid point
+   * @param d   dimension
+   * @param l   reference parameter for the level
+   * @param i   reference parameter for the index
+   */
+  inline void get(size_t seq, size_t d, level_type& l, index_type& i) const {
+    l = static_cast<level_type>(levels[seq * dimension + d]);
+    i = indices[seq * dimension + d];
+  }
+
+  /**
+   * gets a pointer to the contiguous indices of a grid point
+   *
+   * @param seq sequence number of the grid point
+   * @return pointer to the getDimension() indices of the grid point
+   */
+  inline const index_type* getIndexArray(size_t seq) const {
+    return &indices[seq * dimension];
+  }
+
+  /**
+   * gets a pointer to the contiguous packed levels of a grid point
+   *
+   * @param seq sequence number of the grid point
+   * @return pointer to the getDimension() levels of the grid point
+   */
+  inline const packed_level_type* getLevelArray(size_t seq) const {
+    return &levels[seq * dimension];
+  }
+
+  /**
+   * copies a grid point into a HashGridPoint
+   *
+   * @param seq         sequence number of the grid point
+   * @param[out] point  HashGridPoint of the same dimension which is overwritten
+   */
+  void getPoint(size_t seq, HashGridPoint& point) const;
+
+  /**
+   * checks if a grid point is a leaf
+   *
+   * @param seq sequence number of the grid point
+   * @return true if the grid point has no children
+   */
+  inline bool isLeaf(size_t seq) const { return leaf[seq] != 0; }
+
+  /**
+   * sets the leaf property of a grid point
+   *
+   * @param seq    sequence number of the grid point
+   * @param isLeaf true if the grid point has no children
+   */
+  inline void setLeaf(size_t seq, bool isLeaf) { leaf[seq] = isLeaf ? 1 : 0; }
+
+  /**
+   * inserts a new grid point (the grid point must not be contained in the storage yet)
+   *
+   * @param point grid point that should be inserted
+   * @return sequence number of the new grid point
+   */
+  size_t insert(const HashGridPoint& point);
+
+  /**
+   * inserts a new grid point given by its level and index arrays
+   * (the grid point must not be contained in the storage yet)
+   *
+   * @param level  array of getDimension() levels
+   * @param index  array of getDimension() indices
+   * @param isLeaf leaf property of the new grid point
+   * @return sequence number of the new grid point
+   */
+  size_t insert(const level_type* level, const index_type* index, bool isLeaf = false);
+
+  /**
+   * inserts a new grid point including all its ancestors. Boundary points are not added.
+   *
+   * @param point          grid point that should be inserted
+   * @param insertedPoints containing the sequence numbers of the new points
+   */
+  void insert(HashGridPoint& point, std::vector<size_t>& insertedPoints);
+
+  /**
+   * gets the sequence number of a grid point
+   *
+   * @param point grid point
+   * @return sequence number of the grid point, getSize() + 1 if the point is not contained
+   */
+  size_t getSequenceNumber(const HashGridPoint& point) const;
+
+  /**
+   * gets the sequence number of a grid point given by its level and index arrays
+   *
+   * @param level array of getDimension() levels
+   * @param index array of getDimension() indices
+   * @return sequence number of the grid point, getSize() + 1 if the point is not contained
+   */
+  size_t getSequenceNumber(const level_type* level, const index_type* index) const;
+
+  /**
+   * tests if a grid point is contained in the storage
+   *
+   * @param point grid point
+   * @return true if the point is contained
+   */
+  inline bool isContaining(const HashGridPoint& point) const {
+    return getSequenceNumber(point) < getSize();
+  }
+
+  /**
+   * tests if a sequence number does not point to a valid grid point
+   *
+   * @param s sequence number
+   * @return true if s is not a valid sequence number
+   */
+  inline bool isInvalidSequenceNumber(size_t s) const { return s >= getSize(); }
+
+  /**
+   * recalculates the leaf property of every grid point
+   */
+  void recalcLeafProperty();
+
+  /**
+   * copies all grid points to a HashGridStorage, preserving the sequence numbers
+   * (the grid points of the HashGridStorage are cleared before)
+   *
+   * @param[out] storage storage into which the grid points are written
+   */
+  void copyTo(HashGridStorage& storage) const;
+
+  /**
+   * returns the max. level of the grid in all dimensions
+   *
+   * @return max. level
+   */
+  size_t getMaxLevel() const;
+
+  /**
+   * gets the number of bytes used by the grid points and the hash table
+   *
+   * @return memory footprint in bytes
+   */
+  size_t getMemoryFootprint() const;
+
+  /**
+   * computes the hash value of a grid point
+   *
+   * @param level array of dimension levels
+   * @param index array of dimension indices
+   * @param dimension dimension of the grid point
+   * @return hash value
+   */
+  static inline size_t hash(const level_type* level, const index_type* index,
+                            size_t dimension) {
+    return hashPoint(PointArrays{level, index}, dimension);
+  }
+
+ private:
+  /// value of an empty slot in the hash table
+  static const uint32_t EMPTY_SLOT = 0;
+  /// max. load factor of the hash table is MAX_LOAD_NUMERATOR / MAX_LOAD_DENOMINATOR
+  static const size_t MAX_LOAD_NUMERATOR = 1;
+  /// max. load factor of the hash table is MAX_LOAD_NUMERATOR / MAX_LOAD_DENOMINATOR
+  static const size_t MAX_LOAD_DENOMINATOR = 2;
+
+  /// the dimension of the grid
+  size_t dimension;
+  /// levels of all grid points (row-major, one row per grid point)
+  std::vector<packed_level_type> levels;
+  /// indices of all grid points (row-major, one row per grid point)
+  std::vector<index_type> indices;
+  /// leaf property of all grid points
+  std::vector<uint8_t> leaf;
+  /// cached hash values of all grid points (needed for rehashing)
+  std::vector<size_t> hashes;
+  /// open-addressing hash table storing sequence number + 1 (EMPTY_SLOT means empty)
+  std::vector<uint32_t> table;
+  /// table.size() - 1 (table size is a power of two)
+  size_t tableMask;
+
+  /**
+   * level and index arrays of a grid point with the accessor of HashGridPoint, such that
+   * lookups and insertions work on both without copying the point
+   */
+  struct PointArrays {
+    /// array of dimension levels
+    const level_type* level;
+    /// array of dimension indices
+    const index_type* index;
+
+    inline void get(size_t d, level_type& l, index_type& i) const {
+      l = level[d];
+      i = index[d];
+    }
+  };
+
+  /**
+   * computes the hash value of a grid point (HashGridPoint or PointArrays)
+   */
+  template <class Point>
+  static inline size_t hashPoint(const Point& point, size_t dimension) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    level_type l;
+    index_type i;
+
+    for (size_t d = 0; d < dimension; d++) {
+      point.get(d, l, i);
+      // combine level and index to one word, level < 32 is guaranteed
+      h ^= (static_cast<uint64_t>(i) << 5) | static_cast<uint64_t>(l);
+      h *= 0x100000001b3ULL;
+    }
+
+    // final avalanche (MurmurHash3 fmix64), since the table uses the lowest bits only
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+  }
+
+  /**
+   * checks if the grid point seq equals the given grid point
+   */
+  template <class Point>
+  inline bool equals(size_t seq, const Point& point) const {
+    const packed_level_type* l = &levels[seq * dimension];
+    const index_type* i = &indices[seq * dimension];
+    level_type level;
+    index_type index;
+
+    for (size_t d = 0; d < dimension; d++) {
+      point.get(d, level, index);
+
+      if ((l[d] != level) || (i[d] != index)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * resizes the hash table to a given capacity (power of two) and reinserts all grid points
+   *
+   * @param capacity new capacity
+   */
+  void rehash(size_t capacity);
+
+  /**
+   * inserts a new grid point (HashGridPoint or PointArrays)
+   *
+   * @return sequence number of the new grid point
+   */
+  template <class Point>
+  size_t insertPoint(const Point& point, bool isLeaf);
+
+  /**
+   * looks up a grid point (HashGridPoint or PointArrays)
+   *
+   * @return sequence number of the grid point, getSize() + 1 if the point is not contained
+   */
+  template <class Point>
+  size_t find(const Point& point) const;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* COMPACTGRIDSTORAGE_HPP */
@@ -59,6 +59,28 @@ class OperationEval {
       value[j] = eval(curAlpha, point);
     }
   }
+
+  /**
+   * Evaluates the sparse grid function at multiple points.
+   * The default implementation evaluates the points one after another;
+   * grid types with a batched evaluation override it.
+   *
+   * @param      alpha   coefficient vector
+   * @param      points  evaluation points (row-wise)
+   * @param[out] result  function values at the points (resized to the number of points)
+   */
+  virtual void evalBatch(const DataVector& alpha, const DataMatrix& points,
+                         DataVector& result) {
+    const size_t n = points.getNrows();
+    DataVector point(points.getNcols());
+
+    result.resize(n);
+
+    for (size_t i = 0; i < n; i++) {
+      points.getRow(i, point);
+      result[i] = eval(alpha, point);
+    }
+  }
 };
 
 }  // namespace base
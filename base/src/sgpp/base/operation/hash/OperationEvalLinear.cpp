@@ -25,5 +25,13 @@ double OperationEvalLinear::eval(const DataVector& alpha,
   return AlgoEval(base, point, alpha);
 }
 
+void OperationEvalLinear::evalBatch(const DataVector& alpha, const DataMatrix& points,
+                                    DataVector& result) {
+  LinearBasis<unsigned int, unsigned int> base;
+  AlgorithmEvaluation<LinearBasis<unsigned int, unsigned int> > AlgoEval(storage);
+
+  AlgoEval(base, points, alpha, result);
+}
+
 }  // namespace base
 }  // namespace sgpp
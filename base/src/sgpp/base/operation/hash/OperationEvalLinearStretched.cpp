@@ -25,5 +25,13 @@ double OperationEvalLinearStretched::eval(const DataVector& alpha,
   return AlgoEval(base, point, alpha);
 }
 
+void OperationEvalLinearStretched::evalBatch(const DataVector& alpha, const DataMatrix& points,
+                                             DataVector& result) {
+  LinearStretchedBasis<unsigned int, unsigned int> base;
+  AlgorithmEvaluation<LinearStretchedBasis<unsigned int, unsigned int> > AlgoEval(storage);
+
+  AlgoEval(base, points, alpha, result);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -36,6 +36,9 @@ class OperationEvalLinearStretched : public OperationEval {
   double eval(const DataVector& alpha,
                const DataVector& point) override;
 
+  void evalBatch(const DataVector& alpha, const DataMatrix& points,
+                 DataVector& result) override;
+
  protected:
   /// reference to the grid's GridStorage object
   GridStorage& storage;
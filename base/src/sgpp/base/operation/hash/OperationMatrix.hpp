@@ -6,6 +6,7 @@
 #ifndef OPERATIONMATRIX_HPP
 #define OPERATIONMATRIX_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -38,6 +39,30 @@ class OperationMatrix {
    * @param result DataVector into which the result of the Laplace operation is stored
    */
   virtual void mult(DataVector& alpha, DataVector& result) = 0;
+
+  /**
+   * Multiplication of the matrix with several vectors at once.
+   * The default implementation calls mult() for each column. Operations that stream
+   * through large data (e.g., the training data of a regression system) should override
+   * this to apply the matrix to all columns in one pass.
+   *
+   * @param alpha DataMatrix whose columns are the vectors the matrix is applied to
+   * @param result DataMatrix into which the results are stored column by column
+   *        (resized to the size of alpha)
+   */
+  virtual void multBlock(DataMatrix& alpha, DataMatrix& result) {
+    const size_t numCols = alpha.getNcols();
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(alpha.getNrows());
+    result.resizeRowsCols(alpha.getNrows(), numCols);
+
+    for (size_t j = 0; j < numCols; j++) {
+      alpha.getColumn(j, alphaColumn);
+      resultColumn.setAll(0.0);
+      mult(alphaColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
 };
 
 }  // namespace base
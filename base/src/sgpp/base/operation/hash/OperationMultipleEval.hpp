@@ -101,6 +101,51 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with the columns of @f$\alpha@f$, i.e., evaluation of several
+   * sparse grid functions at all data points
+   *
+   * Implementations that evaluate the basis functions explicitly should override this to
+   * compute each basis function value only once for all columns. By default, mult() is applied
+   * to each column.
+   *
+   * @param alpha matrix with one coefficient vector per column (one row per grid point)
+   * @param result the result matrix (one row per data point, one column per column of alpha)
+   */
+  virtual void multBlock(DataMatrix& alpha, DataMatrix& result) {
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(dataset.getNrows());
+
+    result.resizeRowsCols(dataset.getNrows(), alpha.getNcols());
+
+    for (size_t j = 0; j < alpha.getNcols(); j++) {
+      alpha.getColumn(j, alphaColumn);
+      this->mult(alphaColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
+  /**
+   * Multiplication of @f$B@f$ with the columns of a matrix
+   *
+   * By default, multTranspose() is applied to each column.
+   *
+   * @param source matrix with one vector per column (one row per data point)
+   * @param result the result matrix (one row per grid point, one column per column of source)
+   */
+  virtual void multTransposeBlock(DataMatrix& source, DataMatrix& result) {
+    DataVector sourceColumn(source.getNrows());
+    DataVector resultColumn(grid.getSize());
+
+    result.resizeRowsCols(grid.getSize(), source.getNcols());
+
+    for (size_t j = 0; j < source.getNcols(); j++) {
+      source.getColumn(j, sourceColumn);
+      this->multTranspose(sourceColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
   /**
    * Evaluate multiple datapoints with the specified grid
    *
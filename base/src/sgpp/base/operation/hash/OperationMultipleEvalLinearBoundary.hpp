@@ -37,6 +37,8 @@ class OperationMultipleEvalLinearBoundary : public OperationMultipleEval {
 
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
+  void multBlock(DataMatrix& alpha, DataMatrix& result) override;
+  void multTransposeBlock(DataMatrix& source, DataMatrix& result) override;
 
   double getDuration() override;
 
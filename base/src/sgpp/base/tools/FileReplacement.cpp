@@ -0,0 +1,76 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/FileReplacement.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+bool fileExists(const std::string& filename) {
+  return std::ifstream(filename.c_str()).good();
+}
+
+}  // namespace
+
+std::string FileReplacement::getTemporaryFilename(const std::string& filename) {
+  return filename + ".tmp";
+}
+
+bool FileReplacement::recover(const std::string& filename) {
+  const std::string tmpFilename = getTemporaryFilename(filename);
+
+  if (fileExists(filename) || !fileExists(tmpFilename)) {
+    return false;
+  }
+
+  return (std::rename(tmpFilename.c_str(), filename.c_str()) == 0);
+}
+
+void FileReplacement::replace(const std::string& filename,
+                              const std::function<void(std::ostream&)>& write) {
+  const std::string tmpFilename = getTemporaryFilename(filename);
+
+  {
+    std::ofstream tmpFile(tmpFilename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (tmpFile) {
+      try {
+        write(tmpFile);
+      } catch (...) {
+        tmpFile.close();
+        std::remove(tmpFilename.c_str());
+        throw;
+      }
+
+      tmpFile.flush();
+    }
+
+    if (!tmpFile) {
+      tmpFile.close();
+      std::remove(tmpFilename.c_str());
+      throw file_exception("FileReplacement::replace: cannot write temporary file");
+    }
+  }
+
+  if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0) {
+    // renaming does not replace existing files on all platforms, the temporary file is
+    // picked up by recover() if the process is interrupted before it has been renamed
+    if ((std::remove(filename.c_str()) != 0) ||
+        (std::rename(tmpFilename.c_str(), filename.c_str()) != 0)) {
+      throw file_exception("FileReplacement::replace: cannot replace file");
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,58 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef FILEREPLACEMENT_HPP
+#define FILEREPLACEMENT_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Replaces the content of files such that either the old or the new content survives if the
+ * process is interrupted meanwhile.
+ * The new content is written to the temporary file "<filename>.tmp", which is then renamed to
+ * the file. On platforms where renaming does not replace existing files, the file is removed
+ * before; if the process is interrupted between removing and renaming, recover() picks up the
+ * temporary file.
+ */
+class FileReplacement {
+ public:
+  /**
+   * @param filename  name of the file
+   * @return          name of the temporary file used to replace the file
+   */
+  static std::string getTemporaryFilename(const std::string& filename);
+
+  /**
+   * Completes an interrupted replacement, i.e., renames the temporary file to the file if
+   * only the former exists. Should be called before the file is opened.
+   *
+   * @param filename  name of the file
+   * @return          whether the file has been recovered from the temporary file
+   */
+  static bool recover(const std::string& filename);
+
+  /**
+   * Replaces the content of a file (or creates it).
+   * Throws a file_exception if the new content cannot be written or the file cannot be
+   * replaced; the file is not modified in this case.
+   *
+   * @param filename  name of the file
+   * @param write     function writing the new content to the given stream
+   */
+  static void replace(const std::string& filename,
+                      const std::function<void(std::ostream&)>& write);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* FILEREPLACEMENT_HPP */
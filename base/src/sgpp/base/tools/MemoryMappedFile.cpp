@@ -0,0 +1,71 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fstream>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+    : data(nullptr), size(0), mapped(false), buffer() {
+#ifndef _WIN32
+  const int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd >= 0) {
+    struct stat fileStat;
+
+    if ((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0)) {
+      void* address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ,
+                           MAP_PRIVATE, fd, 0);
+
+      if (address != MAP_FAILED) {
+        data = static_cast<const char*>(address);
+        size = static_cast<size_t>(fileStat.st_size);
+        mapped = true;
+      }
+    }
+
+    close(fd);
+  }
+#endif
+
+  if (!mapped) {
+    // fallback: read the whole file
+    std::ifstream istr(filename, std::ios::in | std::ios::binary | std::ios::ate);
+
+    if (!istr) {
+      throw file_exception("MemoryMappedFile: cannot open file");
+    }
+
+    size = static_cast<size_t>(istr.tellg());
+    buffer.resize(size);
+    istr.seekg(0);
+    istr.read(buffer.data(), static_cast<std::streamsize>(size));
+    data = buffer.data();
+  }
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+#ifndef _WIN32
+  if (mapped) {
+    munmap(const_cast<char*>(data), size);
+  }
+#endif
+}
+
+}  // namespace base
+}  // namespace sgpp
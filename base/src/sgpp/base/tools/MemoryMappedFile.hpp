@@ -0,0 +1,72 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MEMORYMAPPEDFILE_HPP
+#define MEMORYMAPPEDFILE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only view of the content of a file.
+ * On POSIX systems, the file is memory-mapped, i.e., its content is not copied,
+ * but paged in from the page cache on access. If the file cannot be mapped
+ * (or on other systems), it is read into memory instead.
+ */
+class MemoryMappedFile {
+ public:
+  /**
+   * Constructor, maps the file into memory.
+   * Throws a file_exception if the file cannot be opened.
+   *
+   * @param filename  name of the file
+   */
+  explicit MemoryMappedFile(const std::string& filename);
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~MemoryMappedFile();
+
+  /**
+   * @return beginning of the file content
+   */
+  const char* getData() const { return data; }
+
+  /**
+   * @return size of the file in bytes
+   */
+  size_t getSize() const { return size; }
+
+  /**
+   * @return whether the file has been memory-mapped (or read into memory as fallback)
+   */
+  bool isMapped() const { return mapped; }
+
+ protected:
+  /// beginning of the file content
+  const char* data;
+  /// size of the file in bytes
+  size_t size;
+  /// whether data is memory-mapped (otherwise, it points to buffer)
+  bool mapped;
+  /// file content if the file could not be memory-mapped
+  std::vector<char> buffer;
+
+ private:
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* MEMORYMAPPEDFILE_HPP */
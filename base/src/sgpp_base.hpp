@@ -130,10 +130,12 @@
 #include <sgpp/base/grid/type/WaveletGrid.hpp>
 #include <sgpp/base/tools/EvalCuboidGenerator.hpp>
 #include <sgpp/base/tools/EvalCuboidGeneratorForStretching.hpp>
+#include <sgpp/base/tools/FileReplacement.hpp>
 #include <sgpp/base/tools/GaussHermiteQuadRule1D.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/base/tools/GridPrinter.hpp>
 #include <sgpp/base/tools/GridPrinterForStretching.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
 #include <sgpp/base/tools/MultipleClassPoint.hpp>
 #include <sgpp/base/tools/OperationQuadratureMC.hpp>
 #include <sgpp/base/tools/QuadRule1D.hpp>
@@ -0,0 +1,158 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/serialization/BinaryGridSerializer.hpp>
+#include <sgpp/base/grid/serialization/BinaryGridView.hpp>
+#include <sgpp/base/grid/type/ModBsplineGrid.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using sgpp::base::BinaryGridHeader;
+using sgpp::base::BinaryGridSerializer;
+using sgpp::base::BinaryGridView;
+using sgpp::base::BoundingBox1D;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridStorage;
+
+namespace {
+
+void checkEqualStorages(GridStorage& storage, GridStorage& other) {
+  BOOST_REQUIRE_EQUAL(storage.getSize(), other.getSize());
+  BOOST_REQUIRE_EQUAL(storage.getDimension(), other.getDimension());
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    BOOST_CHECK(storage.getPoint(i).equals(other.getPoint(i)));
+    BOOST_CHECK_EQUAL(storage.getPoint(i).isLeaf(), other.getPoint(i).isLeaf());
+  }
+
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    BOOST_CHECK_EQUAL(storage.getBoundingBox()->getBoundary(d).leftBoundary,
+                      other.getBoundingBox()->getBoundary(d).leftBoundary);
+    BOOST_CHECK_EQUAL(storage.getBoundingBox()->getBoundary(d).rightBoundary,
+                      other.getBoundingBox()->getBoundary(d).rightBoundary);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestBinaryGridSerializer)
+
+BOOST_AUTO_TEST_CASE(testStreamRoundTrip) {
+  std::unique_ptr<Grid> grid(Grid::createModBsplineGrid(3, 5));
+  grid->getGenerator().regular(4);
+  grid->getBoundingBox().setBoundary(1, BoundingBox1D(-2.0, 3.0));
+
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = 0.5 * static_cast<double>(i) - 1.0;
+  }
+
+  std::stringstream stream;
+  BinaryGridSerializer::writeGrid(*grid, stream, &alpha);
+
+  DataVector alphaRead;
+  std::unique_ptr<Grid> gridRead(BinaryGridSerializer::readGrid(stream, &alphaRead));
+
+  BOOST_CHECK(gridRead->getType() == grid->getType());
+  BOOST_CHECK_EQUAL(dynamic_cast<sgpp::base::ModBsplineGrid*>(gridRead.get())->getDegree(), 5);
+  checkEqualStorages(grid->getStorage(), gridRead->getStorage());
+
+  BOOST_REQUIRE_EQUAL(alphaRead.getSize(), alpha.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    BOOST_CHECK_EQUAL(alphaRead[i], alpha[i]);
+  }
+
+  // storage only
+  std::stringstream storageStream;
+  BinaryGridSerializer::writeStorage(grid->getStorage(), storageStream);
+  std::unique_ptr<GridStorage> storageRead(BinaryGridSerializer::readStorage(storageStream));
+  checkEqualStorages(grid->getStorage(), *storageRead);
+}
+
+BOOST_AUTO_TEST_CASE(testMemoryMappedView) {
+  const std::string filename = "test_BinaryGridSerializer.tmp";
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(2, 2));
+  grid->getGenerator().regular(3);
+  GridStorage& storage = grid->getStorage();
+  const size_t dim = storage.getDimension();
+
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i * i);
+  }
+
+  BinaryGridSerializer::writeGrid(*grid, filename, &alpha);
+
+  {
+    BinaryGridView view(filename);
+    BOOST_CHECK(view.containsGrid());
+    BOOST_CHECK(view.hasCoefficients());
+    BOOST_REQUIRE_EQUAL(view.getSize(), storage.getSize());
+    BOOST_REQUIRE_EQUAL(view.getDimension(), dim);
+
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      for (size_t d = 0; d < dim; d++) {
+        BOOST_CHECK_EQUAL(view.getLevel(i, d), storage.getPoint(i).getLevel(d));
+        BOOST_CHECK_EQUAL(view.getIndex(i, d), storage.getPoint(i).getIndex(d));
+      }
+
+      BOOST_CHECK_EQUAL(view.getCoefficients()[i], alpha[i]);
+    }
+
+    std::unique_ptr<Grid> gridRead(view.createGrid());
+    BOOST_CHECK(gridRead->getType() == grid->getType());
+    checkEqualStorages(storage, gridRead->getStorage());
+
+    // lookups in the created grid
+    BOOST_CHECK(gridRead->getStorage().isContaining(storage.getPoint(storage.getSize() - 1)));
+  }
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testInvalidInput) {
+  std::stringstream text("linear\n9 1 0\n0\n0.0 1.0 0 0\n");
+  BOOST_CHECK_THROW(BinaryGridSerializer::readGrid(text), sgpp::base::file_exception);
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(2);
+  std::stringstream stream;
+  BinaryGridSerializer::writeGrid(*grid, stream);
+
+  // truncated stream
+  std::stringstream truncated(stream.str().substr(0, stream.str().size() - 4));
+  BOOST_CHECK_THROW(BinaryGridSerializer::readGrid(truncated), sgpp::base::file_exception);
+
+  // coefficients requested, but not contained
+  DataVector alpha;
+  BOOST_CHECK_THROW(BinaryGridSerializer::readGrid(stream, &alpha), sgpp::base::file_exception);
+
+  // dimension in the header does not match the grid description
+  std::string mismatched = stream.str();
+  const uint64_t dimension = 1;
+  mismatched.replace(offsetof(BinaryGridHeader, dimension), sizeof(dimension),
+                     reinterpret_cast<const char*>(&dimension), sizeof(dimension));
+  std::stringstream mismatchedGrid(mismatched);
+  BOOST_CHECK_THROW(BinaryGridSerializer::readGrid(mismatchedGrid), sgpp::base::file_exception);
+  std::stringstream mismatchedStorage(mismatched);
+  BOOST_CHECK_THROW(BinaryGridSerializer::readStorage(mismatchedStorage),
+                    sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,153 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
+#include <sgpp/base/grid/storage/compact/CompactGridIterator.hpp>
+#include <sgpp/base/grid/storage/compact/CompactGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridIterator.hpp>
+
+#include <memory>
+#include <vector>
+
+using sgpp::base::CompactGridIterator;
+using sgpp::base::CompactGridStorage;
+using sgpp::base::Grid;
+using sgpp::base::generation_exception;
+using sgpp::base::HashGenerator;
+using sgpp::base::HashGridIterator;
+using sgpp::base::HashGridPoint;
+using sgpp::base::HashGridStorage;
+
+BOOST_AUTO_TEST_SUITE(TestCompactGridStorage)
+
+BOOST_AUTO_TEST_CASE(testSequenceNumbers) {
+  HashGridStorage hashStorage(3);
+  HashGenerator generator;
+  generator.regular(hashStorage, 5);
+
+  CompactGridStorage storage(hashStorage);
+  BOOST_CHECK_EQUAL(storage.getSize(), hashStorage.getSize());
+  BOOST_CHECK_EQUAL(storage.getDimension(), hashStorage.getDimension());
+  BOOST_CHECK_EQUAL(storage.getMaxLevel(), hashStorage.getMaxLevel());
+
+  HashGridPoint point(3);
+
+  for (size_t i = 0; i < hashStorage.getSize(); i++) {
+    BOOST_CHECK_EQUAL(storage.getSequenceNumber(hashStorage[i]), i);
+    BOOST_CHECK_EQUAL(storage.isLeaf(i), hashStorage[i].isLeaf());
+
+    storage.getPoint(i, point);
+    BOOST_CHECK(point.equals(hashStorage[i]));
+  }
+
+  // points that are not contained
+  point.set(0, 6, 1);
+  point.set(1, 1, 1);
+  point.set(2, 1, 1);
+  BOOST_CHECK(!storage.isContaining(point));
+  BOOST_CHECK(storage.isInvalidSequenceNumber(storage.getSequenceNumber(point)));
+}
+
+BOOST_AUTO_TEST_CASE(testInsertAndLeafProperty) {
+  HashGridStorage hashStorage(2);
+  CompactGridStorage storage(2);
+  HashGridPoint point(2);
+  std::vector<size_t> hashInserted, compactInserted;
+
+  point.set(0, 3, 5);
+  point.set(1, 2, 1);
+  hashStorage.insert(point, hashInserted);
+
+  point.set(0, 3, 5);
+  point.set(1, 2, 1);
+  storage.insert(point, compactInserted);
+
+  BOOST_CHECK_EQUAL(storage.getSize(), hashStorage.getSize());
+  BOOST_CHECK_EQUAL_COLLECTIONS(compactInserted.begin(), compactInserted.end(),
+                                hashInserted.begin(), hashInserted.end());
+
+  hashStorage.recalcLeafProperty();
+  storage.recalcLeafProperty();
+
+  for (size_t i = 0; i < hashStorage.getSize(); i++) {
+    BOOST_CHECK_EQUAL(storage.getSequenceNumber(hashStorage[i]), i);
+    BOOST_CHECK_EQUAL(storage.isLeaf(i), hashStorage[i].isLeaf());
+  }
+
+  // copy back and compare
+  HashGridStorage copy(2);
+  storage.copyTo(copy);
+  BOOST_CHECK_EQUAL(copy.getSize(), hashStorage.getSize());
+
+  for (size_t i = 0; i < hashStorage.getSize(); i++) {
+    BOOST_CHECK(copy[i].equals(hashStorage[i]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testInvalidLevel) {
+  CompactGridStorage storage(2);
+  CompactGridStorage::level_type level[2] = {1, CompactGridStorage::MAX_LEVEL + 1};
+  CompactGridStorage::index_type index[2] = {1, 1};
+
+  // a failed insertion leaves the storage unchanged
+  BOOST_CHECK_THROW(storage.insert(level, index, true), generation_exception);
+  BOOST_CHECK_EQUAL(storage.getSize(), 0);
+
+  level[1] = 2;
+  index[1] = 3;
+  BOOST_CHECK_EQUAL(storage.insert(level, index, true), 0);
+  BOOST_CHECK_EQUAL(storage.getSequenceNumber(level, index), 0);
+  BOOST_CHECK_EQUAL(storage.getLevel(0, 1), 2);
+  BOOST_CHECK_EQUAL(storage.getIndex(0, 1), 3);
+}
+
+BOOST_AUTO_TEST_CASE(testIterator) {
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(2));
+  grid->getGenerator().regular(4);
+  std::unique_ptr<CompactGridStorage> storage(grid->createCompactStorage());
+
+  HashGridIterator hashIterator(grid->getStorage());
+  CompactGridIterator iterator(*storage);
+  BOOST_CHECK_EQUAL(iterator.seq(), hashIterator.seq());
+  BOOST_CHECK_EQUAL(iterator.toString(), hashIterator.toString());
+
+  for (size_t d = 0; d < 2; d++) {
+    iterator.leftChild(d);
+    hashIterator.leftChild(d);
+    BOOST_CHECK_EQUAL(iterator.seq(), hashIterator.seq());
+    BOOST_CHECK_EQUAL(iterator.hint(), hashIterator.hint());
+    BOOST_CHECK_EQUAL(iterator.hintLeft(d), hashIterator.hintLeft(d));
+    BOOST_CHECK_EQUAL(iterator.hintRight(d), hashIterator.hintRight(d));
+
+    iterator.stepRight(d);
+    hashIterator.stepRight(d);
+    BOOST_CHECK_EQUAL(iterator.seq(), hashIterator.seq());
+
+    iterator.up(d);
+    hashIterator.up(d);
+    BOOST_CHECK_EQUAL(iterator.seq(), hashIterator.seq());
+
+    iterator.resetToLeftLevelZero(d);
+    hashIterator.resetToLeftLevelZero(d);
+    BOOST_CHECK_EQUAL(iterator.seq(), hashIterator.seq());
+    BOOST_CHECK(!iterator.isInnerPoint());
+
+    iterator.resetToLevelOne(d);
+    hashIterator.resetToLevelOne(d);
+    BOOST_CHECK_EQUAL(iterator.getGridDepth(d), hashIterator.getGridDepth(d));
+  }
+
+  iterator.resetToLevelZero();
+  hashIterator.resetToLevelZero();
+  BOOST_CHECK_EQUAL(iterator.seq(), hashIterator.seq());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/tools/FileReplacement.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+using sgpp::base::FileReplacement;
+
+namespace {
+
+std::string readFile(const std::string& filename) {
+  std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+bool fileExists(const std::string& filename) { return std::ifstream(filename.c_str()).good(); }
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestFileReplacement)
+
+BOOST_AUTO_TEST_CASE(testReplace) {
+  const std::string filename = "test_FileReplacement.tmp";
+  const std::string tmpFilename = FileReplacement::getTemporaryFilename(filename);
+  std::remove(filename.c_str());
+  std::remove(tmpFilename.c_str());
+
+  // creates the file
+  FileReplacement::replace(filename, [](std::ostream& out) { out << "old"; });
+  BOOST_CHECK_EQUAL(readFile(filename), "old");
+  BOOST_CHECK(!fileExists(tmpFilename));
+
+  // replaces the file
+  FileReplacement::replace(filename, [](std::ostream& out) { out << "new"; });
+  BOOST_CHECK_EQUAL(readFile(filename), "new");
+  BOOST_CHECK(!fileExists(tmpFilename));
+
+  // the file is not modified if writing fails
+  BOOST_CHECK_THROW(FileReplacement::replace(filename,
+                                             [](std::ostream& out) {
+                                               out << "partial";
+                                               throw std::runtime_error("write failed");
+                                             }),
+                    std::runtime_error);
+  BOOST_CHECK_EQUAL(readFile(filename), "new");
+  BOOST_CHECK(!fileExists(tmpFilename));
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testRecover) {
+  const std::string filename = "test_FileReplacement.tmp";
+  const std::string tmpFilename = FileReplacement::getTemporaryFilename(filename);
+  std::remove(filename.c_str());
+  std::remove(tmpFilename.c_str());
+
+  // nothing to recover
+  BOOST_CHECK(!FileReplacement::recover(filename));
+  BOOST_CHECK(!fileExists(filename));
+
+  // interrupted after the old file has been removed
+  std::ofstream(tmpFilename.c_str()) << "new";
+  BOOST_CHECK(FileReplacement::recover(filename));
+  BOOST_CHECK_EQUAL(readFile(filename), "new");
+  BOOST_CHECK(!fileExists(tmpFilename));
+
+  // interrupted while writing the temporary file, the old file is kept
+  std::ofstream(tmpFilename.c_str()) << "partial";
+  BOOST_CHECK(!FileReplacement::recover(filename));
+  BOOST_CHECK_EQUAL(readFile(filename), "new");
+
+  std::remove(filename.c_str());
+  std::remove(tmpFilename.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,8 @@
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <random>
+
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
@@ -19,6 +21,77 @@ using sgpp::base::Grid;
 using sgpp::base::GridStorage;
 using sgpp::base::OperationMultipleEval;
 
+namespace {
+
+/**
+ * Compares multBlock() and multTransposeBlock() to mult() and multTranspose() applied to
+ * each column.
+ */
+void compareBlockToColumnwise(Grid& grid) {
+  // more data points than evaluated per round to test the blocked accumulation
+  const size_t dim = grid.getDimension();
+  const size_t numberDataPoints = 1000;
+  const size_t numberColumns = 4;
+  grid.getGenerator().regular(4);
+  const size_t N = grid.getSize();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  DataMatrix dataset(numberDataPoints, dim);
+  DataMatrix alpha(N, numberColumns);
+  DataMatrix source(numberDataPoints, numberColumns);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t j = 0; j < dim; j++) {
+      dataset.set(i, j, distribution(generator));
+    }
+
+    for (size_t j = 0; j < numberColumns; j++) {
+      source.set(i, j, distribution(generator) - 0.5);
+    }
+  }
+
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < numberColumns; j++) {
+      alpha.set(i, j, distribution(generator) - 0.5);
+    }
+  }
+
+  std::unique_ptr<OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, dataset));
+  DataMatrix result;
+  DataMatrix resultTranspose;
+  op->multBlock(alpha, result);
+  op->multTransposeBlock(source, resultTranspose);
+
+  BOOST_CHECK_EQUAL(result.getNrows(), numberDataPoints);
+  BOOST_CHECK_EQUAL(result.getNcols(), numberColumns);
+  BOOST_CHECK_EQUAL(resultTranspose.getNrows(), N);
+  BOOST_CHECK_EQUAL(resultTranspose.getNcols(), numberColumns);
+
+  DataVector alphaColumn(N);
+  DataVector sourceColumn(numberDataPoints);
+  DataVector resultColumn(numberDataPoints);
+  DataVector resultTransposeColumn(N);
+
+  for (size_t j = 0; j < numberColumns; j++) {
+    alpha.getColumn(j, alphaColumn);
+    source.getColumn(j, sourceColumn);
+    op->mult(alphaColumn, resultColumn);
+    op->multTranspose(sourceColumn, resultTransposeColumn);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      BOOST_CHECK_SMALL(result.get(i, j) - resultColumn[i], 1e-12);
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      BOOST_CHECK_SMALL(resultTranspose.get(i, j) - resultTransposeColumn[i], 1e-12);
+    }
+  }
+}
+
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
 
 BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
@@ -78,4 +151,51 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalTranspose) {
+  // more data points than evaluated per round to test the blocked accumulation
+  const size_t dim = 3;
+  const size_t numberDataPoints = 1000;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  const size_t N = grid->getSize();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector source(numberDataPoints);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t j = 0; j < dim; j++) {
+      dataset.set(i, j, distribution(generator));
+    }
+
+    source[i] = distribution(generator) - 0.5;
+  }
+
+  DataVector result(N);
+  DataVector result_ref(N);
+  std::unique_ptr<OperationMultipleEval>(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset))
+      ->multTranspose(source, result);
+  std::unique_ptr<OperationMultipleEval>(
+      sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset))
+      ->multTranspose(source, result_ref);
+
+  for (size_t i = 0; i < N; i++) {
+    BOOST_CHECK_SMALL(result[i] - result_ref[i], 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBlock) {
+  const size_t dim = 3;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  compareBlockToColumnwise(*grid);
+
+  grid.reset(Grid::createModLinearGrid(dim));
+  compareBlockToColumnwise(*grid);
+
+  grid.reset(Grid::createLinearBoundaryGrid(dim));
+  compareBlockToColumnwise(*grid);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
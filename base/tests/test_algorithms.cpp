@@ -6,15 +6,21 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearClenshawCurtisBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearStretchedBasis.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
 
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -497,4 +503,49 @@ BOOST_AUTO_TEST_CASE(TestGetAffectedBasisFunctionsStretched) {
   BOOST_CHECK_CLOSE(x[0].second, 1.0384615384615385, 1e-5);
 }
 
+BOOST_AUTO_TEST_CASE(TestAlgorithmEvaluationBatch) {
+  const size_t dim = 3;
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  grid->getBoundingBox().setBoundary(0, BoundingBox1D(-1.0, 2.0));
+  const size_t N = grid->getSize();
+
+  DataVector alpha(N);
+
+  for (size_t i = 0; i < N; i++) {
+    alpha[i] = static_cast<double>(i % 7) - 3.0;
+  }
+
+  // more points than one block, some of them outside of the bounding box
+  const size_t numberOfPoints = 500;
+  sgpp::base::DataMatrix points(numberOfPoints, dim);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      points.set(i, d, static_cast<double>((i * (3 * d + 7)) % 101) / 90.0 - 0.05);
+    }
+  }
+
+  std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
+  DataVector result;
+  DataVector point(dim);
+
+  opEval->evalBatch(alpha, points, result);
+  BOOST_CHECK_EQUAL(result.getSize(), numberOfPoints);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    points.getRow(i, point);
+    BOOST_CHECK_CLOSE(result[i], opEval->eval(alpha, point), 1e-12);
+  }
+
+  // reuse of the workspace for multiple points
+  sgpp::base::SLinearBase basis;
+  sgpp::base::AlgorithmEvaluation<sgpp::base::SLinearBase> algoEval(grid->getStorage());
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    points.getRow(i, point);
+    BOOST_CHECK_CLOSE(algoEval(basis, point, alpha), result[i], 1e-12);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -141,6 +141,7 @@ namespace combigrid {
 %include "combigrid/src/sgpp/combigrid/operation/onedim/AbstractLinearEvaluator.hpp"
 %include "combigrid/src/sgpp/combigrid/operation/onedim/AbstractEvaluator.hpp"
 
+%include "combigrid/src/sgpp/combigrid/storage/tree/TreeStorageLayout.hpp"
 %include "combigrid/src/sgpp/combigrid/storage/tree/TreeStorage.hpp"
 
 %ignore sgpp::combigrid::FloatScalarVector::operator=;
@@ -0,0 +1,90 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/*
+ * Compares the evaluation of a combigrid interpolant at many points
+ *  - point by point with CombigridOperation and
+ *  - in one batch with CombigridMultiOperation.
+ * Usage: batchedEvaluationBenchmark [numDimensions] [level] [numPoints]
+ */
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/combigrid/operation/CombigridMultiOperation.hpp>
+#include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/utils/Stopwatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+double f(sgpp::base::DataVector const &x) {
+  double result = 1.0;
+  for (size_t d = 0; d < x.getSize(); ++d) {
+    result *= std::exp(-x[d]) * (1.0 + x[d] * x[d]);
+  }
+  return result;
+}
+
+int main(int argc, char **argv) {
+  size_t numDimensions = argc > 1 ? std::atoi(argv[1]) : 4;
+  size_t level = argc > 2 ? std::atoi(argv[2]) : 5;
+  size_t numPoints = argc > 3 ? std::atoi(argv[3]) : 10000;
+
+  // evaluation points, one column per point
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  sgpp::base::DataMatrix points(numDimensions, numPoints);
+  for (size_t i = 0; i < numDimensions; ++i) {
+    for (size_t j = 0; j < numPoints; ++j) {
+      points(i, j) = distribution(generator);
+    }
+  }
+
+  sgpp::combigrid::MultiFunction func(f);
+  auto singleOperation =
+      sgpp::combigrid::CombigridOperation::createLinearLejaPolynomialInterpolation(numDimensions,
+                                                                                   func);
+  auto multiOperation =
+      sgpp::combigrid::CombigridMultiOperation::createLinearLejaPolynomialInterpolation(
+          numDimensions, func);
+
+  // compute the function values once, so only the evaluation is measured
+  sgpp::base::DataVector point(numDimensions);
+  points.getColumn(0, point);
+  singleOperation->evaluate(level, point);
+  multiOperation->evaluate(level, sgpp::base::DataMatrix(numDimensions, 1, 0.5));
+
+  sgpp::combigrid::Stopwatch stopwatch;
+  sgpp::base::DataVector singleResults(numPoints);
+  stopwatch.start();
+  for (size_t j = 0; j < numPoints; ++j) {
+    points.getColumn(j, point);
+    singleResults[j] = singleOperation->evaluate(level, point);
+  }
+  double singleSeconds = stopwatch.elapsedSeconds();
+
+  stopwatch.start();
+  sgpp::base::DataVector multiResults = multiOperation->evaluate(level, points);
+  double multiSeconds = stopwatch.elapsedSeconds();
+
+  double maxDifference = 0.0;
+  for (size_t j = 0; j < numPoints; ++j) {
+    maxDifference = std::max(maxDifference, std::abs(singleResults[j] - multiResults[j]));
+  }
+
+  std::cout << numDimensions << " dimensions, level " << level << ", "
+            << singleOperation->numGridPoints() << " grid points, " << numPoints
+            << " evaluation points\n";
+  std::cout << "point by point: " << static_cast<double>(numPoints) / singleSeconds
+            << " points/s\n";
+  std::cout << "batched:        " << static_cast<double>(numPoints) / multiSeconds
+            << " points/s\n";
+  std::cout << "max. difference: " << maxDifference << "\n";
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/*
+ * Compares checkpointing the function values and the level structure of a combigrid operation
+ *  - with the string serialization (serialize() / getSerializedLevelStructure()) and
+ *  - with the binary serialization (saveBinary() / writeBinaryLevelStructure()).
+ * Usage: serializationBenchmark [numDimensions] [level]
+ */
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/utils/Stopwatch.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+double f(sgpp::base::DataVector const &x) {
+  double result = 1.0;
+  for (size_t d = 0; d < x.getSize(); ++d) {
+    result *= std::sin(3.0 * x[d]) + 2.0;
+  }
+  return result;
+}
+
+std::string readFile(std::string const &filename) {
+  std::ifstream stream(filename);
+  std::stringstream content;
+  content << stream.rdbuf();
+  return content.str();
+}
+
+size_t fileSize(std::string const &filename) {
+  std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+  return static_cast<size_t>(stream.tellg());
+}
+
+int main(int argc, char **argv) {
+  size_t numDimensions = argc > 1 ? std::atoi(argv[1]) : 4;
+  size_t level = argc > 2 ? std::atoi(argv[2]) : 6;
+  std::string storageFile = "serializationBenchmarkStorage";
+  std::string levelFile = "serializationBenchmarkLevels";
+
+  sgpp::combigrid::MultiFunction func(f);
+  auto operation =
+      sgpp::combigrid::CombigridOperation::createLinearClenshawCurtisPolynomialInterpolation(
+          numDimensions, func);
+  auto levelManager = operation->getLevelManager();
+  levelManager->addRegularLevels(level);
+  auto storage = operation->getStorage();
+
+  // a second operation that restores the checkpoint without evaluating the function
+  auto restored =
+      sgpp::combigrid::CombigridOperation::createLinearClenshawCurtisPolynomialInterpolation(
+          numDimensions, func);
+
+  sgpp::combigrid::Stopwatch stopwatch;
+
+  // string serialization
+  stopwatch.start();
+  {
+    std::ofstream storageStream(storageFile);
+    storageStream << storage->serialize();
+    std::ofstream levelStream(levelFile);
+    levelStream << levelManager->getSerializedLevelStructure();
+  }
+  double textSaveSeconds = stopwatch.elapsedSeconds();
+  size_t textBytes = fileSize(storageFile) + fileSize(levelFile);
+
+  stopwatch.start();
+  restored->getStorage()->deserialize(readFile(storageFile));
+  restored->getLevelManager()->addLevelsFromSerializedStructure(readFile(levelFile));
+  double textLoadSeconds = stopwatch.elapsedSeconds();
+
+  // binary serialization
+  restored = sgpp::combigrid::CombigridOperation::createLinearClenshawCurtisPolynomialInterpolation(
+      numDimensions, func);
+
+  stopwatch.start();
+  storage->saveBinary(storageFile);
+  {
+    std::ofstream levelStream(levelFile, std::ios::binary);
+    levelManager->writeBinaryLevelStructure(levelStream);
+  }
+  double binarySaveSeconds = stopwatch.elapsedSeconds();
+  size_t binaryBytes = fileSize(storageFile) + fileSize(levelFile);
+
+  stopwatch.start();
+  restored->getStorage()->loadBinary(storageFile);
+  {
+    std::ifstream levelStream(levelFile, std::ios::binary);
+    restored->getLevelManager()->addLevelsFromBinaryStructure(levelStream);
+  }
+  double binaryLoadSeconds = stopwatch.elapsedSeconds();
+
+  std::cout << storage->getNumEntries() << " function values, "
+            << restored->getStorage()->getNumEntries() << " restored\n";
+  std::cout << "string: save " << textSaveSeconds << " s, restore " << textLoadSeconds << " s, "
+            << textBytes << " bytes\n";
+  std::cout << "binary: save " << binarySaveSeconds << " s, restore " << binaryLoadSeconds
+            << " s, " << binaryBytes << " bytes\n";
+
+  std::remove(storageFile.c_str());
+  std::remove(levelFile.c_str());
+
+  return 0;
+}
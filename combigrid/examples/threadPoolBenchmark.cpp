@@ -0,0 +1,123 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/*
+ * Benchmarks for the work-stealing ThreadPool:
+ *  - task throughput for tiny tasks, both added up front and spawned recursively by the tasks,
+ *  - adaptive refinement of a combigrid operation with addLevelsAdaptiveParallel().
+ * Usage: threadPoolBenchmark [maxNumThreads]
+ */
+
+#include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/operation/multidim/LevelManager.hpp>
+#include <sgpp/combigrid/threading/ThreadPool.hpp>
+#include <sgpp/combigrid/utils/Stopwatch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using sgpp::combigrid::ThreadPool;
+
+std::atomic<size_t> numExecuted(0);
+
+/**
+ * Adds two subtasks until depth is zero, i.e., 2^(depth + 1) - 1 tasks in total.
+ */
+void spawnTasks(ThreadPool &tp, size_t depth) {
+  numExecuted.fetch_add(1, std::memory_order_relaxed);
+  if (depth > 0) {
+    for (size_t i = 0; i < 2; ++i) {
+      tp.addTask(ThreadPool::Task([&tp, depth]() { spawnTasks(tp, depth - 1); }));
+    }
+  }
+}
+
+void benchmarkFlatTasks(size_t numThreads, size_t numTasks) {
+  numExecuted = 0;
+  ThreadPool tp(numThreads);
+  std::vector<ThreadPool::Task> tasks(
+      numTasks, ThreadPool::Task([]() { numExecuted.fetch_add(1, std::memory_order_relaxed); }));
+  tp.addTasks(tasks);
+
+  sgpp::combigrid::Stopwatch stopwatch;
+  stopwatch.start();
+  tp.start();
+  tp.join();
+  double seconds = stopwatch.elapsedSeconds();
+
+  std::cout << "flat tasks,    " << numThreads << " threads: "
+            << static_cast<double>(numExecuted) / seconds << " tasks/s\n";
+}
+
+void benchmarkSpawnedTasks(size_t numThreads, size_t depth) {
+  numExecuted = 0;
+  // idle threads wait until the whole tree has been executed, as they would otherwise terminate
+  // before the first tasks have spawned enough work to steal
+  size_t numTasks = (size_t(2) << depth) - 1;
+  ThreadPool tp(numThreads, ThreadPool::IdleCallback([numTasks](ThreadPool &pool) {
+                  if (numExecuted.load(std::memory_order_relaxed) >= numTasks) {
+                    pool.triggerTermination();
+                  } else {
+                    std::this_thread::yield();
+                  }
+                }));
+  tp.addTask(ThreadPool::Task([&tp, depth]() { spawnTasks(tp, depth); }));
+
+  sgpp::combigrid::Stopwatch stopwatch;
+  stopwatch.start();
+  tp.start();
+  tp.join();
+  double seconds = stopwatch.elapsedSeconds();
+
+  std::cout << "spawned tasks, " << numThreads << " threads: "
+            << static_cast<double>(numExecuted) / seconds << " tasks/s\n";
+}
+
+double f(sgpp::base::DataVector const &x) {
+  // make the function evaluations expensive enough to dominate the bookkeeping
+  double result = 0.0;
+  for (size_t k = 1; k <= 200; ++k) {
+    double prod = 1.0;
+    for (size_t dim = 0; dim < x.getSize(); ++dim) {
+      prod *= std::cos(static_cast<double>(k) * x[dim]);
+    }
+    result += prod / static_cast<double>(k * k);
+  }
+  return result;
+}
+
+void benchmarkAdaptiveRefinement(size_t numThreads, size_t maxNumPoints) {
+  size_t d = 4;
+  auto op = sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+      d, sgpp::combigrid::MultiFunction(f));
+
+  sgpp::combigrid::Stopwatch stopwatch;
+  stopwatch.start();
+  op->getLevelManager()->addLevelsAdaptiveParallel(maxNumPoints, numThreads);
+  double seconds = stopwatch.elapsedSeconds();
+
+  std::cout << "adaptive refinement, " << numThreads << " threads: " << seconds << " s for "
+            << op->numGridPoints() << " grid points\n";
+}
+
+int main(int argc, char **argv) {
+  size_t maxNumThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  if (argc > 1) {
+    maxNumThreads = std::strtoul(argv[1], nullptr, 10);
+  }
+
+  for (size_t numThreads = 1; numThreads <= maxNumThreads; numThreads *= 2) {
+    benchmarkFlatTasks(numThreads, 1000000);
+    benchmarkSpawnedTasks(numThreads, 19);
+    benchmarkAdaptiveRefinement(numThreads, 20000);
+  }
+
+  return 0;
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/*
+ * Benchmarks for the memory layouts of TreeStorage (see TreeStorageLayout):
+ *  - insertion of the values of a full grid with set(),
+ *  - guided iteration through a full grid as in FullGridLinearSummationStrategy,
+ *  - insertion of a sparse set of multi-indices (all indices with a bounded sum).
+ * The memory is measured with mallinfo() if glibc is available.
+ * Usage: treeStorageBenchmark [numDimensions] [numPointsPerDimension]
+ */
+
+#include <sgpp/combigrid/common/BoundedSumMultiIndexIterator.hpp>
+#include <sgpp/combigrid/common/MultiIndexIterator.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorageLayout.hpp>
+#include <sgpp/combigrid/utils/Stopwatch.hpp>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::combigrid::MultiIndex;
+using sgpp::combigrid::MultiIndexIterator;
+using sgpp::combigrid::TreeStorage;
+using sgpp::combigrid::TreeStorageLayout;
+
+/**
+ * @return number of bytes allocated on the heap (0 if unknown)
+ */
+size_t allocatedBytes() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  return mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+  return static_cast<size_t>(static_cast<unsigned int>(mallinfo().uordblks));
+#else
+  return 0;
+#endif
+}
+
+std::string layoutName(TreeStorageLayout layout) {
+  switch (layout) {
+    case TreeStorageLayout::TREE:
+      return "tree     ";
+    case TreeStorageLayout::FULL_GRID:
+      return "full grid";
+    default:
+      return "hash     ";
+  }
+}
+
+void benchmarkFullGrid(TreeStorageLayout layout, size_t numDimensions, size_t numPoints) {
+  MultiIndex bounds(numDimensions, numPoints);
+  sgpp::combigrid::Stopwatch stopwatch;
+
+  size_t bytesBefore = allocatedBytes();
+  auto storage = std::make_shared<TreeStorage<double>>(numDimensions, layout);
+
+  // insertion with set()
+  stopwatch.start();
+  MultiIndexIterator insertIt(bounds);
+  size_t numValues = 0;
+  while (insertIt.isValid()) {
+    storage->set(insertIt.value(), static_cast<double>(numValues++));
+    insertIt.moveToNext();
+  }
+  double insertSeconds = stopwatch.elapsedSeconds();
+  size_t bytes = allocatedBytes() - bytesBefore;
+
+  // guided iteration, several passes
+  size_t numPasses = 10;
+  double sum = 0.0;
+  stopwatch.start();
+  for (size_t pass = 0; pass < numPasses; ++pass) {
+    MultiIndexIterator multiIt(bounds);
+    auto it = storage->getGuidedIterator(multiIt);
+    while (it->isValid()) {
+      sum += it->value();
+      it->moveToNext();
+    }
+  }
+  double iterateSeconds = stopwatch.elapsedSeconds();
+
+  std::cout << layoutName(layout) << ": insert " << static_cast<double>(numValues) / insertSeconds
+            << " values/s, guided iteration "
+            << static_cast<double>(numPasses * numValues) / iterateSeconds << " values/s, "
+            << static_cast<double>(bytes) / static_cast<double>(numValues) << " bytes/value"
+            << " (checksum " << sum << ")\n";
+}
+
+void benchmarkSparseSet(TreeStorageLayout layout, size_t numDimensions, size_t maxSum) {
+  sgpp::combigrid::Stopwatch stopwatch;
+
+  size_t bytesBefore = allocatedBytes();
+  auto storage = std::make_shared<TreeStorage<double>>(numDimensions, layout);
+
+  stopwatch.start();
+  sgpp::combigrid::BoundedSumMultiIndexIterator it(numDimensions, maxSum);
+  size_t numValues = 0;
+  while (it.isValid()) {
+    storage->set(it.value(), static_cast<double>(numValues++));
+    it.moveToNext();
+  }
+  double insertSeconds = stopwatch.elapsedSeconds();
+  size_t bytes = allocatedBytes() - bytesBefore;
+
+  std::cout << layoutName(layout) << ": insert " << static_cast<double>(numValues) / insertSeconds
+            << " values/s, " << static_cast<double>(bytes) / static_cast<double>(numValues)
+            << " bytes/value (" << numValues << " values)\n";
+}
+
+int main(int argc, char **argv) {
+  size_t numDimensions = argc > 1 ? std::atoi(argv[1]) : 6;
+  size_t numPoints = argc > 2 ? std::atoi(argv[2]) : 9;
+  std::vector<TreeStorageLayout> layouts = {TreeStorageLayout::TREE, TreeStorageLayout::FULL_GRID,
+                                            TreeStorageLayout::HASH};
+
+  std::cout << "full grid, " << numDimensions << " dimensions, " << numPoints
+            << " points per dimension:\n";
+  for (auto layout : layouts) {
+    benchmarkFullGrid(layout, numDimensions, numPoints);
+  }
+
+  std::cout << "\nsparse set, " << numDimensions << " dimensions, index sum <= " << numPoints
+            << ":\n";
+  for (auto layout : layouts) {
+    benchmarkSparseSet(layout, numDimensions, numPoints);
+  }
+
+  return 0;
+}
@@ -17,7 +17,7 @@ void FloatTensorVector::ensureDim(size_t dim) {
     if (d == 0 && dim == 1) {
       return;
     }
-    auto newStorage = std::make_shared<TreeStorage<FloatScalarVector>>(dim);
+    auto newStorage = std::make_shared<TreeStorage<FloatScalarVector>>(dim, layout);
     auto it = values->getStoredDataIterator();
     for (; it->isValid(); it->moveToNext()) {
       MultiIndex index = it->getMultiIndex();
@@ -31,23 +31,26 @@ void FloatTensorVector::ensureDim(size_t dim) {
 }
 
 FloatTensorVector::FloatTensorVector(const std::shared_ptr<TreeStorage<FloatScalarVector>>& values)
-    : d(values->getNumDimensions()), values(values) {}
+    : d(values->getNumDimensions()), values(values), layout(values->getLayout()) {}
 
-FloatTensorVector::FloatTensorVector(size_t d) : d(d), values(nullptr) {
+FloatTensorVector::FloatTensorVector(size_t d, TreeStorageLayout layout)
+    : d(d), values(nullptr), layout(layout) {
   if (d > 0) {
-    values = std::make_shared<TreeStorage<FloatScalarVector>>(d);
+    values = std::make_shared<TreeStorage<FloatScalarVector>>(d, layout);
   } else {
-    values = std::make_shared<TreeStorage<FloatScalarVector>>(1);
+    values = std::make_shared<TreeStorage<FloatScalarVector>>(1, layout);
   }
 }
 
-FloatTensorVector::FloatTensorVector(FloatScalarVector scalar)
-    : d(0), values(std::make_shared<TreeStorage<FloatScalarVector>>(1)) {
+FloatTensorVector::FloatTensorVector(FloatScalarVector scalar, TreeStorageLayout layout)
+    : d(0), values(std::make_shared<TreeStorage<FloatScalarVector>>(1, layout)), layout(layout) {
   values->set(MultiIndex{0}, scalar);
 }
 
-FloatTensorVector::FloatTensorVector(const FloatTensorVector& other) : d(other.d) {
-  values = std::make_shared<TreeStorage<FloatScalarVector>>(other.values->getNumDimensions());
+FloatTensorVector::FloatTensorVector(const FloatTensorVector& other)
+    : d(other.d), layout(other.layout) {
+  values =
+      std::make_shared<TreeStorage<FloatScalarVector>>(other.values->getNumDimensions(), layout);
   auto it = other.values->getStoredDataIterator();
   for (; it->isValid(); it->moveToNext()) {
     values->set(it->getMultiIndex(), it->value());
@@ -57,7 +60,9 @@ FloatTensorVector::FloatTensorVector(const FloatTensorVector& other) : d(other.d
 FloatTensorVector& FloatTensorVector::operator=(const FloatTensorVector& other) {
   if (&other != this) {
     d = other.d;
-    values = std::make_shared<TreeStorage<FloatScalarVector>>(other.values->getNumDimensions());
+    layout = other.layout;
+    values =
+        std::make_shared<TreeStorage<FloatScalarVector>>(other.values->getNumDimensions(), layout);
     auto it = other.values->getStoredDataIterator();
     for (; it->isValid(); it->moveToNext()) {
       values->set(it->getMultiIndex(), it->value());
@@ -131,7 +136,7 @@ void FloatTensorVector::componentwiseMult(const FloatTensorVector& other) {
     scalarMult(scalar);
   } else {
     size_t dnew = d + other.d;
-    auto newValues = std::make_shared<TreeStorage<FloatScalarVector>>(dnew);
+    auto newValues = std::make_shared<TreeStorage<FloatScalarVector>>(dnew, layout);
     auto it1 = values->getStoredDataIterator();
     for (; it1->isValid(); it1->moveToNext()) {
       auto it2 = other.values->getStoredDataIterator();
@@ -19,15 +19,21 @@ class FloatTensorVector {
   // if d == 0, then values->getNumDimensions() == 1 (to store the only value at index 0)
   size_t d;
   std::shared_ptr<TreeStorage<FloatScalarVector>> values;
+  // memory layout of values and of the storages that replace it
+  TreeStorageLayout layout;
 
   void ensureDim(size_t dim);
 
  public:
+  /**
+   * The memory layout is taken from values.
+   */
   explicit FloatTensorVector(std::shared_ptr<TreeStorage<FloatScalarVector>> const &values);
 
-  explicit FloatTensorVector(size_t d = 0);
+  explicit FloatTensorVector(size_t d = 0, TreeStorageLayout layout = TreeStorageLayout::TREE);
 
-  explicit FloatTensorVector(FloatScalarVector scalar);
+  explicit FloatTensorVector(FloatScalarVector scalar,
+                             TreeStorageLayout layout = TreeStorageLayout::TREE);
 
   FloatTensorVector(FloatTensorVector const &other);
 
@@ -35,6 +41,8 @@ class FloatTensorVector {
 
   std::shared_ptr<TreeStorage<FloatScalarVector>> const &getValues() const { return values; }
 
+  TreeStorageLayout getLayout() const { return layout; }
+
   /**
    * This function can be called from python because it does not return a reference.
    */
@@ -45,6 +45,8 @@ class MultiIndexIterator {
 
   size_t numDimensions() const { return index.size(); }
 
+  MultiIndex const &getMultiBounds() const { return multiBounds; }
+
   int moveToNext() {
     size_t lastDim = index.size() - 1;
     size_t d = lastDim;
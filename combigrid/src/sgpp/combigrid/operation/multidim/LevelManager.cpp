@@ -16,21 +16,38 @@
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+/**
+ * Identifies binary level structures written by LevelManager::writeBinaryLevelStructure().
+ */
+const char binaryLevelStructureMagic[] = "SGCGLVLS";
+
+}  // namespace
+
 LevelManager::LevelManager(std::shared_ptr<AbstractLevelEvaluator> levelEvaluator,
                            bool collectStats)
     : queue(),
+      levelDataLayout(TreeStorageLayout::TREE),
       numDimensions(levelEvaluator->numDims()),
       combiEval(levelEvaluator),
       collectStats(collectStats) {
   managerMutex = std::make_shared<std::recursive_mutex>();
   infoOnAddedLevels = std::make_shared<LevelInfos>();
-  levelData = std::make_shared<TreeStorage<std::shared_ptr<LevelInfo>>>(numDimensions);
+  levelData =
+      std::make_shared<TreeStorage<std::shared_ptr<LevelInfo>>>(numDimensions, levelDataLayout);
 }
 
-LevelManager::LevelManager() : queue(), numDimensions(0), combiEval(nullptr), collectStats(false) {
+LevelManager::LevelManager()
+    : queue(),
+      levelDataLayout(TreeStorageLayout::TREE),
+      numDimensions(0),
+      combiEval(nullptr),
+      collectStats(false) {
   managerMutex = std::make_shared<std::recursive_mutex>();
   infoOnAddedLevels = std::make_shared<LevelInfos>();
-  levelData = std::make_shared<TreeStorage<std::shared_ptr<LevelInfo>>>(numDimensions);
+  levelData =
+      std::make_shared<TreeStorage<std::shared_ptr<LevelInfo>>>(numDimensions, levelDataLayout);
 }
 
 LevelManager::~LevelManager() {}
@@ -42,7 +59,7 @@ void LevelManager::setLevelEvaluator(std::shared_ptr<AbstractLevelEvaluator> lev
 
 void LevelManager::initAdaption() {
   queue.clear();
-  levelData.reset(new TreeStorage<std::shared_ptr<LevelInfo>>(numDimensions));
+  levelData.reset(new TreeStorage<std::shared_ptr<LevelInfo>>(numDimensions, levelDataLayout));
 
   auto levelStructure = getLevelStructure();
   auto it = levelStructure->getStoredDataIterator();
@@ -374,6 +391,29 @@ void LevelManager::addLevelsFromSerializedStructureParallel(std::string serializ
       numThreads);
 }
 
+void LevelManager::writeBinaryLevelStructure(std::ostream &stream) const {
+  BinaryWriter writer(stream);
+  writer.writeHeader(binaryLevelStructureMagic);
+  BinaryTreeStorageSerializationStrategy<uint8_t>(numDimensions)
+      .serialize(getLevelStructure(), writer);
+}
+
+void LevelManager::addLevelsFromBinaryStructure(std::istream &stream) {
+  BinaryReader reader(stream);
+  reader.readHeader(binaryLevelStructureMagic);
+  addLevelsFromStructure(BinaryTreeStorageSerializationStrategy<uint8_t>(numDimensions)
+                             .deserialize(reader));
+}
+
+void LevelManager::addLevelsFromBinaryStructureParallel(std::istream &stream,
+                                                        size_t numThreads) {
+  BinaryReader reader(stream);
+  reader.readHeader(binaryLevelStructureMagic);
+  addLevelsFromStructureParallel(
+      BinaryTreeStorageSerializationStrategy<uint8_t>(numDimensions).deserialize(reader),
+      numThreads);
+}
+
 void LevelManager::addLevelsAdaptive(size_t maxNumPoints) {
   initAdaption();
 
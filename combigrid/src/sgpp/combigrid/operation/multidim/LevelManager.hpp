@@ -12,15 +12,18 @@
 #include <sgpp/combigrid/operation/multidim/AbstractLevelEvaluator.hpp>
 #include <sgpp/combigrid/operation/multidim/AdaptiveRefinementStrategy.hpp>
 #include <sgpp/combigrid/operation/multidim/LevelHelpers.hpp>
+#include <sgpp/combigrid/serialization/BinaryTreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 
 #include <cmath>
+#include <istream>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <queue>
 #include <string>
 #include <unordered_set>
@@ -66,6 +69,11 @@ class LevelManager {
    */
   std::shared_ptr<TreeStorage<std::shared_ptr<LevelInfo>>> levelData;
 
+  /**
+   * Memory layout of levelData.
+   */
+  TreeStorageLayout levelDataLayout;
+
   /**
    * Dimensionality of the problem.
    */
@@ -229,6 +237,18 @@ class LevelManager {
    */
   void setLevelEvaluator(std::shared_ptr<AbstractLevelEvaluator> levelEvaluator);
 
+  /**
+   * Sets the memory layout of the storage for the information on the visited levels. It is used
+   * from the next adaptive refinement on. The default is TreeStorageLayout::TREE,
+   * TreeStorageLayout::HASH is more compact for many dimensions.
+   */
+  void setLevelDataLayout(TreeStorageLayout layout) { levelDataLayout = layout; }
+
+  /**
+   * @return the memory layout of the storage for the information on the visited levels
+   */
+  TreeStorageLayout getLevelDataLayout() const { return levelDataLayout; }
+
   /**
    * @param q: Maximum 1-norm of the level-multi-index, where the levels start from 0 (not from 1 as
    * in most papers).
@@ -313,6 +333,24 @@ class LevelManager {
    */
   void addLevelsFromSerializedStructureParallel(std::string serializedStructure, size_t numThreads);
 
+  /**
+   * Writes getLevelStructure() in a binary format (see BinaryWriter) to the stream. In contrast to
+   * getSerializedLevelStructure(), the structure is not converted to a string first.
+   */
+  void writeBinaryLevelStructure(std::ostream &stream) const;
+
+  /**
+   * Reads a level structure written by writeBinaryLevelStructure() and then calls
+   * addLevelsFromStructure().
+   */
+  void addLevelsFromBinaryStructure(std::istream &stream);
+
+  /**
+   * Does the same as addLevelsFromBinaryStructure(), but with parallel precomputation of function
+   * values using numThreads threads.
+   */
+  void addLevelsFromBinaryStructureParallel(std::istream &stream, size_t numThreads);
+
   /**
    * Adds levels in an adaptive manner, such that the given maximum number of function evaluations
    * (grid points) is not exceeded. The adaption strategy depends on the particular implementation
@@ -5,6 +5,192 @@
 
 #include <sgpp/combigrid/operation/multidim/fullgrid/FullGridLinearSummationStrategy.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace sgpp {
-namespace combigrid {} /* namespace combigrid */
+namespace combigrid {
+
+namespace {
+
+/**
+ * Number of parameters that are evaluated together, such that the partial products of a block
+ * stay in the L1 cache.
+ */
+const size_t parameterBlockSize = 128;
+
+/**
+ * Minimal number of grid points times number of parameters for which the blocks are evaluated in
+ * parallel.
+ */
+const size_t minParallelWork = size_t(1) << 18;
+
+/**
+ * Adds the contributions of all grid points of a level to sum[begin], ..., sum[end - 1].
+ * @param functionValues function values of the grid points in the order of a MultiIndexIterator
+ * @param basisMatrices basis values of each dimension, basisMatrices[d][i * numParameters + p] is
+ * the basis value of the i-th grid point in dimension d at the p-th parameter
+ * @param multiBounds number of grid points in each dimension
+ * @param numParameters number of parameters
+ * @param begin first parameter of the block
+ * @param end end of the block
+ * @param sum sums for all parameters
+ */
+void addBlockContributions(std::vector<double> const &functionValues,
+                           std::vector<std::vector<double>> const &basisMatrices,
+                           MultiIndex const &multiBounds, size_t numParameters, size_t begin,
+                           size_t end, std::vector<double> &sum) {
+  size_t numDimensions = multiBounds.size();
+  size_t lastDim = numDimensions - 1;
+  size_t width = end - begin;
+  size_t rowLength = multiBounds[lastDim];
+  size_t numRows = functionValues.size() / rowLength;
+
+  // partialProducts[d * width + p] is the product of the basis values in the dimensions 0, ...,
+  // d - 1 for the current row, i.e., partialProducts[p] = 1
+  std::vector<double> partialProducts(numDimensions * width, 1.0);
+  std::vector<double> rowSums(width);
+  MultiIndex rowIndex(lastDim, 0);
+  size_t firstChangedDim = 0;
+
+  for (size_t row = 0; row < numRows; ++row) {
+    for (size_t d = firstChangedDim; d < lastDim; ++d) {
+      double const *previous = &partialProducts[d * width];
+      double *current = &partialProducts[(d + 1) * width];
+      double const *basis = &basisMatrices[d][rowIndex[d] * numParameters + begin];
+
+#pragma omp simd
+      for (size_t p = 0; p < width; ++p) {
+        current[p] = previous[p] * basis[p];
+      }
+    }
+
+    // multiply the function values of the row with the basis matrix of the last dimension
+    double *rowSum = rowSums.data();
+    std::fill(rowSums.begin(), rowSums.end(), 0.0);
+
+    double const *values = &functionValues[row * rowLength];
+    double const *lastBasis = &basisMatrices[lastDim][begin];
+    size_t i = 0;
+
+    // four grid points at once to save loads and stores of rowSum
+    for (; i + 4 <= rowLength; i += 4) {
+      double const *basis0 = lastBasis + i * numParameters;
+      double const *basis1 = basis0 + numParameters;
+      double const *basis2 = basis1 + numParameters;
+      double const *basis3 = basis2 + numParameters;
+
+#pragma omp simd
+      for (size_t p = 0; p < width; ++p) {
+        rowSum[p] += values[i] * basis0[p] + values[i + 1] * basis1[p] +
+                     values[i + 2] * basis2[p] + values[i + 3] * basis3[p];
+      }
+    }
+
+    for (; i < rowLength; ++i) {
+      double const *basis = lastBasis + i * numParameters;
+
+#pragma omp simd
+      for (size_t p = 0; p < width; ++p) {
+        rowSum[p] += values[i] * basis[p];
+      }
+    }
+
+    double const *products = &partialProducts[lastDim * width];
+    double *result = &sum[begin];
+
+#pragma omp simd
+    for (size_t p = 0; p < width; ++p) {
+      result[p] += products[p] * rowSum[p];
+    }
+
+    // move to the next row
+    for (size_t d = lastDim; d-- > 0;) {
+      if (++rowIndex[d] < multiBounds[d]) {
+        firstChangedDim = d;
+        break;
+      }
+      rowIndex[d] = 0;
+    }
+  }
+}
+
+}  // namespace
+
+template <>
+FloatArrayVector FullGridLinearSummationStrategy<FloatArrayVector>::eval(
+    MultiIndex const &level) {
+  CGLOG("FullGridLinearSummationStrategy<FloatArrayVector>::eval(): start");
+  size_t numDimensions = this->evaluators.size();
+  MultiIndex multiBounds(numDimensions);
+  std::vector<bool> orderingConfiguration(numDimensions);
+
+  prepareLevel(level, multiBounds, orderingConfiguration);
+
+  // basis values as contiguous matrices, an array vector with fewer entries is extended by
+  // repeating its last entry (see FloatArrayVector)
+  size_t numParameters = 1;
+  for (size_t d = 0; d < numDimensions; ++d) {
+    for (auto &basisValue : this->basisValues[d]) {
+      numParameters = std::max(numParameters, basisValue.size());
+    }
+  }
+
+  std::vector<std::vector<double>> basisMatrices(numDimensions);
+  for (size_t d = 0; d < numDimensions; ++d) {
+    auto &basisValues = this->basisValues[d];
+    auto &matrix = basisMatrices[d];
+    matrix.resize(basisValues.size() * numParameters, 0.0);
+
+    for (size_t i = 0; i < basisValues.size(); ++i) {
+      size_t size = basisValues[i].size();
+
+      for (size_t p = 0; p < numParameters && size > 0; ++p) {
+        matrix[i * numParameters + p] = basisValues[i][std::min(p, size - 1)].getValue();
+      }
+    }
+  }
+
+  CGLOG("FullGridLinearSummationStrategy<FloatArrayVector>::eval(): gather function values");
+
+  // traverse the storage once
+  MultiIndexIterator it(multiBounds);
+  auto funcIter = this->storage->getGuidedIterator(level, it, orderingConfiguration);
+  std::vector<double> functionValues;
+
+  while (funcIter->isValid()) {
+    functionValues.push_back(funcIter->value());
+
+    if (funcIter->moveToNext() < 0) {
+      break;
+    }
+  }
+
+  if (functionValues.empty()) {  // should not happen
+    return FloatArrayVector::zero();
+  }
+
+  CGLOG("FullGridLinearSummationStrategy<FloatArrayVector>::eval(): sum up");
+
+  std::vector<double> sum(numParameters, 0.0);
+  size_t numBlocks = (numParameters + parameterBlockSize - 1) / parameterBlockSize;
+  bool parallel = numBlocks > 1 && functionValues.size() * numParameters >= minParallelWork;
+
+#pragma omp parallel for schedule(static) if (parallel)
+  for (size_t block = 0; block < numBlocks; ++block) {
+    size_t begin = block * parameterBlockSize;
+    size_t end = std::min(begin + parameterBlockSize, numParameters);
+    addBlockContributions(functionValues, basisMatrices, multiBounds, numParameters, begin, end,
+                          sum);
+  }
+
+  std::vector<FloatScalarVector> result(numParameters);
+  for (size_t p = 0; p < numParameters; ++p) {
+    result[p] = FloatScalarVector(sum[p]);
+  }
+
+  return FloatArrayVector(result);
+}
+
+} /* namespace combigrid */
 } /* namespace sgpp */
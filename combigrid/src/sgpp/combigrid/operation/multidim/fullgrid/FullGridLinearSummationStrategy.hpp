@@ -22,37 +22,18 @@ namespace combigrid {
 
 template <typename V>
 class FullGridLinearSummationStrategy : public AbstractFullGridSummationStrategy<V> {
- public:
+ protected:
   /**
-   * Constructor.
-   *
-   * @param storage Storage that stores and provides the function values for each grid point.
-   * @param evaluatorPrototypes prototype objects for the evaluators that are cloned to get an
-   * evaluator for each dimension and each level.
-   * @param pointHierarchies PointHierarchy objects for each dimension providing the points for each
-   * level and information about their ordering.
+   * Clones the evaluators for the given level if necessary and stores their basis values in
+   * basisValues.
+   * @param level level of the full grid
+   * @param[out] multiBounds number of grid points in each dimension
+   * @param[out] orderingConfiguration whether the evaluator of each dimension needs sorted
+   * (ascending) points
    */
-  FullGridLinearSummationStrategy(
-      std::shared_ptr<AbstractCombigridStorage> storage,
-      std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>> evaluatorPrototypes,
-      std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies)
-      : AbstractFullGridSummationStrategy<V>(storage, evaluatorPrototypes, pointHierarchies) {}
-
-  ~FullGridLinearSummationStrategy() {}
-
-  /**
-   * Evaluates the function given through the storage for a certain level-multi-index (see class
-   * description).
-   * Summation of the form \f$\sum_i \alpha_i basis_i(param) \f$
-   * This is used for interpolation and quadratures
-   */
-  V eval(MultiIndex const &level) override {
-    CGLOG("FullGridTensorEvaluator::eval(): start");
+  void prepareLevel(MultiIndex const &level, MultiIndex &multiBounds,
+                    std::vector<bool> &orderingConfiguration) {
     size_t numDimensions = this->evaluators.size();
-    size_t lastDim = numDimensions - 1;
-    MultiIndex multiBounds(numDimensions);
-    std::vector<bool> orderingConfiguration(numDimensions);
-
     size_t paramIndex = 0;
 
     // the basis coefficients for this level are stored
@@ -90,6 +71,40 @@ class FullGridLinearSummationStrategy : public AbstractFullGridSummationStrategy
         ++paramIndex;
       }
     }
+  }
+
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage Storage that stores and provides the function values for each grid point.
+   * @param evaluatorPrototypes prototype objects for the evaluators that are cloned to get an
+   * evaluator for each dimension and each level.
+   * @param pointHierarchies PointHierarchy objects for each dimension providing the points for each
+   * level and information about their ordering.
+   */
+  FullGridLinearSummationStrategy(
+      std::shared_ptr<AbstractCombigridStorage> storage,
+      std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>> evaluatorPrototypes,
+      std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies)
+      : AbstractFullGridSummationStrategy<V>(storage, evaluatorPrototypes, pointHierarchies) {}
+
+  ~FullGridLinearSummationStrategy() {}
+
+  /**
+   * Evaluates the function given through the storage for a certain level-multi-index (see class
+   * description).
+   * Summation of the form \f$\sum_i \alpha_i basis_i(param) \f$
+   * This is used for interpolation and quadratures
+   */
+  V eval(MultiIndex const &level) override {
+    CGLOG("FullGridTensorEvaluator::eval(): start");
+    size_t numDimensions = this->evaluators.size();
+    size_t lastDim = numDimensions - 1;
+    MultiIndex multiBounds(numDimensions);
+    std::vector<bool> orderingConfiguration(numDimensions);
+
+    prepareLevel(level, multiBounds, orderingConfiguration);
 
     // for efficient computation, the products over the first i evaluator coefficients are stored
     // for all i up to n-1.
@@ -151,5 +166,17 @@ class FullGridLinearSummationStrategy : public AbstractFullGridSummationStrategy
   }
 };
 
+/**
+ * Batched evaluation at multiple parameters. The function values of the level are gathered in one
+ * traversal of the storage, the basis values are copied to one contiguous matrix per dimension
+ * (one row per grid point, one column per parameter). The sum is then computed per block of
+ * parameters: the function values of each row of the grid (along the last dimension) are
+ * multiplied with the basis matrix of the last dimension, scaled by the partial products of the
+ * other dimensions and accumulated. The blocks are processed in parallel with OpenMP for large
+ * problems.
+ */
+template <>
+FloatArrayVector FullGridLinearSummationStrategy<FloatArrayVector>::eval(MultiIndex const &level);
+
 } /* namespace combigrid */
 } /* namespace sgpp */
@@ -0,0 +1,34 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_ABSTRACTBINARYSERIALIZATIONSTRATEGY_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_ABSTRACTBINARYSERIALIZATIONSTRATEGY_HPP_
+
+#include <sgpp/combigrid/serialization/BinaryReader.hpp>
+#include <sgpp/combigrid/serialization/BinaryWriter.hpp>
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * This is an abstract base class for strategies that write objects of type T (template parameter)
+ * to a BinaryWriter and read them from a BinaryReader. In contrast to
+ * AbstractSerializationStrategy, no strings are created, so large objects can be streamed
+ * directly to and from files.
+ */
+template <typename T>
+class AbstractBinarySerializationStrategy {
+ public:
+  virtual ~AbstractBinarySerializationStrategy() {}
+
+  virtual void serialize(T const &value, BinaryWriter &writer) = 0;
+  virtual T deserialize(BinaryReader &reader) = 0;
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_ABSTRACTBINARYSERIALIZATIONSTRATEGY_HPP_ */
@@ -0,0 +1,62 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/combigrid/serialization/BinaryReader.hpp>
+#include <sgpp/combigrid/serialization/BinaryWriter.hpp>
+
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace sgpp {
+namespace combigrid {
+
+BinaryReader::BinaryReader(std::istream &stream) : stream(stream), swapBytes(false) {}
+
+void BinaryReader::readHeader(std::string const &magic) {
+  char expectedMagic[8] = {};
+  char actualMagic[8];
+  magic.copy(expectedMagic, sizeof(expectedMagic));
+  readBytes(actualMagic, sizeof(actualMagic));
+
+  if (std::memcmp(expectedMagic, actualMagic, sizeof(actualMagic)) != 0) {
+    throw std::runtime_error("BinaryReader::readHeader(): the data is not of type " + magic);
+  }
+
+  swapBytes = false;
+  uint32_t version = read<uint32_t>();
+  uint32_t byteOrderMark = read<uint32_t>();
+
+  if (byteOrderMark != BinaryWriter::byteOrderMark) {
+    reverseBytes(byteOrderMark);
+
+    if (byteOrderMark != BinaryWriter::byteOrderMark) {
+      throw std::runtime_error("BinaryReader::readHeader(): invalid byte order mark");
+    }
+
+    swapBytes = true;
+    reverseBytes(version);
+  }
+
+  if (version != BinaryWriter::version) {
+    throw std::runtime_error("BinaryReader::readHeader(): unsupported version " +
+                             std::to_string(version));
+  }
+}
+
+size_t BinaryReader::readSize() {
+  uint64_t size = read<uint64_t>();
+
+  if (size > std::numeric_limits<size_t>::max()) {
+    throw std::runtime_error("BinaryReader::readSize(): size does not fit into size_t");
+  }
+
+  return static_cast<size_t>(size);
+}
+
+bool BinaryReader::hasSwappedByteOrder() const { return swapBytes; }
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
@@ -0,0 +1,108 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYREADER_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYREADER_HPP_
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Reads binary data written by BinaryWriter from a std::istream. If the header read by
+ * readHeader() indicates that the data has been written with a different byte order, the bytes of
+ * all values read afterwards are swapped. The reader takes exactly the bytes it needs from the
+ * stream, so other data may follow in the same stream.
+ */
+class BinaryReader {
+  std::istream &stream;
+  bool swapBytes;
+
+  template <typename T>
+  static void reverseBytes(T &value) {
+    char *bytes = reinterpret_cast<char *>(&value);
+    std::reverse(bytes, bytes + sizeof(T));
+  }
+
+ public:
+  /**
+   * @param stream stream to read from, it has to stay valid as long as this object is used
+   */
+  explicit BinaryReader(std::istream &stream);
+
+  /**
+   * Reads a header written by BinaryWriter::writeHeader() and determines the byte order. Throws a
+   * std::runtime_error if the magic string does not match or the version is unknown.
+   * @param magic expected magic string
+   */
+  void readHeader(std::string const &magic);
+
+  /**
+   * Reads a value of an arithmetic type.
+   */
+  template <typename T>
+  T read() {
+    static_assert(std::is_arithmetic<T>::value, "BinaryReader::read(): T has to be arithmetic");
+    T value;
+    readBytes(&value, sizeof(T));
+
+    if (swapBytes) {
+      reverseBytes(value);
+    }
+
+    return value;
+  }
+
+  /**
+   * Reads an array of values of an arithmetic type into values[0], ..., values[size - 1].
+   */
+  template <typename T>
+  void readArray(T *values, size_t size) {
+    static_assert(std::is_arithmetic<T>::value,
+                  "BinaryReader::readArray(): T has to be arithmetic");
+    readBytes(values, size * sizeof(T));
+
+    if (swapBytes) {
+      for (size_t i = 0; i < size; ++i) {
+        reverseBytes(values[i]);
+      }
+    }
+  }
+
+  /**
+   * Reads a size written by BinaryWriter::writeSize().
+   */
+  size_t readSize();
+
+  /**
+   * Reads raw bytes, throws a std::runtime_error if the stream ends before.
+   */
+  void readBytes(void *data, size_t numBytes) {
+    std::streamsize count = static_cast<std::streamsize>(numBytes);
+
+    if (stream.rdbuf()->sgetn(static_cast<char *>(data), count) != count) {
+      stream.setstate(std::ios::eofbit | std::ios::failbit);
+      throw std::runtime_error("BinaryReader::readBytes(): unexpected end of stream");
+    }
+  }
+
+  /**
+   * @return whether the data has been written with a different byte order
+   */
+  bool hasSwappedByteOrder() const;
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYREADER_HPP_ */
@@ -0,0 +1,32 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYSERIALIZATIONSTRATEGY_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYSERIALIZATIONSTRATEGY_HPP_
+
+#include <sgpp/combigrid/serialization/AbstractBinarySerializationStrategy.hpp>
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Binary serialization strategy for arithmetic types. The value is stored with sizeof(T) bytes, so
+ * floating-point numbers (including infinities and NaN) are restored exactly.
+ */
+template <typename T>
+class BinarySerializationStrategy : public AbstractBinarySerializationStrategy<T> {
+ public:
+  virtual ~BinarySerializationStrategy() {}
+
+  virtual void serialize(T const &value, BinaryWriter &writer) { writer.write(value); }
+
+  virtual T deserialize(BinaryReader &reader) { return reader.read<T>(); }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYSERIALIZATIONSTRATEGY_HPP_ */
@@ -0,0 +1,118 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYTREESTORAGESERIALIZATIONSTRATEGY_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYTREESTORAGESERIALIZATIONSTRATEGY_HPP_
+
+#include <sgpp/combigrid/serialization/AbstractBinarySerializationStrategy.hpp>
+#include <sgpp/combigrid/serialization/BinarySerializationStrategy.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorageLayout.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Binary counterpart of TreeStorageSerializationStrategy. The storage is written as the number of
+ * dimensions and the number of entries, followed by the entries. Each entry consists of its
+ * multi-index (one 32-bit unsigned integer per dimension) and its value, which is written by the
+ * inner strategy. The strategy can be nested (e.g., for TreeStorage<std::shared_ptr<TreeStorage<
+ * double>>>) because every storage carries its own length prefix.
+ */
+template <typename T>
+class BinaryTreeStorageSerializationStrategy
+    : public AbstractBinarySerializationStrategy<std::shared_ptr<TreeStorage<T>>> {
+  std::shared_ptr<AbstractBinarySerializationStrategy<T>> innerStrategy;
+  size_t numDimensions;
+  TreeStorageLayout layout;
+
+  static std::shared_ptr<AbstractBinarySerializationStrategy<T>> getDefaultStrategy() {
+    std::shared_ptr<AbstractBinarySerializationStrategy<T>> ans =
+        std::make_shared<BinarySerializationStrategy<T>>();
+    return ans;
+  }
+
+ public:
+  /**
+   * Constructor. A binary serialization strategy for the type T can be provided, otherwise, a
+   * BinarySerializationStrategy<T> will be used (which requires an arithmetic type T).
+   * @param numDimensions Dimension of the tree storage.
+   * @param innerStrategy Strategy that should be used to serialize the contained objects of the
+   * TreeStorage.
+   * @param layout Memory layout of the deserialized TreeStorage.
+   */
+  BinaryTreeStorageSerializationStrategy(
+      size_t numDimensions,
+      std::shared_ptr<AbstractBinarySerializationStrategy<T>> innerStrategy = getDefaultStrategy(),
+      TreeStorageLayout layout = TreeStorageLayout::TREE)
+      : innerStrategy(innerStrategy), numDimensions(numDimensions), layout(layout) {}
+
+  virtual ~BinaryTreeStorageSerializationStrategy() {}
+
+  virtual void serialize(std::shared_ptr<TreeStorage<T>> const &storage, BinaryWriter &writer) {
+    size_t numEntries = 0;
+    for (auto it = storage->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+      ++numEntries;
+    }
+
+    writer.writeSize(numDimensions);
+    writer.writeSize(numEntries);
+
+    std::vector<uint32_t> index(numDimensions);
+
+    for (auto it = storage->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+      auto multiIndex = it->getMultiIndex();
+
+      for (size_t d = 0; d < numDimensions; ++d) {
+        if (multiIndex[d] > std::numeric_limits<uint32_t>::max()) {
+          throw std::runtime_error(
+              "BinaryTreeStorageSerializationStrategy::serialize(): index too large");
+        }
+
+        index[d] = static_cast<uint32_t>(multiIndex[d]);
+      }
+
+      writer.writeArray(index.data(), numDimensions);
+      innerStrategy->serialize(it->value(), writer);
+    }
+  }
+
+  virtual std::shared_ptr<TreeStorage<T>> deserialize(BinaryReader &reader) {
+    if (reader.readSize() != numDimensions) {
+      throw std::runtime_error(
+          "BinaryTreeStorageSerializationStrategy::deserialize(): wrong number of dimensions");
+    }
+
+    size_t numEntries = reader.readSize();
+    auto storage = std::make_shared<TreeStorage<T>>(numDimensions, layout);
+
+    std::vector<uint32_t> index(numDimensions);
+    MultiIndex multiIndex(numDimensions);
+
+    for (size_t i = 0; i < numEntries; ++i) {
+      reader.readArray(index.data(), numDimensions);
+
+      for (size_t d = 0; d < numDimensions; ++d) {
+        multiIndex[d] = index[d];
+      }
+
+      storage->set(multiIndex, innerStrategy->deserialize(reader));
+    }
+
+    return storage;
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYTREESTORAGESERIALIZATIONSTRATEGY_HPP_ */
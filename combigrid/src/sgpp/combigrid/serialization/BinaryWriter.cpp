@@ -0,0 +1,27 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/combigrid/serialization/BinaryWriter.hpp>
+
+#include <string>
+
+namespace sgpp {
+namespace combigrid {
+
+const uint32_t BinaryWriter::version = 1;
+const uint32_t BinaryWriter::byteOrderMark = 0x01020304;
+
+BinaryWriter::BinaryWriter(std::ostream &stream) : stream(stream) {}
+
+void BinaryWriter::writeHeader(std::string const &magic) {
+  char paddedMagic[8] = {};
+  magic.copy(paddedMagic, sizeof(paddedMagic));
+  writeBytes(paddedMagic, sizeof(paddedMagic));
+  write(version);
+  write(byteOrderMark);
+}
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
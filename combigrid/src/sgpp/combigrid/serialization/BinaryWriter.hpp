@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYWRITER_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYWRITER_HPP_
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Writes binary data in the byte order of this machine to a std::ostream, e.g., a std::ofstream
+ * opened with std::ios::binary. The data is passed directly to the buffer of the stream, so no
+ * intermediate copies are made.
+ *
+ * The binary format starts with a header (see writeHeader()) consisting of an 8-byte magic string
+ * that identifies the content, a version and a byte order mark, such that BinaryReader can read
+ * files written on machines with a different byte order. Sizes are written as 64-bit unsigned
+ * integers (see writeSize()) and precede the data they refer to.
+ */
+class BinaryWriter {
+  std::ostream &stream;
+
+ public:
+  static const uint32_t version;
+  static const uint32_t byteOrderMark;
+
+  /**
+   * @param stream stream to write to, it has to stay valid as long as this object is used
+   */
+  explicit BinaryWriter(std::ostream &stream);
+
+  /**
+   * Writes the header.
+   * @param magic string identifying the content, only the first 8 characters are used (shorter
+   * strings are padded with zeros)
+   */
+  void writeHeader(std::string const &magic);
+
+  /**
+   * Writes a value of an arithmetic type (integers and floating-point numbers).
+   */
+  template <typename T>
+  void write(T const &value) {
+    static_assert(std::is_arithmetic<T>::value, "BinaryWriter::write(): T has to be arithmetic");
+    writeBytes(&value, sizeof(T));
+  }
+
+  /**
+   * Writes an array of values of an arithmetic type, without its size.
+   */
+  template <typename T>
+  void writeArray(T const *values, size_t size) {
+    static_assert(std::is_arithmetic<T>::value,
+                  "BinaryWriter::writeArray(): T has to be arithmetic");
+    writeBytes(values, size * sizeof(T));
+  }
+
+  /**
+   * Writes a size or length prefix as a 64-bit unsigned integer.
+   */
+  void writeSize(size_t size) { write(static_cast<uint64_t>(size)); }
+
+  /**
+   * Writes raw bytes, throws a std::runtime_error if the stream does not accept all of them.
+   */
+  void writeBytes(void const *data, size_t numBytes) {
+    std::streamsize count = static_cast<std::streamsize>(numBytes);
+
+    if (stream.rdbuf()->sputn(static_cast<char const *>(data), count) != count) {
+      stream.setstate(std::ios::badbit);
+      throw std::runtime_error("BinaryWriter::writeBytes(): cannot write to stream");
+    }
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYWRITER_HPP_ */
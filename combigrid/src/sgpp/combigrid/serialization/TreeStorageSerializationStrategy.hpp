@@ -10,6 +10,7 @@
 #include <sgpp/combigrid/serialization/AbstractSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/DefaultSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorageLayout.hpp>
 #include <sgpp/combigrid/utils/Utils.hpp>
 #include <sgpp/globaldef.hpp>
 
@@ -29,6 +30,7 @@ class TreeStorageSerializationStrategy
     : public AbstractSerializationStrategy<std::shared_ptr<TreeStorage<T>>> {
   std::shared_ptr<AbstractSerializationStrategy<T>> innerStrategy;
   size_t numDimensions;
+  TreeStorageLayout layout;
 
   static std::shared_ptr<AbstractSerializationStrategy<T>> getDefaultStrategy() {
     std::shared_ptr<AbstractSerializationStrategy<T>> ans =
@@ -44,11 +46,13 @@ class TreeStorageSerializationStrategy
    * @param numDimensions Dimension of the tree storage.
    * @param innerStrategy Strategy that should be used to serialize the contained objects of the
    * TreeStorage.
+   * @param layout Memory layout of the deserialized TreeStorage.
    */
   TreeStorageSerializationStrategy(
       size_t numDimensions,
-      std::shared_ptr<AbstractSerializationStrategy<T>> innerStrategy = getDefaultStrategy())
-      : innerStrategy(innerStrategy), numDimensions(numDimensions) {}
+      std::shared_ptr<AbstractSerializationStrategy<T>> innerStrategy = getDefaultStrategy(),
+      TreeStorageLayout layout = TreeStorageLayout::TREE)
+      : innerStrategy(innerStrategy), numDimensions(numDimensions), layout(layout) {}
 
   virtual ~TreeStorageSerializationStrategy() {}
 
@@ -74,7 +78,7 @@ class TreeStorageSerializationStrategy
   }
 
   virtual std::shared_ptr<TreeStorage<T>> deserialize(std::string const &input) {
-    auto storage = std::make_shared<TreeStorage<T>>(numDimensions);
+    auto storage = std::make_shared<TreeStorage<T>>(numDimensions, layout);
 
     DefaultSerializationStrategy<size_t> indexStrategy;
 
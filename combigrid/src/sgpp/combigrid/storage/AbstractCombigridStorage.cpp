@@ -5,10 +5,39 @@
 
 #include "AbstractCombigridStorage.hpp"
 
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
 namespace sgpp {
 namespace combigrid {
 
 AbstractCombigridStorage::~AbstractCombigridStorage() {}
 
+void AbstractCombigridStorage::saveBinary(std::string const &filename) {
+  std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+
+  if (!stream) {
+    throw std::runtime_error("AbstractCombigridStorage::saveBinary(): cannot open " + filename);
+  }
+
+  writeBinary(stream);
+  stream.close();
+
+  if (!stream) {
+    throw std::runtime_error("AbstractCombigridStorage::saveBinary(): cannot write " + filename);
+  }
+}
+
+void AbstractCombigridStorage::loadBinary(std::string const &filename) {
+  std::ifstream stream(filename, std::ios::binary);
+
+  if (!stream) {
+    throw std::runtime_error("AbstractCombigridStorage::loadBinary(): cannot open " + filename);
+  }
+
+  readBinary(stream);
+}
+
 } /* namespace combigrid */
 } /* namespace sgpp*/
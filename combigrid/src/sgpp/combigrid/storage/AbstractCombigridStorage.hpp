@@ -10,8 +10,10 @@
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
 
+#include <istream>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -59,6 +61,27 @@ class AbstractCombigridStorage {
    */
   virtual void deserialize(std::string const &str) = 0;
 
+  /**
+   * Writes all stored values in a binary format (see BinaryWriter) to the stream. This is much
+   * faster and more compact than serialize() and does not build the data in memory.
+   */
+  virtual void writeBinary(std::ostream &stream) = 0;
+
+  /**
+   * Replaces the stored values by those read from a stream written by writeBinary().
+   */
+  virtual void readBinary(std::istream &stream) = 0;
+
+  /**
+   * Writes the stored values with writeBinary() to a file, replacing the file if it exists.
+   */
+  void saveBinary(std::string const &filename);
+
+  /**
+   * Re-loads the stored values from a file written by saveBinary().
+   */
+  void loadBinary(std::string const &filename);
+
   /**
    * Sets a value at the given level-index pair, creating a new entry if no value had been
    * previously stored at this level-index pair.
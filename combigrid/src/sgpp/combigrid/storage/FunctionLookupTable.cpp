@@ -3,91 +3,404 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/tools/FileReplacement.hpp>
 #include <sgpp/combigrid/serialization/DefaultSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/FunctionLookupTable.hpp>
-#include <sgpp/combigrid/utils/DataVectorHashing.hpp>
 #include <sgpp/combigrid/utils/Utils.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <list>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+const size_t maxNumShards = 64;
+
+/**
+ * Header of the binary format: magic string, version and a byte order mark. The header is followed
+ * by the entries, each consisting of the dimension (uint32_t), the parameter and the value.
+ */
+const char binaryMagic[8] = {'S', 'G', 'P', 'P', 'F', 'L', 'T', '\0'};
+const uint32_t binaryVersion = 1;
+const uint32_t binaryByteOrderMark = 0x01020304;
+
+/**
+ * Hash of the bit patterns of the entries of a DataVector.
+ */
+class BitwiseDataVectorHash {
+ public:
+  size_t operator()(base::DataVector const &vec) const {
+    uint64_t result = 0x9E3779B97F4A7C15ull ^ vec.getSize();
+    for (size_t i = 0; i < vec.getSize(); ++i) {
+      uint64_t bits;
+      std::memcpy(&bits, &vec[i], sizeof(bits));
+      result = (result ^ bits) * 0xFF51AFD7ED558CCDull;
+      result ^= result >> 32;
+    }
+    return static_cast<size_t>(result);
+  }
+};
+
+/**
+ * Compares DataVectors by the bit patterns of their entries.
+ */
+class BitwiseDataVectorEqualTo {
+ public:
+  bool operator()(base::DataVector const &first, base::DataVector const &second) const {
+    return first.getSize() == second.getSize() &&
+           (first.getSize() == 0 || std::memcmp(first.getPointer(), second.getPointer(),
+                                                first.getSize() * sizeof(double)) == 0);
+  }
+};
+
+/**
+ * Result of a function evaluation that is still running.
+ */
+struct PendingValue {
+  std::promise<double> promise;
+  std::shared_future<double> future;
+
+  PendingValue() : promise(), future(promise.get_future().share()) {}
+};
+
+struct TableEntry {
+  double value;
+  /**
+   * not nullptr while the value is computed
+   */
+  std::shared_ptr<PendingValue> pending;
+  /**
+   * position in the LRU list of the shard (only valid if pending is nullptr)
+   */
+  std::list<base::DataVector const *>::iterator lruPosition;
+
+  TableEntry() : value(0.0), pending(), lruPosition() {}
+};
+
+struct Shard {
+  std::mutex mutex;
+  std::unordered_map<base::DataVector, TableEntry, BitwiseDataVectorHash, BitwiseDataVectorEqualTo>
+      entries;
+  /**
+   * keys of the entries with a value, the most recently used first
+   */
+  std::list<base::DataVector const *> lru;
+};
+
+void writeEntry(std::ostream &stream, base::DataVector const &x, double y) {
+  uint32_t dim = static_cast<uint32_t>(x.getSize());
+  stream.write(reinterpret_cast<char const *>(&dim), sizeof(dim));
+  if (dim > 0) {
+    stream.write(reinterpret_cast<char const *>(x.getPointer()), dim * sizeof(double));
+  }
+  stream.write(reinterpret_cast<char const *>(&y), sizeof(y));
+}
+
+void writeHeader(std::ostream &stream) {
+  stream.write(binaryMagic, sizeof(binaryMagic));
+  stream.write(reinterpret_cast<char const *>(&binaryVersion), sizeof(binaryVersion));
+  stream.write(reinterpret_cast<char const *>(&binaryByteOrderMark), sizeof(binaryByteOrderMark));
+}
+
+/**
+ * @return false if the stream is empty, throws if the header is invalid
+ */
+bool readHeader(std::istream &stream, std::string const &filename) {
+  char magic[sizeof(binaryMagic)];
+  uint32_t version = 0;
+  uint32_t byteOrderMark = 0;
+  stream.read(magic, sizeof(magic));
+
+  if (stream.gcount() == 0) {
+    return false;
+  }
+
+  stream.read(reinterpret_cast<char *>(&version), sizeof(version));
+  stream.read(reinterpret_cast<char *>(&byteOrderMark), sizeof(byteOrderMark));
+
+  if (!stream || std::memcmp(magic, binaryMagic, sizeof(magic)) != 0) {
+    throw std::runtime_error("FunctionLookupTable: " + filename +
+                             " is not a binary function lookup table");
+  }
+
+  if (version != binaryVersion || byteOrderMark != binaryByteOrderMark) {
+    throw std::runtime_error("FunctionLookupTable: " + filename +
+                             " has an unsupported version or byte order");
+  }
+
+  return true;
+}
+
+/**
+ * Reads the entries following the header up to the end of the stream or up to an incomplete last
+ * entry.
+ *
+ * @return the position after the last complete entry
+ */
+std::streamoff readEntries(std::istream &stream, std::streamoff fileSize,
+                           std::function<void(base::DataVector const &, double)> const &store) {
+  std::streamoff end = stream.tellg();
+
+  while (true) {
+    uint32_t dim = 0;
+    stream.read(reinterpret_cast<char *>(&dim), sizeof(dim));
+
+    if (stream.gcount() != sizeof(dim) ||
+        static_cast<uint64_t>(fileSize - stream.tellg()) <
+            (static_cast<uint64_t>(dim) + 1) * sizeof(double)) {
+      break;
+    }
+
+    base::DataVector x(dim);
+    double y = 0.0;
+    if (dim > 0) {
+      stream.read(reinterpret_cast<char *>(x.getPointer()), dim * sizeof(double));
+    }
+    stream.read(reinterpret_cast<char *>(&y), sizeof(y));
+
+    if (!stream) {
+      break;
+    }
+
+    store(x, y);
+    end = stream.tellg();
+  }
+
+  return end;
+}
+
+/**
+ * Cuts an incomplete last entry off the file. The file is replaced by a copy of the complete
+ * entries, so that they survive if the process is interrupted meanwhile.
+ */
+void truncateFile(std::string const &filename, std::streamoff size) {
+  std::ifstream in(filename, std::ios::binary);
+
+  base::FileReplacement::replace(filename, [&in, size](std::ostream &out) mutable {
+    std::vector<char> buffer(1 << 16);
+
+    while (size > 0 && in && out) {
+      std::streamsize chunk =
+          static_cast<std::streamsize>(std::min<std::streamoff>(size, buffer.size()));
+      in.read(buffer.data(), chunk);
+      out.write(buffer.data(), in.gcount());
+      size -= in.gcount();
+    }
+
+    if (size > 0) {
+      throw std::runtime_error("FunctionLookupTable: cannot repair file");
+    }
+  });
+}
+
+}  // namespace
+
 /**
  * Helper to realize the PIMPL pattern
  */
 struct FunctionLookupTableImpl {
-  std::shared_ptr<std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo>>
-      hashmap;
   MultiFunction func;
-  std::recursive_mutex tableMutex;
+  size_t capacity;
+  std::vector<std::unique_ptr<Shard>> shards;
+  /**
+   * maximum number of values per shard, 0 means no limit
+   */
+  size_t shardCapacity;
+
+  std::mutex appendMutex;
+  std::unique_ptr<std::ofstream> appendStream;
+
+  FunctionLookupTableImpl(MultiFunction func, size_t capacity)
+      : func(func), capacity(capacity), shards(), shardCapacity(0), appendMutex(), appendStream() {
+    // with a bound, use fewer shards such that every shard holds a reasonable number of values
+    size_t numShards = maxNumShards;
+    while (capacity > 0 && numShards > 1 && capacity / numShards < 16) {
+      numShards /= 2;
+    }
+
+    for (size_t i = 0; i < numShards; ++i) {
+      shards.emplace_back(new Shard());
+    }
+
+    shardCapacity = capacity / numShards;
+  }
+
+  Shard &getShard(base::DataVector const &x) {
+    // the low bits are used for the buckets of the hashtables
+    uint64_t hash = BitwiseDataVectorHash()(x);
+    return *shards[(hash >> 48) % shards.size()];
+  }
 
-  explicit FunctionLookupTableImpl(MultiFunction func) : func(func), tableMutex() {
-    hashmap = std::make_shared<
-        std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo>>();
+  /**
+   * Marks the entry as the most recently used one (needs the lock of the shard).
+   */
+  void touch(Shard &shard, TableEntry &entry) {
+    shard.lru.splice(shard.lru.begin(), shard.lru, entry.lruPosition);
+  }
+
+  /**
+   * Stores the value of an entry that has no value yet and evicts the least recently used entries
+   * if necessary (needs the lock of the shard).
+   */
+  void setValue(Shard &shard,
+                std::unordered_map<base::DataVector, TableEntry, BitwiseDataVectorHash,
+                                   BitwiseDataVectorEqualTo>::iterator it,
+                double y) {
+    it->second.value = y;
+    it->second.pending = nullptr;
+    shard.lru.push_front(&it->first);
+    it->second.lruPosition = shard.lru.begin();
+
+    while (shardCapacity > 0 && shard.lru.size() > shardCapacity) {
+      auto evicted = shard.entries.find(*shard.lru.back());
+      shard.lru.pop_back();
+      shard.entries.erase(evicted);
+    }
+  }
+
+  /**
+   * Stores a value, replacing an existing one.
+   */
+  void store(base::DataVector const &x, double y) {
+    Shard &shard = getShard(x);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto it = shard.entries.find(x);
+
+    if (it == shard.entries.end()) {
+      setValue(shard, shard.entries.emplace(x, TableEntry()).first, y);
+    } else if (it->second.pending != nullptr) {
+      // the thread that computes the value will not overwrite it
+      setValue(shard, it, y);
+    } else {
+      it->second.value = y;
+      touch(shard, it->second);
+    }
+  }
+
+  void append(base::DataVector const &x, double y) {
+    std::lock_guard<std::mutex> guard(appendMutex);
+
+    if (appendStream != nullptr) {
+      writeEntry(*appendStream, x, y);
+    }
+  }
+
+  template <typename F>
+  void forEachEntry(F f) {
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> guard(shard->mutex);
+
+      for (auto &entry : shard->entries) {
+        if (entry.second.pending == nullptr) {
+          f(entry.first, entry.second.value);
+        }
+      }
+    }
   }
 };
 
-FunctionLookupTable::FunctionLookupTable(MultiFunction const& func)
-    : impl(std::make_shared<FunctionLookupTableImpl>(func)) {}
+FunctionLookupTable::FunctionLookupTable(MultiFunction const &func, size_t capacity)
+    : impl(std::make_shared<FunctionLookupTableImpl>(func, capacity)) {}
+
+double FunctionLookupTable::operator()(const base::DataVector &x) { return evalThreadsafe(x); }
 
-double FunctionLookupTable::operator()(const base::DataVector& x) {
-  auto it = impl->hashmap->find(x);
-  if (it == impl->hashmap->end()) {
-    auto y = impl->func(x);
-    addEntry(x, y);
-    return y;
+double FunctionLookupTable::eval(const base::DataVector &x) { return evalThreadsafe(x); }
+
+double FunctionLookupTable::evalThreadsafe(const base::DataVector &x) {
+  Shard &shard = impl->getShard(x);
+  std::shared_ptr<PendingValue> pending;
+  bool computeValue = false;
+
+  {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto it = shard.entries.find(x);
+
+    if (it == shard.entries.end()) {
+      it = shard.entries.emplace(x, TableEntry()).first;
+      it->second.pending = std::make_shared<PendingValue>();
+      computeValue = true;
+    } else if (it->second.pending == nullptr) {
+      impl->touch(shard, it->second);
+      return it->second.value;
+    }
+
+    pending = it->second.pending;
   }
 
-  return it->second;
-}
+  if (!computeValue) {
+    // another thread computes the value
+    return pending->future.get();
+  }
 
-double FunctionLookupTable::eval(const base::DataVector& x) { return (*this)(x); }
+  double y;
+
+  try {
+    y = impl->func(x);
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      auto it = shard.entries.find(x);
+      if (it != shard.entries.end() && it->second.pending == pending) {
+        shard.entries.erase(it);
+      }
+    }
 
-double FunctionLookupTable::evalThreadsafe(const base::DataVector& x) {
-  impl->tableMutex.lock();
-  auto it = impl->hashmap->find(x);
-  if (it == impl->hashmap->end()) {
-    impl->tableMutex.unlock();
-    auto y = impl->func(x);
-    impl->tableMutex.lock();
-    addEntry(x, y);
-    impl->tableMutex.unlock();
-    return y;
+    pending->promise.set_exception(std::current_exception());
+    throw;
   }
 
-  std::lock_guard<std::recursive_mutex> guard(impl->tableMutex);
-  auto y = it->second;
-  impl->tableMutex.unlock();
+  {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto it = shard.entries.find(x);
+
+    // addEntry() may have stored a value in the meantime
+    if (it != shard.entries.end() && it->second.pending == pending) {
+      impl->setValue(shard, it, y);
+    }
+  }
+
+  impl->append(x, y);
+  pending->promise.set_value(y);
   return y;
 }
 
-void FunctionLookupTable::addEntry(const base::DataVector& x, double y) { (*impl->hashmap)[x] = y; }
+void FunctionLookupTable::addEntry(const base::DataVector &x, double y) {
+  impl->store(x, y);
+  impl->append(x, y);
+}
 
 std::string FunctionLookupTable::serialize() {
   FloatSerializationStrategy<double> strategy;
 
   std::vector<std::string> entries;
 
-  for (auto it = impl->hashmap->begin(); it != impl->hashmap->end(); ++it) {
+  impl->forEachEntry([&strategy, &entries](base::DataVector const &vec, double y) {
     std::vector<std::string> vectorEntries;
 
-    auto& vec = it->first;
-
     for (size_t i = 0; i < vec.getSize(); ++i) {
       vectorEntries.push_back(strategy.serialize(vec[i]));
     }
 
-    entries.push_back(join(vectorEntries, ", ") + " -> " + strategy.serialize(it->second));
-  }
+    entries.push_back(join(vectorEntries, ", ") + " -> " + strategy.serialize(y));
+  });
 
   return join(entries, "\n");
 }
 
-void FunctionLookupTable::deserialize(const std::string& value) {
+void FunctionLookupTable::deserialize(const std::string &value) {
   FloatSerializationStrategy<double> strategy;
 
   std::vector<std::string> entries = split(value, "\n");
@@ -117,16 +430,117 @@ void FunctionLookupTable::deserialize(const std::string& value) {
 
     double y = strategy.deserialize(keyValuePair[1]);
 
-    addEntry(x, y);
+    impl->store(x, y);
   }
 }
 
-bool FunctionLookupTable::containsEntry(const base::DataVector& x) {
-  auto it = impl->hashmap->find(x);
-  return it != impl->hashmap->end();
+void FunctionLookupTable::saveBinary(std::string const &filename) const {
+  std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+
+  if (!stream) {
+    throw std::runtime_error("FunctionLookupTable::saveBinary(): cannot open " + filename);
+  }
+
+  writeHeader(stream);
+  impl->forEachEntry(
+      [&stream](base::DataVector const &x, double y) { writeEntry(stream, x, y); });
+
+  if (!stream) {
+    throw std::runtime_error("FunctionLookupTable::saveBinary(): cannot write " + filename);
+  }
+}
+
+void FunctionLookupTable::loadBinary(std::string const &filename) {
+  // pick up the repaired file if a run was interrupted while repairing it
+  base::FileReplacement::recover(filename);
+
+  std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+
+  if (!stream) {
+    throw std::runtime_error("FunctionLookupTable::loadBinary(): cannot open " + filename);
+  }
+
+  std::streamoff fileSize = stream.tellg();
+  stream.seekg(0);
+
+  if (!readHeader(stream, filename)) {
+    return;
+  }
+
+  readEntries(stream, fileSize,
+              [this](base::DataVector const &x, double y) { impl->store(x, y); });
+}
+
+void FunctionLookupTable::appendEntriesTo(std::string const &filename) {
+  bool hasHeader = false;
+  base::FileReplacement::recover(filename);
+
+  {
+    std::ifstream existing(filename, std::ios::binary | std::ios::ate);
+
+    if (existing) {
+      std::streamoff fileSize = existing.tellg();
+      existing.seekg(0);
+      hasHeader = readHeader(existing, filename);
+
+      // new entries must not be appended to an incomplete entry of an interrupted run
+      if (hasHeader) {
+        std::streamoff end =
+            readEntries(existing, fileSize, [](base::DataVector const &, double) {});
+
+        if (end < fileSize) {
+          existing.close();
+          truncateFile(filename, end);
+        }
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(impl->appendMutex);
+  impl->appendStream.reset(new std::ofstream(filename, std::ios::binary | std::ios::app));
+
+  if (!*impl->appendStream) {
+    impl->appendStream.reset();
+    throw std::runtime_error("FunctionLookupTable::appendEntriesTo(): cannot open " + filename);
+  }
+
+  if (!hasHeader) {
+    writeHeader(*impl->appendStream);
+  }
+}
+
+void FunctionLookupTable::flushAppendedEntries() {
+  std::lock_guard<std::mutex> guard(impl->appendMutex);
+
+  if (impl->appendStream != nullptr) {
+    impl->appendStream->flush();
+  }
+}
+
+void FunctionLookupTable::stopAppendingEntries() {
+  std::lock_guard<std::mutex> guard(impl->appendMutex);
+  impl->appendStream.reset();
+}
+
+bool FunctionLookupTable::containsEntry(const base::DataVector &x) {
+  Shard &shard = impl->getShard(x);
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  auto it = shard.entries.find(x);
+  return it != shard.entries.end() && it->second.pending == nullptr;
+}
+
+size_t FunctionLookupTable::getNumEntries() const {
+  size_t numEntries = 0;
+
+  for (auto &shard : impl->shards) {
+    std::lock_guard<std::mutex> guard(shard->mutex);
+    numEntries += shard->lru.size();
+  }
+
+  return numEntries;
 }
 
-size_t FunctionLookupTable::getNumEntries() const { return impl->hashmap->size(); }
+size_t FunctionLookupTable::getCapacity() const { return impl->capacity; }
 
 MultiFunction FunctionLookupTable::toMultiFunction() const { return MultiFunction(*this); }
 
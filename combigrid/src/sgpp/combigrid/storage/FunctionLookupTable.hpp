@@ -24,13 +24,27 @@ struct FunctionLookupTableImpl;
 /**
  * This class wraps a MultiFunction and stores computed values using a hashtable to avoid
  * reevaluating a function at points where it already has been evaluated. This means that only the
- * exact same parameter will allow retrieving the function value.
+ * exact same parameter will allow retrieving the function value: the parameters are compared by
+ * the bit patterns of their entries (so 0.0 and -0.0 are different parameters).
+ *
+ * All methods are thread-safe. The table is split into shards with separate locks, which are not
+ * held while the function is evaluated. If several threads request the same new parameter
+ * concurrently, the function is evaluated only once and the other threads wait for the result.
+ *
+ * Optionally, the number of stored values is bounded. Then, the least recently used values are
+ * evicted (for each shard separately) when new values are stored.
+ *
+ * Copies of a FunctionLookupTable share the stored values.
  */
 class FunctionLookupTable {
   std::shared_ptr<FunctionLookupTableImpl> impl;
 
  public:
-  explicit FunctionLookupTable(MultiFunction const &func);
+  /**
+   * @param func function whose values are stored
+   * @param capacity maximum number of stored values, 0 means no limit
+   */
+  explicit FunctionLookupTable(MultiFunction const &func, size_t capacity = 0);
 
   /**
    * Evaluates the function at the point x. If the function has already been evaluated at this
@@ -44,9 +58,9 @@ class FunctionLookupTable {
   double eval(base::DataVector const &x);
 
   /**
-   * Does the same as eval(), but uses a mutex whenever the hashtable is accessed. Crucially, the
-   * mutex is not locked when evaluating the function, such that multiple function evaluations can
-   * be done in parallel.
+   * Does the same as eval(). It is kept for compatibility, since all methods are thread-safe now.
+   * The locks are not held when evaluating the function, such that multiple function evaluations
+   * can be done in parallel.
    */
   double evalThreadsafe(base::DataVector const &x);
 
@@ -72,11 +86,47 @@ class FunctionLookupTable {
    */
   void deserialize(std::string const &value);
 
+  /**
+   * Stores the stored values into a binary file (in the byte order of this machine), replacing
+   * the file if it exists. This is much faster and more compact than serialize().
+   */
+  void saveBinary(std::string const &filename) const;
+
+  /**
+   * Retrieves stored values from a binary file written by saveBinary() or appendEntriesTo(). An
+   * incomplete last entry, e.g., from an interrupted run, is ignored.
+   */
+  void loadBinary(std::string const &filename);
+
+  /**
+   * From now on, every newly computed or added function value is appended to the given binary
+   * file, which can be read by loadBinary(). If the file does not exist or is empty, the header is
+   * written first. An incomplete last entry of the file is removed before appending.
+   * Values that are already stored or that are loaded later are not written.
+   * The entries are buffered, call flushAppendedEntries() to make sure that they are written.
+   */
+  void appendEntriesTo(std::string const &filename);
+
+  /**
+   * Writes the entries that are buffered for appendEntriesTo() to the file.
+   */
+  void flushAppendedEntries();
+
+  /**
+   * Stops appending entries to the file given to appendEntriesTo() and closes it.
+   */
+  void stopAppendingEntries();
+
   /**
    * @return the number of stored function values.
    */
   size_t getNumEntries() const;
 
+  /**
+   * @return the maximum number of stored function values, 0 means no limit
+   */
+  size_t getCapacity() const;
+
   /**
    * This is a convenience function that is especially nice for python code.
    * @return a MultiFunction object that delegates each call to this FunctionLookupTable.
@@ -0,0 +1,263 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGE_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGE_HPP_
+
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
+#include <sgpp/combigrid/storage/flat/FullGridStorageGuidedIterator.hpp>
+#include <sgpp/combigrid/storage/flat/FullGridStorageStoredDataIterator.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Storage for the values on a full grid: all values are stored in one contiguous block that covers
+ * the bounding box of the stored multi-indices, in row-major order (the last dimension is
+ * contiguous). The position of a multi-index is computed with strides, so there are no pointers to
+ * follow, and a guided iteration through a full grid traverses the block linearly.
+ *
+ * When a multi-index outside of the bounding box is accessed, the block is reallocated with the
+ * enlarged bounding box. Guided iterators reserve the block for their bounds right away. For
+ * sparse index sets, the memory grows with the bounding box, use HashStorage instead.
+ *
+ * Like in the TreeStorage, references to values may be invalidated when new values are added.
+ * For more information see AbstractMultiStorage.
+ */
+template <typename T>
+class FullGridStorage : public AbstractMultiStorage<T> {
+ public:
+  typedef std::function<T(MultiIndex const &)> function_type;
+
+ private:
+  size_t numDimensions;
+  function_type func;
+  MultiIndex extents;
+  MultiIndex strides;
+  std::vector<T> values;
+  std::vector<StorageStatus> status;
+  size_t generation;
+
+  FullGridStorage(FullGridStorage<T> const &) = delete;
+
+  static size_t computeStrides(MultiIndex const &extents, MultiIndex &strides) {
+    size_t size = 1;
+    strides.resize(extents.size());
+
+    for (size_t d = extents.size(); d-- > 0;) {
+      strides[d] = size;
+      size *= extents[d];
+    }
+
+    return size;
+  }
+
+  /**
+   * Reallocates the block for the given (larger) bounding box and moves the stored values.
+   */
+  void grow(MultiIndex const &newExtents) {
+    MultiIndex newStrides;
+    size_t newSize = computeStrides(newExtents, newStrides);
+    std::vector<T> newValues(newSize);
+    std::vector<StorageStatus> newStatus(newSize, StorageStatus::NOT_STORED);
+
+    if (!values.empty()) {
+      // the rows along the last dimension are contiguous in both blocks
+      size_t lastDim = numDimensions - 1;
+      size_t rowLength = extents[lastDim];
+      size_t numRows = values.size() / rowLength;
+      MultiIndex rowIndex(numDimensions, 0);
+
+      for (size_t row = 0; row < numRows; ++row) {
+        size_t oldOffset = row * rowLength;
+        size_t newOffset = 0;
+
+        for (size_t d = 0; d < lastDim; ++d) {
+          newOffset += rowIndex[d] * newStrides[d];
+        }
+
+        std::move(values.begin() + oldOffset, values.begin() + oldOffset + rowLength,
+                  newValues.begin() + newOffset);
+        std::copy(status.begin() + oldOffset, status.begin() + oldOffset + rowLength,
+                  newStatus.begin() + newOffset);
+
+        for (size_t d = lastDim; d-- > 0;) {
+          if (++rowIndex[d] < extents[d]) {
+            break;
+          }
+          rowIndex[d] = 0;
+        }
+      }
+    }
+
+    extents = newExtents;
+    strides.swap(newStrides);
+    values.swap(newValues);
+    status.swap(newStatus);
+    ++generation;
+  }
+
+  /**
+   * @return the position of the given multi-index, the block is enlarged if necessary
+   */
+  size_t ensureOffset(MultiIndex const &index) {
+    if (index.size() != numDimensions) {
+      throw std::runtime_error("FullGridStorage: index.size() != numDimensions");
+    }
+
+    if (!isInside(index)) {
+      MultiIndex newExtents(extents);
+
+      for (size_t d = 0; d < numDimensions; ++d) {
+        newExtents[d] = std::max(newExtents[d], index[d] + 1);
+      }
+
+      grow(newExtents);
+    }
+
+    return getOffset(index);
+  }
+
+ public:
+  /**
+   * Constructor.
+   * @param numDimensions number of dimensions of the multi-indices that the storage is addressed
+   * with
+   * @param func "Default-value-function" that is called to compute entries that are not already
+   * stored (see TreeStorage).
+   */
+  explicit FullGridStorage(size_t numDimensions,
+                           function_type func = multiIndexToDefaultValue<T>())
+      : numDimensions(numDimensions),
+        func(func),
+        extents(numDimensions, 0),
+        strides(),
+        values(),
+        status(),
+        generation(0) {
+    size_t size = computeStrides(extents, strides);
+    values.resize(size);
+    status.resize(size, StorageStatus::NOT_STORED);
+  }
+
+  virtual ~FullGridStorage() {}
+
+  virtual size_t getNumDimensions() const { return numDimensions; }
+
+  virtual T &get(MultiIndex const &index) {
+    size_t offset = ensureOffset(index);
+
+    if (status[offset] != StorageStatus::STORED) {
+      values[offset] = func(index);
+      status[offset] = StorageStatus::STORED;
+    }
+
+    return values[offset];
+  }
+
+  virtual void set(MultiIndex const &index, T const &value) {
+    size_t offset = ensureOffset(index);
+    values[offset] = value;
+    status[offset] = StorageStatus::STORED;
+  }
+
+  virtual bool containsIndex(MultiIndex const &index) const {
+    return index.size() == numDimensions && isInside(index) &&
+           status[getOffset(index)] == StorageStatus::STORED;
+  }
+
+  /**
+   * Changes the function that generates the entries.
+   */
+  void setFunc(function_type newFunc) { func = newFunc; }
+
+  function_type const &getFunc() const { return func; }
+
+  /**
+   * Enlarges the block such that it contains all multi-indices below the given bounds.
+   */
+  void reserve(MultiIndex const &bounds) {
+    MultiIndex newExtents(extents);
+    bool enlarge = false;
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      if (bounds[d] > newExtents[d]) {
+        newExtents[d] = bounds[d];
+        enlarge = true;
+      }
+    }
+
+    if (enlarge) {
+      grow(newExtents);
+    }
+  }
+
+  /**
+   * @return true iff the multi-index lies in the current block
+   */
+  bool isInside(MultiIndex const &index) const {
+    for (size_t d = 0; d < numDimensions; ++d) {
+      if (index[d] >= extents[d]) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @return position of a multi-index that lies in the current block
+   */
+  size_t getOffset(MultiIndex const &index) const {
+    size_t offset = 0;
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      offset += index[d] * strides[d];
+    }
+
+    return offset;
+  }
+
+  MultiIndex const &getExtents() const { return extents; }
+
+  size_t getStride(size_t d) const { return strides[d]; }
+
+  /**
+   * @return number of positions in the block (stored or not)
+   */
+  size_t getBlockSize() const { return values.size(); }
+
+  T &valueAt(size_t offset) { return values[offset]; }
+
+  StorageStatus &statusAt(size_t offset) { return status[offset]; }
+
+  /**
+   * @return counter that is incremented whenever the block is reallocated, which changes the
+   * positions of the values
+   */
+  size_t getGeneration() const { return generation; }
+
+  virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getStoredDataIterator() {
+    return std::make_shared<FullGridStorageStoredDataIterator<T>>(*this);
+  }
+
+  virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getGuidedIterator(
+      MultiIndexIterator &indexIter, IterationPolicy const &policy = IterationPolicy::Default) {
+    return std::make_shared<FullGridStorageGuidedIterator<T>>(policy, *this, indexIter);
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGE_HPP_ */
@@ -0,0 +1,190 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGEGUIDEDITERATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGEGUIDEDITERATOR_HPP_
+
+#include <sgpp/combigrid/common/MultiIndexIterator.hpp>
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
+#include <sgpp/combigrid/storage/IterationPolicy.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace sgpp {
+namespace combigrid {
+
+template <typename T>
+class FullGridStorage;
+
+/**
+ * Iterator class that travels "along" a MultiIndexIterator through a FullGridStorage.
+ * The block of the storage is enlarged to the bounds of the MultiIndexIterator on construction, so
+ * the iteration only updates an offset into the block. If entries are not already contained, they
+ * are created during iteration.
+ * For a detailed method description, see AbstractMultiStorageIterator.
+ */
+template <typename T>
+class FullGridStorageGuidedIterator : public AbstractMultiStorageIterator<T> {
+  FullGridStorage<T> &storage;
+  MultiIndexIterator &iterator;
+  MultiIndex permutedIndex;
+
+  /**
+   * Offset of the current row, i.e., of the multi-index with the current indices in all but the
+   * last dimension and zero in the last dimension.
+   */
+  size_t rowOffset;
+
+  /**
+   * false if the current row is not contained in the block (only possible if the policy maps to
+   * indices outside of the bounds of the iterator)
+   */
+  bool rowInside;
+
+  /**
+   * Generation of the block that rowOffset refers to.
+   */
+  size_t generation;
+
+  IterationPolicy policy;
+
+  void updateRowOffset() {
+    size_t lastDim = permutedIndex.size() - 1;
+    MultiIndex const &extents = storage.getExtents();
+    generation = storage.getGeneration();
+    rowOffset = 0;
+    rowInside = true;
+
+    for (size_t d = 0; d < lastDim; ++d) {
+      if (permutedIndex[d] >= extents[d]) {
+        rowInside = false;
+        return;
+      }
+      rowOffset += permutedIndex[d] * storage.getStride(d);
+    }
+  }
+
+  /**
+   * @return offset of the current entry, the block is enlarged if necessary
+   */
+  size_t locate() {
+    size_t lastDim = permutedIndex.size() - 1;
+    permutedIndex[lastDim] = policy.value(lastDim, iterator.indexAt(lastDim));
+
+    if (generation != storage.getGeneration()) {
+      updateRowOffset();
+    }
+
+    if (!rowInside || permutedIndex[lastDim] >= storage.getExtents()[lastDim]) {
+      MultiIndex bounds(permutedIndex);
+
+      for (size_t d = 0; d <= lastDim; ++d) {
+        ++bounds[d];
+      }
+
+      storage.reserve(bounds);
+      updateRowOffset();
+    }
+
+    // the last dimension has stride 1
+    return rowOffset + permutedIndex[lastDim];
+  }
+
+ public:
+  FullGridStorageGuidedIterator(IterationPolicy const &policy, FullGridStorage<T> &storage,
+                                MultiIndexIterator &iterator)
+      : storage(storage),
+        iterator(iterator),
+        permutedIndex(storage.getNumDimensions(), 0),
+        rowOffset(0),
+        rowInside(false),
+        generation(0),
+        policy(policy) {
+    storage.reserve(iterator.getMultiBounds());
+
+    size_t lastDim = permutedIndex.size() - 1;
+    for (size_t d = 0; d < lastDim; ++d) {
+      permutedIndex[d] = this->policy.value(d, 0);
+    }
+
+    updateRowOffset();
+  }
+
+  virtual ~FullGridStorageGuidedIterator() {}
+
+  virtual int moveToNext() {
+    size_t lastDim = permutedIndex.size() - 1;
+
+    int h = iterator.moveToNext();
+
+    if (h == 0) {
+      policy.moveToNext(lastDim);
+      return 0;
+    } else if (h < 0) {
+      return h;
+    }
+
+    policy.reset(lastDim);
+
+    // the indices in dimensions d, ..., lastDim - 1 have changed
+    size_t d = lastDim - h;
+    permutedIndex[d] = policy.moveAndGetValue(d, iterator.indexAt(d));
+
+    for (size_t k = d + 1; k < lastDim; ++k) {
+      permutedIndex[k] = policy.resetAndGetValue(k, 0);
+    }
+
+    updateRowOffset();
+
+    return h;
+  }
+
+  virtual T &value() {
+    size_t offset = locate();
+    StorageStatus &status = storage.statusAt(offset);
+
+    if (status != StorageStatus::STORED) {
+      storage.valueAt(offset) = storage.getFunc()(permutedIndex);
+      status = StorageStatus::STORED;
+    }
+
+    return storage.valueAt(offset);
+  }
+
+  virtual void setValue(T const &input) {
+    size_t offset = locate();
+    storage.valueAt(offset) = input;
+    storage.statusAt(offset) = StorageStatus::STORED;
+  }
+
+  /**
+   * @return returns true if the iterator points to a valid position.
+   */
+  virtual bool isValid() { return iterator.isValid(); }
+
+  virtual size_t indexAt(size_t d) const { return iterator.indexAt(d); }
+
+  virtual MultiIndex getMultiIndex() const { return iterator.getMultiIndex(); }
+
+  virtual bool computationRequested() {
+    return storage.statusAt(locate()) >= StorageStatus::REQUESTED;
+  }
+
+  virtual std::function<T()> requestComputationTask() {
+    storage.statusAt(locate()) = StorageStatus::REQUESTED;
+
+    FullGridStorage<T> *myStorage = &storage;
+    auto myPermutedIndex = permutedIndex;
+    return [myStorage, myPermutedIndex]() { return myStorage->getFunc()(myPermutedIndex); };
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGEGUIDEDITERATOR_HPP_ */
@@ -0,0 +1,111 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGESTOREDDATAITERATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGESTOREDDATAITERATOR_HPP_
+
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace sgpp {
+namespace combigrid {
+
+template <typename T>
+class FullGridStorage;
+
+/**
+ * Iterator for the FullGridStorage class that only traverses entries stored in the storage.
+ * The entries are traversed in lexicographical order (lexicographically ascending multi-indices),
+ * which is the order of the block.
+ * For a detailed method description, see AbstractMultiStorageIterator.
+ */
+template <typename T>
+class FullGridStorageStoredDataIterator : public AbstractMultiStorageIterator<T> {
+  FullGridStorage<T> &storage;
+  MultiIndex index;
+  size_t offset;
+  bool valid;
+
+  /**
+   * Helper function that moves to the next position in the block, which might not be stored.
+   * @return lowest dimension where the index changed, or -1 at the end of the block
+   */
+  int moveToNextPosition() {
+    MultiIndex const &extents = storage.getExtents();
+    ++offset;
+
+    for (size_t d = index.size(); d-- > 0;) {
+      if (++index[d] < extents[d]) {
+        return static_cast<int>(d);
+      }
+      index[d] = 0;
+    }
+
+    valid = false;
+    return -1;
+  }
+
+ public:
+  explicit FullGridStorageStoredDataIterator(FullGridStorage<T> &storage)
+      : storage(storage), index(storage.getNumDimensions(), 0), offset(0), valid(true) {
+    if (storage.getBlockSize() == 0) {
+      valid = false;
+    } else if (storage.statusAt(0) != StorageStatus::STORED) {
+      moveToNext();
+    }
+  }
+
+  virtual ~FullGridStorageStoredDataIterator() {}
+
+  virtual int moveToNext() {
+    int lowestDim = static_cast<int>(index.size()) - 1;
+
+    do {
+      int d = moveToNextPosition();
+      if (d < 0) {
+        return -1;
+      }
+      if (d < lowestDim) {
+        lowestDim = d;
+      }
+    } while (storage.statusAt(offset) != StorageStatus::STORED);
+
+    return static_cast<int>(index.size()) - 1 - lowestDim;
+  }
+
+  virtual T &value() { return storage.valueAt(offset); }
+
+  virtual void setValue(T const &input) { storage.valueAt(offset) = input; }
+
+  /**
+   * @return returns true if the iterator points to a valid position.
+   */
+  virtual bool isValid() { return valid; }
+
+  virtual size_t indexAt(size_t d) const { return index[d]; }
+
+  virtual MultiIndex getMultiIndex() const { return index; }
+
+  /**
+   * Returns true because the iterator only iterates over already stored data.
+   */
+  virtual bool computationRequested() { return true; }
+
+  /**
+   * Returns a dummy function because the values pointed to are already stored.
+   */
+  virtual std::function<T()> requestComputationTask() {
+    return []() { return T(); };  // no computation necessary
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_FULLGRIDSTORAGESTOREDDATAITERATOR_HPP_ */
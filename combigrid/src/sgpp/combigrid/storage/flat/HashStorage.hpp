@@ -0,0 +1,226 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGE_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGE_HPP_
+
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
+#include <sgpp/combigrid/storage/flat/HashStorageGuidedIterator.hpp>
+#include <sgpp/combigrid/storage/flat/HashStorageStoredDataIterator.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Storage that keeps its entries in insertion order in contiguous arrays (multi-indices, values
+ * and status) and finds them with an open-addressing hash table (linear probing, at most half
+ * full). Unlike TreeStorage and FullGridStorage, only the entries that have been accessed occupy
+ * memory, so it is suited for sparse sets of multi-indices, e.g., sets of levels.
+ *
+ * Like in the TreeStorage, references to values may be invalidated when new values are added.
+ * For more information see AbstractMultiStorage.
+ */
+template <typename T>
+class HashStorage : public AbstractMultiStorage<T> {
+ public:
+  typedef std::function<T(MultiIndex const &)> function_type;
+
+  /**
+   * Returned by find() if the multi-index is not contained.
+   */
+  static const size_t npos = std::numeric_limits<size_t>::max();
+
+ private:
+  size_t numDimensions;
+  function_type func;
+
+  /**
+   * multi-indices of the entries, numDimensions components per entry
+   */
+  std::vector<size_t> keys;
+  std::vector<T> values;
+  std::vector<StorageStatus> status;
+
+  /**
+   * hash table of entry numbers + 1 (0 marks an empty slot), its size is a power of two
+   */
+  std::vector<size_t> slots;
+
+  HashStorage(HashStorage<T> const &) = delete;
+
+  size_t hash(MultiIndex const &index) const {
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      h = (h ^ static_cast<uint64_t>(index[d])) * 0x100000001b3ULL;
+    }
+
+    // mix the high bits into the low bits that select the slot
+    return static_cast<size_t>(h ^ (h >> 29));
+  }
+
+  bool keyEquals(size_t entry, MultiIndex const &index) const {
+    size_t const *key = &keys[entry * numDimensions];
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      if (key[d] != index[d]) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @return slot that contains the entry for the multi-index or the empty slot where it belongs
+   */
+  size_t findSlot(MultiIndex const &index) const {
+    size_t mask = slots.size() - 1;
+    size_t slot = hash(index) & mask;
+
+    while (slots[slot] != 0 && !keyEquals(slots[slot] - 1, index)) {
+      slot = (slot + 1) & mask;
+    }
+
+    return slot;
+  }
+
+  void rehash(size_t numSlots) {
+    slots.assign(numSlots, 0);
+    MultiIndex index(numDimensions);
+
+    for (size_t entry = 0; entry < status.size(); ++entry) {
+      for (size_t d = 0; d < numDimensions; ++d) {
+        index[d] = keys[entry * numDimensions + d];
+      }
+      slots[findSlot(index)] = entry + 1;
+    }
+  }
+
+  void checkIndex(MultiIndex const &index) const {
+    if (index.size() != numDimensions) {
+      throw std::runtime_error("HashStorage: index.size() != numDimensions");
+    }
+  }
+
+ public:
+  /**
+   * Constructor.
+   * @param numDimensions number of dimensions of the multi-indices that the storage is addressed
+   * with
+   * @param func "Default-value-function" that is called to compute entries that are not already
+   * stored (see TreeStorage).
+   */
+  explicit HashStorage(size_t numDimensions, function_type func = multiIndexToDefaultValue<T>())
+      : numDimensions(numDimensions), func(func), keys(), values(), status(), slots(16, 0) {}
+
+  virtual ~HashStorage() {}
+
+  virtual size_t getNumDimensions() const { return numDimensions; }
+
+  virtual T &get(MultiIndex const &index) {
+    checkIndex(index);
+    size_t entry = insert(index);
+
+    if (status[entry] != StorageStatus::STORED) {
+      values[entry] = func(index);
+      status[entry] = StorageStatus::STORED;
+    }
+
+    return values[entry];
+  }
+
+  virtual void set(MultiIndex const &index, T const &value) {
+    checkIndex(index);
+    size_t entry = insert(index);
+    values[entry] = value;
+    status[entry] = StorageStatus::STORED;
+  }
+
+  virtual bool containsIndex(MultiIndex const &index) const {
+    if (index.size() != numDimensions) {
+      return false;
+    }
+
+    size_t entry = find(index);
+    return entry != npos && status[entry] == StorageStatus::STORED;
+  }
+
+  /**
+   * Changes the function that generates the entries.
+   */
+  void setFunc(function_type newFunc) { func = newFunc; }
+
+  function_type const &getFunc() const { return func; }
+
+  /**
+   * @return number of the entry for the multi-index or npos if there is none
+   */
+  size_t find(MultiIndex const &index) const {
+    size_t slot = slots[findSlot(index)];
+    return slot == 0 ? npos : slot - 1;
+  }
+
+  /**
+   * @return number of the entry for the multi-index, a new entry (not stored) is created if there
+   * is none
+   */
+  size_t insert(MultiIndex const &index) {
+    size_t slot = findSlot(index);
+
+    if (slots[slot] != 0) {
+      return slots[slot] - 1;
+    }
+
+    size_t entry = status.size();
+    keys.insert(keys.end(), index.begin(), index.end());
+    values.emplace_back();
+    status.push_back(StorageStatus::NOT_STORED);
+
+    if (2 * status.size() > slots.size()) {
+      rehash(2 * slots.size());
+    } else {
+      slots[slot] = entry + 1;
+    }
+
+    return entry;
+  }
+
+  /**
+   * @return number of entries (stored or not)
+   */
+  size_t getNumEntries() const { return status.size(); }
+
+  size_t keyAt(size_t entry, size_t d) const { return keys[entry * numDimensions + d]; }
+
+  T &valueAt(size_t entry) { return values[entry]; }
+
+  StorageStatus &statusAt(size_t entry) { return status[entry]; }
+
+  virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getStoredDataIterator() {
+    return std::make_shared<HashStorageStoredDataIterator<T>>(*this);
+  }
+
+  virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getGuidedIterator(
+      MultiIndexIterator &indexIter, IterationPolicy const &policy = IterationPolicy::Default) {
+    return std::make_shared<HashStorageGuidedIterator<T>>(policy, *this, indexIter);
+  }
+};
+
+template <typename T>
+const size_t HashStorage<T>::npos;
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGE_HPP_ */
@@ -0,0 +1,131 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGEGUIDEDITERATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGEGUIDEDITERATOR_HPP_
+
+#include <sgpp/combigrid/common/MultiIndexIterator.hpp>
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
+#include <sgpp/combigrid/storage/IterationPolicy.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace sgpp {
+namespace combigrid {
+
+template <typename T>
+class HashStorage;
+
+/**
+ * Iterator class that travels "along" a MultiIndexIterator through a HashStorage. Every access
+ * looks up the current multi-index in the hash table.
+ * If entries are not already contained, they are created during iteration.
+ * For a detailed method description, see AbstractMultiStorageIterator.
+ */
+template <typename T>
+class HashStorageGuidedIterator : public AbstractMultiStorageIterator<T> {
+  HashStorage<T> &storage;
+  MultiIndexIterator &iterator;
+  MultiIndex permutedIndex;
+  IterationPolicy policy;
+
+  /**
+   * @return number of the entry of the current multi-index, which is created if necessary
+   */
+  size_t locate() {
+    size_t lastDim = permutedIndex.size() - 1;
+    permutedIndex[lastDim] = policy.value(lastDim, iterator.indexAt(lastDim));
+    return storage.insert(permutedIndex);
+  }
+
+ public:
+  HashStorageGuidedIterator(IterationPolicy const &policy, HashStorage<T> &storage,
+                            MultiIndexIterator &iterator)
+      : storage(storage),
+        iterator(iterator),
+        permutedIndex(storage.getNumDimensions(), 0),
+        policy(policy) {
+    size_t lastDim = permutedIndex.size() - 1;
+    for (size_t d = 0; d < lastDim; ++d) {
+      permutedIndex[d] = this->policy.value(d, 0);
+    }
+  }
+
+  virtual ~HashStorageGuidedIterator() {}
+
+  virtual int moveToNext() {
+    size_t lastDim = permutedIndex.size() - 1;
+
+    int h = iterator.moveToNext();
+
+    if (h == 0) {
+      policy.moveToNext(lastDim);
+      return 0;
+    } else if (h < 0) {
+      return h;
+    }
+
+    policy.reset(lastDim);
+
+    size_t d = lastDim - h;
+    permutedIndex[d] = policy.moveAndGetValue(d, iterator.indexAt(d));
+
+    for (size_t k = d + 1; k < lastDim; ++k) {
+      permutedIndex[k] = policy.resetAndGetValue(k, 0);
+    }
+
+    return h;
+  }
+
+  virtual T &value() {
+    size_t entry = locate();
+    StorageStatus &status = storage.statusAt(entry);
+
+    if (status != StorageStatus::STORED) {
+      storage.valueAt(entry) = storage.getFunc()(permutedIndex);
+      status = StorageStatus::STORED;
+    }
+
+    return storage.valueAt(entry);
+  }
+
+  virtual void setValue(T const &input) {
+    size_t entry = locate();
+    storage.valueAt(entry) = input;
+    storage.statusAt(entry) = StorageStatus::STORED;
+  }
+
+  /**
+   * @return returns true if the iterator points to a valid position.
+   */
+  virtual bool isValid() { return iterator.isValid(); }
+
+  virtual size_t indexAt(size_t d) const { return iterator.indexAt(d); }
+
+  virtual MultiIndex getMultiIndex() const { return iterator.getMultiIndex(); }
+
+  virtual bool computationRequested() {
+    size_t lastDim = permutedIndex.size() - 1;
+    permutedIndex[lastDim] = policy.value(lastDim, iterator.indexAt(lastDim));
+    size_t entry = storage.find(permutedIndex);
+    return entry != HashStorage<T>::npos && storage.statusAt(entry) >= StorageStatus::REQUESTED;
+  }
+
+  virtual std::function<T()> requestComputationTask() {
+    storage.statusAt(locate()) = StorageStatus::REQUESTED;
+
+    HashStorage<T> *myStorage = &storage;
+    auto myPermutedIndex = permutedIndex;
+    return [myStorage, myPermutedIndex]() { return myStorage->getFunc()(myPermutedIndex); };
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGEGUIDEDITERATOR_HPP_ */
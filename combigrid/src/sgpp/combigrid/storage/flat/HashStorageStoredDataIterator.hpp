@@ -0,0 +1,113 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGESTOREDDATAITERATOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGESTOREDDATAITERATOR_HPP_
+
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
+#include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+template <typename T>
+class HashStorage;
+
+/**
+ * Iterator for the HashStorage class that only traverses entries stored in the storage.
+ * The entries are traversed in lexicographical order (lexicographically ascending multi-indices)
+ * like in the TreeStorage, so they are sorted when the iterator is created. Entries that are added
+ * afterwards are not traversed.
+ * For a detailed method description, see AbstractMultiStorageIterator.
+ */
+template <typename T>
+class HashStorageStoredDataIterator : public AbstractMultiStorageIterator<T> {
+  HashStorage<T> &storage;
+  std::vector<size_t> order;
+  size_t position;
+
+ public:
+  explicit HashStorageStoredDataIterator(HashStorage<T> &storage)
+      : storage(storage), order(), position(0) {
+    for (size_t entry = 0; entry < storage.getNumEntries(); ++entry) {
+      if (storage.statusAt(entry) == StorageStatus::STORED) {
+        order.push_back(entry);
+      }
+    }
+
+    size_t numDimensions = storage.getNumDimensions();
+    std::sort(order.begin(), order.end(), [&storage, numDimensions](size_t a, size_t b) {
+      for (size_t d = 0; d < numDimensions; ++d) {
+        if (storage.keyAt(a, d) != storage.keyAt(b, d)) {
+          return storage.keyAt(a, d) < storage.keyAt(b, d);
+        }
+      }
+      return false;
+    });
+  }
+
+  virtual ~HashStorageStoredDataIterator() {}
+
+  virtual int moveToNext() {
+    if (++position >= order.size()) {
+      return -1;
+    }
+
+    size_t numDimensions = storage.getNumDimensions();
+    size_t previous = order[position - 1];
+    size_t current = order[position];
+    size_t d = 0;
+
+    while (d + 1 < numDimensions && storage.keyAt(previous, d) == storage.keyAt(current, d)) {
+      ++d;
+    }
+
+    return static_cast<int>(numDimensions - 1 - d);
+  }
+
+  virtual T &value() { return storage.valueAt(order[position]); }
+
+  virtual void setValue(T const &input) { storage.valueAt(order[position]) = input; }
+
+  /**
+   * @return returns true if the iterator points to a valid position.
+   */
+  virtual bool isValid() { return position < order.size(); }
+
+  virtual size_t indexAt(size_t d) const { return storage.keyAt(order[position], d); }
+
+  virtual MultiIndex getMultiIndex() const {
+    MultiIndex index(storage.getNumDimensions());
+
+    for (size_t d = 0; d < index.size(); ++d) {
+      index[d] = indexAt(d);
+    }
+
+    return index;
+  }
+
+  /**
+   * Returns true because the iterator only iterates over already stored data.
+   */
+  virtual bool computationRequested() { return true; }
+
+  /**
+   * Returns a dummy function because the values pointed to are already stored.
+   */
+  virtual std::function<T()> requestComputationTask() {
+    return []() { return T(); };  // no computation necessary
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_FLAT_HASHSTORAGESTOREDDATAITERATOR_HPP_ */
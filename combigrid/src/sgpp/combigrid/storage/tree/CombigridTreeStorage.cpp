@@ -5,6 +5,7 @@
 
 #include "CombigridTreeStorage.hpp"
 
+#include <sgpp/combigrid/serialization/BinaryTreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
@@ -17,21 +18,38 @@
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+
+/**
+ * Identifies binary files written by CombigridTreeStorage::writeBinary().
+ */
+const char binaryMagic[] = "SGCGSTOR";
+
+}  // namespace
+
 class CombigridTreeStorageImpl {
  public:
   CombigridTreeStorageImpl(
       std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
-      MultiFunction p_func, bool exploitNesting)
+      MultiFunction p_func, bool exploitNesting, TreeStorageLayout layout)
       : func(p_func),
         pointHierarchies(p_pointHierarchies),
         mutexPtr(nullptr),
-        exploitNesting(exploitNesting) {
+        exploitNesting(exploitNesting),
+        layout(layout) {
     storage = std::make_shared<TreeStorage<std::shared_ptr<TreeStorage<double>>>>(
-        p_pointHierarchies.size(),
+        p_pointHierarchies.size(), getLevelLayout(),
         [](MultiIndex const &level) { return std::shared_ptr<TreeStorage<double>>(nullptr); });
     setFunctions();
   }
 
+  /**
+   * @return layout of the storage of the levels, which is sparse in general
+   */
+  TreeStorageLayout getLevelLayout() const {
+    return layout == TreeStorageLayout::TREE ? TreeStorageLayout::TREE : TreeStorageLayout::HASH;
+  }
+
   /**
    * Sets the computation functions for the storage and the storages it contains
    */
@@ -55,7 +73,8 @@ class CombigridTreeStorageImpl {
       // capture level by copy because the reference might not be valid anymore at the time the
       // lambda is called
       return std::make_shared<TreeStorage<double>>(
-          pointHierarchies.size(), [innerLambda, level, this](MultiIndex const &index) -> double {
+          pointHierarchies.size(), layout,
+          [innerLambda, level, this](MultiIndex const &index) -> double {
             return innerLambda(index, level);
           });
     };
@@ -75,18 +94,21 @@ class CombigridTreeStorageImpl {
   std::shared_ptr<TreeStorage<std::shared_ptr<TreeStorage<double>>>> storage;
   std::shared_ptr<std::recursive_mutex> mutexPtr;
   bool exploitNesting;
+  TreeStorageLayout layout;
 };
 
 CombigridTreeStorage::CombigridTreeStorage(
     std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
     MultiFunction p_func) {
-  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, true);
+  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, true,
+                                                    TreeStorageLayout::TREE);
 }
 
 CombigridTreeStorage::CombigridTreeStorage(
     std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
-    bool exploitNesting, MultiFunction p_func) {
-  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, exploitNesting);
+    bool exploitNesting, MultiFunction p_func, TreeStorageLayout layout) {
+  impl = std::make_unique<CombigridTreeStorageImpl>(p_pointHierarchies, p_func, exploitNesting,
+                                                    layout);
 }
 
 CombigridTreeStorage::~CombigridTreeStorage() {}
@@ -166,16 +188,46 @@ void CombigridTreeStorage::deserialize(const std::string &str) {
 
   std::shared_ptr<AbstractSerializationStrategy<std::shared_ptr<TreeStorage<double>>>>
       innerSerializationStrategy = std::make_shared<TreeStorageSerializationStrategy<double>>(
-          impl->pointHierarchies.size(), floatSerializationStrategy);
+          impl->pointHierarchies.size(), floatSerializationStrategy, impl->layout);
 
   TreeStorageSerializationStrategy<std::shared_ptr<TreeStorage<double>>> outerSerializationStrategy(
-      impl->pointHierarchies.size(), innerSerializationStrategy);
+      impl->pointHierarchies.size(), innerSerializationStrategy, impl->getLevelLayout());
 
   impl->storage = outerSerializationStrategy.deserialize(str);
 
   impl->setFunctions();
 }
 
+void CombigridTreeStorage::writeBinary(std::ostream &stream) {
+  size_t numDimensions = impl->pointHierarchies.size();
+  auto innerSerializationStrategy =
+      std::make_shared<BinaryTreeStorageSerializationStrategy<double>>(numDimensions);
+  BinaryTreeStorageSerializationStrategy<std::shared_ptr<TreeStorage<double>>>
+      outerSerializationStrategy(numDimensions, innerSerializationStrategy);
+
+  BinaryWriter writer(stream);
+  writer.writeHeader(binaryMagic);
+  outerSerializationStrategy.serialize(impl->storage, writer);
+}
+
+void CombigridTreeStorage::readBinary(std::istream &stream) {
+  size_t numDimensions = impl->pointHierarchies.size();
+  std::shared_ptr<AbstractBinarySerializationStrategy<double>> floatSerializationStrategy =
+      std::make_shared<BinarySerializationStrategy<double>>();
+  auto innerSerializationStrategy =
+      std::make_shared<BinaryTreeStorageSerializationStrategy<double>>(
+          numDimensions, floatSerializationStrategy, impl->layout);
+  BinaryTreeStorageSerializationStrategy<std::shared_ptr<TreeStorage<double>>>
+      outerSerializationStrategy(numDimensions, innerSerializationStrategy,
+                                 impl->getLevelLayout());
+
+  BinaryReader reader(stream);
+  reader.readHeader(binaryMagic);
+  impl->storage = outerSerializationStrategy.deserialize(reader);
+
+  impl->setFunctions();
+}
+
 void CombigridTreeStorage::set(const MultiIndex &level, const MultiIndex &index, double value) {
   MultiIndex reducedLevel = level;
   size_t numDimensions = impl->pointHierarchies.size();
@@ -12,6 +12,7 @@
 #include <sgpp/combigrid/grid/hierarchy/AbstractPointHierarchy.hpp>
 #include <sgpp/combigrid/storage/AbstractCombigridStorage.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorageLayout.hpp>
 
 #include <memory>
 #include <string>
@@ -46,11 +47,14 @@ class CombigridTreeStorage : public AbstractCombigridStorage {
    * @param exploitNesting If this is set to true, identical grid points on different levels can
    * have different values. This is e.g. relevant for PDE solving.
    * @param p_func Function generating the values that are stored in the storage.
+   * @param layout Memory layout of the function values of each level. With a flat layout
+   * (FULL_GRID or HASH), the set of levels is stored in a HashStorage.
    */
   CombigridTreeStorage(
       std::vector<std::shared_ptr<AbstractPointHierarchy>> const &p_pointHierarchies,
       bool exploitNesting = true,
-      MultiFunction p_func = MultiFunction(constantFunction<base::DataVector const &, double>()));
+      MultiFunction p_func = MultiFunction(constantFunction<base::DataVector const &, double>()),
+      TreeStorageLayout layout = TreeStorageLayout::TREE);
   virtual ~CombigridTreeStorage();
 
   virtual std::shared_ptr<AbstractMultiStorageIterator<double>> getGuidedIterator(
@@ -68,6 +72,9 @@ class CombigridTreeStorage : public AbstractCombigridStorage {
   virtual std::string serialize();
   virtual void deserialize(std::string const &str);
 
+  virtual void writeBinary(std::ostream &stream);
+  virtual void readBinary(std::istream &stream);
+
   virtual void set(MultiIndex const &level, MultiIndex const &index, double value);
   double get(MultiIndex const &level, MultiIndex const &index) override;
   virtual void setMutex(std::shared_ptr<std::recursive_mutex> mutexPtr);
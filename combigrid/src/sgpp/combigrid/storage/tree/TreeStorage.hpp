@@ -7,11 +7,14 @@
 #define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_TREE_TREESTORAGE_HPP_
 
 #include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
+#include <sgpp/combigrid/storage/flat/FullGridStorage.hpp>
+#include <sgpp/combigrid/storage/flat/HashStorage.hpp>
 #include <sgpp/combigrid/storage/tree/AbstractTreeStorageNode.hpp>
 #include <sgpp/combigrid/storage/tree/InternalTreeStorageNode.hpp>
 #include <sgpp/combigrid/storage/tree/LowestTreeStorageNode.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorageContext.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorageGuidedIterator.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorageLayout.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorageStoredDataIterator.hpp>
 
 #include <iostream>
@@ -29,6 +32,9 @@ namespace combigrid {
  * TreeStorage caches its values.
  * Multi-Indices start from 0 in each dimension.
  * The class T has to have a default constructor.
+ *
+ * Instead of the tree, the values can be kept in one of the flat layouts (see TreeStorageLayout),
+ * which are selected in the constructor and behave the same way otherwise.
  * For more information see AbstractMultiStorage.
  */
 template <typename T>
@@ -38,6 +44,12 @@ class TreeStorage : public AbstractMultiStorage<T> {
 
   std::unique_ptr<AbstractTreeStorageNode<T>> root;
 
+  TreeStorageLayout layout;
+
+  // only one of root, fullGrid and hash is used, depending on the layout
+  std::unique_ptr<FullGridStorage<T>> fullGrid;
+  std::unique_ptr<HashStorage<T>> hash;
+
   TreeStorage(TreeStorage<T> const &) = delete;
 
  public:
@@ -54,8 +66,23 @@ class TreeStorage : public AbstractMultiStorage<T> {
    * If no function is specified, the default constructor of the stored type is used.
    */
   explicit TreeStorage(size_t numDimensions, function_type func = multiIndexToDefaultValue<T>())
-      : context(numDimensions, func), root(nullptr) {
-    if (numDimensions <= 1) {
+      : TreeStorage(numDimensions, TreeStorageLayout::TREE, func) {}
+
+  /**
+   * Constructor for a storage with the given memory layout.
+   * @param numDimensions number of dimensions of the multi-indices that the storage is addressed
+   * with
+   * @param layout memory layout of the values
+   * @param func "Default-value-function", see above.
+   */
+  TreeStorage(size_t numDimensions, TreeStorageLayout layout,
+              function_type func = multiIndexToDefaultValue<T>())
+      : context(numDimensions, func), root(nullptr), layout(layout), fullGrid(), hash() {
+    if (layout == TreeStorageLayout::FULL_GRID) {
+      fullGrid = std::make_unique<FullGridStorage<T>>(numDimensions, func);
+    } else if (layout == TreeStorageLayout::HASH) {
+      hash = std::make_unique<HashStorage<T>>(numDimensions, func);
+    } else if (numDimensions <= 1) {
       root.reset(new LowestTreeStorageNode<T>(context));
     } else {
       root.reset(new InternalTreeStorageNode<T>(context, numDimensions - 1));
@@ -74,29 +101,71 @@ class TreeStorage : public AbstractMultiStorage<T> {
     if (index.size() != context.numDimensions) {
       throw std::runtime_error("TreeStorage::get(): index.size() != context.numDimensions");
     }
+    if (fullGrid) {
+      return fullGrid->get(index);
+    } else if (hash) {
+      return hash->get(index);
+    }
     return root->get(index);
   }
 
   /**
    * Changes the function that generates the entries.
    */
-  virtual void setFunc(function_type func) { context.func = func; }
+  virtual void setFunc(function_type func) {
+    context.func = func;
+    if (fullGrid) {
+      fullGrid->setFunc(func);
+    } else if (hash) {
+      hash->setFunc(func);
+    }
+  }
+
+  /**
+   * @return memory layout of the values
+   */
+  TreeStorageLayout getLayout() const { return layout; }
 
   /**
    * Unlike get(), this function does not activate a computation if there is no entry for the given
    * multi-index in the storage.
    * Instead, it directly sets the given value.
    */
-  virtual void set(MultiIndex const &index, T const &value) { root->set(index, value); }
+  virtual void set(MultiIndex const &index, T const &value) {
+    if (fullGrid) {
+      fullGrid->set(index, value);
+    } else if (hash) {
+      hash->set(index, value);
+    } else {
+      root->set(index, value);
+    }
+  }
 
-  virtual bool containsIndex(MultiIndex const &index) const { return root->containsIndex(index); }
+  virtual bool containsIndex(MultiIndex const &index) const {
+    if (fullGrid) {
+      return fullGrid->containsIndex(index);
+    } else if (hash) {
+      return hash->containsIndex(index);
+    }
+    return root->containsIndex(index);
+  }
 
   virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getStoredDataIterator() {
+    if (fullGrid) {
+      return fullGrid->getStoredDataIterator();
+    } else if (hash) {
+      return hash->getStoredDataIterator();
+    }
     return std::make_shared<TreeStorageStoredDataIterator<T>>(root.get(), context.numDimensions);
   }
 
   virtual std::shared_ptr<AbstractMultiStorageIterator<T>> getGuidedIterator(
       MultiIndexIterator &indexIter, IterationPolicy const &policy = IterationPolicy::Default) {
+    if (fullGrid) {
+      return fullGrid->getGuidedIterator(indexIter, policy);
+    } else if (hash) {
+      return hash->getGuidedIterator(indexIter, policy);
+    }
     return std::make_shared<TreeStorageGuidedIterator<T>>(policy, root.get(), context.numDimensions,
                                                           indexIter);
   }
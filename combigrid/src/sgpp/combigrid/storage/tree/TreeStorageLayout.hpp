@@ -0,0 +1,38 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_TREE_TREESTORAGELAYOUT_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_TREE_TREESTORAGELAYOUT_HPP_
+
+#include <cstdint>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Memory layout of a TreeStorage.
+ */
+enum class TreeStorageLayout : uint8_t {
+  /**
+   * Tree with one level per dimension (the default). Suitable for all index sets.
+   */
+  TREE = 0,
+  /**
+   * One contiguous block for the bounding box of all stored multi-indices, addressed with
+   * computed strides (see FullGridStorage). Fastest for full grids, e.g., the function values of a
+   * level, but the memory grows with the bounding box for sparse index sets.
+   */
+  FULL_GRID,
+  /**
+   * Open-addressing hash table of multi-indices with contiguous values (see HashStorage). Compact
+   * for sparse index sets, e.g., sets of levels or polynomial degrees in many dimensions.
+   */
+  HASH
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_STORAGE_TREE_TREESTORAGELAYOUT_HPP_ */
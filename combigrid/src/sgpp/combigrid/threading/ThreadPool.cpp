@@ -6,103 +6,197 @@
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 
-#include <chrono>
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
+namespace {
+/**
+ * The pool whose worker is the current thread (nullptr for threads that are not workers) and the
+ * index of the worker. Tasks that are added by a worker go to its own deque.
+ */
+thread_local ThreadPool *currentPool = nullptr;
+thread_local size_t currentWorker = 0;
+
+/**
+ * Maximum number of tasks a worker moves from the shared queue to its own deque at once.
+ */
+const size_t maxSharedBatch = 64;
+
+uint64_t xorshift(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+}  // namespace
+
 ThreadPool::IdleCallback ThreadPool::terminateWhenIdle((ThreadPool::doTerminateWhenIdle));
 
 ThreadPool::ThreadPool(size_t numThreads)
     : numThreads(numThreads),
       threads(),
-      tasks(),
-      poolMutex(),
+      queues(),
+      sharedTasks(),
+      numSharedTasks(0),
+      sharedMutex(),
+      idleMutex(),
       terminateFlag(false),
       useIdleCallback(false),
-      idleCallback() {}
+      idleCallback() {
+  for (size_t i = 0; i < numThreads; ++i) {
+    queues.emplace_back(new WorkStealingDeque<Task>());
+  }
+}
 
 ThreadPool::ThreadPool(size_t numThreads, IdleCallback idleCallback)
-    : numThreads(numThreads),
-      threads(),
-      tasks(),
-      poolMutex(),
-      terminateFlag(false),
-      useIdleCallback(true),
-      idleCallback(idleCallback) {}
+    : ThreadPool(numThreads) {
+  this->useIdleCallback = true;
+  this->idleCallback = idleCallback;
+}
 
 ThreadPool::~ThreadPool() {
   triggerTermination();
   join();
+
+  // the threads are finished, so the remaining tasks can be removed from any thread
+  for (auto &queue : queues) {
+    while (Task *task = queue->take()) {
+      delete task;
+    }
+  }
 }
 
-void ThreadPool::addTask(const Task& task) {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  tasks.push_back(task);
+void ThreadPool::addTask(const Task &task) {
+  if (currentPool == this) {
+    queues[currentWorker]->push(new Task(task));
+  } else {
+    CGLOG_SURROUND(std::lock_guard<std::mutex> guard(sharedMutex));
+    sharedTasks.push_back(task);
+    numSharedTasks.store(sharedTasks.size(), std::memory_order_release);
+  }
 }
 
-void ThreadPool::addTasks(const std::vector<Task>& newTasks) {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  tasks.insert(tasks.end(), newTasks.begin(), newTasks.end());
+void ThreadPool::addTasks(const std::vector<Task> &newTasks) {
+  if (currentPool == this) {
+    for (auto const &task : newTasks) {
+      queues[currentWorker]->push(new Task(task));
+    }
+  } else {
+    CGLOG_SURROUND(std::lock_guard<std::mutex> guard(sharedMutex));
+    sharedTasks.insert(sharedTasks.end(), newTasks.begin(), newTasks.end());
+    numSharedTasks.store(sharedTasks.size(), std::memory_order_release);
+  }
 }
 
 void ThreadPool::start() {
   for (size_t i = 0; i < numThreads; ++i) {
-    threads.push_back(std::make_shared<std::thread>([this]() {
-      while (true) {
-        Task nextTask;
-
-        // wait for terminate or next task
-        while (true) {
-          {
-            CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(this->poolMutex));
-            if (this->terminateFlag) {
-              return;
-            }
-            if (!this->tasks.empty()) {
-              nextTask = tasks.front();
-              tasks.pop_front();
-              break;
-            } else if (!useIdleCallback) {
-              return;
-            }
-            CGLOG("leave outer guard(this->poolMutex)");
-          }
-
-          // no tasks, so acquire tasks
-
-          if (useIdleCallback) {
-            CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> idleLock(idleMutex));
-
-            {
-              CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(this->poolMutex));
-              if (this->terminateFlag || !this->tasks.empty()) {
-                CGLOG("leave inner guard(this->poolMutex)");
-                continue;
-              }
-              CGLOG("leave inner guard(this->poolMutex)");
-            }
-
-            idleCallback(*this);
-            CGLOG("leave idleLock(idleMutex)");
-          } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
-          }
-        }
-
-        // execute next task
-        nextTask();
+    threads.push_back(std::make_shared<std::thread>([this, i]() { work(i); }));
+  }
+}
+
+void ThreadPool::work(size_t worker) {
+  currentPool = this;
+  currentWorker = worker;
+  uint64_t randomState = 0x9E3779B97F4A7C15ull * (worker + 1);
+
+  while (!terminateFlag.load(std::memory_order_acquire)) {
+    bool contended = false;
+    std::unique_ptr<Task> task(findTask(worker, randomState, contended));
+
+    if (task != nullptr) {
+      (*task)();
+      continue;
+    }
+
+    if (contended) {
+      // another thread was faster, but there may be more tasks left
+      std::this_thread::yield();
+      continue;
+    }
+
+    // no tasks, so acquire tasks
+    if (!useIdleCallback) {
+      break;
+    }
+
+    CGLOG_SURROUND(std::lock_guard<std::mutex> idleLock(idleMutex));
+
+    if (terminateFlag.load(std::memory_order_acquire) || hasTasks()) {
+      CGLOG("leave idleLock(idleMutex)");
+      continue;
+    }
+
+    idleCallback(*this);
+    CGLOG("leave idleLock(idleMutex)");
+  }
+
+  currentPool = nullptr;
+}
+
+ThreadPool::Task *ThreadPool::findTask(size_t worker, uint64_t &randomState, bool &contended) {
+  Task *task = queues[worker]->take();
+
+  if (task != nullptr) {
+    return task;
+  }
+
+  if (numSharedTasks.load(std::memory_order_acquire) > 0) {
+    CGLOG_SURROUND(std::lock_guard<std::mutex> guard(sharedMutex));
+
+    if (!sharedTasks.empty()) {
+      // run the first task and keep a share of the others for this thread
+      size_t batchSize =
+          std::max(std::min(sharedTasks.size() / numThreads, maxSharedBatch), size_t(1));
+      task = new Task(std::move(sharedTasks.front()));
+      sharedTasks.pop_front();
+
+      for (size_t i = 1; i < batchSize && !sharedTasks.empty(); ++i) {
+        queues[worker]->push(new Task(std::move(sharedTasks.front())));
+        sharedTasks.pop_front();
+      }
+
+      numSharedTasks.store(sharedTasks.size(), std::memory_order_release);
+      return task;
+    }
+  }
+
+  // steal from the other threads, starting with a random one
+  if (numThreads > 1) {
+    size_t first = static_cast<size_t>(xorshift(randomState) % (numThreads - 1));
+
+    for (size_t i = 0; i < numThreads - 1; ++i) {
+      size_t victim = (worker + 1 + (first + i) % (numThreads - 1)) % numThreads;
+      task = queues[victim]->steal(contended);
+
+      if (task != nullptr) {
+        return task;
       }
-    }));
+    }
   }
+
+  return nullptr;
 }
 
-void ThreadPool::triggerTermination() {
-  CGLOG_SURROUND(std::lock_guard<std::recursive_mutex> guard(poolMutex));
-  terminateFlag = true;
+bool ThreadPool::hasTasks() {
+  if (numSharedTasks.load(std::memory_order_acquire) > 0) {
+    return true;
+  }
+
+  for (auto &queue : queues) {
+    if (queue->size() > 0) {
+      return true;
+    }
+  }
+
+  return false;
 }
 
+void ThreadPool::triggerTermination() { terminateFlag.store(true, std::memory_order_release); }
+
 void ThreadPool::join() {
   for (auto thread_ptr : threads) {
     thread_ptr->join();
@@ -111,8 +205,10 @@ void ThreadPool::join() {
   threads.clear();
 }
 
+size_t ThreadPool::getNumThreads() const { return numThreads; }
+
 // static
-void ThreadPool::doTerminateWhenIdle(ThreadPool& tp) { tp.triggerTermination(); }
+void ThreadPool::doTerminateWhenIdle(ThreadPool &tp) { tp.triggerTermination(); }
 
 } /* namespace combigrid */
 } /* namespace sgpp*/
@@ -7,8 +7,11 @@
 #define COMBIGRID_SRC_SGPP_COMBIGRID_THREADING_THREADPOOL_HPP_
 
 #include <sgpp/combigrid/GeneralFunction.hpp>
+#include <sgpp/combigrid/threading/WorkStealingDeque.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <deque>
 #include <functional>
 #include <memory>
@@ -22,6 +25,13 @@ namespace combigrid {
 /**
  * This implements a thread-pool with a pre-specified number of threads that process a list of
  * tasks.
+ *
+ * The tasks are scheduled by work stealing: every thread has its own lock-free deque. Tasks that
+ * a thread of the pool adds (e.g., in the idle callback or in a task) are pushed to its own deque,
+ * tasks added by other threads are collected in a shared queue. A thread takes tasks from the
+ * bottom of its own deque. When it is empty, the thread moves a batch of tasks from the shared
+ * queue to its deque or, if there are none, steals from the top of the deques of the other
+ * threads. Hence the threads only synchronize when they run out of work.
  */
 class ThreadPool {
  public:
@@ -33,13 +43,34 @@ class ThreadPool {
  private:
   size_t numThreads;
   std::vector<std::shared_ptr<std::thread>> threads;
-  std::deque<Task> tasks;
-  std::recursive_mutex poolMutex;
-  std::recursive_mutex idleMutex;
-  bool terminateFlag;
+  std::vector<std::unique_ptr<WorkStealingDeque<Task>>> queues;
+  std::deque<Task> sharedTasks;
+  std::atomic<size_t> numSharedTasks;
+  std::mutex sharedMutex;
+  std::mutex idleMutex;
+  std::atomic<bool> terminateFlag;
   bool useIdleCallback;
   IdleCallback idleCallback;
 
+  /**
+   * Main loop of the thread with index worker.
+   */
+  void work(size_t worker);
+
+  /**
+   * Looks for a task in the own deque, the shared queue and the deques of the other threads.
+   * @param worker index of the calling thread
+   * @param randomState state of the random number generator that chooses the first victim
+   * @param[out] contended set to true if a deque was not empty but another thread was faster
+   * @return task (to be deleted by the caller) or nullptr
+   */
+  Task *findTask(size_t worker, uint64_t &randomState, bool &contended);
+
+  /**
+   * @return whether there are tasks waiting (approximately, if other threads are running)
+   */
+  bool hasTasks();
+
  public:
   /**
    * Creates a ThreadPool that processes available tasks. When no more tasks are available, the
@@ -84,6 +115,11 @@ class ThreadPool {
    */
   void join();
 
+  /**
+   * @return number of threads
+   */
+  size_t getNumThreads() const;
+
   static void doTerminateWhenIdle(ThreadPool &tp);
 
   /**
@@ -0,0 +1,170 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_THREADING_WORKSTEALINGDEQUE_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_THREADING_WORKSTEALINGDEQUE_HPP_
+
+#include <sgpp/globaldef.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Lock-free work-stealing deque of pointers (Chase and Lev, "Dynamic circular work-stealing
+ * deque", with the memory orderings of Le et al., "Correct and efficient work-stealing for weak
+ * memory models"). Only the owner thread may call push() and take(), which work at the bottom of
+ * the deque; any thread may call steal(), which takes from the top. The deque does not own the
+ * objects pointed to.
+ *
+ * The buffer grows when it is full. Old buffers may still be read by concurrent steal()
+ * operations, so they are kept until the deque is destroyed (they are at most as large as the
+ * current buffer in total).
+ */
+template <typename T>
+class WorkStealingDeque {
+  /**
+   * Circular buffer with a power of two as capacity.
+   */
+  class Buffer {
+   public:
+    explicit Buffer(int64_t capacity)
+        : capacity(capacity), mask(capacity - 1), items(new std::atomic<T *>[capacity]) {}
+
+    int64_t getCapacity() const { return capacity; }
+
+    T *get(int64_t index) const { return items[index & mask].load(std::memory_order_relaxed); }
+
+    void put(int64_t index, T *item) { items[index & mask].store(item, std::memory_order_relaxed); }
+
+    /**
+     * @return buffer with twice the capacity that contains the items top, ..., bottom - 1
+     */
+    Buffer *grow(int64_t bottom, int64_t top) const {
+      Buffer *result = new Buffer(2 * capacity);
+      for (int64_t i = top; i < bottom; ++i) {
+        result->put(i, get(i));
+      }
+      return result;
+    }
+
+   private:
+    int64_t capacity;
+    int64_t mask;
+    std::unique_ptr<std::atomic<T *>[]> items;
+  };
+
+ public:
+  /**
+   * @param initialCapacity initial capacity, has to be a power of two
+   */
+  explicit WorkStealingDeque(int64_t initialCapacity = 256)
+      : top(0), bottom(0), buffer(new Buffer(initialCapacity)), buffers() {
+    buffers.emplace_back(buffer.load(std::memory_order_relaxed));
+  }
+
+  WorkStealingDeque(WorkStealingDeque const &) = delete;
+  WorkStealingDeque &operator=(WorkStealingDeque const &) = delete;
+
+  /**
+   * Adds an item at the bottom (owner only).
+   */
+  void push(T *item) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    Buffer *a = buffer.load(std::memory_order_relaxed);
+
+    if (b - t > a->getCapacity() - 1) {
+      a = a->grow(b, t);
+      buffers.emplace_back(a);
+      buffer.store(a, std::memory_order_release);
+    }
+
+    a->put(b, item);
+    // publishes the item (and the object pointed to) to thieves that acquire bottom
+    bottom.store(b + 1, std::memory_order_release);
+  }
+
+  /**
+   * Removes the item at the bottom (owner only).
+   * @return the item or nullptr if the deque is empty
+   */
+  T *take() {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    Buffer *a = buffer.load(std::memory_order_relaxed);
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      // empty
+      bottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    T *item = a->get(b);
+
+    if (t == b) {
+      // last item, race against thieves
+      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        item = nullptr;
+      }
+      bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    return item;
+  }
+
+  /**
+   * Removes the item at the top (any thread).
+   * @param[out] contended set to true if the deque was not empty but another thread was faster
+   * @return the item or nullptr if the deque is empty or the steal failed
+   */
+  T *steal(bool &contended) {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+      return nullptr;
+    }
+
+    Buffer *a = buffer.load(std::memory_order_acquire);
+    T *item = a->get(t);
+
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed)) {
+      contended = true;
+      return nullptr;
+    }
+
+    return item;
+  }
+
+  /**
+   * @return approximate number of items (exact if no other thread works on the deque)
+   */
+  int64_t size() const {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_relaxed);
+    return b > t ? b - t : 0;
+  }
+
+ private:
+  std::atomic<int64_t> top;
+  std::atomic<int64_t> bottom;
+  std::atomic<Buffer *> buffer;
+  std::vector<std::unique_ptr<Buffer>> buffers;
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_THREADING_WORKSTEALINGDEQUE_HPP_ */
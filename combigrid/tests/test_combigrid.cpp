@@ -313,4 +313,32 @@ BOOST_AUTO_TEST_CASE(testBsplinedeg3Interpolation) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testBatchedEvaluation) {
+  // more points than one parameter block of the batched summation
+  const size_t numPoints = 300;
+  auto func = MultiFunction(testFunction3);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t d = 1; d <= 4; ++d) {
+    std::vector<DataVector> params(numPoints, DataVector(d));
+    for (auto &param : params) {
+      for (size_t i = 0; i < d; ++i) {
+        param[i] = distribution(generator);
+      }
+    }
+
+    auto multiOperation =
+        CombigridMultiOperation::createExpUniformBoundaryLinearInterpolation(d, func);
+    auto singleOperation =
+        sgpp::combigrid::CombigridOperation::createExpUniformBoundaryLinearInterpolation(d, func);
+    auto result = multiOperation->evaluate(4, params);
+
+    BOOST_CHECK_EQUAL(result.getSize(), numPoints);
+    for (size_t j = 0; j < numPoints; ++j) {
+      BOOST_CHECK_SMALL(result[j] - singleOperation->evaluate(4, params[j]), 1e-12);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -146,19 +146,30 @@ BOOST_AUTO_TEST_CASE(testLevelManagerAdaptive) {
   size_t numDims = 6;
   sgpp::combigrid::Genz model;
   sgpp::combigrid::MultiFunction func(model.eval);
-  auto op = sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
-      numDims, func);
-
-  auto levelManager = std::make_shared<AveragingLevelManager>();
-  op->setLevelManager(levelManager);
-  levelManager->disableStatsCollection();
-  size_t i = 0;
-  size_t maxIterations = 30;
-  while (i < maxIterations) {
-    levelManager->addLevelsAdaptiveByNumLevels(10);
-    BOOST_CHECK_EQUAL(op->getUpperPointBound(), op->numGridPoints());
-    i++;
+  std::vector<size_t> numGridPoints;
+
+  // the layout of the level data must not change the refinement
+  for (auto layout : {sgpp::combigrid::TreeStorageLayout::TREE,
+                      sgpp::combigrid::TreeStorageLayout::HASH}) {
+    auto op = sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+        numDims, func);
+
+    auto levelManager = std::make_shared<AveragingLevelManager>();
+    op->setLevelManager(levelManager);
+    levelManager->disableStatsCollection();
+    levelManager->setLevelDataLayout(layout);
+    BOOST_CHECK(levelManager->getLevelDataLayout() == layout);
+    size_t i = 0;
+    size_t maxIterations = 30;
+    while (i < maxIterations) {
+      levelManager->addLevelsAdaptiveByNumLevels(10);
+      BOOST_CHECK_EQUAL(op->getUpperPointBound(), op->numGridPoints());
+      i++;
+    }
+    numGridPoints.push_back(op->numGridPoints());
   }
+
+  BOOST_CHECK_EQUAL(numGridPoints[0], numGridPoints[1]);
 }
 
 #ifdef USE_DAKOTA
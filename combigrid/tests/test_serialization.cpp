@@ -8,6 +8,9 @@
 #include <sgpp/combigrid/grid/distribution/ClenshawCurtisDistribution.hpp>
 #include <sgpp/combigrid/grid/hierarchy/NonNestedPointHierarchy.hpp>
 #include <sgpp/combigrid/grid/ordering/ExponentialLevelorderPointOrdering.hpp>
+#include <sgpp/combigrid/serialization/BinaryReader.hpp>
+#include <sgpp/combigrid/serialization/BinaryTreeStorageSerializationStrategy.hpp>
+#include <sgpp/combigrid/serialization/BinaryWriter.hpp>
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/FunctionLookupTable.hpp>
@@ -15,9 +18,15 @@
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <limits>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -92,6 +101,76 @@ BOOST_AUTO_TEST_CASE(testFunctionLookupTableSerialization) {
   BOOST_CHECK_EQUAL(func(vec), table2(vec));
 }
 
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableBinarySerialization) {
+  std::string filename = "functionLookupTableTest.bin";
+  std::remove(filename.c_str());
+  FunctionLookupTable table((MultiFunction(testFunc1)));
+  table.appendEntriesTo(filename);
+
+  sgpp::base::DataVector vec(2);
+  for (size_t i = 0; i < 100; ++i) {
+    vec[0] = static_cast<double>(i) / 7.0;
+    vec[1] = -static_cast<double>(i) / 3.0;
+    table(vec);
+  }
+  table.stopAppendingEntries();
+
+  // the appended file and the saved file contain the same values
+  FunctionLookupTable appended((MultiFunction(testFunc2)));
+  appended.loadBinary(filename);
+  BOOST_CHECK_EQUAL(appended.getNumEntries(), 100);
+
+  table.saveBinary(filename);
+  FunctionLookupTable saved((MultiFunction(testFunc2)));
+  saved.loadBinary(filename);
+  BOOST_CHECK_EQUAL(saved.getNumEntries(), 100);
+
+  for (size_t i = 0; i < 100; ++i) {
+    vec[0] = static_cast<double>(i) / 7.0;
+    vec[1] = -static_cast<double>(i) / 3.0;
+    BOOST_CHECK_EQUAL(testFunc1(vec), appended(vec));
+    BOOST_CHECK_EQUAL(testFunc1(vec), saved(vec));
+  }
+
+  // an incomplete last entry is ignored
+  {
+    std::ofstream stream(filename, std::ios::binary | std::ios::app);
+    uint32_t dim = 2;
+    double x = 1.0;
+    stream.write(reinterpret_cast<char const *>(&dim), sizeof(dim));
+    stream.write(reinterpret_cast<char const *>(&x), sizeof(x));
+  }
+  FunctionLookupTable truncated((MultiFunction(testFunc2)));
+  truncated.loadBinary(filename);
+  BOOST_CHECK_EQUAL(truncated.getNumEntries(), 100);
+
+  // resuming after an interrupted run removes the incomplete entry before appending
+  {
+    std::ofstream stream(filename, std::ios::binary | std::ios::app);
+    stream.write("junk", 4);
+  }
+  FunctionLookupTable resumed((MultiFunction(testFunc1)));
+  resumed.appendEntriesTo(filename);
+  for (size_t i = 100; i < 110; ++i) {
+    vec[0] = static_cast<double>(i) / 7.0;
+    vec[1] = -static_cast<double>(i) / 3.0;
+    resumed(vec);
+  }
+  resumed.stopAppendingEntries();
+
+  FunctionLookupTable reloaded((MultiFunction(testFunc2)));
+  reloaded.loadBinary(filename);
+  BOOST_CHECK_EQUAL(reloaded.getNumEntries(), 110);
+
+  for (size_t i = 0; i < 110; ++i) {
+    vec[0] = static_cast<double>(i) / 7.0;
+    vec[1] = -static_cast<double>(i) / 3.0;
+    BOOST_CHECK_EQUAL(testFunc1(vec), reloaded(vec));
+  }
+
+  std::remove(filename.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(testCombigridTreeStorageSerialization) {
   std::vector<std::shared_ptr<AbstractPointHierarchy>> hierarchies(
       2, std::make_shared<NonNestedPointHierarchy>(
@@ -140,3 +219,86 @@ BOOST_AUTO_TEST_CASE(testCombigridTreeStorageSerialization) {
     std::cout << "\n";  // prevent optimizing away
   }
 }
+
+template <typename T>
+void writeSwapped(std::ostream &stream, T value) {
+  char *bytes = reinterpret_cast<char *>(&value);
+  std::reverse(bytes, bytes + sizeof(T));
+  stream.write(bytes, sizeof(T));
+}
+
+BOOST_AUTO_TEST_CASE(testBinaryReaderByteOrder) {
+  std::stringstream stream;
+  stream.write("TEST\0\0\0\0", 8);
+  writeSwapped(stream, sgpp::combigrid::BinaryWriter::version);
+  writeSwapped(stream, sgpp::combigrid::BinaryWriter::byteOrderMark);
+  writeSwapped(stream, static_cast<uint64_t>(42));
+  writeSwapped(stream, -1.5);
+
+  sgpp::combigrid::BinaryReader reader(stream);
+  reader.readHeader("TEST");
+  BOOST_CHECK(reader.hasSwappedByteOrder());
+  BOOST_CHECK_EQUAL(reader.readSize(), 42);
+  BOOST_CHECK_EQUAL(reader.read<double>(), -1.5);
+  BOOST_CHECK_THROW(reader.read<double>(), std::runtime_error);
+
+  std::stringstream otherStream;
+  sgpp::combigrid::BinaryWriter writer(otherStream);
+  writer.writeHeader("OTHER");
+  sgpp::combigrid::BinaryReader otherReader(otherStream);
+  BOOST_CHECK_THROW(otherReader.readHeader("TEST"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(testCombigridTreeStorageBinarySerialization) {
+  std::vector<std::shared_ptr<AbstractPointHierarchy>> hierarchies(
+      2, std::make_shared<NonNestedPointHierarchy>(
+             std::make_shared<ClenshawCurtisDistribution>(),
+             std::make_shared<ExponentialLevelorderPointOrdering>()));
+
+  MultiFunction testFunc1Multi(testFunc1);
+  CombigridTreeStorage storage(hierarchies, testFunc1Multi);
+
+  std::vector<bool> orderingConfiguration(2, false);
+  MultiIndex bounds(2, 3);
+
+  for (size_t l = 0; l < 3; ++l) {
+    MultiIndex level(2, 2 + l);
+    MultiIndexIterator mIt(bounds);
+    for (auto it = storage.getGuidedIterator(level, mIt, orderingConfiguration); it->isValid();
+         it->moveToNext()) {
+      it->value();
+    }
+  }
+
+  std::stringstream stream;
+  storage.writeBinary(stream);
+
+  MultiFunction testFunc2Multi(testFunc2);
+  CombigridTreeStorage otherStorage(hierarchies, false, testFunc2Multi,
+                                    sgpp::combigrid::TreeStorageLayout::FULL_GRID);
+  otherStorage.readBinary(stream);
+  BOOST_CHECK_EQUAL(otherStorage.getNumEntries(), storage.getNumEntries());
+
+  for (size_t l = 0; l < 3; ++l) {
+    MultiIndex level(2, 2 + l);
+    MultiIndexIterator mIt(bounds);
+    MultiIndexIterator otherMIt(bounds);
+    auto otherIt = otherStorage.getGuidedIterator(level, otherMIt, orderingConfiguration);
+    for (auto it = storage.getGuidedIterator(level, mIt, orderingConfiguration); it->isValid();
+         it->moveToNext(), otherIt->moveToNext()) {
+      BOOST_CHECK(otherIt->isValid());
+      BOOST_CHECK_EQUAL(it->value(), otherIt->value());
+    }
+  }
+
+  // values that were not stored are computed with the function of otherStorage
+  MultiIndex level(2, 5);
+  MultiIndexIterator otherMIt(bounds);
+  BOOST_CHECK_EQUAL(otherStorage.getGuidedIterator(level, otherMIt, orderingConfiguration)->value(),
+                    -1.0);
+
+  // a truncated stream is rejected
+  std::string data = stream.str();
+  std::stringstream truncated(data.substr(0, data.size() - 1));
+  BOOST_CHECK_THROW(otherStorage.readBinary(truncated), std::runtime_error);
+}
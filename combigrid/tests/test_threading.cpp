@@ -7,6 +7,7 @@
 #include <sgpp/combigrid/integration/MCIntegrator.hpp>
 #include <sgpp/combigrid/operation/CombigridMultiOperation.hpp>
 #include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/storage/FunctionLookupTable.hpp>
 #include <sgpp/combigrid/storage/tree/CombigridTreeStorage.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 #include <sgpp/combigrid/utils/Stopwatch.hpp>
@@ -14,9 +15,11 @@
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <memory>
+#include <thread>
 #include <vector>
 
 using sgpp::base::DataVector;
@@ -83,3 +86,90 @@ BOOST_AUTO_TEST_CASE(testThreadingWithCallback) {
 
   checkCorrectness();
 }
+
+void addSubtasks(ThreadPool &tp, std::atomic<int> &numExecuted, int depth) {
+  ++numExecuted;
+  if (depth > 0) {
+    for (int i = 0; i < 2; ++i) {
+      tp.addTask(ThreadPool::Task(
+          [&tp, &numExecuted, depth]() { addSubtasks(tp, numExecuted, depth - 1); }));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testThreadingWithSubtasks) {
+  // tasks added by the tasks go to the deque of the executing thread and are stolen by the others
+  int depth = 12;
+  int numRoots = 4;
+  int numTasks = numRoots * ((2 << depth) - 1);
+  std::atomic<int> numExecuted(0);
+  auto tp = std::make_shared<ThreadPool>(
+      4, ThreadPool::IdleCallback([&numExecuted, numTasks](ThreadPool &pool) {
+        if (numExecuted >= numTasks) {
+          pool.triggerTermination();
+        } else {
+          std::this_thread::yield();
+        }
+      }));
+
+  for (int i = 0; i < numRoots; ++i) {
+    tp->addTask(ThreadPool::Task(
+        [&tp, &numExecuted, depth]() { addSubtasks(*tp, numExecuted, depth); }));
+  }
+
+  tp->start();
+  tp->join();
+
+  BOOST_CHECK_EQUAL(numExecuted, numTasks);
+}
+
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableConcurrentEvaluation) {
+  // every value is computed once, although all threads request the same parameters
+  std::atomic<int> numEvaluations(0);
+  sgpp::combigrid::FunctionLookupTable table(
+      sgpp::combigrid::MultiFunction([&numEvaluations](DataVector const &x) {
+        ++numEvaluations;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        return x[0] * x[0];
+      }));
+
+  int numPoints = 200;
+  std::vector<std::thread> threads;
+  std::atomic<int> numWrongValues(0);
+
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&table, &numWrongValues, numPoints]() {
+      DataVector x(1);
+      for (int i = 0; i < numPoints; ++i) {
+        x[0] = static_cast<double>(i);
+        if (table(x) != x[0] * x[0]) {
+          ++numWrongValues;
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  BOOST_CHECK_EQUAL(numEvaluations, numPoints);
+  BOOST_CHECK_EQUAL(numWrongValues, 0);
+  BOOST_CHECK_EQUAL(table.getNumEntries(), static_cast<size_t>(numPoints));
+}
+
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableCapacity) {
+  size_t capacity = 64;
+  sgpp::combigrid::FunctionLookupTable table(
+      sgpp::combigrid::MultiFunction([](DataVector const &x) { return x[0]; }), capacity);
+
+  DataVector x(1);
+  for (size_t i = 0; i < 1000; ++i) {
+    x[0] = static_cast<double>(i);
+    BOOST_CHECK_EQUAL(table(x), x[0]);
+    BOOST_CHECK(table.getNumEntries() <= capacity);
+  }
+
+  // the most recent value has not been evicted
+  BOOST_CHECK(table.containsEntry(x));
+}
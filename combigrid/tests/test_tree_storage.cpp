@@ -6,11 +6,17 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 #include <sgpp/globaldef.hpp>
+#include <sgpp/combigrid/algebraic/FloatTensorVector.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorageLayout.hpp>
 #include <sgpp/combigrid/common/MultiIndexIterator.hpp>
 #include <iostream>
+#include <vector>
 
+using sgpp::combigrid::FloatScalarVector;
+using sgpp::combigrid::FloatTensorVector;
 using sgpp::combigrid::TreeStorage;
+using sgpp::combigrid::TreeStorageLayout;
 using sgpp::combigrid::MultiIndex;
 using sgpp::combigrid::MultiIndexIterator;
 
@@ -121,3 +127,105 @@ BOOST_AUTO_TEST_CASE(testTreeStorageGuidedIterator) {
   BOOST_CHECK_EQUAL(it->moveToNext(), -1);
   BOOST_CHECK_EQUAL(it->isValid(), false);
 }
+
+BOOST_AUTO_TEST_CASE(testTreeStorageLayouts) {
+  std::vector<TreeStorageLayout> layouts = {TreeStorageLayout::FULL_GRID, TreeStorageLayout::HASH};
+
+  for (auto layout : layouts) {
+    // the function values are computed from the multi-index
+    TreeStorage<int> storage(3, layout, [](MultiIndex const &index) {
+      return static_cast<int>(100 * index[0] + 10 * index[1] + index[2]);
+    });
+    BOOST_CHECK(storage.getLayout() == layout);
+
+    MultiIndex index(3, 0);
+    BOOST_CHECK(!storage.containsIndex(index));
+    storage.set(index, 1);
+
+    index[2] = 2;
+    storage.set(index, 2);
+
+    index[0] = 2;
+    storage.set(index, 3);
+    BOOST_CHECK(storage.containsIndex(index));
+    BOOST_CHECK_EQUAL(storage.get(index), 3);
+
+    // the stored entries are traversed like in the tree
+    auto dataIt = storage.getStoredDataIterator();
+    BOOST_CHECK(dataIt->isValid());
+    BOOST_CHECK_EQUAL(dataIt->value(), 1);
+    BOOST_CHECK_EQUAL(dataIt->moveToNext(), 0);
+    BOOST_CHECK_EQUAL(dataIt->value(), 2);
+    BOOST_CHECK_EQUAL(dataIt->moveToNext(), 2);
+    BOOST_CHECK_EQUAL(dataIt->value(), 3);
+    BOOST_CHECK_EQUAL(dataIt->indexAt(0), 2);
+    BOOST_CHECK_EQUAL(dataIt->moveToNext(), -1);
+    BOOST_CHECK(!dataIt->isValid());
+
+    // the guided iterator creates the missing entries with the function
+    MultiIndex bounds(3, 3);
+    MultiIndexIterator multiIter(bounds);
+    auto it = storage.getGuidedIterator(multiIter);
+    std::vector<int> hValues;
+    size_t numValues = 0;
+
+    while (it->isValid()) {
+      MultiIndex current = it->getMultiIndex();
+      int expected = static_cast<int>(100 * current[0] + 10 * current[1] + current[2]);
+
+      if (current == MultiIndex({0, 0, 0})) {
+        expected = 1;
+      } else if (current == MultiIndex({0, 0, 2})) {
+        expected = 2;
+      } else if (current == MultiIndex({2, 0, 2})) {
+        expected = 3;
+      }
+
+      BOOST_CHECK_EQUAL(it->value(), expected);
+      ++numValues;
+      hValues.push_back(it->moveToNext());
+    }
+
+    BOOST_CHECK_EQUAL(numValues, 27);
+    BOOST_CHECK_EQUAL(hValues[1], 0);
+    BOOST_CHECK_EQUAL(hValues[2], 1);
+    BOOST_CHECK_EQUAL(hValues[8], 2);
+    BOOST_CHECK_EQUAL(hValues.back(), -1);
+
+    // all entries are stored now
+    size_t numStored = 0;
+    for (auto storedIt = storage.getStoredDataIterator(); storedIt->isValid();
+         storedIt->moveToNext()) {
+      ++numStored;
+    }
+    BOOST_CHECK_EQUAL(numStored, 27);
+
+    // entries outside of the previous bounds
+    index = MultiIndex({4, 1, 7});
+    BOOST_CHECK(!storage.containsIndex(index));
+    BOOST_CHECK_EQUAL(storage.get(index), 417);
+    BOOST_CHECK_EQUAL(storage.get(MultiIndex({2, 0, 2})), 3);
+    BOOST_CHECK_EQUAL(storage.get(MultiIndex({1, 2, 1})), 121);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testFloatTensorVectorLayouts) {
+  for (auto layout : {TreeStorageLayout::FULL_GRID, TreeStorageLayout::HASH}) {
+    FloatTensorVector first(1, layout);
+    first[MultiIndex({0})] = FloatScalarVector(1.0);
+    first[MultiIndex({2})] = FloatScalarVector(2.0);
+
+    FloatTensorVector second(2, layout);
+    second[MultiIndex({1, 3})] = FloatScalarVector(3.0);
+
+    // the tensor product and the copies keep the layout
+    first.componentwiseMult(second);
+    FloatTensorVector copy(first);
+    BOOST_CHECK(first.getLayout() == layout);
+    BOOST_CHECK(copy.getLayout() == layout);
+    BOOST_CHECK(copy.getValues()->getLayout() == layout);
+    BOOST_CHECK_EQUAL(copy[MultiIndex({0, 1, 3})].value(), 3.0);
+    BOOST_CHECK_EQUAL(copy[MultiIndex({2, 1, 3})].value(), 6.0);
+    BOOST_CHECK_EQUAL(copy.get(MultiIndex({1, 1, 3})).value(), 0.0);
+  }
+}
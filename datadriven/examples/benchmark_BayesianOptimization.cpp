@@ -0,0 +1,118 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/bo/BOConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
+#include <sgpp/optimization/tools/Printer.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * Measures the cost of the steps of Bayesian Optimization as a function of the number of
+ * trials. A synthetic score function replaces the model fitting. For each trial, the time of
+ * the incremental Gaussian Process update (updateGP), of a Cholesky decomposition of the full
+ * Gram matrix from scratch (the previous update), of a likelihood evaluation (fitScales performs
+ * a few thousand of them) and, every few trials, of the acquisition optimization (main) is
+ * printed as whitespace-separated columns, e.g., for plotting with gnuplot:
+ *
+ *   plot "bo.dat" using 1:2 with lines title "updateGP", "" using 1:3 with lines title "full"
+ *
+ * usage: benchmark_BayesianOptimization [number of trials] [acquisition every n trials]
+ */
+
+double millisecondsSince(const std::chrono::high_resolution_clock::time_point& begin) {
+  return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() -
+                                                   begin)
+      .count();
+}
+
+int main(int argc, char* argv[]) {
+  const size_t numberTrials = (argc > 1) ? std::atoi(argv[1]) : 1000;
+  const size_t acquisitionInterval = (argc > 2) ? std::atoi(argv[2]) : 100;
+  const size_t numberRandom = 10;
+
+  sgpp::optimization::Printer::getInstance().disableStatusPrinting();
+
+  std::vector<int> discOptions = {4};
+  std::vector<int> catOptions = {2};
+  sgpp::datadriven::BOConfig prototype(&discOptions, &catOptions, 3);
+  std::mt19937 generator(42);
+
+  auto score = [](sgpp::datadriven::BOConfig& config) {
+    double result = 0.1 * config.getDisc(0) + 0.2 * config.getCat(0);
+
+    for (size_t k = 0; k < config.getContSize(); k++) {
+      result += std::sin(5.0 * config.getCont(k) + static_cast<double>(k));
+    }
+
+    return result;
+  };
+
+  std::vector<sgpp::datadriven::BOConfig> configs;
+
+  for (size_t i = 0; i < numberRandom; i++) {
+    configs.emplace_back(prototype);
+    configs.back().randomize(generator);
+    configs.back().setScore(score(configs.back()));
+  }
+
+  sgpp::datadriven::BayesianOptimization bo(configs);
+  sgpp::base::DataVector scales(prototype.getNPar() + 1, 1.0);
+
+  std::cout << "# trials  updateGP[ms]  fullDecomposition[ms]  likelihood[ms]  main[ms]\n";
+
+  for (size_t trial = numberRandom; trial < numberTrials; trial++) {
+    sgpp::datadriven::BOConfig next(prototype);
+    next.randomize(generator);
+    next.setScore(score(next));
+    configs.push_back(next);
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    bo.updateGP(next, true);
+    const double updateTime = millisecondsSince(begin);
+
+    // reference: assembly and decomposition of the Gram matrix from scratch
+    const size_t size = configs.size();
+    begin = std::chrono::high_resolution_clock::now();
+    sgpp::base::DataMatrix gram(size, size);
+
+    for (size_t i = 0; i < size; i++) {
+      for (size_t k = 0; k < i; k++) {
+        const double value = bo.kernel(configs[i].getScaledDistance(configs[k], scales));
+        gram.set(i, k, value);
+        gram.set(k, i, value);
+      }
+
+      gram.set(i, i, 1.0 + std::pow(10.0, -10.0));
+    }
+
+    sgpp::base::DataMatrix factor;
+    bo.decomposeCholesky(gram, factor);
+    const double fullTime = millisecondsSince(begin);
+
+    begin = std::chrono::high_resolution_clock::now();
+    bo.likelihood(scales);
+    const double likelihoodTime = millisecondsSince(begin);
+
+    std::cout << size << " " << updateTime << " " << fullTime << " " << likelihoodTime;
+
+    if ((trial + 1) % acquisitionInterval == 0) {
+      begin = std::chrono::high_resolution_clock::now();
+      bo.main(prototype);
+      std::cout << " " << millisecondsSince(begin);
+    }
+
+    std::cout << "\n";
+  }
+
+  return 0;
+}
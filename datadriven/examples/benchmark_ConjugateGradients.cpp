@@ -0,0 +1,167 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+#include <sgpp/datadriven/algorithm/DensitySystemMatrix.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/precond/HierarchicalPreconditioner.hpp>
+#include <sgpp/solver/sle/precond/JacobiPreconditioner.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * \page example_benchmark_ConjugateGradients_cpp Preconditioned and pipelined CG
+ * Compares the number of iterations and the time to solution of solver::ConjugateGradients
+ * without preconditioner, with a JacobiPreconditioner and with a HierarchicalPreconditioner,
+ * each in the standard and in the pipelined variant, for
+ * - the regression system (DMSystemMatrix) of the Friedman 3 training data with identity and
+ *   diagonal (OperationDiagonal) regularization and
+ * - the density estimation system (DensitySystemMatrix) of a 3D data set.
+ *
+ * usage: benchmark_ConjugateGradients [level] [lambda] [epsilon] [level base]
+ */
+
+double secondsSince(const std::chrono::high_resolution_clock::time_point& begin) {
+  return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin)
+      .count();
+}
+
+void benchmark(const std::string& name, sgpp::base::OperationMatrix& systemMatrix,
+               sgpp::base::DataVector& b, sgpp::solver::Preconditioner* jacobi,
+               sgpp::solver::Preconditioner* hierarchical, double epsilon) {
+  const std::string preconditionerNames[] = {"none", "Jacobi", "hierarchical"};
+  sgpp::solver::Preconditioner* preconditioners[] = {nullptr, jacobi, hierarchical};
+  sgpp::base::DataVector reference;
+
+  std::cout << name << ", " << b.getSize() << " unknowns" << std::endl;
+
+  for (size_t k = 0; k < 3; k++) {
+    for (bool pipelined : {false, true}) {
+      if ((k > 0) && (preconditioners[k] == nullptr)) {
+        continue;
+      }
+
+      sgpp::solver::ConjugateGradients solver(100000, epsilon);
+      solver.setPreconditioner(preconditioners[k]);
+      solver.setPipelined(pipelined);
+
+      sgpp::base::DataVector alpha(b.getSize());
+      const auto begin = std::chrono::high_resolution_clock::now();
+      solver.solve(systemMatrix, alpha, b, false, false);
+      const double time = secondsSince(begin);
+
+      if (reference.getSize() == 0) {
+        reference = alpha;
+      }
+
+      sgpp::base::DataVector difference(alpha);
+      difference.sub(reference);
+
+      std::cout << "  " << std::left << std::setw(13) << preconditionerNames[k] << std::setw(10)
+                << (pipelined ? "pipelined" : "standard") << std::right << std::setw(7)
+                << solver.getNumberIterations() << " it. " << std::setw(10) << time << " s"
+                << "  |alpha - alpha_ref|_inf = " << difference.maxNorm() << std::endl;
+    }
+  }
+
+  std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  const int level = (argc > 1) ? std::atoi(argv[1]) : 4;
+  const double lambda = (argc > 2) ? std::atof(argv[2]) : 1e-4;
+  const double epsilon = (argc > 3) ? std::atof(argv[3]) : 1e-8;
+  const double levelBase = (argc > 4) ? std::atof(argv[4]) : 2.0;
+
+  // regression
+  {
+    sgpp::datadriven::Dataset dataset = sgpp::datadriven::ARFFTools::readARFFFromFile(
+        "../datasets/friedman/friedman3_10k_train.arff");
+    // the first column of the Friedman 3 files is the index of the sample
+    const size_t dim = dataset.getDimension() - 1;
+    const double numData = static_cast<double>(dataset.getNumberInstances());
+    sgpp::base::DataMatrix data(dataset.getNumberInstances(), dim);
+
+    for (size_t k = 0; k < dataset.getNumberInstances(); k++) {
+      for (size_t t = 0; t < dim; t++) {
+        data.set(k, t, dataset.getData().get(k, t + 1));
+      }
+    }
+
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(level);
+
+    // for uniformly distributed data, the diagonal of B^T B is approximately
+    // M (1/3)^d 2^(-(|l|_1 - d)) for piecewise linear basis functions
+    const double dataScale = numData * std::pow(1.0 / 3.0, static_cast<double>(dim));
+
+    // identity regularization
+    {
+      std::shared_ptr<sgpp::base::OperationMatrix> C(
+          sgpp::op_factory::createOperationIdentity(*grid));
+      sgpp::datadriven::DMSystemMatrix systemMatrix(*grid, data, C, lambda);
+      sgpp::base::DataVector b(grid->getSize());
+      systemMatrix.generateb(dataset.getTargets(), b);
+
+      sgpp::solver::HierarchicalPreconditioner hierarchical(&grid->getStorage(), levelBase,
+                                                            numData * lambda / dataScale);
+      benchmark("regression (Friedman 3, identity regularization)", systemMatrix, b, nullptr,
+                &hierarchical, epsilon);
+    }
+
+    // diagonal regularization, the regularization operator yields the Jacobi preconditioner
+    {
+      std::shared_ptr<sgpp::base::OperationMatrix> C(
+          sgpp::op_factory::createOperationDiagonal(*grid, 0.25));
+      sgpp::datadriven::DMSystemMatrix systemMatrix(*grid, data, C, lambda);
+      sgpp::base::DataVector b(grid->getSize());
+      systemMatrix.generateb(dataset.getTargets(), b);
+
+      sgpp::solver::JacobiPreconditioner jacobi(*C, numData * lambda, dataScale);
+      sgpp::solver::HierarchicalPreconditioner hierarchical(&grid->getStorage(), levelBase,
+                                                            numData * lambda / dataScale);
+      benchmark("regression (Friedman 3, diagonal regularization)", systemMatrix, b, &jacobi,
+                &hierarchical, epsilon);
+    }
+  }
+
+  // density estimation
+  {
+    sgpp::datadriven::Dataset dataset = sgpp::datadriven::CSVTools::readCSVFromFile(
+        "../datasets/densityEstimation/3D_KurB4B1.csv", false, false);
+    sgpp::base::DataMatrix& data = dataset.getData();
+    const size_t dim = dataset.getDimension();
+
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(level + 1);
+
+    // the diagonal of the L2 dot product matrix is (1/3)^d 2^(-(|l|_1 - d))
+    const double massScale = std::pow(1.0 / 3.0, static_cast<double>(dim));
+
+    // the system matrix takes ownership of the regularization operator
+    sgpp::base::OperationMatrix* C = sgpp::op_factory::createOperationDiagonal(*grid, 0.25);
+    sgpp::datadriven::DensitySystemMatrix systemMatrix(*grid, data, C, lambda);
+    sgpp::base::DataVector b(grid->getSize());
+    systemMatrix.generateb(b);
+
+    sgpp::solver::JacobiPreconditioner jacobi(*C, lambda, massScale);
+    sgpp::solver::HierarchicalPreconditioner hierarchical(&grid->getStorage(), levelBase,
+                                                          lambda / massScale);
+    benchmark("density estimation (3D_KurB4B1, diagonal regularization)", systemMatrix, b,
+              &jacobi, &hierarchical, epsilon);
+  }
+
+  return 0;
+}
@@ -0,0 +1,99 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ * Compares reading a CSV file with the stream-based CSVTools::readCSV, the memory-mapped
+ * TextDataReader and the CSVFileSampleProvider (in batches). A random CSV file is generated
+ * first and removed afterwards.
+ *
+ * usage: benchmark_TextDataReader [number of instances] [dimension] [batch size]
+ */
+
+double secondsSince(const std::chrono::high_resolution_clock::time_point& begin) {
+  return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin)
+      .count();
+}
+
+int main(int argc, char* argv[]) {
+  const size_t numberInstances = (argc > 1) ? std::atoi(argv[1]) : 200000;
+  const size_t dim = (argc > 2) ? std::atoi(argv[2]) : 10;
+  const size_t batchSize = (argc > 3) ? std::atoi(argv[3]) : 10000;
+  const std::string fileName = "benchmark_TextDataReader.csv";
+
+  {
+    std::ofstream file(fileName);
+    std::mt19937_64 generator(42);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    file.precision(17);
+
+    for (size_t d = 0; d < dim; d++) {
+      file << "x" << d << ",";
+    }
+
+    file << "class\n";
+
+    for (size_t i = 0; i < numberInstances; i++) {
+      for (size_t d = 0; d < dim; d++) {
+        file << distribution(generator) << ",";
+      }
+
+      file << ((i % 2 == 0) ? 1 : -1) << "\n";
+    }
+  }
+
+  std::cout << "instances = " << numberInstances << ", dim = " << dim << "\n\n";
+
+  double checksum = 0.0;
+  auto begin = std::chrono::high_resolution_clock::now();
+  {
+    std::ifstream stream(fileName);
+    sgpp::datadriven::Dataset dataset = sgpp::datadriven::CSVTools::readCSV(stream, true);
+    checksum = dataset.getData().sum();
+  }
+  std::cout << "CSVTools::readCSV (stream):  " << secondsSince(begin) << " s\t(checksum "
+            << checksum << ")\n";
+
+  begin = std::chrono::high_resolution_clock::now();
+  {
+    sgpp::datadriven::TextDataReader reader(fileName, sgpp::datadriven::TextDataFormat::CSV,
+                                            true, true);
+    const double indexTime = secondsSince(begin);
+    sgpp::datadriven::Dataset dataset = reader.readAll();
+    checksum = dataset.getData().sum();
+    std::cout << "TextDataReader:              " << secondsSince(begin) << " s\t(checksum "
+              << checksum << ", index " << indexTime << " s)\n";
+  }
+
+  begin = std::chrono::high_resolution_clock::now();
+  {
+    sgpp::datadriven::CSVFileSampleProvider sampleProvider;
+    sampleProvider.readFile(fileName, true);
+    checksum = 0.0;
+
+    for (size_t i = 0; i < sampleProvider.getNumSamples(); i += batchSize) {
+      std::unique_ptr<sgpp::datadriven::Dataset> batch(sampleProvider.getNextSamples(batchSize));
+      checksum += batch->getData().sum();
+    }
+  }
+  std::cout << "CSVFileSampleProvider:       " << secondsSince(begin) << " s\t(checksum "
+            << checksum << ", batches of " << batchSize << ")\n";
+
+  std::remove(fileName.c_str());
+  return 0;
+}
@@ -214,6 +214,6 @@ int main() {
   std::cout << "Matrix build.\nBegin decomposition..." << std::endl;
   offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
   // offline->printMatrix();
-    offline->store(filename);
+    offline->store(filename, grid.get());
   }
 }
@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/BinaryDatasetReader.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetWriter.hpp>
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/**
+ * Converts a CSV or ARFF file (with targets in the last column) to the binary dataset format
+ * that can be read by the BinaryFileSampleProvider (file type "bin" in data mining
+ * configurations). The format of the input is determined by its extension.
+ *
+ * usage: convertToBinaryDataset <input.csv|input.arff> <output.bin> [row|column] [double|float]
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cout << "usage: " << argv[0]
+              << " <input.csv|input.arff> <output.bin> [row|column] [double|float]\n";
+    return 1;
+  }
+
+  const std::string inputFileName = argv[1];
+  const std::string outputFileName = argv[2];
+  const bool isArff = (inputFileName.size() >= 5) &&
+                      (inputFileName.compare(inputFileName.size() - 5, 5, ".arff") == 0);
+  const sgpp::datadriven::BinaryDatasetLayout layout =
+      ((argc > 3) && (std::string(argv[3]) == "column"))
+          ? sgpp::datadriven::BinaryDatasetLayout::COLUMN_MAJOR
+          : sgpp::datadriven::BinaryDatasetLayout::ROW_MAJOR;
+  const sgpp::datadriven::BinaryDatasetPrecision precision =
+      ((argc > 4) && (std::string(argv[4]) == "float"))
+          ? sgpp::datadriven::BinaryDatasetPrecision::FLOAT
+          : sgpp::datadriven::BinaryDatasetPrecision::DOUBLE;
+
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  // CSV files are expected to contain a line with the column titles
+  sgpp::datadriven::TextDataReader textReader(
+      inputFileName,
+      isArff ? sgpp::datadriven::TextDataFormat::ARFF : sgpp::datadriven::TextDataFormat::CSV,
+      !isArff, true);
+  sgpp::datadriven::BinaryDatasetWriter::convert(textReader, outputFileName, layout, precision);
+
+  std::cout << "converted " << textReader.getNumberInstances() << " samples of dimension "
+            << textReader.getDimension() << " in "
+            << std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin)
+                   .count()
+            << " s\n";
+
+  // opening the binary file only maps it
+  begin = std::chrono::high_resolution_clock::now();
+  sgpp::datadriven::BinaryDatasetReader binaryReader(outputFileName);
+  const double checksum = binaryReader.readAll().getData().sum();
+  std::cout << "read binary file in "
+            << std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin)
+                   .count()
+            << " s (checksum " << checksum << ")\n";
+
+  return 0;
+}
@@ -88,6 +88,7 @@
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBspline/OperationMultiEvalStreamingBspline.hpp>
 
 #ifdef __AVX__
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
@@ -517,6 +518,9 @@ base::OperationMultipleEval* createOperationMultipleEval(
     }
   } else if (grid.getType() == base::GridType::Bspline) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingBspline(grid, dataset);
+      }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCL) {
 #ifdef USE_OCL
         return datadriven::createStreamingBSplineOCLConfigured(grid, dataset, configuration);
@@ -526,6 +530,14 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       }
     }
+  } else if ((grid.getType() == base::GridType::ModBspline) ||
+             (grid.getType() == base::GridType::BsplineBoundary) ||
+             (grid.getType() == base::GridType::BsplineClenshawCurtis) ||
+             (grid.getType() == base::GridType::ModBsplineClenshawCurtis)) {
+    if ((configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) &&
+        (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT)) {
+      return new datadriven::OperationMultiEvalStreamingBspline(grid, dataset);
+    }
   } else if (grid.getType() == base::GridType::Poly) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::CUDA) {
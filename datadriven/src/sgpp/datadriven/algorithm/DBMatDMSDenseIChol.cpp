@@ -10,6 +10,7 @@
  */
 
 #include <sgpp/datadriven/algorithm/DBMatDMSDenseIChol.hpp>
+#include <sgpp/datadriven/algorithm/LTwoDotMatrixBuilder.hpp>
 
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
@@ -27,10 +28,14 @@ DBMatDMSDenseIChol::DBMatDMSDenseIChol(
     : DBMatDMSChol{}, densityEstimationConfig{densityEstimationConfig}, proxyMatrix{} {
   // initialize proxy matrix if we do cv
   if (doCV) {
-    auto size = grid.getStorage().getSize();
-    proxyMatrix.resizeQuadratic(size);
-    std::unique_ptr<OperationMatrix> op(
-        sgpp::op_factory::createOperationLTwoDotExplicit(&proxyMatrix, grid));
+    if (LTwoDotMatrixBuilder::isSupported(grid)) {
+      LTwoDotMatrixBuilder(grid).buildDense(proxyMatrix);
+    } else {
+      auto size = grid.getStorage().getSize();
+      proxyMatrix.resizeQuadratic(size);
+      std::unique_ptr<OperationMatrix> op(
+          sgpp::op_factory::createOperationLTwoDotExplicit(&proxyMatrix, grid));
+    }
 
     // set regularization parameter
     updateProxyMatrixLambda(lambda);
@@ -13,7 +13,13 @@
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
 
+#include <sys/stat.h>
+
 #include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 namespace sgpp {
@@ -30,6 +36,46 @@ const std::string keyRegularizationStrength = "lambda";
 const std::string keyDecompositionType = "decomposition";
 const std::string keyFilepath = "filepath";
 
+namespace {
+
+/**
+ * Process-wide LRU cache of loaded offline objects, keyed by the file path.
+ */
+struct OfflineObjectCache {
+  struct Entry {
+    std::shared_ptr<DBMatOffline> offline;
+    size_t fileSize;
+    time_t modificationTime;
+    std::list<std::string>::iterator position;
+  };
+
+  std::mutex mutex;
+  std::map<std::string, Entry> entries;
+  // most recently used file first
+  std::list<std::string> order;
+  size_t capacity = size_t(2) << 30;
+  size_t size = 0;
+
+  void erase(std::map<std::string, Entry>::iterator it) {
+    size -= it->second.fileSize;
+    order.erase(it->second.position);
+    entries.erase(it);
+  }
+
+  void evict() {
+    while (size > capacity) {
+      erase(entries.find(order.back()));
+    }
+  }
+};
+
+OfflineObjectCache& getCache() {
+  static OfflineObjectCache cache;
+  return cache;
+}
+
+}  // namespace
+
 DBMatDatabase::DBMatDatabase(const std::string& filepath) {
   databaseFilepath = filepath;
   databaseRoot = std::make_unique<json::JSON>(filepath);
@@ -273,6 +319,87 @@ int DBMatDatabase::entryIndexByConfiguration(
   }
   return -1;
 }
+
+DBMatOffline* DBMatDatabase::getOfflineObject(
+    sgpp::base::GeneralGridConfiguration& gridConfig,
+    sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+    sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+    sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig) {
+  return loadOfflineObject(
+      getDataMatrix(gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig));
+}
+
+DBMatOffline* DBMatDatabase::loadOfflineObject(const std::string& filepath) {
+  struct stat status;
+
+  if (stat(filepath.c_str(), &status) != 0) {
+    throw sgpp::base::data_exception("DBMatDatabase: matrix file does not exist");
+  }
+
+  const size_t fileSize = static_cast<size_t>(status.st_size);
+  OfflineObjectCache& cache = getCache();
+  std::shared_ptr<DBMatOffline> offline;
+
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.entries.find(filepath);
+
+    if (it != cache.entries.end()) {
+      if ((it->second.fileSize == fileSize) &&
+          (it->second.modificationTime == status.st_mtime)) {
+        cache.order.splice(cache.order.begin(), cache.order, it->second.position);
+        offline = it->second.offline;
+      } else {
+        // the file has changed since it was cached
+        cache.erase(it);
+      }
+    }
+  }
+
+  if (offline != nullptr) {
+    // copying does not modify the cached object, so no lock is needed
+    return offline->clone();
+  }
+
+  offline.reset(DBMatOfflineFactory::buildFromFile(filepath));
+
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    if ((fileSize <= cache.capacity) &&
+        (cache.entries.find(filepath) == cache.entries.end())) {
+      cache.order.push_front(filepath);
+      cache.entries[filepath] =
+          OfflineObjectCache::Entry{offline, fileSize, status.st_mtime, cache.order.begin()};
+      cache.size += fileSize;
+      cache.evict();
+    }
+  }
+
+  return offline->clone();
+}
+
+void DBMatDatabase::setCacheCapacity(size_t capacity) {
+  OfflineObjectCache& cache = getCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.capacity = capacity;
+  cache.evict();
+}
+
+void DBMatDatabase::clearCache() {
+  OfflineObjectCache& cache = getCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.entries.clear();
+  cache.order.clear();
+  cache.size = 0;
+}
+
+size_t DBMatDatabase::getCacheSize() {
+  OfflineObjectCache& cache = getCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.size;
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
 
@@ -73,6 +73,47 @@ class DBMatDatabase{
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
       std::string filepath, bool overwriteEntry = false);
 
+  /**
+   * Loads the decomposition that matches the configurations, see getDataMatrix and
+   * loadOfflineObject.
+   * @param gridConfig the grid configuration the matrix must match
+   * @param adaptivityConfig the adaptivity configuration the matrix must match
+   * @param regularizationConfig the regularization configuration the matrix must match
+   * @param densityEstimationConfig the density estimation configuration the matrix must match
+   * @return new instance of DBMatOffline implementor owned by caller
+   */
+  DBMatOffline* getOfflineObject(sgpp::base::GeneralGridConfiguration& gridConfig,
+      sgpp::base::AdaptivityConfiguration& adaptivityConfig,
+      sgpp::datadriven::RegularizationConfiguration& regularizationConfig,
+      sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig);
+
+  /**
+   * Loads a decomposition from a file through a process-wide LRU cache. If the file was loaded
+   * before and has not been modified since (size and modification time), the cached object is
+   * copied instead of reading the file again. Online objects modify their offline object, so the
+   * caller always receives its own copy.
+   * @param filepath the path of the matrix decomposition
+   * @return new instance of DBMatOffline implementor owned by caller
+   */
+  static DBMatOffline* loadOfflineObject(const std::string& filepath);
+
+  /**
+   * Sets the capacity of the cache, least recently used decompositions are evicted if the
+   * total size of the cached files exceeds the capacity. A capacity of 0 disables the cache.
+   * @param capacity the capacity in bytes (default is 2 GiB)
+   */
+  static void setCacheCapacity(size_t capacity);
+
+  /**
+   * Removes all decompositions from the cache.
+   */
+  static void clearCache();
+
+  /**
+   * @return the total size in bytes of the files whose decompositions are cached
+   */
+  static size_t getCacheSize();
+
 
  private:
   /**
@@ -14,13 +14,11 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
+#include <sgpp/datadriven/algorithm/LTwoDotMatrixBuilder.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_matrix_double.h>
-#endif /* USE_GSL */
-
 #include <math.h>
 #include <stdio.h>
 #include <algorithm>
@@ -120,55 +118,49 @@ void DBMatOffline::buildMatrix(Grid* grid, RegularizationConfiguration& regulari
   size_t size = grid->getStorage().getSize();  // Size of the (quadratic) matrices A and C
 
   // Construct matrix A
-  lhsMatrix = DataMatrix(size, size);
+  if (LTwoDotMatrixBuilder::isSupported(*grid)) {
+    // every pair in the upper triangle is visited, but the integral is skipped early
+    // if the supports of the two basis functions do not overlap
+    LTwoDotMatrixBuilder(*grid).buildDense(lhsMatrix);
+  } else {
+    lhsMatrix = DataMatrix(size, size);
+
+    std::unique_ptr<OperationMatrix> op(
+        op_factory::createOperationLTwoDotExplicit(&lhsMatrix, *grid));
+  }
 
-  std::unique_ptr<OperationMatrix> op(
-      op_factory::createOperationLTwoDotExplicit(&lhsMatrix, *grid));
   isConstructed = true;
 }
 
-void DBMatOffline::store(const std::string& fileName) {
-#ifdef USE_GSL
+void DBMatOffline::store(const std::string& fileName, Grid* grid,
+                         const std::string& configuration) {
+  storeMatrices(fileName, {&lhsMatrix}, grid, configuration);
+}
+
+void DBMatOffline::storeMatrices(const std::string& fileName,
+                                 const std::vector<const DataMatrix*>& matrices, Grid* grid,
+                                 const std::string& configuration) {
   if (!isDecomposed) {
     throw algorithm_exception("Matrix not decomposed yet");
-    return;
   }
 
-  // Write configuration
-  std::ofstream outputFile(fileName, std::ofstream::out);
-
-  if (!outputFile) {
-    throw algorithm_exception{"cannot open file for writing"};
-  }
-
-  std::string inter = "," + std::to_string(interactions.size());
-  for (std::vector<size_t> i : interactions) {
-    inter.append("," + std::to_string(i.size()));
-    for (size_t j : i) {
-      inter.append("," + std::to_string(j));
-    }
-  }
+  DBMatOfflineFile::write(fileName, getDecompositionType(), matrices, interactions, grid,
+                          configuration);
+}
 
-  outputFile << lhsMatrix.getNrows() << "," << lhsMatrix.getNcols() << ","
-             << static_cast<int>(getDecompositionType()) << inter << "\n";
-  outputFile.close();
+void DBMatOffline::load(const DBMatOfflineFile& file) { loadDecomposition(file, 1); }
 
-  // write matrix
-  // switch to c FILE API for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
+void DBMatOffline::loadDecomposition(const DBMatOfflineFile& file, size_t numberOfMatrices) {
+  if (file.getDecompositionType() != getDecompositionType()) {
+    throw algorithm_exception("DBMatOffline: decomposition type of the file does not match");
+  } else if (file.getNumberOfMatrices() != numberOfMatrices) {
+    throw algorithm_exception("DBMatOffline: unexpected number of matrices in the file");
   }
-  gsl_matrix_view matrixView =
-      gsl_matrix_view_array(lhsMatrix.getPointer(), lhsMatrix.getNrows(), lhsMatrix.getNcols());
-  gsl_matrix_fwrite(outputCFile, &matrixView.matrix);
 
-  fclose(outputCFile);
-  std::cout << "Stored " << lhsMatrix.getNrows() << "x" << lhsMatrix.getNcols() << " matrix"
-            << std::endl;
-#else
-  throw base::not_implemented_exception("built withot GSL");
-#endif /* USE_GSL */
+  interactions = file.getInteractions();
+  file.readMatrix(0, lhsMatrix);
+  isConstructed = true;
+  isDecomposed = true;
 }
 
 void DBMatOffline::printMatrix() {
@@ -182,6 +174,11 @@ void DBMatOffline::printMatrix() {
 
 void sgpp::datadriven::DBMatOffline::parseInter(
     const std::string& fileName, std::vector<std::vector<size_t>>& interactions) const {
+  if (DBMatOfflineFile::isBinaryFile(fileName)) {
+    throw algorithm_exception(
+        "Binary DBMatOffline files have to be loaded with DBMatOfflineFactory::buildFromFile");
+  }
+
   std::ifstream file(fileName, std::istream::in);
   // Read configuration
   if (!file) {
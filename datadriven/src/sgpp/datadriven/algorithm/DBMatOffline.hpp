@@ -24,6 +24,8 @@ using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 
+class DBMatOfflineFile;
+
 /**
  * Class that is used to decompose and store the left-hand-side
  * matrix for the density based classification approach
@@ -133,10 +135,20 @@ class DBMatOffline {
   void printMatrix();
 
   /**
-   * Serialize the DBMatOffline Object
+   * Serialize the DBMatOffline Object into a binary DBMatOfflineFile
    * @param fileName path where to store the file.
+   * @param grid the grid the decomposition belongs to, stored alongside if given
+   * @param configuration free-form description of the configuration, stored alongside
    */
-  virtual void store(const std::string& fileName);
+  virtual void store(const std::string& fileName, Grid* grid = nullptr,
+                     const std::string& configuration = "");
+
+  /**
+   * Restores the decomposition from a binary DBMatOfflineFile, the decomposition type of the file
+   * has to match the type of this object.
+   * @param file the opened file
+   */
+  virtual void load(const DBMatOfflineFile& file);
 
   /**
    * Returns the dimensionality of the quadratic lhs matrix (i.e. the number of rows)
@@ -171,6 +183,25 @@ class DBMatOffline {
    */
   void parseInter(const std::string& fileName,
                   std::vector<std::vector<size_t>>& interactions) const;
+
+  /**
+   * Writes the given matrices together with the interactions into a binary DBMatOfflineFile.
+   * @param fileName path where to store the file
+   * @param matrices the matrices that describe the decomposition, lhsMatrix first
+   * @param grid the grid the decomposition belongs to (optional)
+   * @param configuration description of the configuration (optional)
+   */
+  void storeMatrices(const std::string& fileName,
+                     const std::vector<const DataMatrix*>& matrices, Grid* grid,
+                     const std::string& configuration);
+
+  /**
+   * Checks decomposition type and number of matrices of a file, then reads the interactions and
+   * the lhsMatrix (the first matrix of the file).
+   * @param file the opened file
+   * @param numberOfMatrices the number of matrices this decomposition type stores
+   */
+  void loadDecomposition(const DBMatOfflineFile& file, size_t numberOfMatrices);
 };
 
 }  // namespace datadriven
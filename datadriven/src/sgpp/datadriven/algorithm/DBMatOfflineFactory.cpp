@@ -15,10 +15,12 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineDenseIChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineLU.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -79,6 +81,19 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 }
 
 DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
+  if (DBMatOfflineFile::isBinaryFile(fileName)) {
+    DBMatOfflineFile binaryFile(fileName);
+    DensityEstimationConfiguration densityEstimationConfig;
+    densityEstimationConfig.decomposition_ = binaryFile.getDecompositionType();
+
+    std::unique_ptr<DBMatOffline> offline(buildOfflineObject(
+        sgpp::base::GeneralGridConfiguration(), sgpp::base::AdaptivityConfiguration(),
+        RegularizationConfiguration(), densityEstimationConfig));
+    offline->load(binaryFile);
+    return offline.release();
+  }
+
+  // legacy format: text header followed by the matrices written by GSL
 #ifdef USE_GSL
   std::ifstream file(fileName, std::istream::in);
 
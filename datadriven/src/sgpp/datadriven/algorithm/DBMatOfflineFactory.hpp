@@ -39,6 +39,8 @@ DBMatOffline* buildOfflineObject(
 
 /**
  * Read a serialized DBMatOffline object and construct a new object with the information.
+ * Both binary files (see DBMatOfflineFile) and files in the legacy text header format are
+ * supported; the latter require GSL.
  * @param fname Path to the serialized DBMatOffline object.
  * @return new instance of DBMatOffline implementor owned by caller.
  */
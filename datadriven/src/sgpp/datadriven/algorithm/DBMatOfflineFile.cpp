@@ -0,0 +1,358 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/serialization/BinaryGridSerializer.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+const char MAGIC[8] = {'S', 'G', 'D', 'B', 'M', 'A', 'T', '\0'};
+
+/**
+ * Incremental checksum of a sequence of 64 bit words. The words are distributed round-robin
+ * on four independent multiply-xor lanes, which are combined at the end.
+ */
+class Checksum {
+ public:
+  Checksum() : lanes{0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL,
+                     0x9e3779b97f4a7c15ULL, 0x7f4a7c159e3779b9ULL}, position(0) {}
+
+  /**
+   * @param data  next bytes of the sequence
+   * @param size  number of bytes (multiple of 8)
+   */
+  void update(const char* data, size_t size) {
+    const size_t n = size / 8;
+    size_t i = 0;
+
+    // continue with the lane of the current position
+    for (; (i < n) && (position % 4 != 0); i++) {
+      mix(lanes[position % 4], load(data + 8 * i));
+      position++;
+    }
+
+    for (; i + 4 <= n; i += 4) {
+      mix(lanes[0], load(data + 8 * i));
+      mix(lanes[1], load(data + 8 * i + 8));
+      mix(lanes[2], load(data + 8 * i + 16));
+      mix(lanes[3], load(data + 8 * i + 24));
+      position += 4;
+    }
+
+    for (; i < n; i++) {
+      mix(lanes[position % 4], load(data + 8 * i));
+      position++;
+    }
+  }
+
+  /**
+   * @return checksum of the sequence so far
+   */
+  uint64_t value() const {
+    uint64_t result = position;
+
+    for (uint64_t lane : lanes) {
+      mix(result, lane);
+    }
+
+    return result;
+  }
+
+ private:
+  uint64_t lanes[4];
+  uint64_t position;
+
+  static uint64_t load(const char* data) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+  }
+
+  static void mix(uint64_t& lane, uint64_t word) {
+    lane = (lane ^ word) * 0x100000001b3ULL;
+    lane ^= lane >> 29;
+  }
+};
+
+uint64_t alignOffset(uint64_t offset) {
+  return (offset + DBMatOfflineFile::ALIGNMENT - 1) / DBMatOfflineFile::ALIGNMENT *
+         DBMatOfflineFile::ALIGNMENT;
+}
+
+}  // namespace
+
+DBMatOfflineFile::DBMatOfflineFile(const std::string& fileName, bool verifyChecksum)
+    : file(new base::MemoryMappedFile(fileName)),
+      header(),
+      matrixTable(nullptr),
+      interactionsOffset(0),
+      gridOffset(0),
+      configurationOffset(0) {
+  const char* data = file->getData();
+  const size_t size = file->getSize();
+
+  if ((size < sizeof(header)) || (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)) {
+    throw base::file_exception("DBMatOfflineFile: not a binary DBMatOffline file");
+  }
+
+  std::memcpy(&header, data, sizeof(header));
+
+  if (header.byteOrderMark != BYTE_ORDER_MARK) {
+    throw base::file_exception("DBMatOfflineFile: file has a different byte order");
+  } else if (header.version > DBMAT_OFFLINE_FILE_VERSION) {
+    throw base::file_exception("DBMatOfflineFile: version of the file is too new");
+  } else if ((header.fileSize != size) || ((size - sizeof(header)) % 8 != 0)) {
+    throw base::file_exception("DBMatOfflineFile: file is truncated");
+  }
+
+  // check that all sections lie within the file
+  const size_t numberOfWords = size / 8;
+  interactionsOffset = sizeof(header) + 3 * 8 * static_cast<size_t>(header.numberOfMatrices);
+
+  if ((interactionsOffset > size) || (header.interactionsSize > numberOfWords) ||
+      (header.gridSize > size) || (header.configurationSize > size)) {
+    throw base::file_exception("DBMatOfflineFile: invalid section sizes");
+  }
+
+  gridOffset = interactionsOffset + 8 * static_cast<size_t>(header.interactionsSize);
+  configurationOffset = gridOffset + padded(static_cast<size_t>(header.gridSize));
+
+  if (configurationOffset + padded(static_cast<size_t>(header.configurationSize)) > size) {
+    throw base::file_exception("DBMatOfflineFile: invalid section sizes");
+  }
+
+  matrixTable = reinterpret_cast<const uint64_t*>(data + sizeof(header));
+
+  for (size_t i = 0; i < getNumberOfMatrices(); i++) {
+    const uint64_t rows = matrixTable[3 * i];
+    const uint64_t cols = matrixTable[3 * i + 1];
+    const uint64_t offset = matrixTable[3 * i + 2];
+
+    if ((offset % 8 != 0) || (offset > size) || ((rows > 0) && (cols > numberOfWords / rows)) ||
+        (rows * cols * 8 > size - offset)) {
+      throw base::file_exception("DBMatOfflineFile: invalid matrix table");
+    }
+  }
+
+  if (verifyChecksum) {
+    Checksum checksum;
+    checksum.update(data + sizeof(header), size - sizeof(header));
+
+    if (checksum.value() != header.checksum) {
+      throw base::file_exception("DBMatOfflineFile: checksum mismatch, file is corrupted");
+    }
+  }
+}
+
+void DBMatOfflineFile::write(const std::string& fileName,
+                             MatrixDecompositionType decompositionType,
+                             const std::vector<const base::DataMatrix*>& matrices,
+                             const std::vector<std::vector<size_t>>& interactions,
+                             base::Grid* grid, const std::string& configuration) {
+  // serialize the small sections first to compute the layout
+  std::vector<uint64_t> interactionsSection;
+  interactionsSection.push_back(interactions.size());
+
+  for (const std::vector<size_t>& term : interactions) {
+    interactionsSection.push_back(term.size());
+    interactionsSection.insert(interactionsSection.end(), term.begin(), term.end());
+  }
+
+  std::string gridSection;
+
+  if (grid != nullptr) {
+    std::ostringstream stream;
+    base::BinaryGridSerializer::writeGrid(*grid, stream);
+    gridSection = stream.str();
+  }
+
+  DBMatOfflineFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = DBMAT_OFFLINE_FILE_VERSION;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.decompositionType = static_cast<uint32_t>(decompositionType);
+  header.numberOfMatrices = static_cast<uint32_t>(matrices.size());
+  header.interactionsSize = interactionsSection.size();
+  header.gridSize = gridSection.size();
+  header.configurationSize = configuration.size();
+
+  std::vector<uint64_t> matrixTable;
+  uint64_t offset = sizeof(header) + 3 * 8 * matrices.size() + 8 * interactionsSection.size() +
+                    padded(gridSection.size()) + padded(configuration.size());
+
+  for (const base::DataMatrix* matrix : matrices) {
+    offset = alignOffset(offset);
+    matrixTable.push_back(matrix->getNrows());
+    matrixTable.push_back(matrix->getNcols());
+    matrixTable.push_back(offset);
+    offset += 8 * matrix->getNrows() * matrix->getNcols();
+  }
+
+  header.fileSize = offset;
+
+  std::ofstream stream(fileName, std::ofstream::binary);
+
+  if (!stream) {
+    throw base::file_exception("DBMatOfflineFile: cannot open file for writing");
+  }
+
+  // the header is written again after the checksum has been computed
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  Checksum checksum;
+  uint64_t position = sizeof(header);
+  const std::vector<char> zeros(ALIGNMENT, 0);
+  auto writeSection = [&](const char* data, size_t size, uint64_t end) {
+    const size_t words = size / 8 * 8;
+    stream.write(data, words);
+    checksum.update(data, words);
+    position += words;
+
+    if (words < size) {
+      // the checksum works on whole words, so the last bytes are padded first
+      char word[8] = {0};
+      std::memcpy(word, data + words, size - words);
+      stream.write(word, sizeof(word));
+      checksum.update(word, sizeof(word));
+      position += sizeof(word);
+    }
+
+    while (position < end) {
+      const size_t padding = static_cast<size_t>(std::min<uint64_t>(end - position, ALIGNMENT));
+      stream.write(zeros.data(), padding);
+      checksum.update(zeros.data(), padding);
+      position += padding;
+    }
+  };
+
+  writeSection(reinterpret_cast<const char*>(matrixTable.data()), 8 * matrixTable.size(),
+               position + 8 * matrixTable.size());
+  writeSection(reinterpret_cast<const char*>(interactionsSection.data()),
+               8 * interactionsSection.size(), position + 8 * interactionsSection.size());
+  writeSection(gridSection.data(), gridSection.size(), position + padded(gridSection.size()));
+  writeSection(configuration.data(), configuration.size(),
+               position + padded(configuration.size()));
+
+  for (size_t i = 0; i < matrices.size(); i++) {
+    // pad up to the aligned offset of the matrix, then write its values
+    writeSection(nullptr, 0, matrixTable[3 * i + 2]);
+    writeSection(reinterpret_cast<const char*>(matrices[i]->data()),
+                 8 * matrices[i]->getNrows() * matrices[i]->getNcols(),
+                 matrixTable[3 * i + 2] + 8 * matrices[i]->getNrows() * matrices[i]->getNcols());
+  }
+
+  header.checksum = checksum.value();
+  stream.seekp(0);
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  stream.close();
+
+  if (!stream) {
+    throw base::file_exception("DBMatOfflineFile: error while writing");
+  }
+}
+
+bool DBMatOfflineFile::isBinaryFile(const std::string& fileName) {
+  std::ifstream stream(fileName, std::ifstream::binary);
+  char magic[sizeof(MAGIC)];
+
+  if (!stream.read(magic, sizeof(magic))) {
+    return false;
+  }
+
+  return std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+size_t DBMatOfflineFile::getMatrixRows(size_t i) const {
+  if (i >= getNumberOfMatrices()) {
+    throw base::file_exception("DBMatOfflineFile: matrix index out of range");
+  }
+
+  return static_cast<size_t>(matrixTable[3 * i]);
+}
+
+size_t DBMatOfflineFile::getMatrixCols(size_t i) const {
+  if (i >= getNumberOfMatrices()) {
+    throw base::file_exception("DBMatOfflineFile: matrix index out of range");
+  }
+
+  return static_cast<size_t>(matrixTable[3 * i + 1]);
+}
+
+const double* DBMatOfflineFile::getMatrixData(size_t i) const {
+  if (i >= getNumberOfMatrices()) {
+    throw base::file_exception("DBMatOfflineFile: matrix index out of range");
+  }
+
+  return reinterpret_cast<const double*>(file->getData() + matrixTable[3 * i + 2]);
+}
+
+void DBMatOfflineFile::readMatrix(size_t i, base::DataMatrix& matrix) const {
+  const double* data = getMatrixData(i);
+  const size_t rows = getMatrixRows(i);
+  const size_t cols = getMatrixCols(i);
+
+  if ((matrix.getNrows() != rows) || (matrix.getNcols() != cols)) {
+    matrix = base::DataMatrix(rows, cols);
+  }
+
+  if (rows * cols > 0) {
+    std::memcpy(matrix.data(), data, rows * cols * sizeof(double));
+  }
+}
+
+std::vector<std::vector<size_t>> DBMatOfflineFile::getInteractions() const {
+  const uint64_t* values = reinterpret_cast<const uint64_t*>(file->getData() + interactionsOffset);
+  const size_t size = static_cast<size_t>(header.interactionsSize);
+  std::vector<std::vector<size_t>> interactions;
+
+  if (size == 0) {
+    return interactions;
+  }
+
+  const size_t numberOfTerms = static_cast<size_t>(values[0]);
+  size_t position = 1;
+
+  for (size_t t = 0; t < numberOfTerms; t++) {
+    if ((position >= size) || (values[position] > size - position - 1)) {
+      throw base::file_exception("DBMatOfflineFile: invalid interactions section");
+    }
+
+    const size_t termSize = static_cast<size_t>(values[position]);
+    interactions.emplace_back(values + position + 1, values + position + 1 + termSize);
+    position += termSize + 1;
+  }
+
+  return interactions;
+}
+
+base::Grid* DBMatOfflineFile::readGrid() const {
+  if (!containsGrid()) {
+    return nullptr;
+  }
+
+  std::istringstream stream(
+      std::string(file->getData() + gridOffset, static_cast<size_t>(header.gridSize)));
+  return base::BinaryGridSerializer::readGrid(stream);
+}
+
+std::string DBMatOfflineFile::getConfiguration() const {
+  return std::string(file->getData() + configurationOffset,
+                     static_cast<size_t>(header.configurationSize));
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,193 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/// version of the binary DBMatOffline format
+#define DBMAT_OFFLINE_FILE_VERSION 1
+
+/**
+ * Header of a binary DBMatOffline file.
+ *
+ * The header is followed by
+ * - a table with rows, columns and offset (uint64_t each) of every matrix,
+ * - the interaction terms (interactionsSize uint64_t values: the number of terms, then
+ *   for every term its size followed by its dimensions),
+ * - the grid (written by base::BinaryGridSerializer, may be empty),
+ * - a free-form description of the configuration (may be empty),
+ * - the matrices (row-major doubles, each aligned to DBMatOfflineFile::ALIGNMENT bytes).
+ * Every section is padded with zeros to a multiple of 8 bytes. The checksum is computed over
+ * everything after the header.
+ */
+struct DBMatOfflineFileHeader {
+  /// magic number "SGDBMAT"
+  char magic[8];
+  /// version of the format
+  uint32_t version;
+  /// used to detect files with a different byte order
+  uint32_t byteOrderMark;
+  /// MatrixDecompositionType
+  uint32_t decompositionType;
+  /// number of stored matrices
+  uint32_t numberOfMatrices;
+  /// number of uint64_t values of the interactions section
+  uint64_t interactionsSize;
+  /// size of the grid section in bytes (without padding)
+  uint64_t gridSize;
+  /// size of the configuration section in bytes (without padding)
+  uint64_t configurationSize;
+  /// size of the whole file in bytes
+  uint64_t fileSize;
+  /// checksum of the file content after the header
+  uint64_t checksum;
+};
+
+/**
+ * Binary container for decomposed DBMatOffline objects.
+ *
+ * Opening a file maps it into memory (base::MemoryMappedFile) and verifies its version and
+ * checksum. The matrices can then be accessed in place (getMatrixData) or copied with a single
+ * memcpy into a DataMatrix (readMatrix); in contrast to the old text header format, no
+ * intermediate GSL buffer is allocated, so loading needs no additional memory.
+ */
+class DBMatOfflineFile {
+ public:
+  /// alignment of the matrices in bytes
+  static const uint64_t ALIGNMENT = 64;
+  /// byte order mark
+  static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+  /**
+   * Constructor, maps the file and checks the header.
+   * Throws a file_exception if the file is not a valid binary DBMatOffline file.
+   *
+   * @param fileName        name of the file
+   * @param verifyChecksum  whether the checksum of the content is verified
+   */
+  explicit DBMatOfflineFile(const std::string& fileName, bool verifyChecksum = true);
+
+  /**
+   * Writes a binary DBMatOffline file.
+   *
+   * @param fileName          name of the file
+   * @param decompositionType type of the decomposition
+   * @param matrices          matrices of the decomposition
+   * @param interactions      interaction terms of the grid
+   * @param grid              grid the decomposition belongs to (optional)
+   * @param configuration     description of the configuration (optional)
+   */
+  static void write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                    const std::vector<const base::DataMatrix*>& matrices,
+                    const std::vector<std::vector<size_t>>& interactions,
+                    base::Grid* grid = nullptr, const std::string& configuration = "");
+
+  /**
+   * Checks if a file starts with the magic number of the binary format.
+   *
+   * @param fileName  name of the file
+   * @return whether the file is a binary DBMatOffline file
+   */
+  static bool isBinaryFile(const std::string& fileName);
+
+  /**
+   * @return type of the decomposition
+   */
+  MatrixDecompositionType getDecompositionType() const {
+    return static_cast<MatrixDecompositionType>(header.decompositionType);
+  }
+
+  /**
+   * @return number of stored matrices
+   */
+  size_t getNumberOfMatrices() const { return header.numberOfMatrices; }
+
+  /**
+   * @param i index of the matrix
+   * @return number of rows of the matrix
+   */
+  size_t getMatrixRows(size_t i) const;
+
+  /**
+   * @param i index of the matrix
+   * @return number of columns of the matrix
+   */
+  size_t getMatrixCols(size_t i) const;
+
+  /**
+   * @param i index of the matrix
+   * @return pointer to the (row-major) values of the matrix in the mapped file
+   */
+  const double* getMatrixData(size_t i) const;
+
+  /**
+   * Copies a matrix into a DataMatrix.
+   *
+   * @param i           index of the matrix
+   * @param[out] matrix matrix (resized accordingly)
+   */
+  void readMatrix(size_t i, base::DataMatrix& matrix) const;
+
+  /**
+   * @return interaction terms of the grid
+   */
+  std::vector<std::vector<size_t>> getInteractions() const;
+
+  /**
+   * @return whether the file contains a grid
+   */
+  bool containsGrid() const { return header.gridSize > 0; }
+
+  /**
+   * @return new grid (owned by the caller) or nullptr if the file does not contain a grid
+   */
+  base::Grid* readGrid() const;
+
+  /**
+   * @return description of the configuration
+   */
+  std::string getConfiguration() const;
+
+  /**
+   * @return size of the file in bytes
+   */
+  size_t getFileSize() const { return file->getSize(); }
+
+ protected:
+  /// mapped file
+  std::unique_ptr<base::MemoryMappedFile> file;
+  /// copy of the header
+  DBMatOfflineFileHeader header;
+  /// matrix table (rows, columns and offset for every matrix)
+  const uint64_t* matrixTable;
+  /// offset of the interactions section
+  size_t interactionsOffset;
+  /// offset of the grid section
+  size_t gridOffset;
+  /// offset of the configuration section
+  size_t configurationOffset;
+
+  /**
+   * @param size size of a section in bytes
+   * @return size rounded up to a multiple of 8
+   */
+  static size_t padded(size_t size) { return (size + 7) / 8 * 8; }
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -13,6 +13,7 @@
 #ifdef USE_GSL
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineLU.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
@@ -135,17 +136,29 @@ void DBMatOfflineLU::permuteVector(DataVector& b) {
   }
 }
 
-void DBMatOfflineLU::store(const std::string& fileName) {
-  // first store header and matrix
-  DBMatOffline::store(fileName);
-  // then store permutation.
-  // c file API needed for GSL
-  FILE* outputCFile = fopen(fileName.c_str(), "ab");
-  if (!outputCFile) {
-    throw algorithm_exception{"cannot open file for writing"};
+void DBMatOfflineLU::store(const std::string& fileName, Grid* grid,
+                           const std::string& configuration) {
+  // the permutation is stored as an additional 1 x n matrix
+  const size_t size = (permutation != nullptr) ? permutation->size : 0;
+  DataMatrix permutationMatrix(1, size);
+
+  for (size_t i = 0; i < size; i++) {
+    permutationMatrix.set(0, i, static_cast<double>(permutation->data[i]));
+  }
+
+  storeMatrices(fileName, {&lhsMatrix, &permutationMatrix}, grid, configuration);
+}
+
+void DBMatOfflineLU::load(const DBMatOfflineFile& file) {
+  loadDecomposition(file, 2);
+
+  const size_t size = file.getMatrixCols(1);
+  const double* values = file.getMatrixData(1);
+  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(size)};
+
+  for (size_t i = 0; i < size; i++) {
+    permutation->data[i] = static_cast<size_t>(values[i]);
   }
-  gsl_permutation_fwrite(outputCFile, permutation.get());
-  fclose(outputCFile);
 }
 
 sgpp::datadriven::MatrixDecompositionType DBMatOfflineLU::getDecompositionType() {
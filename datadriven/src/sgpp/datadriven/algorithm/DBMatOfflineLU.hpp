@@ -71,7 +71,20 @@ class DBMatOfflineLU : public DBMatOfflineGE {
    */
   void permuteVector(DataVector& b);
 
-  void store(const std::string& fname) override;
+  /**
+   * Serializes the factorization together with the permutation
+   * @param fileName path where to store the file
+   * @param grid the grid the decomposition belongs to (optional)
+   * @param configuration description of the configuration (optional)
+   */
+  void store(const std::string& fileName, Grid* grid = nullptr,
+             const std::string& configuration = "") override;
+
+  /**
+   * Restores factorization and permutation from a binary file
+   * @param file the opened file
+   */
+  void load(const DBMatOfflineFile& file) override;
 
  private:
   /**
@@ -10,6 +10,7 @@
 #include <gsl/gsl_vector.h>
 #endif /* USE_GSL */
 
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <string>
@@ -163,27 +164,16 @@ void DBMatOfflineOrthoAdapt::invert_symmetric_tridiag(sgpp::base::DataVector& di
 #endif /* USE_GSL */
 }
 
-void DBMatOfflineOrthoAdapt::store(const std::string& fileName) {
-#ifdef USE_GSL
-  DBMatOffline::store(fileName);
-
-  FILE* outCFile = fopen(fileName.c_str(), "ab");
-  if (!outCFile) {
-    throw sgpp::base::algorithm_exception{"cannot open file for writing"};
-  }
-
-  auto dim_a = getGridSize();
-  // store q_ortho_matrix_
-  gsl_matrix_view q_view = gsl_matrix_view_array(this->q_ortho_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &q_view.matrix);
-
-  // store t_inv_tridiag_
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(this->t_tridiag_inv_matrix_.getPointer(), dim_a, dim_a);
-  gsl_matrix_fwrite(outCFile, &t_inv_view.matrix);
+void DBMatOfflineOrthoAdapt::store(const std::string& fileName, Grid* grid,
+                                   const std::string& configuration) {
+  storeMatrices(fileName, {&lhsMatrix, &q_ortho_matrix_, &t_tridiag_inv_matrix_}, grid,
+                configuration);
+}
 
-  fclose(outCFile);
-#endif /* USE_GSL */
+void DBMatOfflineOrthoAdapt::load(const DBMatOfflineFile& file) {
+  loadDecomposition(file, 3);
+  file.readMatrix(1, q_ortho_matrix_);
+  file.readMatrix(2, t_tridiag_inv_matrix_);
 }
 
 void DBMatOfflineOrthoAdapt::syncDistributedDecomposition(
@@ -85,8 +85,18 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
    * online phase
    *
    * @param fileName path where to store the file
+   * @param grid the grid the decomposition belongs to (optional)
+   * @param configuration description of the configuration (optional)
    */
-  void store(const std::string& fileName);
+  void store(const std::string& fileName, Grid* grid = nullptr,
+             const std::string& configuration = "") override;
+
+  /**
+   * Restores lhsMatrix, q_ortho_matrix_ and t_tridiag_inv_matrix_ from a binary file
+   *
+   * @param file the opened file
+   */
+  void load(const DBMatOfflineFile& file) override;
 
   /**
    * Override to sync Q and Tinv
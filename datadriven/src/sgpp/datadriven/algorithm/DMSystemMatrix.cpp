@@ -73,6 +73,21 @@ void DMSystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
   result.axpy(static_cast<double>(M) * this->lambda_, temptwo);
 }
 
+void DMSystemMatrix::multBlock(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  const double M = static_cast<double>(this->dataset_.getNrows());
+
+  std::unique_ptr<base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  sgpp::base::DataMatrix temp(this->dataset_.getNrows(), alpha.getNcols());
+  op->multBlock(alpha, temp);
+  op->multTransposeBlock(temp, result);
+
+  sgpp::base::DataMatrix regularization(alpha.getNrows(), alpha.getNcols());
+  this->C->multBlock(alpha, regularization);
+  regularization.mult(M * this->lambda_);
+  result.add(regularization);
+}
+
 void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::DataVector& b) {
   // this->B->multTranspose((*this->dataset_), classes, b);
   // this->B->multTranspose(classes, b);
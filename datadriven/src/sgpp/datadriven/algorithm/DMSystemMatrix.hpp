@@ -52,6 +52,15 @@ class DMSystemMatrix : public DMSystemMatrixBase {
 
   virtual void mult(base::DataVector& alpha, base::DataVector& result);
 
+  /**
+   * Applies the system matrix to several coefficient vectors (e.g., the search directions
+   * of a block solver for one-vs-all classification) with a single evaluation operation.
+   *
+   * @param alpha coefficient vectors (one column per vector)
+   * @param result results (one column per vector)
+   */
+  virtual void multBlock(base::DataMatrix& alpha, base::DataMatrix& result);
+
   /**
    * Generates the right hand side of the classification equation
    *
@@ -0,0 +1,259 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/LTwoDotMatrixBuilder.hpp>
+
+#include <sgpp/base/exception/algorithm_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::index_t;
+using sgpp::base::level_t;
+
+namespace {
+
+/**
+ * L2 dot product of two 1D modified hat functions, (l1, i1) being the one with the higher level
+ * (same formulas as in pde::OperationMatrixLTwoDotExplicitModLinear).
+ */
+double modLinearProduct(level_t l1, index_t i1, level_t l2, index_t i2) {
+  const index_t hInv1 = static_cast<index_t>(1) << l1;
+  const index_t hInv2 = static_cast<index_t>(1) << l2;
+  const double hInv1Dbl = static_cast<double>(hInv1);
+  const double hInv2Dbl = static_cast<double>(hInv2);
+
+  if (l1 == l2) {
+    if (l1 == 1) {
+      return 1.0;
+    } else if (i1 != i2) {
+      return 0.0;
+    } else if ((i1 == 1) || (i1 == hInv1 - 1)) {
+      return 8.0 / (hInv1Dbl * 3.0);
+    } else {
+      return 2.0 / (hInv1Dbl * 3.0);
+    }
+  } else if (l2 == 1) {
+    // the constant function of level 1 yields the integral of the other function
+    return ((i1 == 1) || (i1 == hInv1 - 1)) ? 2.0 / hInv1Dbl : 1.0 / hInv1Dbl;
+  } else if (((i1 - 1.0) / hInv1Dbl >= (i2 + 1.0) / hInv2Dbl) ||
+             ((i1 + 1.0) / hInv1Dbl <= (i2 - 1.0) / hInv2Dbl)) {
+    return 0.0;
+  } else if (((i1 == 1) && (i2 == 1)) || ((i1 == hInv1 - 1) && (i2 == hInv2 - 1))) {
+    return 4.0 * ((1.0 / hInv1Dbl) - (hInv2Dbl / 3.0 / (hInv1Dbl * hInv1Dbl)));
+  } else if (i2 == 1) {
+    return (1.0 / hInv1Dbl) * (1.0 / hInv1Dbl) * (2.0 * hInv1Dbl - i1 * hInv2Dbl);
+  } else if (i2 == hInv2 - 1) {
+    return (1.0 / hInv1Dbl) * (1.0 / hInv1Dbl) * (2.0 * hInv1Dbl - (hInv1 - i1) * hInv2Dbl);
+  }
+
+  const double diff = i1 / hInv1Dbl - i2 / hInv2Dbl;
+  const double t = (std::fabs(diff - 1.0 / hInv1Dbl) + std::fabs(diff + 1.0 / hInv1Dbl) -
+                    std::fabs(diff)) * hInv2Dbl;
+  return (1.0 - t) / hInv1Dbl;
+}
+
+}  // namespace
+
+LTwoDotMatrixBuilder::LTwoDotMatrixBuilder(base::Grid& grid)
+    : size(grid.getSize()),
+      dim(grid.getDimension()),
+      modified(grid.getType() == base::GridType::ModLinear),
+      levels(size * dim),
+      indices(size * dim),
+      centers(size * dim),
+      widths(size * dim),
+      inverseWidths(size * dim) {
+  if (!isSupported(grid)) {
+    throw base::algorithm_exception(
+        "LTwoDotMatrixBuilder: only Linear and ModLinear grids are supported");
+  }
+
+  base::GridStorage& storage = grid.getStorage();
+
+  for (size_t i = 0; i < size; i++) {
+    base::GridPoint& gp = storage.getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      const size_t k = i * dim + d;
+      levels[k] = gp.getLevel(d);
+      indices[k] = gp.getIndex(d);
+      inverseWidths[k] = static_cast<double>(static_cast<index_t>(1) << levels[k]);
+      widths[k] = 1.0 / inverseWidths[k];
+      centers[k] = static_cast<double>(indices[k]) * widths[k];
+    }
+  }
+}
+
+bool LTwoDotMatrixBuilder::isSupported(base::Grid& grid) {
+  return (grid.getType() == base::GridType::Linear) ||
+         (grid.getType() == base::GridType::ModLinear);
+}
+
+void LTwoDotMatrixBuilder::buildDense(base::DataMatrix& matrix) const {
+  if ((matrix.getNrows() != size) || (matrix.getNcols() != size)) {
+    matrix = base::DataMatrix(size, size);
+  }
+
+  double* data = matrix.data();
+  const size_t tiles = (size + TILE_SIZE - 1) / TILE_SIZE;
+
+#pragma omp parallel
+  {
+#pragma omp for schedule(dynamic)
+    for (size_t ti = 0; ti < tiles; ti++) {
+      const size_t rowEnd = std::min(size, (ti + 1) * TILE_SIZE);
+
+      for (size_t tj = ti; tj < tiles; tj++) {
+        const size_t colEnd = std::min(size, (tj + 1) * TILE_SIZE);
+
+        for (size_t i = ti * TILE_SIZE; i < rowEnd; i++) {
+          const size_t colBegin = std::max(i, tj * TILE_SIZE);
+          computeRowSegment(i, colBegin, colEnd, data + i * size + colBegin);
+        }
+      }
+    }
+
+    // copy the upper to the lower triangle, tile by tile to keep the transposed reads in cache
+#pragma omp for schedule(dynamic)
+    for (size_t ti = 0; ti < tiles; ti++) {
+      const size_t rowEnd = std::min(size, (ti + 1) * TILE_SIZE);
+
+      for (size_t tj = 0; tj <= ti; tj++) {
+        for (size_t i = ti * TILE_SIZE; i < rowEnd; i++) {
+          const size_t colEnd = std::min(i, (tj + 1) * TILE_SIZE);
+
+          for (size_t j = tj * TILE_SIZE; j < colEnd; j++) {
+            data[i * size + j] = data[j * size + i];
+          }
+        }
+      }
+    }
+  }
+}
+
+void LTwoDotMatrixBuilder::buildPacked(std::vector<double>& packed) const {
+  packed.resize(size * (size + 1) / 2);
+  const size_t tiles = (size + TILE_SIZE - 1) / TILE_SIZE;
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t ti = 0; ti < tiles; ti++) {
+    const size_t rowEnd = std::min(size, (ti + 1) * TILE_SIZE);
+
+    for (size_t tj = ti; tj < tiles; tj++) {
+      const size_t colEnd = std::min(size, (tj + 1) * TILE_SIZE);
+
+      for (size_t i = ti * TILE_SIZE; i < rowEnd; i++) {
+        // entry (i, j) is stored at i * size - i * (i - 1) / 2 + j - i
+        const size_t colBegin = std::max(i, tj * TILE_SIZE);
+        const size_t rowStart = i * size - i * (i - 1) / 2;
+        computeRowSegment(i, colBegin, colEnd, packed.data() + rowStart + colBegin - i);
+      }
+    }
+  }
+}
+
+void LTwoDotMatrixBuilder::buildSparse(std::vector<size_t>& rowPointers,
+                                       std::vector<size_t>& columns,
+                                       std::vector<double>& values) const {
+  const size_t tiles = (size + TILE_SIZE - 1) / TILE_SIZE;
+  std::vector<std::vector<size_t>> rowColumns(size);
+  std::vector<std::vector<double>> rowValues(size);
+
+#pragma omp parallel
+  {
+    std::vector<double> segment(TILE_SIZE);
+
+#pragma omp for schedule(dynamic)
+    for (size_t ti = 0; ti < tiles; ti++) {
+      const size_t rowEnd = std::min(size, (ti + 1) * TILE_SIZE);
+
+      // the column tiles are traversed in ascending order, so the rows are sorted
+      for (size_t tj = ti; tj < tiles; tj++) {
+        const size_t colEnd = std::min(size, (tj + 1) * TILE_SIZE);
+
+        for (size_t i = ti * TILE_SIZE; i < rowEnd; i++) {
+          const size_t colBegin = std::max(i, tj * TILE_SIZE);
+          computeRowSegment(i, colBegin, colEnd, segment.data());
+
+          for (size_t j = colBegin; j < colEnd; j++) {
+            if (segment[j - colBegin] != 0.0) {
+              rowColumns[i].push_back(j);
+              rowValues[i].push_back(segment[j - colBegin]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  rowPointers.assign(size + 1, 0);
+
+  for (size_t i = 0; i < size; i++) {
+    rowPointers[i + 1] = rowPointers[i] + rowColumns[i].size();
+  }
+
+  columns.resize(rowPointers[size]);
+  values.resize(rowPointers[size]);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    std::copy(rowColumns[i].begin(), rowColumns[i].end(), columns.begin() + rowPointers[i]);
+    std::copy(rowValues[i].begin(), rowValues[i].end(), values.begin() + rowPointers[i]);
+  }
+}
+
+void LTwoDotMatrixBuilder::computeRowSegment(size_t i, size_t begin, size_t end,
+                                             double* values) const {
+  for (size_t j = begin; j < end; j++) {
+    values[j - begin] = product(i, j);
+  }
+}
+
+double LTwoDotMatrixBuilder::product(size_t i, size_t j) const {
+  double result = 1.0;
+
+  for (size_t d = 0; d < dim; d++) {
+    size_t fine = i * dim + d;
+    size_t coarse = j * dim + d;
+
+    if (levels[fine] < levels[coarse]) {
+      std::swap(fine, coarse);
+    }
+
+    if (modified) {
+      result *= modLinearProduct(levels[fine], indices[fine], levels[coarse], indices[coarse]);
+    } else if (levels[fine] == levels[coarse]) {
+      if (indices[fine] != indices[coarse]) {
+        return 0.0;
+      }
+
+      result *= 2.0 / 3.0 * widths[fine];
+    } else {
+      // nested supports: the coarse function is linear on the support of the fine one
+      const double distance = std::fabs(centers[fine] - centers[coarse]);
+
+      if (distance >= widths[coarse]) {
+        return 0.0;
+      }
+
+      result *= widths[fine] * (1.0 - distance * inverseWidths[coarse]);
+    }
+
+    if (result == 0.0) {
+      return 0.0;
+    }
+  }
+
+  return result;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,117 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Builds the L2 dot product matrix (mass matrix) M_ij = (phi_i, phi_j) of a grid with linear or
+ * modified linear basis functions.
+ *
+ * In 1D, the supports of two hierarchical basis functions are either nested (one is an ancestor
+ * of the other) or disjoint. Hence two basis functions overlap if and only if the distance of
+ * their centers is smaller than the mesh width of the coarser one, and in the nested case the
+ * coarser function is linear on the support of the finer one, which yields a closed formula for
+ * their product. This test replaces the generic interval intersection of
+ * pde::OperationMatrixLTwoDotExplicitLinear and lets most non-overlapping pairs be rejected after
+ * the first dimension.
+ *
+ * Only the upper triangle is computed, in parallel over tiles of TILE_SIZE rows and columns so
+ * that the data of both tiles stays in cache; the dense matrix is completed by copying the upper
+ * to the lower triangle tile by tile. Besides the dense matrix, the upper triangle can
+ * be emitted in packed or sparse (CSR) format for solvers that exploit symmetry or sparsity.
+ */
+class LTwoDotMatrixBuilder {
+ public:
+  /**
+   * Constructor.
+   * Throws an algorithm_exception if the grid type is not supported.
+   *
+   * @param grid  grid (type Linear or ModLinear)
+   */
+  explicit LTwoDotMatrixBuilder(base::Grid& grid);
+
+  /**
+   * @param grid  grid
+   * @return whether the builder supports the type of the grid
+   */
+  static bool isSupported(base::Grid& grid);
+
+  /**
+   * Computes the full (symmetric) matrix.
+   *
+   * @param[out] matrix  matrix, resized to size x size if necessary
+   */
+  void buildDense(base::DataMatrix& matrix) const;
+
+  /**
+   * Computes the upper triangle in packed storage, i.e., row i contains the entries i, ..., n-1
+   * and starts at position i * n - i * (i - 1) / 2 (this is the column-major lower packed
+   * format of LAPACK).
+   *
+   * @param[out] packed  packed upper triangle (size n * (n + 1) / 2)
+   */
+  void buildPacked(std::vector<double>& packed) const;
+
+  /**
+   * Computes the non-zero entries of the upper triangle (including the diagonal) in compressed
+   * sparse row format. The columns of each row are sorted.
+   *
+   * @param[out] rowPointers  start of each row in columns and values (size n + 1)
+   * @param[out] columns      column indices of the entries
+   * @param[out] values       values of the entries
+   */
+  void buildSparse(std::vector<size_t>& rowPointers, std::vector<size_t>& columns,
+                   std::vector<double>& values) const;
+
+ protected:
+  /// number of rows and columns of the tiles
+  static const size_t TILE_SIZE = 64;
+
+  /// number of grid points
+  size_t size;
+  /// dimensionality of the grid
+  size_t dim;
+  /// whether the basis is modified linear
+  bool modified;
+  /// levels of the grid points (size * dim values)
+  std::vector<base::level_t> levels;
+  /// indices of the grid points (size * dim values)
+  std::vector<base::index_t> indices;
+  /// centers of the basis functions (size * dim values)
+  std::vector<double> centers;
+  /// mesh widths of the basis functions (size * dim values)
+  std::vector<double> widths;
+  /// inverse mesh widths of the basis functions (size * dim values)
+  std::vector<double> inverseWidths;
+
+  /**
+   * Computes the entries (i, begin), ..., (i, end - 1) of the matrix.
+   *
+   * @param i           row
+   * @param begin       first column
+   * @param end         end of the columns
+   * @param[out] values entries (end - begin values)
+   */
+  void computeRowSegment(size_t i, size_t begin, size_t end, double* values) const;
+
+  /**
+   * @param i first grid point
+   * @param j second grid point
+   * @return L2 dot product of the basis functions of the grid points
+   */
+  double product(size_t i, size_t j) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -56,18 +56,50 @@ void ClassificationLearner::train(sgpp::base::DataMatrix& trainDataset,
   }
   learners.reserve(uniqueClasses.size());
 
+  auto createLearner = [this]() {
+    if (terms.size() > 0) {
+      return RegressionLearner(gridConfig, adaptivityConfig, solverConfig, finalSolverConfig,
+                               regularizationConfig, terms);
+    } else {
+      return RegressionLearner(gridConfig, adaptivityConfig, solverConfig, finalSolverConfig,
+                               regularizationConfig);
+    }
+  };
+
+  // Without refinement, all learners share the same grid and system matrix. In this case,
+  // the systems of all classes are solved at once, such that the training data is only
+  // streamed once per iteration for all classes.
+  const bool blockSolve = (adaptivityConfig.numRefinements_ == 0) &&
+                          ((solverConfig.type_ == sgpp::solver::SLESolverType::CG) ||
+                           (solverConfig.type_ == sgpp::solver::SLESolverType::BiCGSTAB));
+
+  if (blockSolve) {
+    auto targets = sgpp::base::DataMatrix(classes.getSize(), uniqueClasses.size());
+    size_t j = 0;
+
+    for (const auto uniqueClass : uniqueClasses) {
+      targets.setColumn(j++, generateYOneVsAll(classes, uniqueClass));
+    }
+
+    auto firstLearner = createLearner();
+    auto weights = firstLearner.trainMultiple(trainDataset, targets);
+    auto weightsColumn = sgpp::base::DataVector(weights.getNrows());
+    j = 0;
+
+    for (const auto uniqueClass : uniqueClasses) {
+      auto learner = (j == 0) ? std::move(firstLearner) : createLearner();
+      weights.getColumn(j++, weightsColumn);
+      learner.setWeights(weightsColumn);
+      learners.emplace_back(uniqueClass, std::move(learner));
+    }
+
+    return;
+  }
+
   // Now we create a learner for each class.
   for (const auto uniqueClass : uniqueClasses) {
     auto newY = generateYOneVsAll(classes, uniqueClass);
-    auto learner = [this]() {
-      if (terms.size() > 0) {
-        return RegressionLearner(gridConfig, adaptivityConfig, solverConfig, finalSolverConfig,
-                                 regularizationConfig, terms);
-      } else {
-        return RegressionLearner(gridConfig, adaptivityConfig, solverConfig, finalSolverConfig,
-                                 regularizationConfig);
-      }
-    }();
+    auto learner = createLearner();
 
     learner.train(trainDataset, newY);
     learners.emplace_back(uniqueClass, std::move(learner));
@@ -85,6 +85,46 @@ void RegressionLearner::train(base::DataMatrix& trainDataset, base::DataVector&
   }
 }
 
+base::DataMatrix RegressionLearner::trainMultiple(base::DataMatrix& trainDataset,
+                                                  base::DataMatrix& targets) {
+  if (trainDataset.getNrows() != targets.getNrows()) {
+    throw base::application_exception(
+        "RegressionLearner::trainMultiple: number of targets does not match to dataset!");
+  }
+
+  if (adaptivityConfig.numRefinements_ > 0) {
+    throw base::application_exception(
+        "RegressionLearner::trainMultiple: refinement is not supported!");
+  }
+
+  auto solver = std::move(createSolver(targets.getNrows()));
+
+  if (solver.type != Solver::solverCategory::cg) {
+    throw base::application_exception(
+        "RegressionLearner::trainMultiple: only (Bi)CG solvers are supported!");
+  }
+
+  // without refinement, the final solver configuration is used right away (as in train)
+  solverConfig = finalSolverConfig;
+  systemMatrix = createDMSystem(trainDataset);
+
+  const size_t gridSize = grid->getSize();
+  const size_t numTargets = targets.getNcols();
+  auto classes = base::DataVector(targets.getNrows());
+  auto bColumn = base::DataVector(gridSize);
+  auto b = base::DataMatrix(gridSize, numTargets);
+
+  for (size_t j = 0; j < numTargets; j++) {
+    targets.getColumn(j, classes);
+    systemMatrix->generateb(classes, bColumn);
+    b.setColumn(j, bColumn);
+  }
+
+  auto multipleWeights = base::DataMatrix(gridSize, numTargets, 0.0);
+  solver.solveCG(*systemMatrix, multipleWeights, b, true, false, solverConfig.threshold_);
+  return multipleWeights;
+}
+
 base::DataVector RegressionLearner::predict(base::DataMatrix& data) {
   auto prediction = base::DataVector(data.getNrows());
   std::unique_ptr<base::OperationMultipleEval> multOp(
@@ -53,6 +53,14 @@ class RegressionLearner {
       }
       solverCG->solve(systemMatrix, alpha, b, reuse, verbose, maxTreshold);
     }
+
+    void solveCG(sgpp::base::OperationMatrix& systemMatrix, sgpp::base::DataMatrix& alpha,
+                 sgpp::base::DataMatrix& b, bool reuse, bool verbose, double maxTreshold) {
+      if (type != solverCategory::cg) {
+        throw sgpp::base::application_exception("Tried to solve with incorrect solver!");
+      }
+      solverCG->solve(systemMatrix, alpha, b, reuse, verbose, maxTreshold);
+    }
     void solveFista(sgpp::base::OperationMultipleEval& op, sgpp::base::DataVector& weights,
                     const sgpp::base::DataVector& classes, size_t maxIt, double treshold,
                     double L) {
@@ -154,6 +162,20 @@ class RegressionLearner {
    * @param classes is the (continuous) target
    */
   void train(sgpp::base::DataMatrix& trainDataset, sgpp::base::DataVector& classes);
+
+  /**
+   * @brief trainMultiple fits one model for each column of targets on the grid of this
+   * learner (e.g., for one-vs-all classification). All systems are solved at once by the
+   * block variant of the (Bi)CG solver, which applies the system matrix to all search
+   * directions together. The weights of this learner are not changed.
+   * Only supported for (Bi)CG without refinement, as the refined grid would depend on the
+   * target.
+   * @param trainDataset is the design matrix
+   * @param targets contains one (continuous) target per column
+   * @return the weights of the models (one column per target)
+   */
+  sgpp::base::DataMatrix trainMultiple(sgpp::base::DataMatrix& trainDataset,
+                                       sgpp::base::DataMatrix& targets);
   /**
    * @brief predict
    * @param data are observations
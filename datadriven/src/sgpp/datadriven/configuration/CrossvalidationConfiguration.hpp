@@ -28,6 +28,10 @@ struct CrossvalidationConfiguration {
   int seed_;      // seed for randomized k-fold
   bool shuffle_;  // randomized/sequential k-fold
   bool silent_;   // verbosity
+  // number of folds trained concurrently by SparseGridMinerCrossValidation
+  size_t parallelFolds_ = 1;
+  // OpenMP threads inside each concurrently trained fold (0: share the threads evenly)
+  size_t threadsPerFold_ = 0;
 
   // regularization parameter optimization
   double lambda_;       // regularization parameter
@@ -15,6 +15,7 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <functional>
 #include <iostream>
 #include <string>
 
@@ -30,6 +31,10 @@ ModelFittingBase* SparseGridMiner::getModel() { return &(*fitter); }
 
 void SparseGridMiner::setModel(ModelFittingBase* model) { fitter.reset(model); }
 
+void SparseGridMiner::setEpochCallback(std::function<bool(size_t, double)> callback) {
+  epochCallback = callback;
+}
+
 void SparseGridMiner::print(std::ostringstream& messageStream) { print(messageStream.str()); }
 
 void SparseGridMiner::print(const char* message) { print(std::string(message)); }
@@ -17,6 +17,7 @@
 #include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
+#include <functional>
 #include <initializer_list>
 #include <memory>
 #include <sstream>
@@ -84,6 +85,15 @@ class SparseGridMiner {
 
   void setModel(ModelFittingBase *model);
 
+  /**
+   * Set a function that is called after every training epoch but the last one with the index of
+   * the epoch and the score on the validation data, e.g., to stop unpromising trials of a
+   * hyperparameter optimization early. If it returns false, learning stops and the current score
+   * is returned. Miners that do not train in epochs do not call it.
+   * @param callback the function or an empty function to disable it
+   */
+  void setEpochCallback(std::function<bool(size_t, double)> callback);
+
   /**
    * Evaluate the model on a certain test dataset.
    *
@@ -119,6 +129,10 @@ class SparseGridMiner {
    * Scorer that quantifies the quality of a fit. (e.g. cross validation or training with testing)
    */
   std::unique_ptr<Scorer> scorer;
+  /**
+   * Function that decides after every epoch whether learning continues, may be empty.
+   */
+  std::function<bool(size_t, double)> epochCallback;
 };
 }  // namespace datadriven
 }  // namespace sgpp
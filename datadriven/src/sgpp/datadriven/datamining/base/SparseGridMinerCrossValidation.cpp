@@ -16,7 +16,16 @@
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <exception>
 #include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 namespace sgpp {
@@ -40,99 +49,84 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
 
   const CrossvalidationConfiguration& crossValidationConfig =
       dataSource->getCrossValidationConfig();
+  const size_t kfold = crossValidationConfig.kfold_;
+
+  std::vector<double> scores(kfold);
+  size_t parallelFolds = std::min(crossValidationConfig.parallelFolds_, kfold);
+
+  // every fold needs its own fitter, which is not available for all fitter types
+  std::vector<std::unique_ptr<ModelFittingBase>> foldFitters;
+  for (size_t fold = 0; (parallelFolds > 1) && (fold < kfold); fold++) {
+    foldFitters.emplace_back(fitter->createUntrainedCopy());
+    if (foldFitters.back() == nullptr) {
+      print("Fitter does not support concurrent training, training the folds sequentially");
+      parallelFolds = 1;
+    } else {
+      foldFitters.back()->verboseSolver = fitter->verboseSolver;
+    }
+  }
 
-  std::vector<double> scores;
-  scores.reserve(crossValidationConfig.kfold_);
-
-  for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
-    dataSource->setFold(fold);
-
-    // todo(fuchsgdk):
-    // This is the kind of cv implemented by Lettrich in the scorer class and it was
-    // merely moved to fit into the data source. Conceptual changes might be done in order to
-    // really support batch based learning with cv and not only regression.
-    // What should be done is reimplementing the data source such that it provides batches
-
-    std::ostringstream out;
-    out << "###############"
-        << "Fold #" << fold;
-    print(out);
+  if (parallelFolds <= 1) {
+    for (size_t fold = 0; fold < kfold; fold++) {
+      dataSource->setFold(fold);
 
-    // Create a refinement monitor for this fold
-    RefinementMonitorFactory monitorFactory;
-    RefinementMonitor* monitor = monitorFactory.createRefinementMonitor(
-        fitter->getFitterConfiguration().getRefinementConfig());
+      // Reset the fitter
+      fitter->reset();
 
-    // Reset the fitter
-    fitter->reset();
+      scores[fold] = learnFold(*dataSource, *fitter, fold, verbose, nullptr);
+    }
+  } else {
+    // nested parallelism: the folds are distributed over parallelFolds threads, each of which
+    // uses threadsPerFold threads for the parallel operations of its fitter
+    size_t threadsPerFold = crossValidationConfig.threadsPerFold_;
+#ifdef _OPENMP
+    if (threadsPerFold == 0) {
+      threadsPerFold = std::max(static_cast<size_t>(omp_get_max_threads()) / parallelFolds,
+                                static_cast<size_t>(1));
+    }
+    const int oldMaxActiveLevels = omp_get_max_active_levels();
+    omp_set_max_active_levels(std::max(oldMaxActiveLevels, 2));
+#endif /* _OPENMP */
+
+    // creating a view initializes the shuffling functor that all views share, so the views are
+    // created before the folds are trained concurrently
+    std::vector<std::unique_ptr<DataSourceCrossValidation>> foldSources;
+    for (size_t fold = 0; fold < kfold; fold++) {
+      foldSources.emplace_back(dataSource->createFoldView(fold));
+    }
 
-    for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
-      if (verbose) {
-        std::ostringstream out;
-        out << "###############"
-            << "Starting training epoch #" << epoch;
-        print(out);
+    std::vector<std::string> logs(kfold);
+    std::vector<std::exception_ptr> errors(kfold);
+
+#pragma omp parallel for schedule(dynamic) num_threads(parallelFolds)
+    for (size_t fold = 0; fold < kfold; fold++) {
+#ifdef _OPENMP
+      omp_set_num_threads(static_cast<int>(threadsPerFold));
+#endif /* _OPENMP */
+      try {
+        std::ostringstream log;
+        scores[fold] = learnFold(*foldSources[fold], *foldFitters[fold], fold, verbose, &log);
+        logs[fold] = log.str();
+      } catch (...) {
+        // exceptions must not leave the parallel region
+        errors[fold] = std::current_exception();
       }
-      dataSource->reset();
-      Dataset* validationData = dataSource->getValidationData();
-      size_t validationSize = validationData->getNumberInstances();
+    }
 
-      if (verbose) {
-        std::ostringstream out;
-        out << "Validation data size: " << validationSize;
-        print(out);
-      }
-      // Process dataset iteratively
-      size_t iteration = 0;
-      while (true) {
-        std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
-        size_t numInstances = dataset->getNumberInstances();
-        if (numInstances == 0) {
-          // The source does not provide any more samples
-          break;
-        }
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Itertation #" << (iteration++) << std::endl
-              << "Batch size: " << numInstances;
-          print(out);
-        }
-
-        // Train model on new batch
-        fitter->update(*dataset);
-
-        // Evaluate the score on the training and validation data
-        double scoreTrain = scorer->test(*fitter, *dataset);
-        double scoreVal = scorer->test(*fitter, *validationData);
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "Score on batch: " << scoreTrain << std::endl
-              << "Score on validation data: " << scoreVal;
-          print(out);
-        }
-
-        // Refine the model if neccessary
-        monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
-        size_t refinements = monitor->refinementsNecessary();
-        while (refinements--) {
-          fitter->refine();
-        }
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Iteration finished.";
-          print(out);
-        }
+#ifdef _OPENMP
+    omp_set_max_active_levels(oldMaxActiveLevels);
+#endif /* _OPENMP */
+
+    // print the output in the order of the folds and rethrow the first error, if any
+    for (size_t fold = 0; fold < kfold; fold++) {
+      std::cout << logs[fold];
+      if (errors[fold] != nullptr) {
+        std::rethrow_exception(errors[fold]);
       }
     }
-    // Evaluate the final score on the validation data
-    dataSource->reset();
-    Dataset* validationData = dataSource->getValidationData();
-    scores.push_back(scorer->test(*fitter, *validationData));
+
+    // keep the model of the last fold, as in sequential mode
+    fitter = std::move(foldFitters.back());
   }
 
   // Calculate mean score and std deviation
@@ -154,5 +148,103 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   print(out);
   return meanScore;
 }
+
+double SparseGridMinerCrossValidation::learnFold(DataSourceCrossValidation& foldSource,
+                                                 ModelFittingBase& foldFitter, size_t fold,
+                                                 bool verbose, std::ostream* log) {
+  // messages are printed directly or, if the fold is trained concurrently to other folds,
+  // collected in the log
+  auto report = [log](std::ostringstream& message) {
+    if (log != nullptr) {
+      *log << message.str() << std::endl;
+    } else {
+      print(message);
+    }
+  };
+
+  // todo(fuchsgdk):
+  // This is the kind of cv implemented by Lettrich in the scorer class and it was
+  // merely moved to fit into the data source. Conceptual changes might be done in order to
+  // really support batch based learning with cv and not only regression.
+  // What should be done is reimplementing the data source such that it provides batches
+
+  std::ostringstream out;
+  out << "###############"
+      << "Fold #" << fold;
+  report(out);
+
+  // Create a refinement monitor for this fold
+  RefinementMonitorFactory monitorFactory;
+  std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+      foldFitter.getFitterConfiguration().getRefinementConfig()));
+
+  for (size_t epoch = 0; epoch < foldSource.getConfig().epochs; epoch++) {
+    if (verbose) {
+      std::ostringstream out;
+      out << "###############"
+          << "Starting training epoch #" << epoch;
+      report(out);
+    }
+    foldSource.reset();
+    Dataset* validationData = foldSource.getValidationData();
+    size_t validationSize = validationData->getNumberInstances();
+
+    if (verbose) {
+      std::ostringstream out;
+      out << "Validation data size: " << validationSize;
+      report(out);
+    }
+    // Process dataset iteratively
+    size_t iteration = 0;
+    while (true) {
+      std::unique_ptr<Dataset> dataset(foldSource.getNextSamples());
+      size_t numInstances = dataset->getNumberInstances();
+      if (numInstances == 0) {
+        // The source does not provide any more samples
+        break;
+      }
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "###############"
+            << "Itertation #" << (iteration++) << std::endl
+            << "Batch size: " << numInstances;
+        report(out);
+      }
+
+      // Train model on new batch
+      foldFitter.update(*dataset);
+
+      // Evaluate the score on the training and validation data
+      double scoreTrain = scorer->test(foldFitter, *dataset);
+      double scoreVal = scorer->test(foldFitter, *validationData);
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "Score on batch: " << scoreTrain << std::endl
+            << "Score on validation data: " << scoreVal;
+        report(out);
+      }
+
+      // Refine the model if neccessary
+      monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
+      size_t refinements = monitor->refinementsNecessary();
+      while (refinements--) {
+        foldFitter.refine();
+      }
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "###############"
+            << "Iteration finished.";
+        report(out);
+      }
+    }
+  }
+  // Evaluate the final score on the validation data
+  foldSource.reset();
+  Dataset* validationData = foldSource.getValidationData();
+  return scorer->test(foldFitter, *validationData);
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
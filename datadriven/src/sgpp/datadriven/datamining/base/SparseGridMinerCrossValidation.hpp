@@ -16,6 +16,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
 
 #include <memory>
+#include <ostream>
 
 namespace sgpp {
 namespace datadriven {
@@ -74,10 +75,29 @@ class SparseGridMinerCrossValidation : public SparseGridMiner {
    * Perform Learning cycle: Get samples from data source and based on the scoring procedure,
    * generalize data by fitting and asses quality of the fit. Each cycle is performed once per
    * fold.
+   *
+   * If CrossvalidationConfiguration::parallelFolds_ is larger than one and the fitter supports
+   * ModelFittingBase::createUntrainedCopy, up to parallelFolds_ folds are trained concurrently,
+   * each with its own fitter and a view of the data source (see
+   * DataSourceCrossValidation::createFoldView). Each fold uses threadsPerFold_ OpenMP threads for
+   * the operations of its fitter. As every fold sees the same batches as in sequential mode, the
+   * scores do not depend on the number of concurrent folds.
    */
   double learn(bool verbose) override;
 
  private:
+  /**
+   * Trains a fitter on one fold and scores it on the validation data of the fold.
+   * @param foldSource data source that is set to the fold
+   * @param foldFitter untrained fitter
+   * @param fold index of the fold
+   * @param verbose whether to print progress messages
+   * @param log stream the messages are written to, or nullptr to print them directly
+   * @return score on the validation data of the fold
+   */
+  double learnFold(DataSourceCrossValidation& foldSource, ModelFittingBase& foldFitter,
+                   size_t fold, bool verbose, std::ostream* log);
+
   /**
    * DataSource provides samples that will be used by fitter to generalize data and scorer to
    * validate and assess model robustness.
@@ -18,6 +18,7 @@
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
 #include <iostream>
+#include <memory>
 
 namespace sgpp {
 namespace datadriven {
@@ -39,8 +40,8 @@ double SparseGridMinerSplitting::learn(bool verbose) {
   fitter->verboseSolver = verbose;
   // Setup refinement monitor
   RefinementMonitorFactory monitorFactory;
-  RefinementMonitor* monitor = monitorFactory.createRefinementMonitor(
-      fitter->getFitterConfiguration().getRefinementConfig());
+  std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+      fitter->getFitterConfiguration().getRefinementConfig()));
 
   for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
     if (verbose) {
@@ -90,6 +91,19 @@ double SparseGridMinerSplitting::learn(bool verbose) {
         print("###############Iteration finished.");
       }
     }
+
+    // report the intermediate score, e.g., to a scheduler that stops unpromising trials
+    if (epochCallback && (epoch + 1 < dataSource->getConfig().epochs)) {
+      double scoreVal = scorer->test(*fitter, *(dataSource->getValidationData()));
+      if (!epochCallback(epoch, scoreVal)) {
+        if (verbose) {
+          std::ostringstream out;
+          out << "Learning stopped after epoch #" << epoch;
+          print(out);
+        }
+        return scoreVal;
+      }
+    }
   }
   return scorer->test(*fitter, *(dataSource->getValidationData()));
 }  // namespace datadriven
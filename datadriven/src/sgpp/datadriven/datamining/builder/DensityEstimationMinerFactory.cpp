@@ -42,13 +42,16 @@ ModelFittingBase *DensityEstimationMinerFactory::createFitter(
 }
 HyperparameterOptimizer *DensityEstimationMinerFactory::buildHPO(const std::string &path) const {
   DataMiningConfigParser parser(path);
+  HyperparameterOptimizer *hpo;
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path),
-                                                new DensityEstimationFitterFactory(parser), parser);
+    hpo = new HarmonicaHyperparameterOptimizer(buildMiner(path),
+                                               new DensityEstimationFitterFactory(parser), parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path),
-                                         new DensityEstimationFitterFactory(parser), parser);
+    hpo = new BoHyperparameterOptimizer(buildMiner(path),
+                                        new DensityEstimationFitterFactory(parser), parser);
   }
+  addTrialMiners(*hpo, path);
+  return hpo;
 }
 FitterFactory *DensityEstimationMinerFactory::createFitterFactory(
     const DataMiningConfigParser &parser) const {
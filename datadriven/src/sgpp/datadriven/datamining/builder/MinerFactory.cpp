@@ -20,6 +20,7 @@
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfiguration.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingClassification.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/BoHyperparameterOptimizer.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/HPOConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/HarmonicaHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
@@ -42,12 +43,15 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
 
 sgpp::datadriven::HyperparameterOptimizer* MinerFactory::buildHPO(const std::string& path) const {
   DataMiningConfigParser parser(path);
+  HyperparameterOptimizer* hpo;
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
-                                                parser);
+    hpo = new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
+                                               parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+    hpo = new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
   }
+  addTrialMiners(*hpo, path);
+  return hpo;
 }
 
 DataSourceSplitting* MinerFactory::createDataSourceSplitting(
@@ -85,5 +89,15 @@ Scorer* MinerFactory::createScorer(const DataMiningConfigParser& parser) const {
   std::unique_ptr<ScorerFactory> factory = std::make_unique<ScorerFactory>();
   return factory->buildScorer(parser);
 }
+
+void MinerFactory::addTrialMiners(HyperparameterOptimizer& hpo, const std::string& path) const {
+  DataMiningConfigParser parser(path);
+  HPOConfig config;
+  config.setupDefaults();
+  parser.getHPOConfig(config);
+  for (int64_t i = 1; i < config.getParallelTrials(); i++) {
+    hpo.addMiner(buildMiner(path));
+  }
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
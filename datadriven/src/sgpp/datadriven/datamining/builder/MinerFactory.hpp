@@ -84,6 +84,14 @@ class MinerFactory {
    * @return the scorer instance
    */
   virtual Scorer* createScorer(const DataMiningConfigParser& parser) const;
+
+  /**
+   * Add miners to a hyperparameter optimizer until it has as many as trials are to be evaluated
+   * concurrently (hpo[parallelTrials]). Every miner reads the data on its own.
+   * @param hpo the hyperparameter optimizer
+   * @param path path to the configuration file
+   */
+  void addTrialMiners(HyperparameterOptimizer& hpo, const std::string& path) const;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -156,6 +156,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.randomSeed =
         parseUInt(*dataSourceConfig, "randomSeed", defaults.randomSeed, "dataSource");
     config.epochs = parseUInt(*dataSourceConfig, "epochs", defaults.epochs, "dataSource");
+    config.prefetchDepth =
+        parseUInt(*dataSourceConfig, "prefetchDepth", defaults.prefetchDepth, "dataSource");
   } else {
     std::cout << "# Could not find specification of dataSource. Falling Back to default values."
               << std::endl;
@@ -319,6 +321,10 @@ bool DataMiningConfigParser::getFitterCrossvalidationConfig(
         parseBool(*crossvalidationConfig, "shuffle", defaults.shuffle_, "crossValidation");
     config.silent_ =
         parseBool(*crossvalidationConfig, "silent", defaults.silent_, "crossValidation");
+    config.parallelFolds_ = parseUInt(*crossvalidationConfig, "parallelFolds",
+                                      defaults.parallelFolds_, "crossValidation");
+    config.threadsPerFold_ = parseUInt(*crossvalidationConfig, "threadsPerFold",
+                                       defaults.threadsPerFold_, "crossValidation");
     config.lambda_ =
         parseDouble(*crossvalidationConfig, "lambda", defaults.lambda_, "crossValidation");
     config.lambdaStart_ = parseDouble(*crossvalidationConfig, "lambdaStart", defaults.lambdaStart_,
@@ -726,6 +732,14 @@ void DataMiningConfigParser::getHPOConfig(HPOConfig &config) {
     auto node = static_cast<DictNode *>(&(*configFile)["hpo"]);
     config.setSeed(parseInt(*node, "randomSeed", config.getSeed(), "hpo"));
     config.setNTrainSamples(parseInt(*node, "trainSize", config.getNTrainSamples(), "hpo"));
+    config.setParallelTrials(
+        parseInt(*node, "parallelTrials", config.getParallelTrials(), "hpo"));
+    if (node->contains("successiveHalving")) {
+      auto halving = static_cast<DictNode *>(&(*node)["successiveHalving"]);
+      config.setHalvingRate(parseInt(*halving, "rate", config.getHalvingRate(), "hpo"));
+      config.setHalvingMinEpochs(
+          parseInt(*halving, "minEpochs", config.getHalvingMinEpochs(), "hpo"));
+    }
     if (node->contains("harmonica")) {
       auto harmonica = static_cast<DictNode *>(&(*node)["harmonica"]);
       config.setLambda(parseDouble(*harmonica, "lambda", config.getLambda(), "hpo"));
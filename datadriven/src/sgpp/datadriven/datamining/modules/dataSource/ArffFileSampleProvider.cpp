@@ -15,8 +15,8 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
-#include <sgpp/datadriven/tools/ARFFTools.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,23 +25,23 @@ namespace sgpp {
 namespace datadriven {
 
 ArffFileSampleProvider::ArffFileSampleProvider(DataShufflingFunctor *shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+    : shuffling{shuffling}, reader(), counter(0) {}
 
 SampleProvider* ArffFileSampleProvider::clone() const {
   return dynamic_cast<SampleProvider*>(new ArffFileSampleProvider{*this});
 }
 
 size_t ArffFileSampleProvider::getDim() const {
-  if (dataset.getDimension() != 0) {
-    return dataset.getDimension();
+  if (reader != nullptr) {
+    return reader->getDimension();
   } else {
     throw base::file_exception{"No dataset loaded."};
   }
 }
 
 size_t ArffFileSampleProvider::getNumSamples() const {
-  if (dataset.getDimension() != 0) {
-    return dataset.getNumberInstances();
+  if (reader != nullptr) {
+    return reader->getNumberInstances();
   } else {
     throw base::file_exception{"No dataset loaded."};
   }
@@ -53,17 +53,17 @@ void ArffFileSampleProvider::readFile(const std::string& fileName,
                                       std::vector<size_t> readinColumns,
                                       std::vector<double> readinClasses) {
   try {
-    dataset = ARFFTools::readARFFFromFile(fileName, hasTargets, readinCutoff,
-        readinColumns, readinClasses);
+    reader = std::make_shared<TextDataReader>(fileName, TextDataFormat::ARFF, false, hasTargets,
+                                              readinCutoff, readinColumns, readinClasses);
   } catch (...) {
-    // TODO(lettrich): catching all exceptions is bad design. Replace call to ARFFTools with
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to TextDataReader with
     // exception safe implementation.
     throw base::data_exception{"Failed to parse ARFF File."};
   }
 }
 
 Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
-  if (dataset.getDimension() != 0) {
+  if (reader != nullptr) {
     return splitDataset(howMany);
   } else {
     throw base::file_exception("No dataset loaded.");
@@ -71,8 +71,8 @@ Dataset* ArffFileSampleProvider::getNextSamples(size_t howMany) {
 }
 
 Dataset* ArffFileSampleProvider::getAllSamples() {
-  if (dataset.getDimension() != 0) {
-    return this->getNextSamples(dataset.getNumberInstances());
+  if (reader != nullptr) {
+    return this->getNextSamples(reader->getNumberInstances());
   } else {
     throw base::file_exception{"No dataset loaded."};
   }
@@ -84,37 +84,33 @@ void ArffFileSampleProvider::readString(const std::string& input,
                                         std::vector<size_t> readinColumns,
                                         std::vector<double> readinClasses) {
   try {
-    dataset = ARFFTools::readARFFFromString(input, hasTargets, readinCutoff,
-        readinColumns, readinClasses);
+    reader = TextDataReader::fromString(input, TextDataFormat::ARFF, false, hasTargets,
+                                        readinCutoff, readinColumns, readinClasses);
   } catch (...) {
-    // TODO(lettrich): catching all exceptions is bad design. Replace call to ARFFTools with
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to TextDataReader with
     // exception safe implementation.
     throw base::data_exception{"Failed to parse ARFF data."};
   }
 }
 
 Dataset* ArffFileSampleProvider::splitDataset(size_t howMany) {
-  const size_t size = counter + howMany <= dataset.getNumberInstances()
-                          ? howMany
-                          : dataset.getNumberInstances() - counter;
-  auto tmpDataset = std::make_unique<Dataset>(size, dataset.getDimension());
+  const size_t numberInstances = reader->getNumberInstances();
+  const size_t size = counter + howMany <= numberInstances ? howMany : numberInstances - counter;
+  auto tmpDataset = std::make_unique<Dataset>(size, reader->getDimension());
 
-  base::DataMatrix& srcSamples = dataset.getData();
-  base::DataVector& srcTargets = dataset.getTargets();
+  // parse "size" samples beginning from "counter" directly into the new dataset.
+  if (shuffling != nullptr) {
+    std::vector<size_t> srcIdx(size);
 
-  base::DataMatrix& destSamples = tmpDataset->getData();
-  base::DataVector& destTargets = tmpDataset->getTargets();
+    for (size_t i = 0; i < size; ++i) {
+      srcIdx[i] = (*shuffling)(counter + i, numberInstances);
+    }
 
-  base::DataVector tmpRow{srcSamples.getNcols()};
-
-  // copy "size" rows beginning from "counter" to the new dataset.
-  for (size_t i = counter; i < counter + size; ++i) {
-    size_t srcIdx = shuffling != nullptr ? (*shuffling)(i, dataset.getNumberInstances()) : i;
-    srcSamples.getRow(srcIdx, tmpRow);
-    destSamples.setRow(i - counter, tmpRow);
-
-    destTargets[i - counter] = srcTargets[srcIdx];
+    reader->readInstances(srcIdx, *tmpDataset);
+  } else {
+    reader->readInstances(counter, size, *tmpDataset);
   }
+
   counter = counter + size;
 
   return tmpDataset.release();
@@ -124,5 +120,9 @@ void ArffFileSampleProvider::reset() {
   counter = 0;
 }
 
+void ArffFileSampleProvider::setShuffling(DataShufflingFunctor *shuffling) {
+  this->shuffling = shuffling;
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
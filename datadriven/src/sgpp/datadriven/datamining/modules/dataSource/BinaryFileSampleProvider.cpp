@@ -0,0 +1,123 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+BinaryFileSampleProvider::BinaryFileSampleProvider(DataShufflingFunctor *shuffling)
+    : shuffling{shuffling}, reader(), counter(0) {}
+
+SampleProvider* BinaryFileSampleProvider::clone() const {
+  return dynamic_cast<SampleProvider*>(new BinaryFileSampleProvider{*this});
+}
+
+size_t BinaryFileSampleProvider::getDim() const {
+  if (reader != nullptr) {
+    return reader->getDimension();
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+size_t BinaryFileSampleProvider::getNumSamples() const {
+  if (reader != nullptr) {
+    return reader->getNumberInstances();
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+void BinaryFileSampleProvider::readFile(const std::string& fileName,
+                                        bool hasTargets,
+                                        size_t readinCutoff,
+                                        std::vector<size_t> readinColumns,
+                                        std::vector<double> readinClasses) {
+  try {
+    reader = std::make_shared<BinaryDatasetReader>(fileName, readinCutoff, readinColumns,
+                                                   readinClasses);
+  } catch (...) {
+    throw base::data_exception{"Failed to read binary dataset file."};
+  }
+
+  checkTargets(hasTargets);
+}
+
+void BinaryFileSampleProvider::readString(const std::string& input,
+                                          bool hasTargets,
+                                          size_t readinCutoff,
+                                          std::vector<size_t> readinColumns,
+                                          std::vector<double> readinClasses) {
+  try {
+    reader = BinaryDatasetReader::fromString(input, readinCutoff, readinColumns, readinClasses);
+  } catch (...) {
+    throw base::data_exception{"Failed to read binary dataset."};
+  }
+
+  checkTargets(hasTargets);
+}
+
+void BinaryFileSampleProvider::checkTargets(bool hasTargets) const {
+  if (hasTargets && !reader->containsTargets()) {
+    throw base::data_exception{"Binary dataset does not contain targets."};
+  }
+}
+
+Dataset* BinaryFileSampleProvider::getNextSamples(size_t howMany) {
+  if (reader != nullptr) {
+    return splitDataset(howMany);
+  } else {
+    throw base::file_exception("No dataset loaded.");
+  }
+}
+
+Dataset* BinaryFileSampleProvider::getAllSamples() {
+  if (reader != nullptr) {
+    return this->getNextSamples(reader->getNumberInstances());
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+Dataset* BinaryFileSampleProvider::splitDataset(size_t howMany) {
+  const size_t numberInstances = reader->getNumberInstances();
+  const size_t size = counter + howMany <= numberInstances ? howMany : numberInstances - counter;
+  auto tmpDataset = std::make_unique<Dataset>(size, reader->getDimension());
+
+  if (shuffling != nullptr) {
+    std::vector<size_t> srcIdx(size);
+
+    for (size_t i = 0; i < size; ++i) {
+      srcIdx[i] = (*shuffling)(counter + i, numberInstances);
+    }
+
+    reader->readInstances(srcIdx, *tmpDataset);
+  } else {
+    reader->readInstances(counter, size, *tmpDataset);
+  }
+
+  counter = counter + size;
+
+  return tmpDataset.release();
+}
+
+void BinaryFileSampleProvider::reset() {
+  counter = 0;
+}
+
+void BinaryFileSampleProvider::setShuffling(DataShufflingFunctor *shuffling) {
+  this->shuffling = shuffling;
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
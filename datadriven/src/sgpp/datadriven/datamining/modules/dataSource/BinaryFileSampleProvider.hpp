@@ -0,0 +1,119 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetReader.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * BinaryFileSampleProvider reads files in the binary dataset format written by
+ * #sgpp::datadriven::BinaryDatasetWriter (e.g., converted from CSV or ARFF files) into
+ * #sgpp::datadriven::Dataset objects.
+ *
+ * In contrast to the text formats, nothing has to be parsed or indexed when the file is opened:
+ * the file is memory-mapped and each sample is located by its index, so shuffled batches and
+ * cross validation folds are read directly from the mapping.
+ */
+class BinaryFileSampleProvider : public FileSampleProvider {
+ public:
+  /**
+   * Default constructor
+   * @param shuffling functor to permute the training data indexes
+   */
+  explicit BinaryFileSampleProvider(DataShufflingFunctor *shuffling = nullptr);
+
+  /**
+   * Clone Pattern to allow copying of derived classes.
+   * @return a Pointer to a new instance of #sgpp::datadriven::BinaryFileSampleProvider with
+   * copied state. Caller owns the new object.
+   */
+  SampleProvider *clone() const override;
+
+  Dataset *getNextSamples(size_t howMany) override;
+
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  size_t getNumSamples() const override;
+
+  /**
+   * Open an existing binary dataset file. Throws if the file can not be opened or is not a valid
+   * binary dataset file.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readFile(const std::string &filePath,
+                bool hasTargets,
+                size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Read a binary dataset from a string (e.g., a decompressed file). Throws if the content is
+   * not a valid binary dataset.
+   * @param input string containing a binary dataset
+   * @param hasTargets whether the file has targets (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readString(const std::string &input,
+                  bool hasTargets,
+                  size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Resets the state of the sample provider (e.g. to start a new epoch)
+   */
+  void reset() override;
+
+  void setShuffling(DataShufflingFunctor *shuffling) override;
+
+ private:
+  /**
+   * Functor to shuffle the data (permute the indexes)
+   */
+  DataShufflingFunctor *shuffling;
+
+  /**
+   * Reader of the mapped file or string, shared by clones.
+   */
+  std::shared_ptr<BinaryDatasetReader> reader;
+
+  /**
+   * Indicates the index in the dataset where #getNextSamples will start grabbing new samples in
+   * its next call. After each call of #getNextSamples, the counter is set to the amount of
+   * min(counter + requestedSamplesSize, reader->getNumberInstances()).
+   */
+  size_t counter;
+
+  /**
+   * Throws if targets are requested but the file does not contain any.
+   * @param hasTargets whether the file should have targets
+   */
+  void checkTargets(bool hasTargets) const;
+
+  /**
+   * Helper member function for #getNextSamples. Reads the next samples beginning at counter
+   * (permuted by the shuffling functor) into a new #sgpp::datadriven::Dataset and updates
+   * counter.
+   */
+  Dataset *splitDataset(size_t howMany);
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -15,8 +15,8 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
-#include <sgpp/datadriven/tools/CSVTools.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,23 +25,23 @@ namespace sgpp {
 namespace datadriven {
 
 CSVFileSampleProvider::CSVFileSampleProvider(DataShufflingFunctor *shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+    : shuffling{shuffling}, reader(), counter(0) {}
 
 SampleProvider* CSVFileSampleProvider::clone() const {
   return dynamic_cast<SampleProvider*>(new CSVFileSampleProvider{*this});
 }
 
 size_t CSVFileSampleProvider::getDim() const {
-  if (dataset.getDimension() != 0) {
-    return dataset.getDimension();
+  if (reader != nullptr) {
+    return reader->getDimension();
   } else {
     throw base::file_exception{"No dataset loaded."};
   }
 }
 
 size_t CSVFileSampleProvider::getNumSamples() const {
-  if (dataset.getDimension() != 0) {
-    return dataset.getNumberInstances();
+  if (reader != nullptr) {
+    return reader->getNumberInstances();
   } else {
     throw base::file_exception{"No dataset loaded."};
   }
@@ -53,18 +53,18 @@ void CSVFileSampleProvider::readFile(const std::string& fileName,
                                      std::vector<size_t> readinColumns,
                                      std::vector<double> readinClasses) {
   try {
-    // call readCSV with skipfirstline set to true
-    dataset = CSVTools::readCSVFromFile(fileName, true, hasTargets, readinCutoff,
-        readinColumns, readinClasses);
+    // skip the first line containing the column titles
+    reader = std::make_shared<TextDataReader>(fileName, TextDataFormat::CSV, true, hasTargets,
+                                              readinCutoff, readinColumns, readinClasses);
   } catch (...) {
-    // TODO(lettrich): catching all exceptions is bad design. Replace call to CSVTools with
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to TextDataReader with
     // exception safe implementation.
     throw base::data_exception{"Failed to parse CSV File."};
   }
 }
 
 Dataset* CSVFileSampleProvider::getNextSamples(size_t howMany) {
-  if (dataset.getDimension() != 0) {
+  if (reader != nullptr) {
     return splitDataset(howMany);
   } else {
     throw base::file_exception("No dataset loaded.");
@@ -72,8 +72,8 @@ Dataset* CSVFileSampleProvider::getNextSamples(size_t howMany) {
 }
 
 Dataset* CSVFileSampleProvider::getAllSamples() {
-  if (dataset.getDimension() != 0) {
-    return this->getNextSamples(dataset.getNumberInstances());
+  if (reader != nullptr) {
+    return this->getNextSamples(reader->getNumberInstances());
   } else {
     throw base::file_exception{"No dataset loaded."};
   }
@@ -84,37 +84,34 @@ void CSVFileSampleProvider::readString(const std::string& input,
                                        size_t readinCutoff,
                                        std::vector<size_t> readinColumns,
                                        std::vector<double> readinClasses) {
-  // try {
-  //   dataset = CSVTools::readCSVFromString(input);
-  // } catch (...) {
-  // TODO(lettrich): catching all exceptions is bad design. Replace call to CSVTools with
-  // exception safe implementation.
-  throw base::data_exception{"Failed to parse CSV data. Reading from string is not implemented."};
-  // }
+  try {
+    reader = TextDataReader::fromString(input, TextDataFormat::CSV, true, hasTargets,
+                                        readinCutoff, readinColumns, readinClasses);
+  } catch (...) {
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to TextDataReader with
+    // exception safe implementation.
+    throw base::data_exception{"Failed to parse CSV data."};
+  }
 }
 
 Dataset* CSVFileSampleProvider::splitDataset(size_t howMany) {
-  const size_t size = counter + howMany <= dataset.getNumberInstances()
-                          ? howMany
-                          : dataset.getNumberInstances() - counter;
-  auto tmpDataset = std::make_unique<Dataset>(size, dataset.getDimension());
-
-  base::DataMatrix& srcSamples = dataset.getData();
-  base::DataVector& srcTargets = dataset.getTargets();
+  const size_t numberInstances = reader->getNumberInstances();
+  const size_t size = counter + howMany <= numberInstances ? howMany : numberInstances - counter;
+  auto tmpDataset = std::make_unique<Dataset>(size, reader->getDimension());
 
-  base::DataMatrix& destSamples = tmpDataset->getData();
-  base::DataVector& destTargets = tmpDataset->getTargets();
+  // parse "size" samples beginning from "counter" directly into the new dataset.
+  if (shuffling != nullptr) {
+    std::vector<size_t> srcIdx(size);
 
-  base::DataVector tmpRow{srcSamples.getNcols()};
+    for (size_t i = 0; i < size; ++i) {
+      srcIdx[i] = (*shuffling)(counter + i, numberInstances);
+    }
 
-  // copy "size" rows beginning from "counter" to the new dataset.
-  for (size_t i = counter; i < counter + size; ++i) {
-    size_t srcIdx = shuffling != nullptr ? (*shuffling)(i, dataset.getNumberInstances()) : i;
-    srcSamples.getRow(srcIdx, tmpRow);
-    destSamples.setRow(i - counter, tmpRow);
-
-    destTargets[i - counter] = srcTargets[srcIdx];
+    reader->readInstances(srcIdx, *tmpDataset);
+  } else {
+    reader->readInstances(counter, size, *tmpDataset);
   }
+
   counter = counter + size;
 
   return tmpDataset.release();
@@ -124,5 +121,9 @@ void CSVFileSampleProvider::reset() {
   counter = 0;
 }
 
+void CSVFileSampleProvider::setShuffling(DataShufflingFunctor *shuffling) {
+  this->shuffling = shuffling;
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
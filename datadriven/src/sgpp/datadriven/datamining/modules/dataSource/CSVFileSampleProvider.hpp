@@ -12,13 +12,14 @@
 #pragma once
 
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
 // TODO(lettrich): allow different splitting techniques e.g. proportional splitting for
 // classification
-// TODO(lettrich): save memory by only storing the dataset if data is accessed in batches.
 namespace sgpp {
 namespace datadriven {
 
@@ -27,6 +28,9 @@ namespace datadriven {
  * object. Data can currently only be a file containing CSV data with the first line containing
  * column titles (is skipped).
  *
+ * The file is memory-mapped and indexed by a #sgpp::datadriven::TextDataReader. Samples are only
+ * parsed when they are requested, i.e., #getNextSamples streams through the file without
+ * storing a second copy of the whole dataset.
  */
 class CSVFileSampleProvider : public FileSampleProvider {
  public:
@@ -67,7 +71,8 @@ class CSVFileSampleProvider : public FileSampleProvider {
                 std::vector<double> readinClasses = std::vector<double>()) override;
 
   /**
-   * Currently not implemented.
+   * Parse contents of a string containing information in CSV format (the first line containing
+   * column titles is skipped). Throws if string can not be parsed.
    * @param input string containing information in CSV file format
    * @param hasTargets whether the file has targest (i.e. supervised learning)
    * @param readinCutoff see FileSampleProvider.hpp
@@ -85,6 +90,8 @@ class CSVFileSampleProvider : public FileSampleProvider {
    */
   void reset() override;
 
+  void setShuffling(DataShufflingFunctor *shuffling) override;
+
  private:
   /**
    * Functor to shuffle the data (permute the indexes)
@@ -92,21 +99,22 @@ class CSVFileSampleProvider : public FileSampleProvider {
   DataShufflingFunctor *shuffling;
 
   /**
-   * #sgpp::datadriven::Dataset containing the samples read from file or string.
+   * Index of the samples read from file or string, shared by clones.
    */
-  Dataset dataset;
+  std::shared_ptr<TextDataReader> reader;
 
   /**
-   * Indicates the index in dataset where #getNextSamples will start grabbing new samples in its
+   * Indicates the index in the dataset where #getNextSamples will start grabbing new samples in its
    * next call. After each call of #getNextSamples, the counter is set to the amount of min(counter
-   * + requestedSamplesSize, dataset.getSize()).
+   * + requestedSamplesSize, reader->getNumberInstances()).
    */
   size_t counter;
 
   /**
-   * Helper member function for #getNextSamples. Linearly walks through dataset, beginning at
-   * counter and returns a pointer to a new instance of #sgpp::datadriven::Dataset containing the
-   * desired amount of samples (if available - else all remaining samples) and updates counter.
+   * Helper member function for #getNextSamples. Linearly walks through the dataset, beginning at
+   * counter, parses the samples and returns a pointer to a new instance of
+   * #sgpp::datadriven::Dataset containing the desired amount of samples (if available - else all
+   * remaining samples) and updates counter.
    */
   Dataset *splitDataset(size_t howMany);
 };
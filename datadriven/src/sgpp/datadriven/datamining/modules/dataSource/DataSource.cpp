@@ -25,10 +25,16 @@
 namespace sgpp {
 namespace datadriven {
 
-DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
-    : config(conf), currentIteration(0), sampleProvider(std::unique_ptr<SampleProvider>(sp)) {
+DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp) : DataSource(conf, sp, true) {}
+
+DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp, bool readFile)
+    : config(conf),
+      currentIteration(0),
+      sampleProvider(std::unique_ptr<SampleProvider>(sp)),
+      batchesRead(0),
+      prefetcher() {
   // if a file name was specified, we are reading from a file, so we need to open it.
-  if (!this->config.filePath.empty()) {
+  if (readFile && !this->config.filePath.empty()) {
     std::cout << "Read file " << config.filePath << std::endl;
     dynamic_cast<FileSampleProvider*>(sampleProvider.get())
         ->readFile(this->config.filePath, this->config.hasTargets, this->config.readinCutoff,
@@ -37,6 +43,16 @@ DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
   // Build data transformation
   DataTransformationBuilder dataTrBuilder;
   dataTransformation = dataTrBuilder.buildTransformation(conf.dataTransformationConfig);
+
+  if (config.prefetchDepth > 0) {
+    prefetcher = std::make_unique<DataSourcePrefetcher>([this]() { return readNextSamples(); },
+                                                        config.prefetchDepth);
+  }
+}
+
+DataSource::~DataSource() {
+  // the background thread uses the sample provider, so stop it first
+  stopPrefetching();
 }
 
 DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
@@ -44,11 +60,21 @@ DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
 DataSourceIterator DataSource::end() { return DataSourceIterator(*this, config.numBatches); }
 
 Dataset* DataSource::getNextSamples() {
+  currentIteration++;
+
+  if (prefetcher != nullptr) {
+    return prefetcher->next();
+  } else {
+    return readNextSamples();
+  }
+}
+
+Dataset* DataSource::readNextSamples() {
   Dataset* dataset = nullptr;
 
   // only one iteration: we want all samples
   if (config.numBatches == 1 && config.batchSize == 0) {
-    currentIteration++;
+    batchesRead++;
     dataset = sampleProvider->getAllSamples();
 
     // Transform dataset if wanted
@@ -61,10 +87,10 @@ Dataset* DataSource::getNextSamples() {
     // several iterations
   } else {
     dataset = sampleProvider->getNextSamples(config.batchSize);
-    currentIteration++;
+    batchesRead++;
 
     // If data transformation wanted and first batch -> initialize transformation
-    if (currentIteration == 1 &&
+    if (batchesRead == 1 &&
         !(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
       dataTransformation->initialize(dataset, config.dataTransformationConfig);
       return dataTransformation->doTransformation(dataset);
@@ -78,6 +104,12 @@ Dataset* DataSource::getNextSamples() {
   }
 }
 
+void DataSource::stopPrefetching() {
+  if (prefetcher != nullptr) {
+    prefetcher->stop();
+  }
+}
+
 const DataSourceConfig& DataSource::getConfig() const { return config; }
 
 size_t DataSource::getCurrentIteration() const { return currentIteration; }
@@ -13,10 +13,12 @@
 
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceIterator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourcePrefetcher.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformation.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -28,6 +30,10 @@ class DataSourceIterator;
 /**
  * DataSource is a high level, easy to use interface for accessing data provided by a all kinds of
  * #sgpp::datadriven::SampleProvider. Should be used by end users.
+ *
+ * If DataSourceConfig::prefetchDepth is positive, the next batches are read (and transformed) by
+ * a background thread while the current batch is processed, see
+ * #sgpp::datadriven::DataSourcePrefetcher. The batches are the same as without prefetching.
  */
 class DataSource {
  public:
@@ -38,7 +44,7 @@ class DataSource {
    */
   DataSource(DataSourceConfig config, SampleProvider* sampleProvider);
 
-  virtual ~DataSource() = default;
+  virtual ~DataSource();
 
   /**
    * Read only access to the configuration used by DataSource and underlying SampleProvider.
@@ -82,6 +88,15 @@ class DataSource {
   virtual Dataset *getValidationData() = 0;
 
  protected:
+  /**
+   * Constructor
+   * @param config configuration object used for the data source
+   * @param sampleProvider the sample provider to operate on.
+   * @param readFile whether the file given in the configuration has to be read by the sample
+   * provider (false if the sample provider already holds the samples, e.g., if it is a clone)
+   */
+  DataSource(DataSourceConfig config, SampleProvider* sampleProvider, bool readFile);
+
   /**
    * Configuration file that determines all relevant properties of the object.
    */
@@ -101,6 +116,29 @@ class DataSource {
    * pointer to DataTransformation to perform transformations on init.
    */
   DataTransformation* dataTransformation;
+
+  /**
+   * number of batches read from the sample provider (may be ahead of currentIteration if batches
+   * are prefetched).
+   */
+  size_t batchesRead;
+
+  /**
+   * reads the next batches in the background if prefetching is enabled, nullptr otherwise.
+   */
+  std::unique_ptr<DataSourcePrefetcher> prefetcher;
+
+  /**
+   * Reads the next batch from the sample provider and transforms it (if wanted).
+   * @return #sgpp::datadriven::Dataset containing the next batch.
+   */
+  Dataset* readNextSamples();
+
+  /**
+   * Stops prefetching and discards the prefetched batches. Has to be called before the sample
+   * provider is accessed directly (e.g., when it is reset).
+   */
+  void stopPrefetching();
 };
 
 } /* namespace datadriven */
@@ -25,15 +25,45 @@ DataSourceCrossValidation::DataSourceCrossValidation(
     const DataSourceConfig& dataSourceConfig,
     const CrossvalidationConfiguration& crossValidationConfig,
     DataShufflingFunctorCrossValidation* shuffling,
-    SampleProvider* sampleProvider) : DataSource{dataSourceConfig, sampleProvider},
+    SampleProvider* sampleProvider)
+    : DataSourceCrossValidation{dataSourceConfig, crossValidationConfig, shuffling,
+                                sampleProvider, true} {}
+
+DataSourceCrossValidation::DataSourceCrossValidation(
+    const DataSourceConfig& dataSourceConfig,
+    const CrossvalidationConfiguration& crossValidationConfig,
+    DataShufflingFunctorCrossValidation* shuffling,
+    SampleProvider* sampleProvider, bool readFile)
+    : DataSource{dataSourceConfig, sampleProvider, readFile},
         validationData{nullptr}, crossValidationConfig{crossValidationConfig}, shuffling(shuffling)
          { }
 
+DataSourceCrossValidation::~DataSourceCrossValidation() {
+  // the background thread uses the shuffling functor, so stop it before the members are destroyed
+  stopPrefetching();
+  delete validationData;
+}
+
+DataSourceCrossValidation* DataSourceCrossValidation::createFoldView(size_t fold) const {
+  // the copy shares the chained shuffling functor, which is read-only once it has been
+  // initialized for the number of samples; the initialization here writes to it, so views must
+  // not be created concurrently
+  auto viewShuffling = std::unique_ptr<DataShufflingFunctorCrossValidation>(
+      static_cast<DataShufflingFunctorCrossValidation*>(shuffling->clone()));
+  viewShuffling->setFold(fold);
+  (*viewShuffling)(0, sampleProvider->getNumSamples());
+  SampleProvider* viewSampleProvider = sampleProvider->clone();
+  viewSampleProvider->setShuffling(viewShuffling.get());
+  return new DataSourceCrossValidation{config, crossValidationConfig, viewShuffling.release(),
+                                       viewSampleProvider, false};
+}
+
 Dataset* DataSourceCrossValidation::getValidationData() {
   return validationData;
 }
 
 void DataSourceCrossValidation::reset() {
+  stopPrefetching();
   sampleProvider->reset();
 
   // Retrieve validation data again
@@ -43,6 +73,7 @@ void DataSourceCrossValidation::reset() {
 }
 
 void DataSourceCrossValidation::setFold(size_t foldIdx) {
+  stopPrefetching();
   shuffling->setFold(foldIdx);
 }
 
@@ -15,6 +15,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSource.hpp>
 #include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -31,7 +32,8 @@ class DataSourceCrossValidation : public DataSource {
    * Constructor
    * @param dataSourceConfig configuration of the data source
    * @param crossValidationconfig configuration of the cross validation
-   * @param shuffling cross validation shuffling that is used by the sample provider instance
+   * @param shuffling cross validation shuffling that is used by the sample provider instance. The
+   * data source takes ownership of the passed object.
    * @param sampleProvider the sample provider to operate on.
    */
   DataSourceCrossValidation(
@@ -40,6 +42,24 @@ class DataSourceCrossValidation : public DataSource {
       DataShufflingFunctorCrossValidation* shuffling,
       SampleProvider* sampleProvider);
 
+  /**
+   * Destructor
+   */
+  ~DataSourceCrossValidation() override;
+
+  /**
+   * Creates an independent data source for one fold, e.g., to train several folds concurrently.
+   * The view owns a clone of the sample provider, which shares the parsed samples with this data
+   * source, and a copy of the cross validation shuffling functor. Hence it yields the same
+   * batches and validation data as this data source after setFold(fold), without modifying the
+   * state of this data source.
+   * The views share the chained shuffling functor, which is initialized by this method. Hence,
+   * it is not thread-safe: create all views before using them concurrently.
+   * @param fold index of the fold
+   * @return new data source, owned by the caller
+   */
+  DataSourceCrossValidation* createFoldView(size_t fold) const;
+
   /**
    * Returns the data that is used for validation, i.e. the current fold.d If all folds were already
    * iterated over, this method throws.
@@ -65,6 +85,20 @@ class DataSourceCrossValidation : public DataSource {
   const CrossvalidationConfiguration& getCrossValidationConfig() const;
 
  private:
+  /**
+   * Constructor for fold views
+   * @param dataSourceConfig configuration of the data source
+   * @param crossValidationconfig configuration of the cross validation
+   * @param shuffling cross validation shuffling that is used by the sample provider instance
+   * @param sampleProvider the sample provider to operate on, which already holds the samples.
+   * @param readFile whether the sample provider has to read the file given in the configuration
+   */
+  DataSourceCrossValidation(
+      const DataSourceConfig& dataSourceConfig,
+      const CrossvalidationConfiguration& crossValidationconfig,
+      DataShufflingFunctorCrossValidation* shuffling,
+      SampleProvider* sampleProvider, bool readFile);
+
   /**
    * Validation dataset
    */
@@ -76,7 +110,7 @@ class DataSourceCrossValidation : public DataSource {
   /**
    * Shuffling functor that is held by the sample provider.
    */
-  DataShufflingFunctorCrossValidation* shuffling;
+  std::unique_ptr<DataShufflingFunctorCrossValidation> shuffling;
 };
 
 } /* namespace datadriven */
@@ -0,0 +1,119 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourcePrefetcher.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace sgpp {
+namespace datadriven {
+
+DataSourcePrefetcher::DataSourcePrefetcher(Producer producer, size_t depth)
+    : producer(std::move(producer)),
+      depth(std::max(depth, static_cast<size_t>(1))),
+      queue(),
+      worker(),
+      stopRequested(false),
+      finished(false),
+      error() {}
+
+DataSourcePrefetcher::~DataSourcePrefetcher() { stop(); }
+
+Dataset* DataSourcePrefetcher::next() {
+  std::unique_lock<std::mutex> lock(mutex);
+
+  if (!worker.joinable()) {
+    if (finished) {
+      // all samples have been read, the producer can be called directly
+      lock.unlock();
+      return producer();
+    }
+
+    worker = std::thread(&DataSourcePrefetcher::run, this);
+  }
+
+  notEmpty.wait(lock, [this]() { return !queue.empty() || finished; });
+
+  if (!queue.empty()) {
+    Dataset* batch = queue.front().release();
+    queue.pop_front();
+    notFull.notify_one();
+    return batch;
+  }
+
+  // the background thread has finished without creating another batch
+  lock.unlock();
+  worker.join();
+
+  if (error) {
+    std::exception_ptr currentError = error;
+    error = nullptr;
+    std::rethrow_exception(currentError);
+  }
+
+  return producer();
+}
+
+void DataSourcePrefetcher::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopRequested = true;
+  }
+
+  notFull.notify_all();
+
+  if (worker.joinable()) {
+    worker.join();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  queue.clear();
+  stopRequested = false;
+  finished = false;
+  error = nullptr;
+}
+
+void DataSourcePrefetcher::run() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      notFull.wait(lock, [this]() { return stopRequested || queue.size() < depth; });
+
+      if (stopRequested) {
+        return;
+      }
+    }
+
+    std::unique_ptr<Dataset> batch;
+
+    try {
+      batch.reset(producer());
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      error = std::current_exception();
+      finished = true;
+      notEmpty.notify_all();
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const bool empty = (batch->getNumberInstances() == 0);
+    queue.push_back(std::move(batch));
+
+    if (empty) {
+      finished = true;
+    }
+
+    notEmpty.notify_all();
+
+    if (empty) {
+      return;
+    }
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
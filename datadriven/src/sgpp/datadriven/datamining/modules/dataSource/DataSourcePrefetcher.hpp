@@ -0,0 +1,122 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Bounded queue of batches that is filled by a background thread, used by
+ * #sgpp::datadriven::DataSource to read, parse and transform the next batches while the current
+ * one is being processed.
+ *
+ * The batches are created by calling a producer function. The producer is never called
+ * concurrently and always in the same order as without prefetching, so the sequence of batches
+ * does not change. The background thread stops after the producer has returned an empty batch
+ * (no more samples), further calls of #next then call the producer directly.
+ */
+class DataSourcePrefetcher {
+ public:
+  /**
+   * Function that creates the next batch. Caller owns the returned object.
+   */
+  typedef std::function<Dataset*()> Producer;
+
+  /**
+   * Constructor. The background thread is started by the first call of #next.
+   * @param producer function that creates the next batch
+   * @param depth maximal number of batches that are read ahead (at least 1)
+   */
+  DataSourcePrefetcher(Producer producer, size_t depth);
+
+  /**
+   * Destructor, stops the background thread and discards the prefetched batches.
+   */
+  ~DataSourcePrefetcher();
+
+  /**
+   * Returns the next batch, waits until it has been created. Exceptions thrown by the producer
+   * are rethrown here (after all batches created before have been returned).
+   * @return the next batch. Caller owns the object.
+   */
+  Dataset* next();
+
+  /**
+   * Stops the background thread and discards the prefetched batches. Has to be called before the
+   * state the producer depends on is changed (e.g., before the sample provider is reset). The
+   * next call of #next restarts the background thread.
+   */
+  void stop();
+
+ private:
+  /**
+   * Function that creates the next batch
+   */
+  Producer producer;
+
+  /**
+   * Maximal number of prefetched batches
+   */
+  size_t depth;
+
+  /**
+   * Prefetched batches in the order they have been created
+   */
+  std::deque<std::unique_ptr<Dataset>> queue;
+
+  /**
+   * Background thread
+   */
+  std::thread worker;
+
+  /**
+   * Protects queue and the flags below
+   */
+  std::mutex mutex;
+
+  /**
+   * Signaled when a batch has been removed from the queue or stop has been requested
+   */
+  std::condition_variable notFull;
+
+  /**
+   * Signaled when a batch has been added to the queue or the background thread has finished
+   */
+  std::condition_variable notEmpty;
+
+  /**
+   * Whether the background thread has been asked to stop
+   */
+  bool stopRequested;
+
+  /**
+   * Whether the background thread has finished (no more samples or exception)
+   */
+  bool finished;
+
+  /**
+   * Exception thrown by the producer in the background thread
+   */
+  std::exception_ptr error;
+
+  /**
+   * Main loop of the background thread
+   */
+  void run();
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -45,6 +45,10 @@ size_t FileSampleDecorator::getDim() const { return fileSampleProvider->getDim()
 
 size_t FileSampleDecorator::getNumSamples() const { return fileSampleProvider->getNumSamples(); }
 
+void FileSampleDecorator::setShuffling(DataShufflingFunctor *shuffling) {
+  fileSampleProvider->setShuffling(shuffling);
+}
+
 void FileSampleDecorator::readFile(const std::string &fileName,
                                    bool hasTargets,
                                    size_t readinCutoff,
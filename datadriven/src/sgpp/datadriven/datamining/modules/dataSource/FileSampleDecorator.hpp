@@ -58,6 +58,8 @@ class FileSampleDecorator : public FileSampleProvider {
 
   size_t getNumSamples() const override;
 
+  void setShuffling(DataShufflingFunctor *shuffling) override;
+
   /**
    * Reads a file's content from a file
    * @param fileName path to the file
@@ -75,6 +75,14 @@ class SampleProvider {
    * Resets the state of the sample provider (e.g. to start a new epoch)
    */
   virtual void reset() = 0;
+
+  /**
+   * Replaces the functor that permutes the sample indices, e.g., to let a clone iterate over the
+   * samples in a different order than the original.
+   * @param shuffling the new shuffling functor (nullptr for no shuffling). It is not owned by the
+   * sample provider and has to outlive it.
+   */
+  virtual void setShuffling(DataShufflingFunctor *shuffling) = 0;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
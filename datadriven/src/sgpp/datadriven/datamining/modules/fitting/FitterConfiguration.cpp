@@ -133,6 +133,8 @@ void FitterConfiguration::setupDefaults() {
   crossvalidationConfig.seed_ = 0;
   crossvalidationConfig.shuffle_ = false;
   crossvalidationConfig.silent_ = false;
+  crossvalidationConfig.parallelFolds_ = 1;
+  crossvalidationConfig.threadsPerFold_ = 0;
   crossvalidationConfig.lambda_ = 0.001;
   crossvalidationConfig.lambdaStart_ = 0.001;
   crossvalidationConfig.lambdaEnd_ = 0.001;
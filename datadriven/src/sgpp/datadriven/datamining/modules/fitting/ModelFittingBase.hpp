@@ -87,6 +87,13 @@ class ModelFittingBase {
    */
   // virtual ModelFittingBase* clone() const = 0;
 
+  /**
+   * Creates a new, untrained fitter with the same configuration, e.g., to train the folds of a
+   * cross validation concurrently. In contrast to a clone, the state of the model is not copied.
+   * @return new fitter owned by the caller or nullptr if the fitter does not support this.
+   */
+  virtual ModelFittingBase *createUntrainedCopy() const { return nullptr; }
+
   // TODO(lettrich): dataset should be const.
   /**
    * Fit the grid to the dataset by determinig the weights of an initial grid
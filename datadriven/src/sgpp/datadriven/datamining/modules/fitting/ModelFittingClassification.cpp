@@ -323,6 +323,18 @@ void ModelFittingClassification::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingClassification::createUntrainedCopy() const {
+  // the process grid of ScaLAPACK cannot be shared between concurrently trained models
+  if (config->getParallelConfig().scalapackEnabled_) {
+    return nullptr;
+  }
+  // the configuration is stored as its base class, which holds all of its members
+  FitterConfigurationClassification classificationConfig;
+  static_cast<FitterConfigurationDensityEstimation&>(classificationConfig) =
+      static_cast<const FitterConfigurationDensityEstimation&>(*config);
+  return new ModelFittingClassification(classificationConfig);
+}
+
 void ModelFittingClassification::storeClassificator() {
   std::cout << "Storing Classificator..." << std::endl;
 
@@ -86,6 +86,8 @@ class ModelFittingClassification : public ModelFittingBase {
    */
   void reset() override;
 
+  ModelFittingBase *createUntrainedCopy() const override;
+
   /*
    * store Fitter into text file in folder /datadriven/classificator/
    */
@@ -172,5 +172,10 @@ void ModelFittingDensityEstimationCG::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationCG::createUntrainedCopy() const {
+  return new ModelFittingDensityEstimationCG(
+      static_cast<const FitterConfigurationDensityEstimation&>(*config));
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -105,6 +105,8 @@ class ModelFittingDensityEstimationCG : public ModelFittingDensityEstimation {
    */
   void reset() override;
 
+  ModelFittingBase *createUntrainedCopy() const override;
+
  private:
   /**
    * Creates the regularization operation matrix for the model settings.
@@ -95,7 +95,7 @@ void ModelFittingDensityEstimationOnOff::fit(DataMatrix& newDataset) {
                                densityEstimationConfig)) {
       std::string offlineFilepath = database.getDataMatrix(
           gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig);
-      offline = DBMatOfflineFactory::buildFromFile(offlineFilepath);
+      offline = DBMatDatabase::loadOfflineObject(offlineFilepath);
     }
   }
 
@@ -179,5 +179,10 @@ void ModelFittingDensityEstimationOnOff::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationOnOff::createUntrainedCopy() const {
+  return new ModelFittingDensityEstimationOnOff(
+      static_cast<const FitterConfigurationDensityEstimation&>(*config));
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -112,6 +112,8 @@ class ModelFittingDensityEstimationOnOff : public ModelFittingDensityEstimation
    */
   void reset() override;
 
+  ModelFittingBase *createUntrainedCopy() const override;
+
  private:
   // The online object
   std::unique_ptr<DBMatOnlineDE> online;
@@ -113,7 +113,7 @@ void ModelFittingDensityEstimationOnOffParallel::fit(DataMatrix& newDataset) {
                                densityEstimationConfig)) {
       std::string offlineFilepath = database.getDataMatrix(
           gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig);
-      offline = DBMatOfflineFactory::buildFromFile(offlineFilepath);
+      offline = DBMatDatabase::loadOfflineObject(offlineFilepath);
     }
   }
 
@@ -118,6 +118,11 @@ void ModelFittingLeastSquares::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase *ModelFittingLeastSquares::createUntrainedCopy() const {
+  return new ModelFittingLeastSquares(
+      static_cast<const FitterConfigurationLeastSquares &>(*config));
+}
+
 void ModelFittingLeastSquares::assembleSystemAndSolve(const SLESolverConfiguration &solverConfig,
                                                       DataVector &alpha) const {
   auto systemMatrix = std::unique_ptr<DMSystemMatrixBase>(
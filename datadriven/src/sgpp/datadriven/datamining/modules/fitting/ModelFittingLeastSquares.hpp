@@ -78,6 +78,8 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
    */
   void reset() override;
 
+  ModelFittingBase *createUntrainedCopy() const override;
+
  private:
   /**
    * Count the amount of refinement operations performed on the current dataset.
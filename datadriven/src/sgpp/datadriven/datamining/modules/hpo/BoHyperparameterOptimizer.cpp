@@ -12,9 +12,11 @@
 
 #include <sgpp/datadriven/datamining/modules/hpo/BoHyperparameterOptimizer.hpp>
 
+#include <sgpp/datadriven/datamining/modules/hpo/TrialScheduler.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <limits>
@@ -61,39 +63,55 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   int bestscnt = 0;
   std::string bestconfigstring;
 
-
-
-  // list/vector of configs, start setup
-  std::vector<BOConfig> initialConfigs{};
-  initialConfigs.reserve(static_cast<size_t>(config.getNRandom()));
-  std::mt19937 generator(static_cast<size_t>(config.getSeed()));
-
-  // random warmup phase
-  for (int i = 0; i < config.getNRandom(); ++i) {
-    initialConfigs.emplace_back(prototype);
-    initialConfigs[i].randomize(generator);
-    fitterFactory->setBO(initialConfigs[i]);
-    std::string configString = fitterFactory->printConfig();
-    // std::unique_ptr<ModelFittingBase> fitter(fitterFactory->buildFitter());
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    // hpoScorer->calculateScore(*fitter, *trainData, &stdDeviation);
-    initialConfigs[i].setScore(transformScore(result));
-    std::cout << (i + 1) << configString << ", " << result;
+  // print the result of a trial and keep track of the best one
+  auto report = [&](int sampleNo, const std::string &configString, double result, bool stopped) {
+    std::cout << sampleNo << configString << ", " << result;
+    if (stopped) {
+      std::cout << " stopped early";
+    }
     if (writeToFile) {
       myfile.open(fn.str(), std::ios_base::app);
       if (myfile.is_open()) {
-        myfile << (i + 1) << configString << ", " << result << std::endl;
+        myfile << sampleNo << configString << ", " << result << std::endl;
       }
       myfile.close();
     }
-    if (result < best) {
+    if (!stopped && result < best) {
       best = result;
-      bestscnt = i + 1;
+      bestscnt = sampleNo;
       bestconfigstring = configString;
       std::cout << " new best!";
     }
     std::cout << std::endl;
+  };
+
+  TrialScheduler scheduler{getMiners(), config};
+  const size_t nRandom = static_cast<size_t>(std::max(config.getNRandom(), int64_t{0}));
+  const size_t nRuns = static_cast<size_t>(std::max(config.getNRuns(), int64_t{0}));
+  base::DataVector scores;
+  std::vector<bool> stopped;
+
+  // list/vector of configs, start setup
+  std::vector<BOConfig> initialConfigs{};
+  initialConfigs.reserve(nRandom);
+  std::vector<ModelFittingBase *> fitters(nRandom);
+  std::vector<std::string> configStrings(nRandom);
+  std::mt19937 generator(static_cast<size_t>(config.getSeed()));
+
+  // random warmup phase, all trials are independent of each other
+  for (size_t i = 0; i < nRandom; ++i) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
+    fitterFactory->setBO(initialConfigs[i]);
+    configStrings[i] = fitterFactory->printConfig();
+    fitters[i] = fitterFactory->buildFitter();
+  }
+  scheduler.evaluate(fitters, scores, stopped);
+  double bestTransformed = std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < nRandom; ++i) {
+    initialConfigs[i].setScore(transformScore(scores[i]));
+    bestTransformed = std::min(bestTransformed, initialConfigs[i].getScore());
+    report(static_cast<int>(i + 1), configStrings[i], scores[i], stopped[i]);
   }
 
   std::cout << "############# Random Phase finished! #############" << std::endl;
@@ -101,32 +119,37 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   BayesianOptimization bo(initialConfigs);
   bo.setScales(bo.fitScales(), 0.7);
 
-
-  // main loop
-  for (int q = 0; q < config.getNRuns(); q++) {
-    BOConfig nextConfig = bo.main(prototype);
-    fitterFactory->setBO(nextConfig);
-    std::string configString = fitterFactory->printConfig();
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    nextConfig.setScore(transformScore(result));
-    bo.updateGP(nextConfig, true);
-    bo.setScales(bo.fitScales(), 0.1);
-    std::cout << (q + config.getNRandom() + 1) << configString << ", " << result;
-    if (writeToFile) {
-      myfile.open(fn.str(), std::ios_base::app);
-      if (myfile.is_open()) {
-        myfile << (q + config.getNRandom() + 1) << configString << ", " << result << std::endl;
+  // main loop, one batch of trials per worker
+  for (size_t q = 0; q < nRuns; q += scheduler.getNumberWorkers()) {
+    const size_t batchSize = std::min(scheduler.getNumberWorkers(), nRuns - q);
+
+    // constant liar: the configurations of a batch are chosen one after another, each pending
+    // one is assumed to score as well as the best so far, which moves the maximum of the
+    // acquisition function away from it
+    BayesianOptimization liar(bo);
+    std::vector<BOConfig> nextConfigs;
+    fitters.resize(batchSize);
+    configStrings.resize(batchSize);
+    for (size_t b = 0; b < batchSize; ++b) {
+      nextConfigs.push_back(liar.main(prototype));
+      fitterFactory->setBO(nextConfigs[b]);
+      configStrings[b] = fitterFactory->printConfig();
+      fitters[b] = fitterFactory->buildFitter();
+      if (b + 1 < batchSize) {
+        BOConfig pending(nextConfigs[b]);
+        pending.setScore(bestTransformed);
+        liar.updateGP(pending, true);
       }
-      myfile.close();
     }
-    if (result < best) {
-      best = result;
-      bestscnt = static_cast<int>(q + config.getNRandom() + 1);
-      bestconfigstring = configString;
-      std::cout << " new best!";
+
+    scheduler.evaluate(fitters, scores, stopped);
+    for (size_t b = 0; b < batchSize; ++b) {
+      nextConfigs[b].setScore(transformScore(scores[b]));
+      bestTransformed = std::min(bestTransformed, nextConfigs[b].getScore());
+      bo.updateGP(nextConfigs[b], true);
+      bo.setScales(bo.fitScales(), 0.1);
+      report(static_cast<int>(q + b + nRandom + 1), configStrings[b], scores[b], stopped[b]);
     }
-    std::cout << std::endl;
   }
   if (writeToFile) {
     myfile.open(fn.str(), std::ios_base::app);
@@ -25,6 +25,9 @@ void HPOConfig::setupDefaults() {
   constraints = {2, 2};
   lambda = 1;
   nRandom = 10;
+  parallelTrials = 1;
+  halvingRate = 0;
+  halvingMinEpochs = 1;
 }
 
 int64_t HPOConfig::getSeed() const {
@@ -82,5 +85,29 @@ int64_t HPOConfig::getNTrainSamples() const {
 void HPOConfig::setNTrainSamples(int64_t nTrainSamples) {
   HPOConfig::nTrainSamples = nTrainSamples;
 }
+
+int64_t HPOConfig::getParallelTrials() const {
+  return parallelTrials;
+}
+
+void HPOConfig::setParallelTrials(int64_t parallelTrials) {
+  HPOConfig::parallelTrials = parallelTrials;
+}
+
+int64_t HPOConfig::getHalvingRate() const {
+  return halvingRate;
+}
+
+void HPOConfig::setHalvingRate(int64_t halvingRate) {
+  HPOConfig::halvingRate = halvingRate;
+}
+
+int64_t HPOConfig::getHalvingMinEpochs() const {
+  return halvingMinEpochs;
+}
+
+void HPOConfig::setHalvingMinEpochs(int64_t halvingMinEpochs) {
+  HPOConfig::halvingMinEpochs = halvingMinEpochs;
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
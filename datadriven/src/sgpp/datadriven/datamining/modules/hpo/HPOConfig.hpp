@@ -55,6 +55,18 @@ class HPOConfig {
 
   void setNTrainSamples(int64_t nTrainSamples);
 
+  int64_t getParallelTrials() const;
+
+  void setParallelTrials(int64_t parallelTrials);
+
+  int64_t getHalvingRate() const;
+
+  void setHalvingRate(int64_t halvingRate);
+
+  int64_t getHalvingMinEpochs() const;
+
+  void setHalvingMinEpochs(int64_t halvingMinEpochs);
+
  private:
   /**
    * Seed for random sampling in both harmonica and bayesian optimization
@@ -84,6 +96,19 @@ class HPOConfig {
    * number of samples bayesian optimization is run for
    */
   int64_t nRuns;
+  /**
+   * number of trials that are evaluated concurrently
+   */
+  int64_t parallelTrials;
+  /**
+   * reduction factor of successive halving: after the number of epochs of a rung, only the best
+   * 1 / halvingRate of the trials continue (values below 2 disable early stopping)
+   */
+  int64_t halvingRate;
+  /**
+   * number of epochs of the first rung of successive halving, the rungs then grow by halvingRate
+   */
+  int64_t halvingMinEpochs;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -12,6 +12,7 @@
 
 #include <sgpp/datadriven/datamining/modules/hpo/HarmonicaHyperparameterOptimizer.hpp>
 
+#include <sgpp/datadriven/datamining/modules/hpo/TrialScheduler.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/harmonica/Harmonica.hpp>
 
 #include <vector>
@@ -30,6 +31,7 @@ HarmonicaHyperparameterOptimizer::HarmonicaHyperparameterOptimizer(SparseGridMin
 
 double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
   Harmonica harmonica{fitterFactory.get()};
+  TrialScheduler scheduler{getMiners(), config};
 
   std::cout << std::endl << "Starting Hyperparameter Optimization using Harmonica. Results"
           " are saved with timestamp." << std::endl << std::endl;
@@ -67,13 +69,15 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
     std::vector<std::string> configStrings(nRuns);
     harmonica.prepareConfigs(fitters, static_cast<int>(config.getSeed()), configStrings);
 
-    // run samples (parallelize here)
+    // run samples
+    std::vector<bool> stopped;
+    scheduler.evaluate(fitters, scores, stopped);
     for (size_t i = 0; i < nRuns; i++) {
-      miner->setModel(fitters[i]);
-      scores[i] = miner->learn(false);
-      // hpoScorer->calculateScore(*(fitters[i]), *trainData, &stdDeviation);
       std::cout << scnt << configStrings[i] << ", " << scores[i];
-      if (scores[i] < best) {
+      if (stopped[i]) {
+        std::cout << " stopped early";
+      }
+      if (!stopped[i] && scores[i] < best) {
         best = scores[i];
         bestscnt = scnt;
         bestconfigstring = configStrings[i];
@@ -27,5 +27,17 @@ HyperparameterOptimizer::HyperparameterOptimizer(SparseGridMiner* miner,
   config.setupDefaults();
   parser.getHPOConfig(config);
 }
+
+void HyperparameterOptimizer::addMiner(SparseGridMiner *additionalMiner) {
+  additionalMiners.emplace_back(additionalMiner);
+}
+
+std::vector<SparseGridMiner *> HyperparameterOptimizer::getMiners() const {
+  std::vector<SparseGridMiner *> miners{miner.get()};
+  for (auto &additionalMiner : additionalMiners) {
+    miners.push_back(additionalMiner.get());
+  }
+  return miners;
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -19,6 +19,7 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -76,6 +77,13 @@ class HyperparameterOptimizer {
    */
   virtual double run(bool writeToFile) = 0;
 
+  /**
+   * Add a miner that evaluates trials concurrently to the other miners. It has to be configured
+   * like the miner passed to the constructor, but needs its own data source.
+   * @param additionalMiner the miner. The HyperparameterOptimizer instance will take ownership of
+   * the passed object.
+   */
+  void addMiner(SparseGridMiner *additionalMiner);
 
  protected:
   /**
@@ -83,6 +91,11 @@ class HyperparameterOptimizer {
    */
   std::unique_ptr<SparseGridMiner> miner;
 
+  /**
+   * Further miners to evaluate trials concurrently
+   */
+  std::vector<std::unique_ptr<SparseGridMiner>> additionalMiners;
+
   /**
    * FitterFactory to provide fitters for running different hyperparameter configurations.
    */
@@ -92,6 +105,11 @@ class HyperparameterOptimizer {
    * Configuration for all hpo details.
    */
   HPOConfig config;
+
+  /**
+   * @return all miners, i.e., the workers for the evaluation of trials
+   */
+  std::vector<SparseGridMiner *> getMiners() const;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
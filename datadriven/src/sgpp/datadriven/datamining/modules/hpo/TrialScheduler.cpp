@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * TrialScheduler.cpp
+ */
+
+#include <sgpp/datadriven/datamining/modules/hpo/TrialScheduler.hpp>
+
+#include <sgpp/base/exception/application_exception.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+TrialScheduler::TrialScheduler(const std::vector<SparseGridMiner *> &miners,
+                               const HPOConfig &config)
+    : miners(miners),
+      halvingRate(static_cast<size_t>(std::max(config.getHalvingRate(), int64_t{0}))),
+      halvingMinEpochs(static_cast<size_t>(std::max(config.getHalvingMinEpochs(), int64_t{1}))),
+      rungScores(),
+      rungMutex() {
+  if (miners.empty()) {
+    throw base::application_exception("TrialScheduler: at least one miner is required");
+  }
+}
+
+size_t TrialScheduler::getNumberWorkers() const {
+  return miners.size();
+}
+
+void TrialScheduler::evaluate(const std::vector<ModelFittingBase *> &fitters,
+                              base::DataVector &scores, std::vector<bool> &stopped) {
+  const size_t nTrials = fitters.size();
+  const size_t nWorkers = std::max(std::min(miners.size(), nTrials), size_t{1});
+
+  // the fitters are handed to the miners one by one, the rest is freed if a trial fails
+  std::vector<std::unique_ptr<ModelFittingBase>> trials;
+  for (ModelFittingBase *fitter : fitters) {
+    trials.emplace_back(fitter);
+  }
+  scores = base::DataVector(nTrials);
+  std::vector<char> stoppedTrials(nTrials, 0);
+  std::vector<std::exception_ptr> errors(nTrials);
+
+  auto runTrial = [&](SparseGridMiner &miner, size_t trial) {
+    bool trialStopped = false;
+    if (halvingRate >= 2) {
+      miner.setEpochCallback([this, &trialStopped](size_t epoch, double score) {
+        trialStopped = !continueTrial(epoch, score);
+        return !trialStopped;
+      });
+    }
+    miner.setModel(trials[trial].release());
+    scores[trial] = miner.learn(false);
+    miner.setEpochCallback(nullptr);
+    stoppedTrials[trial] = trialStopped;
+  };
+
+#ifdef _OPENMP
+  // every worker gets its share of the threads for the parallel operations of its fitter
+  const int threadsPerTrial = std::max(omp_get_max_threads() / static_cast<int>(nWorkers), 1);
+  const int oldMaxActiveLevels = omp_get_max_active_levels();
+  omp_set_max_active_levels(std::max(oldMaxActiveLevels, 2));
+#endif /* _OPENMP */
+
+#pragma omp parallel num_threads(static_cast<int>(nWorkers))
+  {
+    size_t worker = 0;
+#ifdef _OPENMP
+    worker = static_cast<size_t>(omp_get_thread_num());
+    omp_set_num_threads(threadsPerTrial);
+#endif /* _OPENMP */
+
+#pragma omp for schedule(dynamic)
+    for (size_t trial = 0; trial < nTrials; trial++) {
+      try {
+        runTrial(*miners[worker], trial);
+      } catch (...) {
+        // exceptions must not leave the parallel region
+        miners[worker]->setEpochCallback(nullptr);
+        errors[trial] = std::current_exception();
+      }
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_max_active_levels(oldMaxActiveLevels);
+#endif /* _OPENMP */
+
+  for (size_t trial = 0; trial < nTrials; trial++) {
+    if (errors[trial] != nullptr) {
+      std::rethrow_exception(errors[trial]);
+    }
+  }
+  stopped.assign(stoppedTrials.begin(), stoppedTrials.end());
+}
+
+bool TrialScheduler::continueTrial(size_t epoch, double score) {
+  if (halvingRate < 2) {
+    return true;
+  }
+
+  // find the rung that ends with this epoch, if any
+  const size_t completedEpochs = epoch + 1;
+  size_t rungEpochs = halvingMinEpochs;
+  size_t rung = 0;
+  while (rungEpochs < completedEpochs) {
+    rungEpochs *= halvingRate;
+    rung++;
+  }
+  if (rungEpochs != completedEpochs) {
+    return true;
+  }
+
+  std::lock_guard<std::mutex> lock(rungMutex);
+  if (rungScores.size() <= rung) {
+    rungScores.resize(rung + 1);
+  }
+  std::vector<double> &recorded = rungScores[rung];
+  recorded.push_back(score);
+
+  // the first trials at a rung always continue as there is nothing to compare with yet
+  const size_t promoted = recorded.size() / halvingRate;
+  if (promoted == 0) {
+    return true;
+  }
+  // lower scores are better, continue if the score is among the best promoted ones
+  std::vector<double> sorted(recorded);
+  std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(promoted - 1),
+                   sorted.end());
+  return score <= sorted[promoted - 1];
+}
+} /* namespace datadriven */
+} /* namespace sgpp */
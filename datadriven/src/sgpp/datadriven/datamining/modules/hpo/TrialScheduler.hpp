@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * TrialScheduler.hpp
+ */
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/HPOConfig.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * TrialScheduler evaluates the trials (fitters with different hyperparameters) of a
+ * hyperparameter optimization. Every miner is a worker: the trials are distributed dynamically
+ * over one thread per miner, and each worker trains with its share of the available OpenMP
+ * threads.
+ *
+ * Optionally, unpromising trials are stopped early by asynchronous successive halving. The rungs
+ * are after halvingMinEpochs, halvingMinEpochs * halvingRate, halvingMinEpochs * halvingRate^2,
+ * ... epochs. A trial that reaches a rung continues only if its validation score is among the
+ * best 1 / halvingRate of all scores recorded at this rung so far. Since the decision depends on
+ * the order in which concurrent trials reach the rungs, early stopping is reproducible only with
+ * a single worker.
+ */
+class TrialScheduler {
+ public:
+  /**
+   * Constructor
+   * @param miners workers that evaluate the trials, each of them with its own data source. The
+   * scheduler does not take ownership.
+   * @param config configuration of the hyperparameter optimization (parallelTrials is ignored,
+   * the number of workers is the number of miners)
+   */
+  TrialScheduler(const std::vector<SparseGridMiner *> &miners, const HPOConfig &config);
+
+  /**
+   * @return number of trials that can be evaluated concurrently
+   */
+  size_t getNumberWorkers() const;
+
+  /**
+   * Evaluate trials concurrently.
+   * @param fitters untrained fitters, one per trial. The scheduler takes ownership.
+   * @param[out] scores scores of the trials on the validation data, resized if necessary
+   * @param[out] stopped whether the trials were stopped early, in which case the score is the
+   * intermediate score at the time of stopping
+   */
+  void evaluate(const std::vector<ModelFittingBase *> &fitters, base::DataVector &scores,
+                std::vector<bool> &stopped);
+
+ protected:
+  /**
+   * Decide whether a trial continues after an epoch (thread-safe).
+   * @param epoch index of the epoch that has been completed
+   * @param score score of the trial on the validation data
+   * @return false if the trial is dominated at a rung
+   */
+  bool continueTrial(size_t epoch, double score);
+
+  /**
+   * workers that evaluate the trials
+   */
+  std::vector<SparseGridMiner *> miners;
+  /**
+   * reduction factor of successive halving (early stopping is disabled if it is below 2)
+   */
+  size_t halvingRate;
+  /**
+   * number of epochs of the first rung
+   */
+  size_t halvingMinEpochs;
+  /**
+   * scores recorded at each rung
+   */
+  std::vector<std::vector<double>> rungScores;
+  /**
+   * guards rungScores
+   */
+  std::mutex rungMutex;
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -132,5 +132,20 @@ double BOConfig::getScaledDistance(BOConfig &other, const base::DataVector &scal
   }
   return tmp;
 }
+
+void BOConfig::calcSquaredDifferences(BOConfig &other, double *result) {
+  size_t k = 0;
+  for (size_t i = 0; i < cont.size(); ++i) {
+    double diff = cont[i] - other.cont[i];
+    result[k++] = diff * diff;
+  }
+  for (size_t i = 0; i < disc.size(); ++i) {
+    double diff = (disc[i] - other.disc[i]) / (discOptions->at(i) - 1.0);
+    result[k++] = diff * diff;
+  }
+  for (size_t i = 0; i < cat.size(); ++i) {
+    result[k++] = (cat[i] != other.cat[i]) ? 1.0 : 0.0;
+  }
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -118,6 +118,14 @@ class BOConfig {
    */
   double getScaledDistance(BOConfig &other, const base::DataVector &scales);
 
+  /**
+   * Compute the unscaled squared difference to another BOConfig/sample point for each
+   * hyperparameter, such that the scaled distance is the sum of scales[k]^2 * result[k]
+   * @param other sample point to calculate the differences to
+   * @param result output array of getNPar() values
+   */
+  void calcSquaredDifferences(BOConfig &other, double *result);
+
   /**
    * Generate a random config
    * @param generator for seeded rng
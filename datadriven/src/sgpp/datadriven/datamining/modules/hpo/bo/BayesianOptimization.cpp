@@ -26,15 +26,19 @@ namespace sgpp {
 namespace datadriven {
 
 BayesianOptimization::BayesianOptimization(const std::vector<BOConfig> &initialConfigs)
-    : kernelmatrix(initialConfigs.size(), initialConfigs.size()),
-      gleft(),
+    : gp(initialConfigs.front().getNPar()),
       transformedOutput(),
       rawScores(initialConfigs.size()),
       screwedvar(false),
-      maxofmax(0),
       allConfigs(initialConfigs) {
+  size_t nPar = allConfigs.front().getNPar();
   for (size_t i = 0; i < allConfigs.size(); ++i) {
     rawScores[i] = allConfigs[i].getScore();
+    std::vector<double> differences(i * nPar);
+    for (size_t k = 0; k < i; ++k) {
+      allConfigs[k].calcSquaredDifferences(allConfigs[i], &differences[k * nPar]);
+    }
+    gp.addSample(differences);
   }
   if (rawScores.min() < rawScores.max()) {
     rawScores.normalize();
@@ -48,8 +52,7 @@ BayesianOptimization::BayesianOptimization(const std::vector<BOConfig> &initialC
 
 
 double BayesianOptimization::kernel(double distance) {
-  double kernelwidth = 8.0;   // offset for dimensional scaling
-  return exp(-distance * kernelwidth / 2);
+  return GaussianProcess::kernel(distance);
 }
 
 double BayesianOptimization::acquisitionEI(double dMean, double dVar, double bestsofar) {
@@ -63,15 +66,10 @@ double BayesianOptimization::mean(base::DataVector &knew) {
 }
 
 double BayesianOptimization::var(base::DataVector &knew, double kself) {
+  // knew^T K^-1 knew = |L^-1 knew|^2, so a forward substitution suffices
   base::DataVector tmp(knew);
-  solveCholeskySystem(gleft, tmp);
-
-  base::DataVector check(tmp.size());
-  kernelmatrix.mult(tmp, check);
-  check.sub(knew);
-  double max = check.maxNorm();
-  maxofmax = std::fmax(max, maxofmax);
-  double var = kself - knew.dotProduct(tmp);
+  gp.solveLower(tmp);
+  double var = kself - tmp.dotProduct(tmp);
   if (var > 1 || var < 0) {
     screwedvar = true;
     return 0;
@@ -87,10 +85,15 @@ BOConfig BayesianOptimization::main(BOConfig &prototype) {
                                                         std::placeholders::_1));
   double min = std::numeric_limits<double>::infinity();
   BOConfig bestConfig;
-  do {
-    for (auto &config : allConfigs) {
-      config.calcDiscDistance(nextconfig, scales);
+  size_t nCont = prototype.getContSize();
+  scaledCont = base::DataMatrix(allConfigs.size(), nCont);
+  for (size_t i = 0; i < allConfigs.size(); ++i) {
+    for (size_t k = 0; k < nCont; ++k) {
+      scaledCont.set(i, k, scales[k] * allConfigs[i].getCont(k));
     }
+  }
+  do {
+    prepareAcquisition(nextconfig);
     optimization::optimizer::MultiStart optimizer(wrapper, 1000, 5);
     optimizer.optimize();
     double optv = optimizer.getOptimalValue();
@@ -107,10 +110,40 @@ BOConfig BayesianOptimization::main(BOConfig &prototype) {
   return bestConfig;
 }
 
+void BayesianOptimization::prepareAcquisition(BOConfig &candidate) {
+  size_t nPar = candidate.getNPar();
+  size_t nCont = candidate.getContSize();
+  std::vector<double> differences(nPar);
+  discDistances = base::DataVector(allConfigs.size());
+  for (size_t i = 0; i < allConfigs.size(); ++i) {
+    allConfigs[i].calcSquaredDifferences(candidate, differences.data());
+    double distance = 0;
+    for (size_t k = nCont; k < nPar; ++k) {
+      distance += scales[k] * scales[k] * differences[k];
+    }
+    discDistances[i] = distance;
+  }
+}
+
 double BayesianOptimization::acquisitionOuter(const base::DataVector &inp) {
+  size_t nCont = scaledCont.getNcols();
+  if (discDistances.size() != allConfigs.size() || scaledCont.getNrows() != allConfigs.size()) {
+    throw base::data_exception(
+        "BayesianOptimization::acquisitionOuter: prepareAcquisition has not been called");
+  }
+  base::DataVector scaledInput(nCont);
+  for (size_t k = 0; k < nCont; ++k) {
+    scaledInput[k] = scales[k] * inp[k];
+  }
   base::DataVector kernelrow(allConfigs.size());
   for (size_t i = 0; i < allConfigs.size(); i++) {
-    kernelrow[i] = kernel(allConfigs[i].getTotalDistance(inp, scales));
+    const double *cont = scaledCont.getPointer() + i * nCont;
+    double distance = discDistances[i];
+    for (size_t k = 0; k < nCont; ++k) {
+      double diff = cont[k] - scaledInput[k];
+      distance += diff * diff;
+    }
+    kernelrow[i] = kernel(distance);
   }
   double m = mean(kernelrow);
   double v = var(kernelrow, 1);
@@ -122,18 +155,11 @@ void BayesianOptimization::setScales(base::DataVector nscales, double factor) {
   scales.mult(1-factor);
   scales.add(nscales);
   // std::cout << scales.toString() << std::endl;
-  double noise = pow(10, -scales.back() * 10);
-  for (size_t i = 0; i < allConfigs.size(); ++i) {
-    for (size_t k = 0; k < i; ++k) {
-      double tmp = kernel(allConfigs[i].getScaledDistance(allConfigs[k], scales));
-      kernelmatrix.set(k, i, tmp);
-      kernelmatrix.set(i, k, tmp);
-    }
-    kernelmatrix.set(i, i, 1 + noise);
+  if (!gp.setScales(scales)) {
+    decomFailed = true;
   }
-  decomposeCholesky(kernelmatrix, gleft);
   transformedOutput = base::DataVector(rawScores);
-  solveCholeskySystem(gleft, transformedOutput);
+  gp.solve(transformedOutput);
 }
 
 base::DataVector BayesianOptimization::fitScales() {
@@ -150,44 +176,23 @@ base::DataVector BayesianOptimization::fitScales() {
 }
 
 double BayesianOptimization::likelihood(const base::DataVector &inp) {
-  double noise = pow(10, -inp.back() * 10);
-  base::DataMatrix km(allConfigs.size(), allConfigs.size());
-  for (size_t i = 0; i < allConfigs.size(); ++i) {
-    for (size_t k = 0; k < i; ++k) {
-      double tmp = kernel(allConfigs[i].getScaledDistance(allConfigs[k], inp));
-      km.set(k, i, tmp);
-      km.set(i, k, tmp);
-    }
-    km.set(i, i, 1 + noise);
-  }
-  base::DataMatrix gnew;
-  decomposeCholesky(km, gnew);
-
-  base::DataVector transformed(rawScores);
-  solveCholeskySystem(gnew, transformed);
-  double tmp = 0;
-  for (size_t i = 0; i < allConfigs.size(); ++i) {
-    tmp += std::log(gnew.get(i, i));
-  }
-  return 2 * tmp + rawScores.dotProduct(transformed);
+  return gp.likelihood(inp, rawScores);
 }
 
 void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
-  allConfigs.push_back(newConfig);
-  double noise = pow(10, -scales.back() * 10);
-  size_t size = kernelmatrix.getNcols();
-  kernelmatrix.appendRow();
-  kernelmatrix.appendCol(base::DataVector(size + 1));
+  size_t nPar = newConfig.getNPar();
+  size_t size = allConfigs.size();
+  std::vector<double> differences(size * nPar);
   for (size_t i = 0; i < size; ++i) {
-    double tmp = kernel(allConfigs[i].getScaledDistance(newConfig, scales));
-    kernelmatrix.set(size, i, tmp);
-    kernelmatrix.set(i, size, tmp);
+    allConfigs[i].calcSquaredDifferences(newConfig, &differences[i * nPar]);
     rawScores[i] = allConfigs[i].getScore();
   }
-  kernelmatrix.set(size, size, 1 + noise);
+  allConfigs.push_back(newConfig);
   rawScores.push_back(newConfig.getScore());
+  if (!gp.addSample(differences)) {
+    decomFailed = true;
+  }
 
-  decomposeCholesky(kernelmatrix, gleft);
   if (normalize) {
     if (rawScores.min() < rawScores.max()) {
       rawScores.normalize();
@@ -197,22 +202,12 @@ void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
   }
   bestsofar = rawScores.min();
   transformedOutput = base::DataVector(rawScores);
-  solveCholeskySystem(gleft, transformedOutput);
-
-
-  // std::cout << "Maxofmax: " << maxofmax << std::endl;
-  base::DataVector check2(transformedOutput.size());
-  kernelmatrix.mult(transformedOutput, check2);
-  check2.sub(rawScores);
-  double max = check2.maxNorm();
-  // std::cout << "Max: " << max << std::endl;
-  // std::cout<<transformedOutput.toString()<<std::endl;
+  gp.solve(transformedOutput);
 
   // std::cout << "Var Screwed: " << screwedvar << std::endl;
-  if (decomFailed || screwedvar || maxofmax > 0.1 || max > 0.1) {
+  if (decomFailed || screwedvar) {
     std::cout << "Numerical instabilities occured. This could lead to bad sampling.";
   }
-  maxofmax = 0;
   screwedvar = false;
   decomFailed = false;
 }
@@ -16,6 +16,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/optimization/sle/system/FullSLE.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BOConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/bo/GaussianProcess.hpp>
 
 #include <vector>
 
@@ -34,14 +35,23 @@ class BayesianOptimization {
   explicit BayesianOptimization(const std::vector<BOConfig> &initialConfigs);
 
   /**
-   * Wrapper function for use in optimizer
+   * Wrapper function for use in optimizer. The discrete part of the candidate is the one last
+   * passed to prepareAcquisition().
    * @param inp point in continuous optimization space
    * @return score to optimize on
    */
   double acquisitionOuter(const base::DataVector &inp);
 
   /**
-   * Gaussian Process update step. Incorporates most recent sample into Gaussian Process.
+   * Precompute the parts of the kernel rows that do not depend on the continuous parameters of
+   * the candidate, so that each acquisitionOuter() call only loops over contiguous arrays
+   * @param candidate sample point whose discrete and categorical parameters are fixed
+   */
+  void prepareAcquisition(BOConfig &candidate);
+
+  /**
+   * Gaussian Process update step. Incorporates most recent sample into Gaussian Process by
+   * extending the Cholesky factor, which costs O(n^2).
    */
   void updateGP(BOConfig &newConfig, bool normalize);
 
@@ -100,13 +110,9 @@ class BayesianOptimization {
 
  protected:
   /**
-   * Gram matrix containing all kernel values between all existing samples
-   */
-  base::DataMatrix kernelmatrix;
-  /**
-   * Cholesky Decomposition of the Gram matrix
+   * Gaussian Process holding the Cholesky Decomposition of the Gram matrix
    */
-  base::DataMatrix gleft;
+  GaussianProcess gp;
   /**
    * solution of Kx = s where K is the Gram matrix and s the scores of the samples
    */
@@ -132,9 +138,13 @@ class BayesianOptimization {
    */
   bool decomFailed = false;
   /**
-   * debugging variable for numerical instabilities
+   * continuous parameters of all existing samples multiplied by the scales (one row per sample)
+   */
+  base::DataMatrix scaledCont;
+  /**
+   * discrete part of the distances of all existing samples to the current candidate
    */
-  double maxofmax;
+  base::DataVector discDistances;
 
   /**
    * existing sample points in the Gaussian Process
@@ -0,0 +1,151 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * GaussianProcess.cpp
+ */
+#include <sgpp/datadriven/datamining/modules/hpo/bo/GaussianProcess.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/**
+ * forward substitution with a packed lower triangular matrix
+ */
+void forwardSubstitution(const std::vector<double> &matrix, size_t size, double *x) {
+  for (size_t i = 0; i < size; ++i) {
+    const double *row = &matrix[i * (i + 1) / 2];
+    double sum = x[i];
+    for (size_t k = 0; k < i; ++k) {
+      sum -= row[k] * x[k];
+    }
+    x[i] = sum / row[i];
+  }
+}
+
+}  // namespace
+
+GaussianProcess::GaussianProcess(size_t nPar)
+    : nPar(nPar), size(0), scales(nPar + 1, 1), squaredDifferences(), factor() {
+}
+
+double GaussianProcess::kernel(double distance) {
+  double kernelwidth = 8.0;   // offset for dimensional scaling
+  return exp(-distance * kernelwidth / 2);
+}
+
+bool GaussianProcess::addSample(const std::vector<double> &newDifferences) {
+  if (newDifferences.size() != size * nPar) {
+    throw base::data_exception("GaussianProcess::addSample: wrong number of differences");
+  }
+  squaredDifferences.insert(squaredDifferences.end(), newDifferences.begin(),
+                            newDifferences.end());
+  factor.resize((size + 1) * (size + 2) / 2);
+  computeKernelRow(scales, size, &factor[size * (size + 1) / 2]);
+  bool success = factorizeRow(factor, size);
+  size++;
+  return success;
+}
+
+bool GaussianProcess::setScales(const base::DataVector &nscales) {
+  if (nscales.size() != nPar + 1) {
+    throw base::data_exception("GaussianProcess::setScales: wrong number of scales");
+  }
+  scales = nscales;
+  bool success = true;
+  for (size_t i = 0; i < size; ++i) {
+    computeKernelRow(scales, i, &factor[i * (i + 1) / 2]);
+    success = factorizeRow(factor, i) && success;
+  }
+  return success;
+}
+
+const base::DataVector &GaussianProcess::getScales() const {
+  return scales;
+}
+
+size_t GaussianProcess::getSize() const {
+  return size;
+}
+
+void GaussianProcess::solveLower(base::DataVector &x) const {
+  forwardSubstitution(factor, size, x.getPointer());
+}
+
+void GaussianProcess::solve(base::DataVector &x) const {
+  solveLower(x);
+  // backward substitution with L^T, traversing L by rows
+  for (size_t i = size; i-- > 0;) {
+    const double *row = &factor[i * (i + 1) / 2];
+    x[i] /= row[i];
+    for (size_t k = 0; k < i; ++k) {
+      x[k] -= row[k] * x[i];
+    }
+  }
+}
+
+double GaussianProcess::likelihood(const base::DataVector &nscales,
+                                   const base::DataVector &targets) const {
+  std::vector<double> matrix(size * (size + 1) / 2);
+  double logdet = 0;
+  for (size_t i = 0; i < size; ++i) {
+    computeKernelRow(nscales, i, &matrix[i * (i + 1) / 2]);
+    factorizeRow(matrix, i);
+    logdet += std::log(matrix[i * (i + 1) / 2 + i]);
+  }
+  // targets^T K^-1 targets = |L^-1 targets|^2
+  base::DataVector transformed(targets);
+  forwardSubstitution(matrix, size, transformed.getPointer());
+  return 2 * logdet + transformed.dotProduct(transformed);
+}
+
+void GaussianProcess::computeKernelRow(const base::DataVector &nscales, size_t i,
+                                       double *row) const {
+  base::DataVector squaredScales(nPar);
+  for (size_t p = 0; p < nPar; ++p) {
+    squaredScales[p] = nscales[p] * nscales[p];
+  }
+  const double *differences = squaredDifferences.data() + i * (i - 1) / 2 * nPar;
+  for (size_t k = 0; k < i; ++k) {
+    double distance = 0;
+    for (size_t p = 0; p < nPar; ++p) {
+      distance += squaredScales[p] * differences[p];
+    }
+    row[k] = kernel(distance);
+    differences += nPar;
+  }
+  double noise = pow(10, -nscales.back() * 10);
+  row[i] = 1 + noise;
+}
+
+bool GaussianProcess::factorizeRow(std::vector<double> &matrix, size_t i) {
+  double *row = &matrix[i * (i + 1) / 2];
+  for (size_t j = 0; j < i; ++j) {
+    const double *other = &matrix[j * (j + 1) / 2];
+    double sum = row[j];
+    for (size_t k = 0; k < j; ++k) {
+      sum -= row[k] * other[k];
+    }
+    row[j] = sum / other[j];
+  }
+  double sum = row[i];
+  for (size_t k = 0; k < i; ++k) {
+    sum -= row[k] * row[k];
+  }
+  if (sum > 0) {
+    row[i] = std::sqrt(sum);
+    return true;
+  }
+  row[i] = 10e-8;
+  return false;
+}
+} /* namespace datadriven */
+} /* namespace sgpp */
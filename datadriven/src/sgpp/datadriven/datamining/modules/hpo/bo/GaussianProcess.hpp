@@ -0,0 +1,133 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * GaussianProcess.hpp
+ */
+
+#ifndef DATADRIVEN_SRC_SGPP_DATADRIVEN_DATAMINING_MODULES_HPO_BO_GAUSSIANPROCESS_HPP_
+#define DATADRIVEN_SRC_SGPP_DATADRIVEN_DATAMINING_MODULES_HPO_BO_GAUSSIANPROCESS_HPP_
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Gaussian Process backend of BayesianOptimization. It stores the Cholesky factor L of the Gram
+ * matrix K = L L^T of the samples and extends it by one row when a sample is added, which costs
+ * O(n^2) instead of the O(n^3) of a new decomposition.
+ *
+ * The factor is kept in packed row-major storage (row i holds the entries 0, ..., i and starts at
+ * position i * (i + 1) / 2), so appending a row just appends to the storage and all inner
+ * products of the decomposition run over contiguous memory. The squared differences of all
+ * sample pairs per hyperparameter are cached as well; the Gram matrix for a new set of scales
+ * (e.g., while maximizing the likelihood) is then computed without touching the samples again.
+ */
+class GaussianProcess {
+ public:
+  /**
+   * Constructor
+   * @param nPar number of hyperparameters of the samples
+   */
+  explicit GaussianProcess(size_t nPar);
+
+  /**
+   * kernel function
+   * @param distance as computed according to some spacial representation
+   * @return kernel value representing variance
+   */
+  static double kernel(double distance);
+
+  /**
+   * Add a sample and extend the Cholesky factor by one row
+   * @param squaredDifferences squared differences of the new sample to all existing samples
+   * (nPar values per existing sample, see BOConfig::calcSquaredDifferences)
+   * @return false if the extended matrix is numerically not positive definite
+   */
+  bool addSample(const std::vector<double> &squaredDifferences);
+
+  /**
+   * Set the scales of the hyperparameter space and decompose the Gram matrix again
+   * @param nscales scales of the hyperparameters, the last entry controls the noise
+   * @return false if the matrix is numerically not positive definite
+   */
+  bool setScales(const base::DataVector &nscales);
+
+  /**
+   * @return scales of the hyperparameter space
+   */
+  const base::DataVector &getScales() const;
+
+  /**
+   * @return number of samples
+   */
+  size_t getSize() const;
+
+  /**
+   * Solve L y = x
+   * @param x right-hand side, overwritten with the solution
+   */
+  void solveLower(base::DataVector &x) const;
+
+  /**
+   * Solve K y = x
+   * @param x right-hand side, overwritten with the solution
+   */
+  void solve(base::DataVector &x) const;
+
+  /**
+   * Gaussian Process likelihood for different scales, computed from the cached differences
+   * @param nscales scales of the hyperparameter space
+   * @param targets score values of the samples
+   * @return log(det(K)) + targets^T K^-1 targets
+   */
+  double likelihood(const base::DataVector &nscales, const base::DataVector &targets) const;
+
+ protected:
+  /**
+   * Compute the Gram matrix row i (entries 0, ..., i) in packed storage
+   * @param nscales scales of the hyperparameter space
+   * @param i row
+   * @param[out] row output array of i + 1 values
+   */
+  void computeKernelRow(const base::DataVector &nscales, size_t i, double *row) const;
+
+  /**
+   * Turn row i of a packed Gram matrix into row i of its Cholesky factor, rows 0, ..., i - 1
+   * already being factorized
+   * @param matrix packed matrix
+   * @param i row
+   * @return false if the diagonal entry is not positive (it is replaced by a small value)
+   */
+  static bool factorizeRow(std::vector<double> &matrix, size_t i);
+
+  /**
+   * number of hyperparameters
+   */
+  size_t nPar;
+  /**
+   * number of samples
+   */
+  size_t size;
+  /**
+   * scales of the hyperparameter space
+   */
+  base::DataVector scales;
+  /**
+   * squared differences per hyperparameter, pair (i, k) with k < i starts at
+   * (i * (i - 1) / 2 + k) * nPar
+   */
+  std::vector<double> squaredDifferences;
+  /**
+   * Cholesky factor of the Gram matrix in packed row-major storage
+   */
+  std::vector<double> factor;
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
+
+#endif /* DATADRIVEN_SRC_SGPP_DATADRIVEN_DATAMINING_MODULES_HPO_BO_GAUSSIANPROCESS_HPP_ */
@@ -138,6 +138,69 @@ void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
   this->duration = this->myTimer_.stop();
 }
 
+void OperationMultiEvalStreaming::multBlock(sgpp::base::DataMatrix& alpha,
+                                            sgpp::base::DataMatrix& result) {
+  this->myTimer_.start();
+
+  const size_t numColumns = alpha.getNcols();
+  const size_t numData = this->dataset.getNrows();
+
+  // transposed result, so that the data points of a chunk are contiguous
+  sgpp::base::DataMatrix paddedResult(numColumns, this->preparedDataset.getNcols(), 0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+    getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
+                              getChunkDataPoints());
+
+    this->multBlockImpl(level_, index_, &this->preparedDataset, alpha, paddedResult, 0,
+                        alpha.getNrows(), start, end);
+  }
+
+  result.resizeRowsCols(numData, numColumns);
+
+  for (size_t i = 0; i < numData; i++) {
+    for (size_t j = 0; j < numColumns; j++) {
+      result(i, j) = paddedResult(j, i);
+    }
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreaming::multTransposeBlock(sgpp::base::DataMatrix& source,
+                                                     sgpp::base::DataMatrix& result) {
+  this->myTimer_.start();
+
+  const size_t numColumns = source.getNcols();
+
+  // transposed source, the padding area is set to zero
+  sgpp::base::DataMatrix paddedSource(numColumns, this->preparedDataset.getNcols(), 0.0);
+
+  for (size_t i = 0; i < source.getNrows(); i++) {
+    for (size_t j = 0; j < numColumns; j++) {
+      paddedSource(j, i) = source(i, j);
+    }
+  }
+
+  result.resizeRowsCols(this->storage->getSize(), numColumns);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+
+    getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
+
+    this->multTransposeBlockImpl(this->level_, this->index_, &this->preparedDataset, paddedSource,
+                                 result, start, end, 0, this->preparedDataset.getNcols());
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
 void OperationMultiEvalStreaming::recalculateLevelAndIndex() {
   if (this->level_ != nullptr) delete this->level_;
 
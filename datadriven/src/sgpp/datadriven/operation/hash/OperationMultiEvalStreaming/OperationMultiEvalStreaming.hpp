@@ -47,6 +47,18 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
 
+  /**
+   * Evaluates the basis functions once per grid point and data chunk and applies them to all
+   * columns of alpha.
+   */
+  void multBlock(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) override;
+
+  /**
+   * Evaluates the basis functions once per grid point and data chunk and applies them to all
+   * columns of source.
+   */
+  void multTransposeBlock(sgpp::base::DataMatrix& source, sgpp::base::DataMatrix& result) override;
+
   void prepare() override;
 
   double getDuration() override;
@@ -72,6 +84,27 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
                          const size_t end_index_grid, const size_t start_index_data,
                          const size_t end_index_data);
 
+  /**
+   * @param alpha coefficients (one row per grid point)
+   * @param result accumulated results, one row per column of alpha and one column per
+   * (padded) data point
+   */
+  void multBlockImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                     sgpp::base::DataMatrix* dataset, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& result, const size_t start_index_grid,
+                     const size_t end_index_grid, const size_t start_index_data,
+                     const size_t end_index_data);
+
+  /**
+   * @param source source vectors, one row per vector and one column per (padded) data point
+   * @param result results (one row per grid point), only the rows of the grid range are written
+   */
+  void multTransposeBlockImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+                              sgpp::base::DataMatrix* dataset, sgpp::base::DataMatrix& source,
+                              sgpp::base::DataMatrix& result, const size_t start_index_grid,
+                              const size_t end_index_grid, const size_t start_index_data,
+                              const size_t end_index_data);
+
   void recalculateLevelAndIndex();
 };
 
@@ -0,0 +1,134 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp"
+#include "sgpp/globaldef.hpp"
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/**
+ * Evaluates the basis function of one grid point at a chunk of data points.
+ * The loops are vectorized for the instruction set the library is compiled for.
+ *
+ * @return whether the basis function is non-zero for at least one of the data points
+ */
+inline bool evalChunk(const double* ptrLevel, const double* ptrIndex, const double* ptrData,
+                      size_t dims, size_t paddedSize, size_t dataStart, size_t chunkSize,
+                      double* phi) {
+  for (size_t i = 0; i < chunkSize; i++) {
+    phi[i] = 1.0;
+  }
+
+  for (size_t d = 0; d < dims; d++) {
+    const double level = ptrLevel[d];
+    const double index = ptrIndex[d];
+    const double* x = ptrData + d * paddedSize + dataStart;
+
+#pragma omp simd
+    for (size_t i = 0; i < chunkSize; i++) {
+      phi[i] *= std::max(1.0 - std::fabs(level * x[i] - index), 0.0);
+    }
+  }
+
+  for (size_t i = 0; i < chunkSize; i++) {
+    if (phi[i] != 0.0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
+void OperationMultiEvalStreaming::multBlockImpl(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  const double* ptrLevel = level->getPointer();
+  const double* ptrIndex = index->getPointer();
+  const double* ptrData = dataset->getPointer();
+  const double* ptrAlpha = alpha.getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t dims = dataset->getNrows();
+  const size_t paddedSize = dataset->getNcols();
+  const size_t numColumns = alpha.getNcols();
+  const size_t chunkSize = getChunkDataPoints();
+  std::vector<double> phi(chunkSize);
+
+  for (size_t i = start_index_data; i < end_index_data; i += chunkSize) {
+    for (size_t j = start_index_grid; j < end_index_grid; j++) {
+      if (!evalChunk(ptrLevel + j * dims, ptrIndex + j * dims, ptrData, dims, paddedSize, i,
+                     chunkSize, phi.data())) {
+        continue;
+      }
+
+      // the basis function values are reused for all columns
+      for (size_t c = 0; c < numColumns; c++) {
+        const double coefficient = ptrAlpha[j * numColumns + c];
+        double* resultChunk = ptrResult + c * paddedSize + i;
+
+#pragma omp simd
+        for (size_t t = 0; t < chunkSize; t++) {
+          resultChunk[t] += coefficient * phi[t];
+        }
+      }
+    }
+  }
+}
+
+void OperationMultiEvalStreaming::multTransposeBlockImpl(
+    sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
+    sgpp::base::DataMatrix& source, sgpp::base::DataMatrix& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
+  const double* ptrLevel = level->getPointer();
+  const double* ptrIndex = index->getPointer();
+  const double* ptrData = dataset->getPointer();
+  const double* ptrSource = source.getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t dims = dataset->getNrows();
+  const size_t paddedSize = dataset->getNcols();
+  const size_t numColumns = source.getNrows();
+  const size_t chunkSize = getChunkDataPoints();
+  std::vector<double> phi(chunkSize);
+
+  for (size_t j = start_index_grid; j < end_index_grid; j++) {
+    double* resultRow = ptrResult + j * numColumns;
+
+    for (size_t c = 0; c < numColumns; c++) {
+      resultRow[c] = 0.0;
+    }
+
+    for (size_t i = start_index_data; i < end_index_data; i += chunkSize) {
+      if (!evalChunk(ptrLevel + j * dims, ptrIndex + j * dims, ptrData, dims, paddedSize, i,
+                     chunkSize, phi.data())) {
+        continue;
+      }
+
+      // the basis function values are reused for all columns
+      for (size_t c = 0; c < numColumns; c++) {
+        const double* sourceChunk = ptrSource + c * paddedSize + i;
+        double sum = 0.0;
+
+#pragma omp simd reduction(+ : sum)
+        for (size_t t = 0; t < chunkSize; t++) {
+          sum += phi[t] * sourceChunk[t];
+        }
+
+        resultRow[c] += sum;
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,381 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBspline/OperationMultiEvalStreamingBspline.hpp>
+
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
+#include <sgpp/base/grid/type/BsplineClenshawCurtisGrid.hpp>
+#include <sgpp/base/grid/type/BsplineGrid.hpp>
+#include <sgpp/base/grid/type/ModBsplineClenshawCurtisGrid.hpp>
+#include <sgpp/base/grid/type/ModBsplineGrid.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineClenshawCurtisBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedClenshawCurtisBasis.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultiEvalStreamingBspline::OperationMultiEvalStreamingBspline(base::Grid& grid,
+                                                                       base::DataMatrix& dataset)
+    : OperationMultipleEval(grid, dataset),
+      storage(grid.getStorage()),
+      dim(grid.getDimension()),
+      numberOfDataPoints(dataset.getNrows()),
+      paddedNumberOfDataPoints(0),
+      preparedGridSize(0),
+      duration(-1.0) {
+  // check the grid type early, the bases of the other threads are created lazily
+  bases.resize(1);
+  bases[0].reset(createBasis());
+
+  prepareDataset();
+  prepare();
+}
+
+OperationMultiEvalStreamingBspline::~OperationMultiEvalStreamingBspline() {}
+
+base::SBasis* OperationMultiEvalStreamingBspline::createBasis() {
+  if (grid.getType() == base::GridType::Bspline) {
+    return new base::SBsplineBase(dynamic_cast<base::BsplineGrid&>(grid).getDegree());
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return new base::SBsplineModifiedBase(dynamic_cast<base::ModBsplineGrid&>(grid).getDegree());
+  } else if (grid.getType() == base::GridType::BsplineBoundary) {
+    return new base::SBsplineBoundaryBase(
+        dynamic_cast<base::BsplineBoundaryGrid&>(grid).getDegree());
+  } else if (grid.getType() == base::GridType::BsplineClenshawCurtis) {
+    return new base::SBsplineClenshawCurtisBase(
+        dynamic_cast<base::BsplineClenshawCurtisGrid&>(grid).getDegree());
+  } else if (grid.getType() == base::GridType::ModBsplineClenshawCurtis) {
+    return new base::SBsplineModifiedClenshawCurtisBase(
+        dynamic_cast<base::ModBsplineClenshawCurtisGrid&>(grid).getDegree());
+  } else {
+    throw base::factory_exception(
+        "OperationMultiEvalStreamingBspline: grid type is not a B-spline grid");
+  }
+}
+
+void OperationMultiEvalStreamingBspline::prepareDataset() {
+  const size_t m = numberOfDataPoints;
+  paddedNumberOfDataPoints = ((m + DATA_BLOCK_SIZE - 1) / DATA_BLOCK_SIZE) * DATA_BLOCK_SIZE;
+
+  base::DataMatrix pointsInUnitCube(dataset);
+  storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
+
+  // Z-order (Morton) key of the data points on a coarse uniform grid
+  const size_t keyDims = std::min<size_t>(dim, 63);
+  const size_t bitsPerDim = std::min<size_t>(16, 63 / std::max<size_t>(keyDims, 1));
+  const double cells = static_cast<double>(static_cast<uint64_t>(1) << bitsPerDim);
+  std::vector<std::pair<uint64_t, size_t>> keys(m);
+
+#pragma omp parallel for schedule(static)
+  for (size_t j = 0; j < m; j++) {
+    uint64_t key = 0;
+
+    for (size_t b = bitsPerDim; b-- > 0;) {
+      for (size_t t = 0; t < keyDims; t++) {
+        const double x = std::min(std::max(pointsInUnitCube.get(j, t), 0.0), 1.0);
+        const uint64_t cell =
+            std::min(static_cast<uint64_t>(x * cells), static_cast<uint64_t>(cells) - 1);
+        key = (key << 1) | ((cell >> b) & 1);
+      }
+    }
+
+    keys[j] = std::make_pair(key, j);
+  }
+
+  std::sort(keys.begin(), keys.end());
+
+  dataPermutation.resize(m);
+  sortedDataset.assign(dim * paddedNumberOfDataPoints, 0.0);
+
+  for (size_t k = 0; k < m; k++) {
+    const size_t j = keys[k].second;
+    dataPermutation[k] = j;
+
+    for (size_t t = 0; t < dim; t++) {
+      sortedDataset[t * paddedNumberOfDataPoints + k] = pointsInUnitCube.get(j, t);
+    }
+  }
+
+  // padding points are copies of the last data point, their results are never used
+  for (size_t k = m; k < paddedNumberOfDataPoints; k++) {
+    for (size_t t = 0; t < dim; t++) {
+      sortedDataset[t * paddedNumberOfDataPoints + k] =
+          (m > 0) ? sortedDataset[t * paddedNumberOfDataPoints + m - 1] : 0.0;
+    }
+  }
+}
+
+void OperationMultiEvalStreamingBspline::prepareGrid() {
+  const size_t n = storage.getSize();
+
+  uniqueLevels.assign(dim, std::vector<base::level_t>());
+  uniqueIndices.assign(dim, std::vector<base::index_t>());
+  uniqueOffsets.assign(dim + 1, 0);
+  gridPointBasisOffsets.resize(n * dim);
+
+  std::vector<std::map<std::pair<base::level_t, base::index_t>, size_t>> uniqueMaps(dim);
+
+  for (size_t i = 0; i < n; i++) {
+    const base::GridPoint& gp = storage[i];
+
+    for (size_t t = 0; t < dim; t++) {
+      const std::pair<base::level_t, base::index_t> li(gp.getLevel(t), gp.getIndex(t));
+      auto it = uniqueMaps[t].find(li);
+
+      if (it == uniqueMaps[t].end()) {
+        it = uniqueMaps[t].insert(std::make_pair(li, uniqueLevels[t].size())).first;
+        uniqueLevels[t].push_back(li.first);
+        uniqueIndices[t].push_back(li.second);
+      }
+
+      // temporarily store the position within the dimension
+      gridPointBasisOffsets[i * dim + t] = static_cast<uint32_t>(it->second);
+    }
+  }
+
+  for (size_t t = 0; t < dim; t++) {
+    uniqueOffsets[t + 1] = uniqueOffsets[t] + uniqueLevels[t].size();
+  }
+
+  // convert to offsets in the block buffers
+  for (size_t i = 0; i < n; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      gridPointBasisOffsets[i * dim + t] = static_cast<uint32_t>(
+          (uniqueOffsets[t] + gridPointBasisOffsets[i * dim + t]) * DATA_BLOCK_SIZE);
+    }
+  }
+
+  preparedGridSize = n;
+}
+
+void OperationMultiEvalStreamingBspline::prepare() {
+  prepareGrid();
+  isPrepared = true;
+}
+
+void OperationMultiEvalStreamingBspline::evalBlock(base::SBasis& basis, size_t blockStart,
+                                                   std::vector<double>& values,
+                                                   std::vector<char>& nonZero) {
+  for (size_t t = 0; t < dim; t++) {
+    const double* x = &sortedDataset[t * paddedNumberOfDataPoints + blockStart];
+    const std::vector<base::level_t>& levels = uniqueLevels[t];
+    const std::vector<base::index_t>& indices = uniqueIndices[t];
+
+    for (size_t u = 0; u < levels.size(); u++) {
+      double* v = &values[(uniqueOffsets[t] + u) * DATA_BLOCK_SIZE];
+      bool anyNonZero = false;
+
+      for (size_t b = 0; b < DATA_BLOCK_SIZE; b++) {
+        v[b] = basis.eval(levels[u], indices[u], x[b]);
+        anyNonZero = anyNonZero || (v[b] != 0.0);
+      }
+
+      nonZero[uniqueOffsets[t] + u] = anyNonZero ? 1 : 0;
+    }
+  }
+}
+
+void OperationMultiEvalStreamingBspline::mult(base::DataVector& alpha,
+                                              base::DataVector& result) {
+  if (storage.getSize() != preparedGridSize) {
+    prepare();
+  }
+
+  myTimer.start();
+
+  const size_t n = storage.getSize();
+  const size_t numberOfBlocks = paddedNumberOfDataPoints / DATA_BLOCK_SIZE;
+  const double* alphaData = alpha.getPointer();
+
+  result.resize(numberOfDataPoints);
+  result.setAll(0.0);
+  bases.resize(std::max(bases.size(), static_cast<size_t>(omp_get_max_threads())));
+
+#pragma omp parallel
+  {
+    const size_t threadId = static_cast<size_t>(omp_get_thread_num());
+
+    if (!bases[threadId]) {
+      bases[threadId].reset(createBasis());
+    }
+
+    base::SBasis& basis = *bases[threadId];
+    std::vector<double> values(uniqueOffsets[dim] * DATA_BLOCK_SIZE);
+    std::vector<char> nonZero(uniqueOffsets[dim]);
+    std::vector<double> product(DATA_BLOCK_SIZE);
+    std::vector<double> blockResult(DATA_BLOCK_SIZE);
+
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numberOfBlocks; block++) {
+      const size_t blockStart = block * DATA_BLOCK_SIZE;
+      evalBlock(basis, blockStart, values, nonZero);
+      std::fill(blockResult.begin(), blockResult.end(), 0.0);
+
+      for (size_t i = 0; i < n; i++) {
+        const uint32_t* offsets = &gridPointBasisOffsets[i * dim];
+        bool skip = (alphaData[i] == 0.0);
+
+        for (size_t t = 0; (t < dim) && !skip; t++) {
+          skip = (nonZero[offsets[t] / DATA_BLOCK_SIZE] == 0);
+        }
+
+        if (skip) {
+          continue;
+        }
+
+        const double* v = &values[offsets[0]];
+
+        for (size_t b = 0; b < DATA_BLOCK_SIZE; b++) {
+          product[b] = alphaData[i] * v[b];
+        }
+
+        for (size_t t = 1; t < dim; t++) {
+          v = &values[offsets[t]];
+
+          for (size_t b = 0; b < DATA_BLOCK_SIZE; b++) {
+            product[b] *= v[b];
+          }
+        }
+
+        for (size_t b = 0; b < DATA_BLOCK_SIZE; b++) {
+          blockResult[b] += product[b];
+        }
+      }
+
+      // blocks write disjoint parts of the result
+      const size_t blockEnd = std::min(blockStart + DATA_BLOCK_SIZE, numberOfDataPoints);
+
+      for (size_t k = blockStart; k < blockEnd; k++) {
+        result[dataPermutation[k]] = blockResult[k - blockStart];
+      }
+    }
+  }
+
+  duration = myTimer.stop();
+}
+
+void OperationMultiEvalStreamingBspline::multTranspose(base::DataVector& source,
+                                                       base::DataVector& result) {
+  if (storage.getSize() != preparedGridSize) {
+    prepare();
+  }
+
+  myTimer.start();
+
+  const size_t n = storage.getSize();
+  const size_t numberOfBlocks = paddedNumberOfDataPoints / DATA_BLOCK_SIZE;
+
+  result.resize(n);
+  result.setAll(0.0);
+
+  // thread-local results, reduced in parallel after the evaluation
+  const size_t maxThreads = static_cast<size_t>(omp_get_max_threads());
+  std::vector<std::vector<double>> localResults(maxThreads);
+  bases.resize(std::max(bases.size(), maxThreads));
+
+#pragma omp parallel
+  {
+    const size_t threadId = static_cast<size_t>(omp_get_thread_num());
+    const size_t numThreads = static_cast<size_t>(omp_get_num_threads());
+
+    if (!bases[threadId]) {
+      bases[threadId].reset(createBasis());
+    }
+
+    base::SBasis& basis = *bases[threadId];
+    std::vector<double> values(uniqueOffsets[dim] * DATA_BLOCK_SIZE);
+    std::vector<char> nonZero(uniqueOffsets[dim]);
+    std::vector<double> product(DATA_BLOCK_SIZE);
+    std::vector<double> blockSource(DATA_BLOCK_SIZE);
+    std::vector<double>& localResult = localResults[threadId];
+    localResult.assign(n, 0.0);
+
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numberOfBlocks; block++) {
+      const size_t blockStart = block * DATA_BLOCK_SIZE;
+      const size_t blockEnd = std::min(blockStart + DATA_BLOCK_SIZE, numberOfDataPoints);
+      bool blockIsZero = true;
+
+      // padding points get a zero weight
+      std::fill(blockSource.begin(), blockSource.end(), 0.0);
+
+      for (size_t k = blockStart; k < blockEnd; k++) {
+        blockSource[k - blockStart] = source[dataPermutation[k]];
+        blockIsZero = blockIsZero && (blockSource[k - blockStart] == 0.0);
+      }
+
+      if (blockIsZero) {
+        continue;
+      }
+
+      evalBlock(basis, blockStart, values, nonZero);
+
+      for (size_t i = 0; i < n; i++) {
+        const uint32_t* offsets = &gridPointBasisOffsets[i * dim];
+        bool skip = false;
+
+        for (size_t t = 0; (t < dim) && !skip; t++) {
+          skip = (nonZero[offsets[t] / DATA_BLOCK_SIZE] == 0);
+        }
+
+        if (skip) {
+          continue;
+        }
+
+        const double* v = &values[offsets[0]];
+
+        for (size_t b = 0; b < DATA_BLOCK_SIZE; b++) {
+          product[b] = blockSource[b] * v[b];
+        }
+
+        for (size_t t = 1; t < dim; t++) {
+          v = &values[offsets[t]];
+
+          for (size_t b = 0; b < DATA_BLOCK_SIZE; b++) {
+            product[b] *= v[b];
+          }
+        }
+
+        double sum = 0.0;
+
+        for (size_t b = 0; b < DATA_BLOCK_SIZE; b++) {
+          sum += product[b];
+        }
+
+        localResult[i] += sum;
+      }
+    }
+
+    // implicit barrier of omp for, now reduce over grid point ranges
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < n; i++) {
+      double sum = 0.0;
+
+      for (size_t thread = 0; thread < numThreads; thread++) {
+        sum += localResults[thread][i];
+      }
+
+      result[i] = sum;
+    }
+  }
+
+  duration = myTimer.stop();
+}
+
+double OperationMultiEvalStreamingBspline::getDuration() { return duration; }
+
+}  // namespace datadriven
+}  // namespace sgpp
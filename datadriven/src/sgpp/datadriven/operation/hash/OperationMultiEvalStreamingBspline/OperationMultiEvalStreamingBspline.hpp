@@ -0,0 +1,139 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Blocked, OpenMP-parallel multiple evaluation for the B-spline grid family
+ * (Bspline, ModBspline, BsplineBoundary, BsplineClenshawCurtis, ModBsplineClenshawCurtis).
+ *
+ * The operation is built around the observation that a sparse grid only contains few distinct
+ * 1D basis functions per dimension:
+ * - prepare() transforms the data set to the unit cube once, stores it dimension-wise,
+ *   sorts the data points along a Z-order curve (so that blocks of data points are spatially
+ *   localized) and maps each grid point to the distinct 1D basis functions it consists of.
+ * - For each block of DATA_BLOCK_SIZE data points, the distinct 1D basis functions are evaluated
+ *   once (contiguous in the data points), blocks in which a 1D function vanishes everywhere are
+ *   marked, and grid points containing such a function are skipped without evaluation.
+ * - The remaining tensor products are computed with unit-stride loops over the data points of
+ *   the block, which the compiler vectorizes.
+ * - Blocks are distributed dynamically among the OpenMP threads. mult() writes disjoint parts of
+ *   the result, multTranspose() accumulates thread-locally and reduces the thread-local results
+ *   in parallel over grid point ranges.
+ *
+ * Each thread uses its own instance of the 1D basis, as some of the bases
+ * (e.g., the Clenshaw-Curtis B-splines) are not thread-safe.
+ */
+class OperationMultiEvalStreamingBspline : public base::OperationMultipleEval {
+ public:
+  /// number of data points that are processed together
+  static const size_t DATA_BLOCK_SIZE = 64;
+
+  /**
+   * Constructor
+   *
+   * @param grid    B-spline grid
+   * @param dataset data set that should be evaluated
+   */
+  OperationMultiEvalStreamingBspline(base::Grid& grid, base::DataMatrix& dataset);
+
+  /**
+   * Destructor
+   */
+  ~OperationMultiEvalStreamingBspline() override;
+
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+  void multTranspose(base::DataVector& source, base::DataVector& result) override;
+
+  /**
+   * Recomputes the internal data structures (has to be called after the grid has been changed).
+   */
+  void prepare() override;
+
+  double getDuration() override;
+
+  std::string getImplementationName() override { return "STREAMING_BSPLINE"; }
+
+ protected:
+  /// grid storage
+  base::GridStorage& storage;
+  /// dimension
+  size_t dim;
+  /// number of data points
+  size_t numberOfDataPoints;
+  /// number of data points rounded up to a multiple of DATA_BLOCK_SIZE
+  size_t paddedNumberOfDataPoints;
+  /// number of grid points for which the data structures have been prepared
+  size_t preparedGridSize;
+
+  /// data points in the unit cube, dimension-wise (dim x paddedNumberOfDataPoints), sorted
+  std::vector<double> sortedDataset;
+  /// sortedDataset[., k] is the data point dataPermutation[k]
+  std::vector<size_t> dataPermutation;
+
+  /// for each dimension, the levels of the distinct 1D basis functions
+  std::vector<std::vector<base::level_t>> uniqueLevels;
+  /// for each dimension, the indices of the distinct 1D basis functions
+  std::vector<std::vector<base::index_t>> uniqueIndices;
+  /// offset of the first distinct 1D basis function of each dimension in the block buffers
+  std::vector<size_t> uniqueOffsets;
+  /// for each grid point and dimension, the position of the 1D basis function in the
+  /// block buffers (grid-point-wise, i.e., numberOfGridPoints x dim)
+  std::vector<uint32_t> gridPointBasisOffsets;
+
+  /// 1D bases, one per thread
+  std::vector<std::unique_ptr<base::SBasis>> bases;
+
+  /// timer
+  base::SGppStopwatch myTimer;
+  /// duration of the last mult/multTranspose call
+  double duration;
+
+  /**
+   * creates a new instance of the 1D basis of the grid
+   */
+  base::SBasis* createBasis();
+
+  /**
+   * sorts the data set along a Z-order curve and stores it dimension-wise
+   */
+  void prepareDataset();
+
+  /**
+   * determines the distinct 1D basis functions of each dimension
+   */
+  void prepareGrid();
+
+  /**
+   * evaluates all distinct 1D basis functions at the data points of a block
+   *
+   * @param basis       1D basis to use
+   * @param blockStart  index of the first data point of the block (in sorted order)
+   * @param values      buffer for the values (size uniqueOffsets.back() * DATA_BLOCK_SIZE)
+   * @param nonZero     buffer for flags if the functions are non-zero somewhere in the block
+   */
+  void evalBlock(base::SBasis& basis, size_t blockStart, std::vector<double>& values,
+                 std::vector<char>& nonZero);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
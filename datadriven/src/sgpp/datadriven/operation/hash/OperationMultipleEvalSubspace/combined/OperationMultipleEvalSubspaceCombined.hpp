@@ -9,6 +9,7 @@
 
 #include <assert.h>
 #include <immintrin.h>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <vector>
@@ -88,6 +89,35 @@ class OperationMultipleEvalSubspaceCombined : public AbstractOperationMultipleEv
 
   uint32_t flattenLevel(size_t dim, size_t maxLevel, std::vector<uint32_t>& level);
 
+  /// non-zero basis function value of a grid point at a data point of a chunk
+  struct Contribution {
+    /// index of the data point relative to the start of the chunk
+    size_t dataIndex;
+    /// index of the grid point in the grid storage
+    size_t gridIndex;
+    /// value of the basis function
+    double value;
+  };
+
+  /**
+   * Stores the index of each grid point in the grid storage as its surplus, so that a traversal
+   * of the subspaces yields the grid points of the non-zero basis functions.
+   */
+  void setGridPointIndices();
+
+  /**
+   * Traverses the subspaces for each chunk of data points in the given range and passes the
+   * non-zero basis function values of the chunk to processChunk (together with the index of the
+   * first data point of the chunk). Requires setGridPointIndices() to be called before.
+   *
+   * @param start_index_data beginning of the range to process
+   * @param end_index_data end of the range to process
+   * @param processChunk called once per chunk of data points
+   */
+  void collectContributions(
+      const size_t start_index_data, const size_t end_index_data,
+      const std::function<void(size_t, const std::vector<Contribution>&)>& processChunk);
+
  public:
 #include "OperationMultipleEvalSubspaceCombined_calculateIndexCombined.hpp"
 
@@ -136,6 +166,24 @@ class OperationMultipleEvalSubspaceCombined : public AbstractOperationMultipleEv
   void multImpl(sgpp::base::DataVector& source, sgpp::base::DataVector& result,
                 const size_t start_index_data, const size_t end_index_data) override;
 
+  /**
+   * Evaluates several sparse grid functions at once. The subspaces are traversed only once per
+   * chunk of data points and the resulting basis function values are applied to all columns.
+   *
+   * @param alpha matrix with one coefficient vector per column
+   * @param result one row per data point, one column per column of alpha
+   */
+  void multBlock(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) override;
+
+  /**
+   * Transposed evaluation for several vectors at once, the subspaces are traversed only once per
+   * chunk of data points.
+   *
+   * @param source matrix with one vector per column
+   * @param result one row per grid point, one column per column of source
+   */
+  void multTransposeBlock(sgpp::base::DataMatrix& source, sgpp::base::DataMatrix& result) override;
+
   /**
    * Pads the dataset.
    *
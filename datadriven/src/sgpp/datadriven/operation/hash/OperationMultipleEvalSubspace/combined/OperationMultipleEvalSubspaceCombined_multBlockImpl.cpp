@@ -0,0 +1,252 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include "OperationMultipleEvalSubspaceCombined.hpp"
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+void OperationMultipleEvalSubspaceCombined::setGridPointIndices() {
+  sgpp::base::DataVector gridPointIndices(this->storage->getSize());
+
+  for (size_t gridPoint = 0; gridPoint < this->storage->getSize(); gridPoint++) {
+    gridPointIndices[gridPoint] = static_cast<double>(gridPoint);
+  }
+
+  this->setCoefficients(gridPointIndices);
+}
+
+void OperationMultipleEvalSubspaceCombined::collectContributions(
+    const size_t start_index_data, const size_t end_index_data,
+    const std::function<void(size_t, const std::vector<Contribution>&)>& processChunk) {
+  size_t dim = this->paddedDataset->getNcols();
+  const double* const datasetPtr = this->paddedDataset->getPointer();
+
+  size_t totalThreadNumber = X86COMBINED_PARALLEL_DATA_POINTS + X86COMBINED_VEC_PADDING;
+
+  std::vector<double> evalIndexValuesAll((dim + 1) * totalThreadNumber, 1.0);
+  // for faster index flattening, last element is for padding
+  std::vector<uint32_t> intermediatesAll((dim + 1) * totalThreadNumber, 0);
+
+  size_t validIndices[X86COMBINED_PARALLEL_DATA_POINTS + X86COMBINED_VEC_PADDING];
+  size_t validIndicesCount;
+  size_t levelIndices[X86COMBINED_PARALLEL_DATA_POINTS + X86COMBINED_VEC_PADDING];
+
+  std::vector<double> listSubspace(this->maxGridPointsOnLevel,
+                                   std::numeric_limits<double>::quiet_NaN());
+  std::vector<Contribution> contributions;
+
+  for (size_t dataIndexBase = start_index_data; dataIndexBase < end_index_data;
+       dataIndexBase += X86COMBINED_PARALLEL_DATA_POINTS) {
+    for (size_t i = 0; i < totalThreadNumber; i++) {
+      levelIndices[i] = 0;
+    }
+
+    contributions.clear();
+
+    for (size_t subspaceIndex = 0; subspaceIndex < subspaceCount; subspaceIndex++) {
+      SubspaceNodeCombined& subspace = this->allSubspaceNodes[subspaceIndex];
+
+      double* levelArrayContinuous = nullptr;
+
+      // prepare the subspace array for a list type subspace
+      if (subspace.type == SubspaceNodeCombined::SubspaceType::LIST) {
+        for (std::pair<uint32_t, double> tuple : subspace.indexFlatSurplusPairs) {
+          listSubspace[tuple.first] = tuple.second;
+        }
+
+        levelArrayContinuous = listSubspace.data();
+      } else {
+        levelArrayContinuous = subspace.subspaceArray.data();
+      }
+
+      validIndicesCount = 0;
+
+      for (size_t parallelIndex = 0; parallelIndex < X86COMBINED_PARALLEL_DATA_POINTS;
+           parallelIndex++) {
+        if (levelIndices[parallelIndex] == subspaceIndex) {
+          validIndices[validIndicesCount] = parallelIndex;
+          validIndicesCount += 1;
+        }
+      }
+
+      size_t paddingSize = std::min(static_cast<int>(validIndicesCount + X86COMBINED_VEC_PADDING),
+                                    X86COMBINED_PARALLEL_DATA_POINTS + X86COMBINED_VEC_PADDING);
+
+      for (size_t i = validIndicesCount; i < paddingSize; i++) {
+        size_t threadId = X86COMBINED_PARALLEL_DATA_POINTS + (i - validIndicesCount);
+        validIndices[i] = threadId;
+        levelIndices[threadId] = 0;
+        double* evalIndexValues = evalIndexValuesAll.data() + (dim + 1) * threadId;
+        uint32_t* intermediates = intermediatesAll.data() + (dim + 1) * threadId;
+
+        for (size_t j = 0; j < dim; j++) {
+          evalIndexValues[j] = 1.0;
+          intermediates[j] = 0;
+        }
+      }
+
+      for (size_t validIndex = 0; validIndex < validIndicesCount; validIndex += 4) {
+        size_t parallelIndices[4];
+        double* evalIndexValues[4];
+        uint32_t* intermediates[4];
+
+        for (size_t innerIndex = 0; innerIndex < 4; innerIndex++) {
+          parallelIndices[innerIndex] = validIndices[validIndex + innerIndex];
+          evalIndexValues[innerIndex] =
+              evalIndexValuesAll.data() + (dim + 1) * parallelIndices[innerIndex];
+          intermediates[innerIndex] =
+              intermediatesAll.data() + (dim + 1) * parallelIndices[innerIndex];
+        }
+
+        const double* const dataTuplePtr[4] = {
+            datasetPtr + (dataIndexBase + parallelIndices[0]) * dim,
+            datasetPtr + (dataIndexBase + parallelIndices[1]) * dim,
+            datasetPtr + (dataIndexBase + parallelIndices[2]) * dim,
+            datasetPtr + (dataIndexBase + parallelIndices[3]) * dim};
+
+#if X86COMBINED_ENABLE_PARTIAL_RESULT_REUSAGE == 1
+        size_t nextIterationToRecalc = subspace.arriveDiff;
+#else
+        size_t nextIterationToRecalc = 0;
+#endif
+
+        uint32_t indexFlat[4];
+        double phiEval[4];
+
+        OperationMultipleEvalSubspaceCombined::calculateIndexCombined(
+            dim, nextIterationToRecalc, dataTuplePtr, subspace.hInverse, intermediates,
+            evalIndexValues, indexFlat, phiEval);
+
+        for (size_t innerIndex = 0; innerIndex < 4; innerIndex++) {
+          const size_t parallelIndex = parallelIndices[innerIndex];
+          const double gridIndex = levelArrayContinuous[indexFlat[innerIndex]];
+
+          if (!std::isnan(gridIndex)) {
+            // padding entries are evaluated, too, but not reported
+            if (parallelIndex < X86COMBINED_PARALLEL_DATA_POINTS) {
+              contributions.push_back(
+                  Contribution{parallelIndex, static_cast<size_t>(gridIndex), phiEval[innerIndex]});
+            }
+
+            levelIndices[parallelIndex] += 1;
+          } else {
+#if X86COMBINED_ENABLE_SUBSPACE_SKIPPING == 1
+            // skip to next relevant subspace
+            levelIndices[parallelIndex] = subspace.jumpTargetIndex;
+#else
+            levelIndices[parallelIndex] += 1;
+#endif
+          }
+        }
+      }
+
+      if (subspace.type == SubspaceNodeCombined::SubspaceType::LIST) {
+        for (std::pair<uint32_t, double>& tuple : subspace.indexFlatSurplusPairs) {
+          listSubspace[tuple.first] = std::numeric_limits<double>::quiet_NaN();
+        }
+      }
+    }  // end iterate subspaces
+
+    processChunk(dataIndexBase, contributions);
+  }  // end iterate data chunks
+}
+
+void OperationMultipleEvalSubspaceCombined::multBlock(sgpp::base::DataMatrix& alpha,
+                                                      sgpp::base::DataMatrix& result) {
+  if (!this->isPrepared) {
+    this->prepare();
+  }
+
+  const size_t numData = this->dataset.getNrows();
+  const size_t numColumns = alpha.getNcols();
+
+  this->setGridPointIndices();
+  result.resizeRowsCols(numData, numColumns);
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+    PartitioningTool::getOpenMPPartitionSegment(0, this->getPaddedDatasetSize(), &start, &end,
+                                                this->getAlignment());
+
+    // the rows of result belong to the data chunks of this thread
+    this->collectContributions(
+        start, end,
+        [&alpha, &result, numData, numColumns](size_t dataIndexBase,
+                                               const std::vector<Contribution>& contributions) {
+          for (const Contribution& contribution : contributions) {
+            const size_t dataIndex = dataIndexBase + contribution.dataIndex;
+
+            if (dataIndex >= numData) {
+              continue;
+            }
+
+            for (size_t j = 0; j < numColumns; j++) {
+              result(dataIndex, j) += contribution.value * alpha(contribution.gridIndex, j);
+            }
+          }
+        });
+  }
+}
+
+void OperationMultipleEvalSubspaceCombined::multTransposeBlock(sgpp::base::DataMatrix& source,
+                                                               sgpp::base::DataMatrix& result) {
+  if (!this->isPrepared) {
+    this->prepare();
+  }
+
+  const size_t numData = source.getNrows();
+  const size_t numColumns = source.getNcols();
+  const size_t gridSize = this->storage->getSize();
+
+  this->setGridPointIndices();
+  result.resizeRowsCols(gridSize, numColumns);
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+    PartitioningTool::getOpenMPPartitionSegment(0, this->getPaddedDatasetSize(), &start, &end,
+                                                this->getAlignment());
+
+    // the data chunks of different threads contribute to the same grid points
+    sgpp::base::DataMatrix localResult(gridSize, numColumns, 0.0);
+
+    this->collectContributions(
+        start, end,
+        [&source, &localResult, numData, numColumns](
+            size_t dataIndexBase, const std::vector<Contribution>& contributions) {
+          for (const Contribution& contribution : contributions) {
+            const size_t dataIndex = dataIndexBase + contribution.dataIndex;
+
+            if (dataIndex >= numData) {
+              continue;
+            }
+
+            for (size_t j = 0; j < numColumns; j++) {
+              localResult(contribution.gridIndex, j) += contribution.value * source(dataIndex, j);
+            }
+          }
+        });
+
+#pragma omp critical
+    { result.add(localResult); }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
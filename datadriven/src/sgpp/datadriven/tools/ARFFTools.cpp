@@ -6,6 +6,7 @@
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -13,6 +14,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <cstring>
@@ -27,13 +29,10 @@ void ARFFTools::readARFFSizeFromFile(const std::string& filename,
                              size_t& dimension,
                              bool hasTargets,
                              std::vector<double> selectedTargets) {
-  std::ifstream stream(filename.c_str());
-  if (!stream) {
-    std::string msg = "readARFFSizeFromFile: Unable to open file: " + filename;
-    throw sgpp::base::file_exception(msg.c_str());
-  }
-  readARFFSize(stream, numberInstances, dimension, hasTargets, selectedTargets);
-  stream.close();
+  TextDataReader reader(filename, TextDataFormat::ARFF, false, hasTargets, -1,
+                        std::vector<size_t>(), selectedTargets);
+  numberInstances = reader.getNumberInstances();
+  dimension = reader.getDimension();
 }
 
 void ARFFTools::readARFFSizeFromString(const std::string& content,
@@ -41,8 +40,11 @@ void ARFFTools::readARFFSizeFromString(const std::string& content,
                                        size_t& dimension,
                                        bool hasTargets,
                                        std::vector<double> selectedTargets) {
-  std::istringstream stream(content);
-  readARFFSize(stream, numberInstances, dimension, hasTargets, selectedTargets);
+  std::unique_ptr<TextDataReader> reader = TextDataReader::fromString(
+      content, TextDataFormat::ARFF, false, hasTargets, -1, std::vector<size_t>(),
+      selectedTargets);
+  numberInstances = reader->getNumberInstances();
+  dimension = reader->getDimension();
 }
 
 Dataset ARFFTools::readARFFFromFile(const std::string& filename,
@@ -50,14 +52,9 @@ Dataset ARFFTools::readARFFFromFile(const std::string& filename,
                                     size_t instanceCutoff,
                                     std::vector<size_t> selectedCols,
                                     std::vector<double> selectedTargets) {
-  std::ifstream stream(filename.c_str());
-  if (!stream) {
-    std::string msg = "readARFFFromFile: Unable to open file: " + filename;
-    throw sgpp::base::file_exception(msg.c_str());
-  }
-  Dataset d = readARFF(stream, hasTargets, instanceCutoff, selectedCols, selectedTargets);
-  stream.close();
-  return d;
+  TextDataReader reader(filename, TextDataFormat::ARFF, false, hasTargets, instanceCutoff,
+                        selectedCols, selectedTargets);
+  return reader.readAll();
 }
 
 Dataset ARFFTools::readARFFFromString(const std::string& content,
@@ -65,8 +62,9 @@ Dataset ARFFTools::readARFFFromString(const std::string& content,
                                       size_t instanceCutoff,
                                       std::vector<size_t> selectedCols,
                                       std::vector<double> selectedTargets) {
-  std::istringstream stream(content);
-  return readARFF(stream, hasTargets, instanceCutoff, selectedCols, selectedTargets);
+  return TextDataReader::fromString(content, TextDataFormat::ARFF, false, hasTargets,
+                                    instanceCutoff, selectedCols, selectedTargets)
+      ->readAll();
 }
 
 void ARFFTools::readARFFSize(std::istream& stream,
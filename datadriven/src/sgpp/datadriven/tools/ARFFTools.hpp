@@ -21,6 +21,8 @@ namespace datadriven {
 
 /**
  * Class that provides functionality to read ARFF files.
+ * The wrappers for files and strings use the faster TextDataReader, the stream-based
+ * functions parse line by line.
  */
 class ARFFTools {
  public:
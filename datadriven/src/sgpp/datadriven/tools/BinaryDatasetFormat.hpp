@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BINARYDATASETFORMAT_HPP
+#define BINARYDATASETFORMAT_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+namespace sgpp {
+namespace datadriven {
+
+/// version of the binary dataset format
+#define BINARY_DATASET_VERSION 1
+
+/**
+ * Memory layout of the samples in a binary dataset file.
+ */
+enum class BinaryDatasetLayout {
+  /// the values of a sample are contiguous (fast access to batches of samples)
+  ROW_MAJOR = 0,
+  /// the values of a dimension are contiguous (fast access to single dimensions)
+  COLUMN_MAJOR = 1
+};
+
+/**
+ * Precision of the values in a binary dataset file.
+ */
+enum class BinaryDatasetPrecision {
+  /// 64 bit floating point numbers
+  DOUBLE = 8,
+  /// 32 bit floating point numbers (half the size, values are rounded)
+  FLOAT = 4
+};
+
+/**
+ * Header of a binary dataset file as written by BinaryDatasetWriter.
+ *
+ * The file consists of the header, the data matrix (numberInstances x dimension values in the
+ * given layout) starting at dataOffset and, if the file contains targets, the target vector
+ * (numberInstances values) starting at targetOffset. All values have the given precision and
+ * both arrays are aligned to BinaryDatasetWriter::ALIGNMENT bytes.
+ */
+struct BinaryDatasetHeader {
+  /// magic number "SGPPDAT"
+  char magic[8];
+  /// version of the format
+  uint32_t version;
+  /// used to detect files with a different byte order
+  uint32_t byteOrderMark;
+  /// BinaryDatasetLayout
+  uint32_t layout;
+  /// size of a value in bytes (BinaryDatasetPrecision)
+  uint32_t valueSize;
+  /// whether the file contains targets (0 or 1)
+  uint32_t hasTargets;
+  /// reserved for future use (0)
+  uint32_t reserved;
+  /// number of samples
+  uint64_t numberInstances;
+  /// dimension of the samples
+  uint64_t dimension;
+  /// offset of the data matrix in bytes
+  uint64_t dataOffset;
+  /// offset of the targets in bytes (0 if the file does not contain targets)
+  uint64_t targetOffset;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* BINARYDATASETFORMAT_HPP */
@@ -0,0 +1,223 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/BinaryDatasetReader.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetWriter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// number of samples below which samples are read sequentially
+const size_t PARALLEL_READ_THRESHOLD = 1024;
+
+}  // namespace
+
+BinaryDatasetReader::BinaryDatasetReader(const std::string& filename, size_t instanceCutoff,
+                                         std::vector<size_t> selectedCols,
+                                         std::vector<double> selectedTargets)
+    : file(std::make_shared<base::MemoryMappedFile>(filename)),
+      content(),
+      data(file->getData()),
+      size(file->getSize()),
+      columns(),
+      filtered(false),
+      instances(),
+      numberInstances(0) {
+  initialize(instanceCutoff, selectedCols, selectedTargets);
+}
+
+BinaryDatasetReader::BinaryDatasetReader(const char* content, size_t contentSize)
+    : file(),
+      content((contentSize + sizeof(double) - 1) / sizeof(double)),
+      data(reinterpret_cast<const char*>(this->content.data())),
+      size(contentSize),
+      columns(),
+      filtered(false),
+      instances(),
+      numberInstances(0) {
+  std::memcpy(this->content.data(), content, contentSize);
+}
+
+std::unique_ptr<BinaryDatasetReader> BinaryDatasetReader::fromString(
+    const std::string& content, size_t instanceCutoff, std::vector<size_t> selectedCols,
+    std::vector<double> selectedTargets) {
+  std::unique_ptr<BinaryDatasetReader> reader(
+      new BinaryDatasetReader(content.data(), content.size()));
+  reader->initialize(instanceCutoff, selectedCols, selectedTargets);
+  return reader;
+}
+
+void BinaryDatasetReader::checkHeader(const BinaryDatasetHeader& header) {
+  if (std::memcmp(header.magic, "SGPPDAT", 8) != 0) {
+    throw base::file_exception("BinaryDatasetReader: not a binary SG++ dataset");
+  }
+
+  if (header.byteOrderMark != BinaryDatasetWriter::BYTE_ORDER_MARK) {
+    throw base::file_exception("BinaryDatasetReader: file has a different byte order");
+  }
+
+  if (header.version > BINARY_DATASET_VERSION) {
+    throw base::file_exception("BinaryDatasetReader: version of the dataset is too new");
+  }
+
+  if (((header.valueSize != sizeof(double)) && (header.valueSize != sizeof(float))) ||
+      (header.layout > static_cast<uint32_t>(BinaryDatasetLayout::COLUMN_MAJOR))) {
+    throw base::file_exception("BinaryDatasetReader: invalid layout or precision");
+  }
+}
+
+void BinaryDatasetReader::initialize(size_t instanceCutoff,
+                                     const std::vector<size_t>& selectedCols,
+                                     const std::vector<double>& selectedTargets) {
+  if (size < sizeof(header)) {
+    throw base::file_exception("BinaryDatasetReader: file too small");
+  }
+
+  std::memcpy(&header, data, sizeof(header));
+  checkHeader(header);
+
+  const uint64_t n = header.numberInstances;
+  const uint64_t dim = header.dimension;
+
+  if ((header.dataOffset + n * dim * header.valueSize > size) ||
+      ((header.hasTargets != 0) && (header.targetOffset + n * header.valueSize > size))) {
+    throw base::file_exception("BinaryDatasetReader: file is truncated");
+  }
+
+  if (selectedCols.size() > 0) {
+    if (*std::max_element(selectedCols.begin(), selectedCols.end()) >= dim) {
+      throw base::file_exception("BinaryDatasetReader: invalid column selection");
+    }
+
+    columns = selectedCols;
+  } else {
+    columns.resize(static_cast<size_t>(dim));
+
+    for (size_t d = 0; d < columns.size(); d++) {
+      columns[d] = d;
+    }
+  }
+
+  filtered = (header.hasTargets != 0) && (selectedTargets.size() > 0);
+
+  if (filtered) {
+    for (size_t i = 0; (i < n) && (instances.size() < instanceCutoff); i++) {
+      const double target = getValue(header.targetOffset, i);
+
+      for (size_t j = 0; j < selectedTargets.size(); j++) {
+        if (std::fabs(target - selectedTargets[j]) < 0.001) {
+          instances.push_back(i);
+          break;
+        }
+      }
+    }
+
+    numberInstances = instances.size();
+  } else {
+    numberInstances = std::min(static_cast<size_t>(n), instanceCutoff);
+  }
+}
+
+void BinaryDatasetReader::readInstance(size_t fileInstance, double* row, double& target) const {
+  const size_t dim = columns.size();
+
+  if (header.layout == static_cast<uint32_t>(BinaryDatasetLayout::ROW_MAJOR)) {
+    const size_t rowBegin = fileInstance * static_cast<size_t>(header.dimension);
+
+    for (size_t j = 0; j < dim; j++) {
+      row[j] = getValue(header.dataOffset, rowBegin + columns[j]);
+    }
+  } else {
+    const size_t n = static_cast<size_t>(header.numberInstances);
+
+    for (size_t j = 0; j < dim; j++) {
+      row[j] = getValue(header.dataOffset, columns[j] * n + fileInstance);
+    }
+  }
+
+  if (header.hasTargets != 0) {
+    target = getValue(header.targetOffset, fileInstance);
+  }
+}
+
+void BinaryDatasetReader::readInstances(size_t first, size_t count, Dataset& dataset,
+                                        size_t datasetOffset) const {
+  const size_t dim = getDimension();
+
+  if ((first + count > numberInstances) ||
+      (datasetOffset + count > dataset.getNumberInstances()) ||
+      (dataset.getData().getNcols() != dim)) {
+    throw base::data_exception("BinaryDatasetReader::readInstances: invalid instance range");
+  }
+
+  double* rows = dataset.getData().getPointer() + datasetOffset * dim;
+  double* targets = dataset.getTargets().getPointer() + datasetOffset;
+
+  if (!filtered && (header.layout == static_cast<uint32_t>(BinaryDatasetLayout::ROW_MAJOR)) &&
+      (header.valueSize == sizeof(double)) && (dim == header.dimension) &&
+      std::is_sorted(columns.begin(), columns.end())) {
+    // the samples are stored exactly like in the dataset
+    std::memcpy(rows, data + header.dataOffset + first * dim * sizeof(double),
+                count * dim * sizeof(double));
+
+    if (header.hasTargets != 0) {
+      std::memcpy(targets, data + header.targetOffset + first * sizeof(double),
+                  count * sizeof(double));
+    }
+
+    return;
+  }
+
+#pragma omp parallel for schedule(static) if (count > PARALLEL_READ_THRESHOLD)
+  for (size_t i = 0; i < count; i++) {
+    double target = 0.0;
+    readInstance(getFileInstance(first + i), rows + i * dim, target);
+    targets[i] = target;
+  }
+}
+
+void BinaryDatasetReader::readInstances(const std::vector<size_t>& instances, Dataset& dataset,
+                                        size_t datasetOffset) const {
+  const size_t dim = getDimension();
+  const size_t count = instances.size();
+
+  if ((datasetOffset + count > dataset.getNumberInstances()) ||
+      (dataset.getData().getNcols() != dim) ||
+      ((count > 0) &&
+       (*std::max_element(instances.begin(), instances.end()) >= numberInstances))) {
+    throw base::data_exception("BinaryDatasetReader::readInstances: invalid instance range");
+  }
+
+  double* rows = dataset.getData().getPointer() + datasetOffset * dim;
+  double* targets = dataset.getTargets().getPointer() + datasetOffset;
+
+#pragma omp parallel for schedule(static) if (count > PARALLEL_READ_THRESHOLD)
+  for (size_t i = 0; i < count; i++) {
+    double target = 0.0;
+    readInstance(getFileInstance(instances[i]), rows + i * dim, target);
+    targets[i] = target;
+  }
+}
+
+Dataset BinaryDatasetReader::readAll() const {
+  Dataset dataset(numberInstances, getDimension());
+  readInstances(0, numberInstances, dataset);
+  return dataset;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
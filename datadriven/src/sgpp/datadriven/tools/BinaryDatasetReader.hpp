@@ -0,0 +1,193 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BINARYDATASETREADER_HPP
+#define BINARYDATASETREADER_HPP
+
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetFormat.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Random-access reader for files written by BinaryDatasetWriter.
+ *
+ * The file is memory-mapped, so opening it neither parses nor copies the samples. Arbitrary
+ * (e.g., shuffled) samples can be read into a Dataset; values stored in single precision are
+ * converted to double. The semantics of instanceCutoff, selectedCols and selectedTargets are
+ * the same as in CSVTools::readCSV.
+ */
+class BinaryDatasetReader {
+ public:
+  /**
+   * Constructor, maps the file.
+   *
+   * @param filename        name of the file
+   * @param instanceCutoff  maximal number of samples to read (-1 for all samples)
+   * @param selectedCols    dimensions that are read (empty for all dimensions)
+   * @param selectedTargets admissible targets (empty for all targets)
+   */
+  explicit BinaryDatasetReader(const std::string& filename, size_t instanceCutoff = -1,
+                               std::vector<size_t> selectedCols = std::vector<size_t>(),
+                               std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * Creates a reader for data that is already in memory (e.g., a decompressed file).
+   * The content is copied. See the constructor for the parameters.
+   *
+   * @return new reader for the content
+   */
+  static std::unique_ptr<BinaryDatasetReader> fromString(
+      const std::string& content, size_t instanceCutoff = -1,
+      std::vector<size_t> selectedCols = std::vector<size_t>(),
+      std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * @return number of (admissible) samples
+   */
+  size_t getNumberInstances() const { return numberInstances; }
+
+  /**
+   * @return dimension of the samples (number of selected dimensions)
+   */
+  size_t getDimension() const { return columns.size(); }
+
+  /**
+   * @return whether the file contains targets
+   */
+  bool containsTargets() const { return header.hasTargets != 0; }
+
+  /**
+   * @return memory layout of the file
+   */
+  BinaryDatasetLayout getLayout() const {
+    return static_cast<BinaryDatasetLayout>(header.layout);
+  }
+
+  /**
+   * @return precision of the values in the file
+   */
+  BinaryDatasetPrecision getPrecision() const {
+    return static_cast<BinaryDatasetPrecision>(header.valueSize);
+  }
+
+  /**
+   * Reads a contiguous range of samples.
+   *
+   * @param first           index of the first sample
+   * @param count           number of samples
+   * @param[out] dataset    dataset the samples are written to (has to be large enough)
+   * @param datasetOffset   row of dataset the first sample is written to
+   */
+  void readInstances(size_t first, size_t count, Dataset& dataset,
+                     size_t datasetOffset = 0) const;
+
+  /**
+   * Reads arbitrary samples, e.g., in the order given by a shuffling.
+   *
+   * @param instances       indices of the samples
+   * @param[out] dataset    dataset the samples are written to (has to be large enough)
+   * @param datasetOffset   row of dataset the first sample is written to
+   */
+  void readInstances(const std::vector<size_t>& instances, Dataset& dataset,
+                     size_t datasetOffset = 0) const;
+
+  /**
+   * Reads all samples.
+   *
+   * @return dataset containing all samples
+   */
+  Dataset readAll() const;
+
+  /**
+   * Checks magic number, byte order, version and parameters of a header.
+   * Throws a file_exception if the header is invalid.
+   *
+   * @param header  header to check
+   */
+  static void checkHeader(const BinaryDatasetHeader& header);
+
+ protected:
+  /// mapped file
+  std::shared_ptr<base::MemoryMappedFile> file;
+  /// content if the reader has been created from a string (double for the alignment)
+  std::vector<double> content;
+  /// beginning of the data
+  const char* data;
+  /// size of the data in bytes
+  size_t size;
+  /// header of the file
+  BinaryDatasetHeader header;
+
+  /// dimensions of the file that are read
+  std::vector<size_t> columns;
+  /// whether the samples are filtered by their targets
+  bool filtered;
+  /// indices of the admissible samples if filtered is true
+  std::vector<size_t> instances;
+  /// number of admissible samples
+  size_t numberInstances;
+
+  /**
+   * Protected constructor for fromString, initialize has to be called afterwards.
+   *
+   * @param content       data to copy
+   * @param contentSize   size of the data in bytes
+   */
+  BinaryDatasetReader(const char* content, size_t contentSize);
+
+  /**
+   * Checks the header and computes columns, instances and numberInstances.
+   */
+  void initialize(size_t instanceCutoff, const std::vector<size_t>& selectedCols,
+                  const std::vector<double>& selectedTargets);
+
+  /**
+   * @param i index of an admissible sample
+   * @return index of the sample in the file
+   */
+  size_t getFileInstance(size_t i) const { return filtered ? instances[i] : i; }
+
+  /**
+   * Reads a value of the file.
+   *
+   * @param offset  offset of the array in bytes
+   * @param index   index of the value in the array
+   * @return value converted to double
+   */
+  double getValue(uint64_t offset, size_t index) const {
+    if (header.valueSize == sizeof(float)) {
+      return static_cast<double>(reinterpret_cast<const float*>(data + offset)[index]);
+    } else {
+      return reinterpret_cast<const double*>(data + offset)[index];
+    }
+  }
+
+  /**
+   * Reads a sample of the file.
+   *
+   * @param fileInstance  index of the sample in the file
+   * @param[out] row      values of the selected dimensions
+   * @param[out] target   target value (only written if the file contains targets)
+   */
+  void readInstance(size_t fileInstance, double* row, double& target) const;
+
+ private:
+  BinaryDatasetReader(const BinaryDatasetReader&) = delete;
+  BinaryDatasetReader& operator=(const BinaryDatasetReader&) = delete;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* BINARYDATASETREADER_HPP */
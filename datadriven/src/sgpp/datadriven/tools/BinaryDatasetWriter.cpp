@@ -0,0 +1,174 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/BinaryDatasetWriter.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+const char MAGIC[8] = {'S', 'G', 'P', 'P', 'D', 'A', 'T', '\0'};
+
+uint64_t align(uint64_t offset) {
+  return (offset + BinaryDatasetWriter::ALIGNMENT - 1) / BinaryDatasetWriter::ALIGNMENT *
+         BinaryDatasetWriter::ALIGNMENT;
+}
+
+}  // namespace
+
+const uint64_t BinaryDatasetWriter::ALIGNMENT;
+const uint32_t BinaryDatasetWriter::BYTE_ORDER_MARK;
+
+BinaryDatasetWriter::BinaryDatasetWriter(const std::string& filename, size_t numberInstances,
+                                         size_t dimension, bool hasTargets,
+                                         BinaryDatasetLayout layout,
+                                         BinaryDatasetPrecision precision)
+    : file(filename, std::ios::out | std::ios::binary | std::ios::trunc),
+      numberWritten(0),
+      buffer() {
+  if (!file) {
+    throw base::file_exception("BinaryDatasetWriter: cannot open file");
+  }
+
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = BINARY_DATASET_VERSION;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.layout = static_cast<uint32_t>(layout);
+  header.valueSize = static_cast<uint32_t>(precision);
+  header.hasTargets = hasTargets ? 1 : 0;
+  header.numberInstances = numberInstances;
+  header.dimension = dimension;
+  header.dataOffset = align(sizeof(header));
+  header.targetOffset =
+      hasTargets ? align(header.dataOffset + numberInstances * dimension * header.valueSize) : 0;
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  // the file is extended to its final size, the arrays are filled by append
+  const uint64_t fileSize = hasTargets ? header.targetOffset + numberInstances * header.valueSize
+                                       : header.dataOffset +
+                                             numberInstances * dimension * header.valueSize;
+
+  if (fileSize > sizeof(header)) {
+    file.seekp(static_cast<std::streamoff>(fileSize - 1));
+    file.put('\0');
+  }
+}
+
+BinaryDatasetWriter::~BinaryDatasetWriter() {
+  if (file.is_open()) {
+    file.close();
+  }
+}
+
+void BinaryDatasetWriter::writeValues(uint64_t offset, const double* values, size_t count,
+                                      size_t stride) {
+  buffer.resize(count * header.valueSize);
+
+  if (header.valueSize == sizeof(float)) {
+    float* dst = reinterpret_cast<float*>(buffer.data());
+
+    for (size_t i = 0; i < count; i++) {
+      dst[i] = static_cast<float>(values[i * stride]);
+    }
+  } else {
+    double* dst = reinterpret_cast<double*>(buffer.data());
+
+    for (size_t i = 0; i < count; i++) {
+      dst[i] = values[i * stride];
+    }
+  }
+
+  file.seekp(static_cast<std::streamoff>(offset));
+  file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+void BinaryDatasetWriter::append(const Dataset& dataset) {
+  const size_t count = dataset.getNumberInstances();
+  const size_t dim = static_cast<size_t>(header.dimension);
+  const size_t n = static_cast<size_t>(header.numberInstances);
+
+  if (!file.is_open()) {
+    throw base::file_exception("BinaryDatasetWriter::append: file has already been closed");
+  }
+
+  if ((dataset.getDimension() != dim) || (numberWritten + count > n)) {
+    throw base::file_exception("BinaryDatasetWriter::append: dataset does not fit");
+  }
+
+  const double* data = dataset.getData().getPointer();
+
+  if (header.layout == static_cast<uint32_t>(BinaryDatasetLayout::ROW_MAJOR)) {
+    writeValues(header.dataOffset + numberWritten * dim * header.valueSize, data, count * dim,
+                1);
+  } else {
+    for (size_t d = 0; d < dim; d++) {
+      writeValues(header.dataOffset + (d * n + numberWritten) * header.valueSize, data + d,
+                  count, dim);
+    }
+  }
+
+  if (header.hasTargets != 0) {
+    writeValues(header.targetOffset + numberWritten * header.valueSize,
+                dataset.getTargets().getPointer(), count, 1);
+  }
+
+  numberWritten += count;
+
+  if (!file) {
+    throw base::file_exception("BinaryDatasetWriter::append: error while writing");
+  }
+}
+
+void BinaryDatasetWriter::close() {
+  if (numberWritten != header.numberInstances) {
+    throw base::file_exception("BinaryDatasetWriter::close: not all samples have been written");
+  }
+
+  file.close();
+
+  if (!file) {
+    throw base::file_exception("BinaryDatasetWriter::close: error while writing");
+  }
+}
+
+void BinaryDatasetWriter::write(const Dataset& dataset, const std::string& filename,
+                                bool hasTargets, BinaryDatasetLayout layout,
+                                BinaryDatasetPrecision precision) {
+  BinaryDatasetWriter writer(filename, dataset.getNumberInstances(), dataset.getDimension(),
+                             hasTargets, layout, precision);
+  writer.append(dataset);
+  writer.close();
+}
+
+void BinaryDatasetWriter::convert(const TextDataReader& reader, const std::string& filename,
+                                  BinaryDatasetLayout layout, BinaryDatasetPrecision precision,
+                                  size_t batchSize) {
+  const size_t numberInstances = reader.getNumberInstances();
+  BinaryDatasetWriter writer(filename, numberInstances, reader.getDimension(),
+                             reader.containsTargets(), layout, precision);
+  batchSize = std::max<size_t>(batchSize, 1);
+
+  for (size_t first = 0; first < numberInstances; first += batchSize) {
+    const size_t count = std::min(batchSize, numberInstances - first);
+    Dataset batch(count, reader.getDimension());
+    reader.readInstances(first, count, batch);
+    writer.append(batch);
+  }
+
+  writer.close();
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,119 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BINARYDATASETWRITER_HPP
+#define BINARYDATASETWRITER_HPP
+
+#include <sgpp/datadriven/tools/BinaryDatasetFormat.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Writes datasets in the binary format described by BinaryDatasetHeader, which can be read
+ * without parsing by BinaryDatasetReader.
+ *
+ * The number of samples has to be known in advance; the samples can then be appended in
+ * batches, so large text files can be converted without loading them completely.
+ */
+class BinaryDatasetWriter {
+ public:
+  /// alignment of the data and target arrays in bytes
+  static const uint64_t ALIGNMENT = 64;
+  /// byte order mark
+  static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+  /**
+   * Constructor, creates the file and writes the header.
+   *
+   * @param filename          name of the file
+   * @param numberInstances   total number of samples
+   * @param dimension         dimension of the samples
+   * @param hasTargets        whether targets are written
+   * @param layout            memory layout of the samples
+   * @param precision         precision of the values
+   */
+  BinaryDatasetWriter(const std::string& filename, size_t numberInstances, size_t dimension,
+                      bool hasTargets = true,
+                      BinaryDatasetLayout layout = BinaryDatasetLayout::ROW_MAJOR,
+                      BinaryDatasetPrecision precision = BinaryDatasetPrecision::DOUBLE);
+
+  /**
+   * Destructor, closes the file (without checking if all samples have been written).
+   */
+  ~BinaryDatasetWriter();
+
+  /**
+   * Appends the samples (and targets) of a dataset.
+   *
+   * @param dataset   samples to append (dimension has to match)
+   */
+  void append(const Dataset& dataset);
+
+  /**
+   * Closes the file. Throws if not all samples have been written.
+   */
+  void close();
+
+  /**
+   * Writes a whole dataset.
+   *
+   * @param dataset     dataset to write
+   * @param filename    name of the file
+   * @param hasTargets  whether the targets of the dataset are written
+   * @param layout      memory layout of the samples
+   * @param precision   precision of the values
+   */
+  static void write(const Dataset& dataset, const std::string& filename, bool hasTargets = true,
+                    BinaryDatasetLayout layout = BinaryDatasetLayout::ROW_MAJOR,
+                    BinaryDatasetPrecision precision = BinaryDatasetPrecision::DOUBLE);
+
+  /**
+   * Converts a CSV or ARFF file indexed by a TextDataReader batch by batch.
+   *
+   * @param reader      reader of the text file
+   * @param filename    name of the binary file
+   * @param layout      memory layout of the samples
+   * @param precision   precision of the values
+   * @param batchSize   number of samples that are parsed and written at once
+   */
+  static void convert(const TextDataReader& reader, const std::string& filename,
+                      BinaryDatasetLayout layout = BinaryDatasetLayout::ROW_MAJOR,
+                      BinaryDatasetPrecision precision = BinaryDatasetPrecision::DOUBLE,
+                      size_t batchSize = 65536);
+
+ protected:
+  /// output file
+  std::ofstream file;
+  /// header of the file
+  BinaryDatasetHeader header;
+  /// number of samples written so far
+  size_t numberWritten;
+  /// conversion buffer
+  std::vector<char> buffer;
+
+  /**
+   * Writes values at the given offset, converting them to the precision of the file.
+   *
+   * @param offset  offset in the file in bytes
+   * @param values  values
+   * @param count   number of values
+   * @param stride  distance of consecutive values in values
+   */
+  void writeValues(uint64_t offset, const double* values, size_t count, size_t stride);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* BINARYDATASETWRITER_HPP */
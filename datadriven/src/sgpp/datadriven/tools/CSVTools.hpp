@@ -23,6 +23,8 @@ namespace datadriven {
 
 /**
  * Class that provides functionality to read CSV files.
+ * The file wrappers use the faster TextDataReader, the stream-based functions parse
+ * line by line.
  */
 class CSVTools {
  public:
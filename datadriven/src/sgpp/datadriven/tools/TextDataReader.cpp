@@ -0,0 +1,442 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// files smaller than this are indexed sequentially
+const size_t PARALLEL_INDEX_THRESHOLD = 1 << 20;
+
+/// number of instances below which instances are parsed sequentially
+const size_t PARALLEL_PARSE_THRESHOLD = 1024;
+
+/// powers of ten that are exactly representable as double
+const double EXACT_POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                      1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                      1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/// 10^(2^k) for k = 0, ..., 8
+const long double BINARY_POWERS_OF_TEN[] = {1e1L,  1e2L,  1e4L,   1e8L,  1e16L,
+                                            1e32L, 1e64L, 1e128L, 1e256L};
+
+const char* findLineEnd(const char* pos, const char* end) {
+  const char* lineEnd = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+  return (lineEnd == nullptr) ? end : lineEnd;
+}
+
+bool isDigit(char c) { return (c >= '0') && (c <= '9'); }
+
+/// case-insensitive comparison of a keyword with the beginning of [pos, end)
+bool startsWith(const char* pos, const char* end, const char* keyword) {
+  for (; *keyword != '\0'; pos++, keyword++) {
+    if ((pos == end) || ((*pos | 0x20) != *keyword)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+TextDataReader::TextDataReader(const std::string& filename, TextDataFormat format,
+                               bool skipFirstLine, bool hasTargets, size_t instanceCutoff,
+                               std::vector<size_t> selectedCols,
+                               std::vector<double> selectedTargets)
+    : file(std::make_shared<base::MemoryMappedFile>(filename)),
+      content(),
+      data(file->getData()),
+      size(file->getSize()),
+      format(format),
+      hasTargets(hasTargets),
+      numberColumns(0),
+      dimension(0),
+      columnPositions(),
+      instanceOffsets() {
+  index(skipFirstLine, instanceCutoff, selectedCols, selectedTargets);
+}
+
+TextDataReader::TextDataReader(const std::string& content, TextDataFormat format,
+                               bool hasTargets)
+    : file(),
+      content(content),
+      data(this->content.data()),
+      size(this->content.size()),
+      format(format),
+      hasTargets(hasTargets),
+      numberColumns(0),
+      dimension(0),
+      columnPositions(),
+      instanceOffsets() {}
+
+std::unique_ptr<TextDataReader> TextDataReader::fromString(
+    const std::string& content, TextDataFormat format, bool skipFirstLine, bool hasTargets,
+    size_t instanceCutoff, std::vector<size_t> selectedCols,
+    std::vector<double> selectedTargets) {
+  std::unique_ptr<TextDataReader> reader(new TextDataReader(content, format, hasTargets));
+  reader->index(skipFirstLine, instanceCutoff, selectedCols, selectedTargets);
+  return reader;
+}
+
+bool TextDataReader::isDataLine(const char* lineBegin, const char* lineEnd) const {
+  if ((format == TextDataFormat::ARFF) &&
+      ((std::memchr(lineBegin, '@', lineEnd - lineBegin) != nullptr) ||
+       (std::memchr(lineBegin, '%', lineEnd - lineBegin) != nullptr))) {
+    return false;
+  }
+
+  for (const char* pos = lineBegin; pos < lineEnd; pos++) {
+    if ((*pos != ' ') && (*pos != '\t') && (*pos != '\r')) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void TextDataReader::index(bool skipFirstLine, size_t instanceCutoff,
+                           const std::vector<size_t>& selectedCols,
+                           const std::vector<double>& selectedTargets) {
+  const char* const end = data + size;
+  const char* begin = data;
+
+  if (skipFirstLine && (format == TextDataFormat::CSV)) {
+    begin = std::min(findLineEnd(begin, end) + 1, end);
+  }
+
+  // the first data line determines the number of columns
+  for (const char* line = begin; line < end;) {
+    const char* lineEnd = findLineEnd(line, end);
+
+    if (isDataLine(line, lineEnd)) {
+      numberColumns = std::count(line, lineEnd, ',') + 1;
+      break;
+    }
+
+    line = lineEnd + 1;
+  }
+
+  if (numberColumns == 0) {
+    // no data
+    dimension = selectedCols.size();
+    return;
+  }
+
+  const size_t maxDimension = hasTargets ? numberColumns - 1 : numberColumns;
+  columnPositions.assign(numberColumns, std::vector<size_t>());
+
+  if (selectedCols.size() > 0) {
+    if (*std::max_element(selectedCols.begin(), selectedCols.end()) >= maxDimension) {
+      throw base::file_exception("TextDataReader: invalid column selection");
+    }
+
+    dimension = selectedCols.size();
+
+    for (size_t i = 0; i < selectedCols.size(); i++) {
+      columnPositions[selectedCols[i]].push_back(i);
+    }
+  } else {
+    dimension = maxDimension;
+
+    for (size_t i = 0; i < maxDimension; i++) {
+      columnPositions[i].push_back(i);
+    }
+  }
+
+  // index the lines in chunks (in parallel for large files without cutoff)
+  size_t numberChunks = 1;
+
+#ifdef _OPENMP
+  if ((size > PARALLEL_INDEX_THRESHOLD) && (instanceCutoff == static_cast<size_t>(-1))) {
+    numberChunks = static_cast<size_t>(omp_get_max_threads());
+  }
+#endif
+
+  // chunk boundaries are moved to the beginning of the next line
+  std::vector<const char*> chunkBegins(numberChunks + 1, end);
+  chunkBegins[0] = begin;
+
+  for (size_t c = 1; c < numberChunks; c++) {
+    const char* chunkBegin = begin + static_cast<size_t>(end - begin) / numberChunks * c;
+
+    if (chunkBegin <= chunkBegins[c - 1]) {
+      chunkBegins[c] = chunkBegins[c - 1];
+    } else {
+      chunkBegins[c] = std::min(findLineEnd(chunkBegin - 1, end) + 1, end);
+    }
+  }
+
+  std::vector<std::vector<size_t>> chunkOffsets(numberChunks);
+  const bool filterTargets = hasTargets && (selectedTargets.size() > 0);
+  bool columnMismatch = false;
+
+#pragma omp parallel for schedule(static, 1)
+  for (size_t c = 0; c < numberChunks; c++) {
+    std::vector<size_t>& offsets = chunkOffsets[c];
+
+    for (const char* line = chunkBegins[c];
+         (line < chunkBegins[c + 1]) && (offsets.size() < instanceCutoff);) {
+      const char* lineEnd = findLineEnd(line, end);
+
+      if (isDataLine(line, lineEnd)) {
+        if (static_cast<size_t>(std::count(line, lineEnd, ',')) + 1 != numberColumns) {
+#pragma omp critical
+          columnMismatch = true;
+        } else if (filterTargets) {
+          // the target is the last column
+          const char* targetBegin = lineEnd;
+
+          while ((targetBegin > line) && (targetBegin[-1] != ',')) {
+            targetBegin--;
+          }
+
+          const double target = parseDouble(targetBegin, lineEnd);
+
+          for (size_t i = 0; i < selectedTargets.size(); i++) {
+            if (std::fabs(target - selectedTargets[i]) < 0.001) {
+              offsets.push_back(static_cast<size_t>(line - data));
+              break;
+            }
+          }
+        } else {
+          offsets.push_back(static_cast<size_t>(line - data));
+        }
+      }
+
+      line = lineEnd + 1;
+    }
+  }
+
+  if (columnMismatch) {
+    throw base::file_exception("TextDataReader: number of columns differs between lines");
+  }
+
+  size_t numberInstances = 0;
+
+  for (size_t c = 0; c < numberChunks; c++) {
+    numberInstances += chunkOffsets[c].size();
+  }
+
+  instanceOffsets.reserve(std::min(numberInstances, instanceCutoff));
+
+  for (size_t c = 0; (c < numberChunks) && (instanceOffsets.size() < instanceCutoff); c++) {
+    const size_t count = std::min(chunkOffsets[c].size(), instanceCutoff - instanceOffsets.size());
+    instanceOffsets.insert(instanceOffsets.end(), chunkOffsets[c].begin(),
+                           chunkOffsets[c].begin() + count);
+  }
+}
+
+void TextDataReader::parseInstance(size_t offset, double* row, double& target) const {
+  const char* pos = data + offset;
+  const char* lineEnd = findLineEnd(pos, data + size);
+
+  for (size_t c = 0; c < numberColumns; c++) {
+    const double value = parseDouble(pos, lineEnd);
+
+    if (!columnPositions[c].empty()) {
+      for (size_t position : columnPositions[c]) {
+        row[position] = value;
+      }
+    } else if (hasTargets && (c == numberColumns - 1)) {
+      target = value;
+    }
+
+    // skip to the next column
+    const char* comma = static_cast<const char*>(std::memchr(pos, ',', lineEnd - pos));
+    pos = (comma == nullptr) ? lineEnd : comma + 1;
+  }
+}
+
+void TextDataReader::readInstances(size_t first, size_t count, Dataset& dataset,
+                                   size_t datasetOffset) const {
+  if ((first + count > getNumberInstances()) ||
+      (datasetOffset + count > dataset.getNumberInstances()) ||
+      (dataset.getData().getNcols() != dimension)) {
+    throw base::data_exception("TextDataReader::readInstances: invalid instance range");
+  }
+
+  double* rows = dataset.getData().getPointer();
+  double* targets = dataset.getTargets().getPointer();
+
+#pragma omp parallel for schedule(static) if (count > PARALLEL_PARSE_THRESHOLD)
+  for (size_t i = 0; i < count; i++) {
+    double target = 0.0;
+    parseInstance(instanceOffsets[first + i], rows + (datasetOffset + i) * dimension, target);
+
+    if (hasTargets) {
+      targets[datasetOffset + i] = target;
+    }
+  }
+}
+
+void TextDataReader::readInstances(const std::vector<size_t>& instances, Dataset& dataset,
+                                   size_t datasetOffset) const {
+  const size_t count = instances.size();
+
+  if ((datasetOffset + count > dataset.getNumberInstances()) ||
+      (dataset.getData().getNcols() != dimension) ||
+      ((count > 0) &&
+       (*std::max_element(instances.begin(), instances.end()) >= getNumberInstances()))) {
+    throw base::data_exception("TextDataReader::readInstances: invalid instance range");
+  }
+
+  double* rows = dataset.getData().getPointer();
+  double* targets = dataset.getTargets().getPointer();
+
+#pragma omp parallel for schedule(static) if (count > PARALLEL_PARSE_THRESHOLD)
+  for (size_t i = 0; i < count; i++) {
+    double target = 0.0;
+    parseInstance(instanceOffsets[instances[i]], rows + (datasetOffset + i) * dimension, target);
+
+    if (hasTargets) {
+      targets[datasetOffset + i] = target;
+    }
+  }
+}
+
+Dataset TextDataReader::readAll() const {
+  Dataset dataset(getNumberInstances(), dimension);
+  readInstances(0, getNumberInstances(), dataset);
+  return dataset;
+}
+
+double TextDataReader::parseDouble(const char*& pos, const char* end) {
+  const char* p = pos;
+
+  while ((p < end) && ((*p == ' ') || (*p == '\t'))) {
+    p++;
+  }
+
+  bool negative = false;
+
+  if ((p < end) && ((*p == '-') || (*p == '+'))) {
+    negative = (*p == '-');
+    p++;
+  }
+
+  // decimal significand (at most 19 significant digits fit into 64 bits)
+  uint64_t significand = 0;
+  int significantDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+
+  for (; (p < end) && isDigit(*p); p++) {
+    hasDigits = true;
+
+    if (significantDigits < 19) {
+      significand = 10 * significand + static_cast<uint64_t>(*p - '0');
+      significantDigits += (significand != 0) ? 1 : 0;
+    } else {
+      exponent++;
+    }
+  }
+
+  if ((p < end) && (*p == '.')) {
+    for (p++; (p < end) && isDigit(*p); p++) {
+      hasDigits = true;
+
+      if (significantDigits < 19) {
+        significand = 10 * significand + static_cast<uint64_t>(*p - '0');
+        significantDigits += (significand != 0) ? 1 : 0;
+        exponent--;
+      }
+    }
+  }
+
+  if (!hasDigits) {
+    double value = 0.0;
+
+    if (startsWith(p, end, "nan")) {
+      value = std::numeric_limits<double>::quiet_NaN();
+      pos = p + 3;
+    } else if (startsWith(p, end, "infinity")) {
+      value = std::numeric_limits<double>::infinity();
+      pos = p + 8;
+    } else if (startsWith(p, end, "inf")) {
+      value = std::numeric_limits<double>::infinity();
+      pos = p + 3;
+    }
+
+    return negative ? -value : value;
+  }
+
+  if ((p < end) && ((*p == 'e') || (*p == 'E'))) {
+    const char* q = p + 1;
+    bool negativeExponent = false;
+
+    if ((q < end) && ((*q == '-') || (*q == '+'))) {
+      negativeExponent = (*q == '-');
+      q++;
+    }
+
+    if ((q < end) && isDigit(*q)) {
+      int explicitExponent = 0;
+
+      for (; (q < end) && isDigit(*q); q++) {
+        if (explicitExponent < 100000) {
+          explicitExponent = 10 * explicitExponent + (*q - '0');
+        }
+      }
+
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+      p = q;
+    }
+  }
+
+  pos = p;
+  double value;
+
+  if (significand == 0) {
+    value = 0.0;
+  } else if ((significand <= (static_cast<uint64_t>(1) << 53)) && (exponent >= -22) &&
+             (exponent <= 22)) {
+    // both operands are exact, so the result is correctly rounded
+    value = static_cast<double>(significand);
+    value = (exponent < 0) ? value / EXACT_POWERS_OF_TEN[-exponent]
+                           : value * EXACT_POWERS_OF_TEN[exponent];
+  } else if (exponent > 330) {
+    value = std::numeric_limits<double>::infinity();
+  } else if (exponent < -350) {
+    value = 0.0;
+  } else {
+    // use the extended precision of long double to keep the rounding error small
+    long double scale = 1.0L;
+
+    for (int k = 0, e = std::abs(exponent); e != 0; k++, e >>= 1) {
+      if ((e & 1) != 0) {
+        scale *= BINARY_POWERS_OF_TEN[k];
+      }
+    }
+
+    const long double result = static_cast<long double>(significand);
+    value = static_cast<double>((exponent < 0) ? result / scale : result * scale);
+  }
+
+  return negative ? -value : value;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,188 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef TEXTDATAREADER_HPP
+#define TEXTDATAREADER_HPP
+
+#include <sgpp/base/tools/MemoryMappedFile.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Text formats supported by TextDataReader.
+ */
+enum class TextDataFormat {
+  /// comma-separated values, optionally with a header line
+  CSV,
+  /// ARFF, all lines containing '@' or '%' (attribute declarations, comments) are skipped
+  ARFF
+};
+
+/**
+ * Fast reader for comma-separated numeric data (CSV and ARFF).
+ *
+ * In contrast to CSVTools and ARFFTools, the file is not read line by line into strings.
+ * It is memory-mapped (see sgpp::base::MemoryMappedFile) and indexed in a single pass that
+ * only stores the byte offset of every admissible instance. Afterwards, arbitrary ranges of
+ * instances can be parsed directly into a pre-sized Dataset, in parallel if OpenMP is
+ * available. Numbers are parsed with parseDouble, which neither allocates nor depends on the
+ * locale.
+ *
+ * The semantics of hasTargets, instanceCutoff, selectedCols and selectedTargets are the same
+ * as in CSVTools::readCSV.
+ */
+class TextDataReader {
+ public:
+  /**
+   * Constructor, maps and indexes a file.
+   *
+   * @param filename        name of the file
+   * @param format          format of the file
+   * @param skipFirstLine   whether to skip the first line (CSV header); ignored for ARFF
+   * @param hasTargets      whether the last column contains the targets
+   * @param instanceCutoff  maximal number of instances to index (-1 for all instances)
+   * @param selectedCols    columns that are used as dimensions (empty for all columns)
+   * @param selectedTargets admissible targets (empty for all targets)
+   */
+  TextDataReader(const std::string& filename, TextDataFormat format, bool skipFirstLine,
+                 bool hasTargets, size_t instanceCutoff = -1,
+                 std::vector<size_t> selectedCols = std::vector<size_t>(),
+                 std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * Creates a reader for data that is already in memory (e.g., a decompressed file).
+   * The content is copied. See the constructor for the parameters.
+   *
+   * @return new reader for the content
+   */
+  static std::unique_ptr<TextDataReader> fromString(
+      const std::string& content, TextDataFormat format, bool skipFirstLine, bool hasTargets,
+      size_t instanceCutoff = -1, std::vector<size_t> selectedCols = std::vector<size_t>(),
+      std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * @return number of (admissible) instances
+   */
+  size_t getNumberInstances() const { return instanceOffsets.size(); }
+
+  /**
+   * @return dimension of the instances (number of selected columns)
+   */
+  size_t getDimension() const { return dimension; }
+
+  /**
+   * @return whether the instances have targets
+   */
+  bool containsTargets() const { return hasTargets; }
+
+  /**
+   * Parses a contiguous range of instances.
+   *
+   * @param first           index of the first instance
+   * @param count           number of instances
+   * @param[out] dataset    dataset the instances are written to (has to be large enough)
+   * @param datasetOffset   row of dataset the first instance is written to
+   */
+  void readInstances(size_t first, size_t count, Dataset& dataset,
+                     size_t datasetOffset = 0) const;
+
+  /**
+   * Parses arbitrary instances, e.g., in the order given by a shuffling.
+   *
+   * @param instances       indices of the instances
+   * @param[out] dataset    dataset the instances are written to (has to be large enough)
+   * @param datasetOffset   row of dataset the first instance is written to
+   */
+  void readInstances(const std::vector<size_t>& instances, Dataset& dataset,
+                     size_t datasetOffset = 0) const;
+
+  /**
+   * Parses all instances.
+   *
+   * @return dataset containing all instances
+   */
+  Dataset readAll() const;
+
+  /**
+   * Parses a floating point number without allocating memory and independent of the locale.
+   * Leading spaces and tabs are skipped. Decimal numbers with up to 19 significant digits
+   * and exponents of at most 22 are converted exactly (correctly rounded), longer numbers
+   * with an error of at most one unit in the last place. "nan" and "inf" are accepted.
+   * If no number can be parsed, 0 is returned (like atof) and pos is not advanced.
+   *
+   * @param[in,out] pos   beginning of the number, set to the first character after the number
+   * @param end           end of the buffer
+   * @return parsed number
+   */
+  static double parseDouble(const char*& pos, const char* end);
+
+ protected:
+  /// mapped file (shared by the instances that are indexed from it)
+  std::shared_ptr<base::MemoryMappedFile> file;
+  /// content if the reader has been created from a string
+  std::string content;
+  /// beginning of the data
+  const char* data;
+  /// size of the data in bytes
+  size_t size;
+
+  /// format of the data
+  TextDataFormat format;
+  /// whether the last column contains the targets
+  bool hasTargets;
+  /// number of columns of every data line
+  size_t numberColumns;
+  /// number of selected columns
+  size_t dimension;
+  /// for every column its positions in the instances (empty if the column is skipped, more
+  /// than one if the column is selected repeatedly)
+  std::vector<std::vector<size_t>> columnPositions;
+  /// byte offset of every admissible instance
+  std::vector<size_t> instanceOffsets;
+
+  /**
+   * Protected constructor for fromString, index has to be called afterwards.
+   */
+  TextDataReader(const std::string& content, TextDataFormat format, bool hasTargets);
+
+  /**
+   * Computes numberColumns, dimension, columnPositions and instanceOffsets.
+   */
+  void index(bool skipFirstLine, size_t instanceCutoff, const std::vector<size_t>& selectedCols,
+             const std::vector<double>& selectedTargets);
+
+  /**
+   * @param lineBegin   beginning of the line
+   * @param lineEnd     end of the line (excluding the line break)
+   * @return whether the line contains data (i.e., is not empty, a comment or a declaration)
+   */
+  bool isDataLine(const char* lineBegin, const char* lineEnd) const;
+
+  /**
+   * Parses the instance at the given offset.
+   *
+   * @param offset        byte offset of the instance
+   * @param[out] row      values of the selected columns
+   * @param[out] target   target value (only written if hasTargets is true)
+   */
+  void parseInstance(size_t offset, double* row, double& target) const;
+
+ private:
+  TextDataReader(const TextDataReader&) = delete;
+  TextDataReader& operator=(const TextDataReader&) = delete;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* TEXTDATAREADER_HPP */
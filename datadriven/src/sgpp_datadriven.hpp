@@ -38,6 +38,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineDenseIChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineGE.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOnline.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOnlineDE.hpp>
@@ -46,6 +47,7 @@
 
 #include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
 #include <sgpp/datadriven/algorithm/GridFactory.hpp>
+#include <sgpp/datadriven/algorithm/LTwoDotMatrixBuilder.hpp>
 
 #include <sgpp/datadriven/algorithm/RefinementMonitor.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorConvergence.hpp>
@@ -89,7 +91,11 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationTest.hpp>
 
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetFormat.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetReader.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetWriter.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
 
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalScalapack/OperationMultipleEvalDistributed.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalScalapack/OperationMultipleEvalLinearDistributed.hpp>
@@ -146,9 +152,11 @@
 #include <sgpp/datadriven/datamining/configuration/SLESolverTypeParser.hpp>
 
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSource.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourcePrefetcher.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceSplitting.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformation.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformationConfig.hpp>
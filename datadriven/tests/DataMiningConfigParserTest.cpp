@@ -83,6 +83,7 @@ BOOST_AUTO_TEST_CASE(testDataSourceConfig) {
   BOOST_CHECK_EQUAL(config.dataTransformationConfig.rosenblattConfig.solverMaxIterations, 1000);
   BOOST_CHECK_EQUAL(config.validationPortion, 0.634);
   BOOST_CHECK_EQUAL(config.epochs, 12);
+  BOOST_CHECK_EQUAL(config.prefetchDepth, 3);
   BOOST_CHECK_EQUAL(static_cast<int>(config.shuffling),
                     static_cast<int>(DataSourceShufflingType::random));
 }
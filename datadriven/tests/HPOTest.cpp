@@ -15,15 +15,18 @@
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BOConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/bo/GaussianProcess.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/FitterFactory.hpp>
 #include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/harmonica/Harmonica.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/BoHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/HarmonicaHyperparameterOptimizer.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/TrialScheduler.hpp>
 #include <sgpp/datadriven/datamining/builder/LeastSquaresRegressionMinerFactory.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
 
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -104,6 +107,27 @@ class FitterFactoryTesterHarm : public sgpp::datadriven::FitterFactory {
   std::vector<ConfigurationBit> exconfBits;
 };
 
+class EpochMinerTester : public sgpp::datadriven::SparseGridMiner {
+ public:
+  EpochMinerTester() : SparseGridMiner(nullptr, nullptr), learned(0) {}
+
+  double learn(bool verbose) override {
+    learned++;
+    // four epochs, the score of the model improves with every epoch
+    double value = static_cast<ModelFittingTester *>(getModel())->value;
+    const size_t epochs = 4;
+    for (size_t epoch = 0; epoch + 1 < epochs; epoch++) {
+      double score = value * static_cast<double>(epochs - epoch);
+      if (epochCallback && !epochCallback(epoch, score)) {
+        return score;
+      }
+    }
+    return value;
+  }
+
+  size_t learned;
+};
+
 class HarmonicaTester : public sgpp::datadriven::Harmonica {
  public:
   explicit HarmonicaTester(sgpp::datadriven::FitterFactory *fft) : Harmonica(fft) {}
@@ -137,6 +161,25 @@ BOOST_AUTO_TEST_CASE(upperLevelTest) {
   BOOST_CHECK_LE(res2, 0.3);
 }
 
+BOOST_AUTO_TEST_CASE(upperLevelTestParallelTrials) {
+  // same as above, but three trials at a time (constant liar batches in BO)
+  std::string path("datadriven/tests/hpo_testconfig.json");
+  sgpp::datadriven::DataMiningConfigParser parser(path);
+  sgpp::datadriven::LeastSquaresRegressionMinerFactory minfac{};
+  sgpp::datadriven::BoHyperparameterOptimizer
+      bohpo(minfac.buildMiner(path), new FitterFactoryTester(), parser);
+  sgpp::datadriven::HarmonicaHyperparameterOptimizer
+      harmhpo(minfac.buildMiner(path), new FitterFactoryTester(), parser);
+  for (size_t i = 0; i < 2; i++) {
+    bohpo.addMiner(minfac.buildMiner(path));
+    harmhpo.addMiner(minfac.buildMiner(path));
+  }
+  double res1 = bohpo.run(false);
+  double res2 = harmhpo.run(false);
+  BOOST_CHECK_LE(res1, 0.3);
+  BOOST_CHECK_LE(res2, 0.3);
+}
+
 BOOST_AUTO_TEST_CASE(harmonicaConfigs) {
   // tests the bit management, especially setParameters and addConstraint by comparing
   // to a vector of all possible bit configurations
@@ -353,6 +396,64 @@ BOOST_AUTO_TEST_CASE(addSamplesGP) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(incrementalCholeskyGP) {
+  // the incrementally extended factor has to match a decomposition from scratch
+  std::mt19937 generator(7);
+  std::vector<int> discOptions = {3};
+  std::vector<int> catOptions = {2};
+  BOConfig prototype{&discOptions, &catOptions, 3};
+  size_t nPar = prototype.getNPar();
+  std::vector<BOConfig> configs{};
+  configs.reserve(30);
+
+  sgpp::datadriven::GaussianProcess gp(nPar);
+  DataVector scales{std::vector<double>({1, 0.5, 0.7, 0.2, 0.9, 1})};
+
+  for (size_t i = 0; i < 30; i++) {
+    configs.emplace_back(prototype);
+    configs[i].randomize(generator);
+    std::vector<double> differences(i * nPar);
+    for (size_t k = 0; k < i; ++k) {
+      configs[k].calcSquaredDifferences(configs[i], &differences[k * nPar]);
+    }
+    BOOST_CHECK(gp.addSample(differences));
+    if (i == 14) {
+      gp.setScales(scales);
+    }
+  }
+
+  DataMatrix kernelmatrix(configs.size(), configs.size());
+  for (size_t i = 0; i < configs.size(); ++i) {
+    for (size_t k = 0; k < i; ++k) {
+      double tmp = gp.kernel(configs[i].getScaledDistance(configs[k], scales));
+      kernelmatrix.set(k, i, tmp);
+      kernelmatrix.set(i, k, tmp);
+    }
+    kernelmatrix.set(i, i, 1 + pow(10, -scales.back() * 10));
+  }
+
+  DataVector rhs(configs.size());
+  for (size_t i = 0; i < rhs.size(); ++i) {
+    rhs[i] = static_cast<double>(i % 7) - 3.0;
+  }
+  DataVector solution(rhs);
+  gp.solve(solution);
+  DataVector check(rhs.size());
+  kernelmatrix.mult(solution, check);
+  for (size_t i = 0; i < rhs.size(); ++i) {
+    BOOST_CHECK_SMALL(check[i] - rhs[i], 1e-8);
+  }
+
+  sgpp::datadriven::BayesianOptimization bo({configs[0], configs[1]});
+  DataMatrix factor;
+  bo.decomposeCholesky(kernelmatrix, factor);
+  double logdet = 0;
+  for (size_t i = 0; i < configs.size(); ++i) {
+    logdet += std::log(factor.get(i, i));
+  }
+  BOOST_CHECK_CLOSE(gp.likelihood(scales, rhs), 2 * logdet + rhs.dotProduct(solution), 1e-6);
+}
+
 BOOST_AUTO_TEST_CASE(fitScalesGP) {
   // test gaussian process fitting by fitting to a second GP
   std::vector<BOConfig> initialConfigs{};
@@ -449,4 +550,65 @@ BOOST_AUTO_TEST_CASE(validAcquisitionFunction) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(trialSchedulerParallel) {
+  std::vector<std::unique_ptr<EpochMinerTester>> miners;
+  std::vector<sgpp::datadriven::SparseGridMiner *> workers;
+  for (size_t i = 0; i < 3; i++) {
+    miners.emplace_back(new EpochMinerTester());
+    workers.push_back(miners.back().get());
+  }
+  sgpp::datadriven::HPOConfig config;
+  config.setupDefaults();
+  sgpp::datadriven::TrialScheduler scheduler(workers, config);
+
+  std::vector<sgpp::datadriven::ModelFittingBase *> fitters;
+  for (size_t i = 0; i < 7; i++) {
+    auto fitter = new ModelFittingTester(0, 0, 0);
+    fitter->value = static_cast<double>(i + 1);
+    fitters.push_back(fitter);
+  }
+  DataVector scores;
+  std::vector<bool> stopped;
+  scheduler.evaluate(fitters, scores, stopped);
+
+  // every trial is evaluated exactly once and keeps its position
+  size_t learned = 0;
+  for (auto &miner : miners) {
+    learned += miner->learned;
+  }
+  BOOST_CHECK_EQUAL(learned, 7);
+  for (size_t i = 0; i < 7; i++) {
+    BOOST_CHECK_EQUAL(scores[i], static_cast<double>(i + 1));
+    BOOST_CHECK(!stopped[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(trialSchedulerSuccessiveHalving) {
+  EpochMinerTester miner;
+  sgpp::datadriven::HPOConfig config;
+  config.setupDefaults();
+  config.setHalvingRate(2);
+  config.setHalvingMinEpochs(1);
+  sgpp::datadriven::TrialScheduler scheduler({&miner}, config);
+
+  // rungs after 1 and 2 epochs, only the better half of the trials at a rung continue
+  std::vector<double> values{2, 1, 3, 0.5};
+  std::vector<sgpp::datadriven::ModelFittingBase *> fitters;
+  for (double value : values) {
+    auto fitter = new ModelFittingTester(0, 0, 0);
+    fitter->value = value;
+    fitters.push_back(fitter);
+  }
+  DataVector scores;
+  std::vector<bool> stopped;
+  scheduler.evaluate(fitters, scores, stopped);
+
+  std::vector<double> expectedScores{2, 1, 12, 0.5};
+  std::vector<bool> expectedStopped{false, false, true, false};
+  for (size_t i = 0; i < values.size(); i++) {
+    BOOST_CHECK_EQUAL(scores[i], expectedScores[i]);
+    BOOST_CHECK_EQUAL(stopped[i], expectedStopped[i]);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
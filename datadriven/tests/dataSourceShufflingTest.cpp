@@ -17,7 +17,16 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorCrossValidation.hpp>
 #include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
-
+#include <sgpp/datadriven/datamining/builder/DataSourceBuilder.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/base/SparseGridMinerCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/MSE.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <memory>
 #include <vector>
 
 using sgpp::datadriven::DataShufflingFunctor;
@@ -25,6 +34,16 @@ using sgpp::datadriven::DataShufflingFunctorSequential;
 using sgpp::datadriven::DataShufflingFunctorRandom;
 using sgpp::datadriven::DataShufflingFunctorCrossValidation;
 using sgpp::datadriven::CrossvalidationConfiguration;
+using sgpp::datadriven::DataSourceBuilder;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourceCrossValidation;
+using sgpp::datadriven::DataSourceShufflingType;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::FitterConfigurationLeastSquares;
+using sgpp::datadriven::ModelFittingLeastSquares;
+using sgpp::datadriven::MSE;
+using sgpp::datadriven::Scorer;
+using sgpp::datadriven::SparseGridMinerCrossValidation;
 
 bool testBijectivity(DataShufflingFunctor& shuffling, size_t numSamples) {
   std::vector<bool> hit(numSamples, false);
@@ -36,6 +55,17 @@ bool testBijectivity(DataShufflingFunctor& shuffling, size_t numSamples) {
   return true;
 }
 
+bool equalDatasets(Dataset& first, Dataset& second) {
+  if (first.getNumberInstances() != second.getNumberInstances()) return false;
+  for (size_t i = 0; i < first.getNumberInstances(); i++) {
+    if (first.getTargets()[i] != second.getTargets()[i]) return false;
+    for (size_t d = 0; d < first.getDimension(); d++) {
+      if (first.getData().get(i, d) != second.getData().get(i, d)) return false;
+    }
+  }
+  return true;
+}
+
 bool testOrder(DataShufflingFunctor& shuffling, std::vector<size_t> expectedOrder) {
   for (size_t idx = 0; idx < expectedOrder.size(); idx++) {
     if (shuffling(idx, expectedOrder.size()) != expectedOrder[idx]) return false;
@@ -43,6 +73,28 @@ bool testOrder(DataShufflingFunctor& shuffling, std::vector<size_t> expectedOrde
   return true;
 }
 
+double crossValidationScore(size_t parallelFolds) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+  config.shuffling = DataSourceShufflingType::random;
+  config.randomSeed = 42;
+  CrossvalidationConfiguration cvConfig;
+  cvConfig.kfold_ = 5;
+  cvConfig.parallelFolds_ = parallelFolds;
+  cvConfig.threadsPerFold_ = 1;
+
+  FitterConfigurationLeastSquares fitterConfig;
+  fitterConfig.setupDefaults();
+  fitterConfig.getGridConfig().level_ = 2;
+  fitterConfig.getRefinementConfig().numRefinements_ = 0;
+
+  DataSourceBuilder builder;
+  SparseGridMinerCrossValidation miner(builder.crossValidationFromConfig(config, cvConfig),
+                                       new ModelFittingLeastSquares(fitterConfig),
+                                       new Scorer(new MSE{}));
+  return miner.learn(false);
+}
+
 BOOST_AUTO_TEST_SUITE(testDataSourceShuffling)
 
 BOOST_AUTO_TEST_CASE(TestShufflingSequential) {
@@ -80,6 +132,49 @@ BOOST_AUTO_TEST_CASE(TestShufflingCrossValidation) {
   BOOST_CHECK(testOrder(cvShuffling, expectedOrder));
 }
 
+BOOST_AUTO_TEST_CASE(TestCrossValidationFoldView) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/liver/liver-disorders_normalized_small.csv";
+  config.batchSize = 2;
+  config.numBatches = 0;
+  config.shuffling = DataSourceShufflingType::random;
+  config.randomSeed = 42;
+  CrossvalidationConfiguration cvConfig;
+  cvConfig.kfold_ = 3;
+
+  DataSourceBuilder builder;
+  std::unique_ptr<DataSourceCrossValidation> dataSource(
+      builder.crossValidationFromConfig(config, cvConfig));
+  std::vector<std::unique_ptr<DataSourceCrossValidation>> views;
+  for (size_t fold = 0; fold < cvConfig.kfold_; fold++) {
+    views.emplace_back(dataSource->createFoldView(fold));
+  }
+
+  // a view yields the same validation data and batches as the data source set to its fold
+  for (size_t fold = 0; fold < cvConfig.kfold_; fold++) {
+    dataSource->setFold(fold);
+    dataSource->reset();
+    views[fold]->reset();
+    BOOST_CHECK(equalDatasets(*dataSource->getValidationData(), *views[fold]->getValidationData()));
+
+    while (true) {
+      std::unique_ptr<Dataset> batch(dataSource->getNextSamples());
+      std::unique_ptr<Dataset> viewBatch(views[fold]->getNextSamples());
+      BOOST_CHECK(equalDatasets(*batch, *viewBatch));
+      if (batch->getNumberInstances() == 0) break;
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestCrossValidationParallelFolds) {
+  // the folds must see the same (randomly shuffled) samples no matter how many are trained
+  // concurrently, so the mean score is exactly the same
+  const double sequentialScore = crossValidationScore(1);
+  for (size_t run = 0; run < 5; run++) {
+    BOOST_CHECK_EQUAL(crossValidationScore(5), sequentialScore);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,152 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourcePrefetcher.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceSplitting.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorRandom.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <memory>
+#include <vector>
+
+using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::DataShufflingFunctorRandom;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourcePrefetcher;
+using sgpp::datadriven::DataSourceSplitting;
+using sgpp::datadriven::Dataset;
+
+namespace {
+
+/**
+ * Reads all batches of all epochs and returns the first value and the sum of each batch
+ * (including the validation data).
+ */
+std::vector<double> readBatches(size_t prefetchDepth, size_t epochs) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/ripley/ripleyGarcke.test.arff";
+  config.numBatches = 100;
+  config.batchSize = 64;
+  config.validationPortion = 0.2;
+  config.prefetchDepth = prefetchDepth;
+
+  // the shuffling functor is not owned by the sample provider
+  DataShufflingFunctorRandom shuffling(7);
+  DataSourceSplitting dataSource(config, new ArffFileSampleProvider(&shuffling));
+  std::vector<double> result;
+
+  for (size_t epoch = 0; epoch < epochs; epoch++) {
+    dataSource.reset();
+    result.push_back(dataSource.getValidationData()->getData().sum());
+
+    // consume a few batches before resetting in the middle of an epoch
+    if (epoch == 0) {
+      for (size_t i = 0; i < 3; i++) {
+        std::unique_ptr<Dataset> dataset(dataSource.getNextSamples());
+        result.push_back(dataset->getData().get(0, 0));
+      }
+
+      dataSource.reset();
+    }
+
+    while (true) {
+      std::unique_ptr<Dataset> dataset(dataSource.getNextSamples());
+
+      if (dataset->getNumberInstances() == 0) {
+        break;
+      }
+
+      result.push_back(dataset->getData().get(0, 0));
+      result.push_back(dataset->getData().sum() + dataset->getTargets().sum());
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dataSourcePrefetcherTest)
+
+BOOST_AUTO_TEST_CASE(prefetcherOrderTest) {
+  size_t calls = 0;
+  DataSourcePrefetcher prefetcher(
+      [&calls]() {
+        // five batches with one sample each, then empty batches
+        Dataset* dataset = new Dataset((calls < 5) ? 1 : 0, 1);
+
+        if (calls < 5) {
+          dataset->getData().set(0, 0, static_cast<double>(calls));
+        }
+
+        calls++;
+        return dataset;
+      },
+      2);
+
+  for (size_t i = 0; i < 5; i++) {
+    std::unique_ptr<Dataset> dataset(prefetcher.next());
+    BOOST_REQUIRE_EQUAL(dataset->getNumberInstances(), 1);
+    BOOST_CHECK_EQUAL(dataset->getData().get(0, 0), static_cast<double>(i));
+  }
+
+  // the background thread stops after the first empty batch
+  for (size_t i = 0; i < 3; i++) {
+    std::unique_ptr<Dataset> dataset(prefetcher.next());
+    BOOST_CHECK_EQUAL(dataset->getNumberInstances(), 0);
+  }
+
+  BOOST_CHECK_EQUAL(calls, 8);
+
+  // prefetched batches are discarded
+  calls = 0;
+  prefetcher.stop();
+  std::unique_ptr<Dataset> dataset(prefetcher.next());
+  BOOST_CHECK_EQUAL(dataset->getData().get(0, 0), 0.0);
+  prefetcher.stop();
+}
+
+BOOST_AUTO_TEST_CASE(prefetcherExceptionTest) {
+  size_t calls = 0;
+  DataSourcePrefetcher prefetcher(
+      [&calls]() {
+        if (calls == 2) {
+          throw sgpp::base::data_exception("test");
+        }
+
+        calls++;
+        return new Dataset(1, 1);
+      },
+      4);
+
+  // the batches created before the exception are returned first
+  delete prefetcher.next();
+  delete prefetcher.next();
+  BOOST_CHECK_THROW(prefetcher.next(), sgpp::base::data_exception);
+}
+
+BOOST_AUTO_TEST_CASE(dataSourcePrefetchingTest) {
+  const std::vector<double> expected = readBatches(0, 3);
+  BOOST_REQUIRE(expected.size() > 30);
+
+  for (size_t prefetchDepth : {1, 4}) {
+    const std::vector<double> actual = readBatches(prefetchDepth, 3);
+    BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+
+    for (size_t i = 0; i < expected.size(); i++) {
+      BOOST_CHECK_EQUAL(actual[i], expected[i]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+void compareToNaive(sgpp::base::Grid& grid, size_t level, size_t numberOfDataPoints) {
+  const size_t dim = grid.getDimension();
+  grid.getGenerator().regular(level);
+  const size_t gridSize = grid.getSize();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  sgpp::base::DataMatrix dataset(numberOfDataPoints, dim);
+
+  for (size_t i = 0; i < numberOfDataPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, distribution(generator));
+    }
+  }
+
+  sgpp::base::DataVector alpha(gridSize);
+  sgpp::base::DataVector source(numberOfDataPoints);
+
+  for (size_t j = 0; j < gridSize; j++) {
+    alpha[j] = distribution(generator) - 0.5;
+  }
+
+  for (size_t i = 0; i < numberOfDataPoints; i++) {
+    source[i] = distribution(generator) - 0.5;
+  }
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+  std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, dataset, configuration));
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opNaive(
+      sgpp::op_factory::createOperationMultipleEvalNaive(grid, dataset));
+
+  sgpp::base::DataVector result(numberOfDataPoints);
+  sgpp::base::DataVector resultNaive(numberOfDataPoints);
+  op->mult(alpha, result);
+  opNaive->mult(alpha, resultNaive);
+
+  for (size_t i = 0; i < numberOfDataPoints; i++) {
+    BOOST_CHECK_SMALL(result[i] - resultNaive[i], 1e-10);
+  }
+
+  sgpp::base::DataVector resultTranspose(gridSize);
+  sgpp::base::DataVector resultTransposeNaive(gridSize);
+  op->multTranspose(source, resultTranspose);
+  opNaive->multTranspose(source, resultTransposeNaive);
+
+  for (size_t j = 0; j < gridSize; j++) {
+    BOOST_CHECK_SMALL(resultTranspose[j] - resultTransposeNaive[j], 1e-10);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestStreamingBsplineMult)
+
+BOOST_AUTO_TEST_CASE(Bspline) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createBsplineGrid(3, 3));
+  compareToNaive(*grid, 4, 300);
+}
+
+BOOST_AUTO_TEST_CASE(ModBspline) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModBsplineGrid(3, 3));
+  compareToNaive(*grid, 4, 300);
+}
+
+BOOST_AUTO_TEST_CASE(BsplineBoundary) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createBsplineBoundaryGrid(2, 5));
+  compareToNaive(*grid, 3, 200);
+}
+
+BOOST_AUTO_TEST_CASE(BsplineClenshawCurtis) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createBsplineClenshawCurtisGrid(2, 3));
+  compareToNaive(*grid, 3, 200);
+}
+
+BOOST_AUTO_TEST_CASE(ModBsplineClenshawCurtis) {
+  std::unique_ptr<sgpp::base::Grid> grid(
+      sgpp::base::Grid::createModBsplineClenshawCurtisGrid(2, 3));
+  compareToNaive(*grid, 4, 200);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
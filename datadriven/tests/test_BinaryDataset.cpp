@@ -0,0 +1,242 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorRandom.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetReader.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetWriter.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::BinaryDatasetLayout;
+using sgpp::datadriven::BinaryDatasetPrecision;
+using sgpp::datadriven::BinaryDatasetReader;
+using sgpp::datadriven::BinaryDatasetWriter;
+using sgpp::datadriven::BinaryFileSampleProvider;
+using sgpp::datadriven::Dataset;
+
+namespace {
+
+const char* const fileName = "test_BinaryDataset.bin";
+
+Dataset createDataset(size_t numberInstances, size_t dim) {
+  Dataset dataset(numberInstances, dim);
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.getData().set(i, d, static_cast<double>(i) + 0.25 * static_cast<double>(d));
+    }
+
+    dataset.getTargets()[i] = (i % 3 == 0) ? 1.0 : -1.0;
+  }
+
+  return dataset;
+}
+
+void checkEqual(const Dataset& actual, const Dataset& expected,
+                const std::vector<size_t>& instances, bool checkTargets = true) {
+  BOOST_REQUIRE_EQUAL(actual.getNumberInstances(), instances.size());
+  BOOST_REQUIRE_EQUAL(actual.getDimension(), expected.getDimension());
+
+  for (size_t i = 0; i < instances.size(); i++) {
+    for (size_t d = 0; d < expected.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(actual.getData().get(i, d), expected.getData().get(instances[i], d));
+    }
+
+    if (checkTargets) {
+      BOOST_CHECK_EQUAL(actual.getTargets()[i], expected.getTargets()[instances[i]]);
+    }
+  }
+}
+
+std::vector<size_t> range(size_t numberInstances) {
+  std::vector<size_t> instances(numberInstances);
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    instances[i] = i;
+  }
+
+  return instances;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestBinaryDataset)
+
+BOOST_AUTO_TEST_CASE(testRoundTrip) {
+  const Dataset dataset = createDataset(101, 5);
+
+  for (BinaryDatasetLayout layout :
+       {BinaryDatasetLayout::ROW_MAJOR, BinaryDatasetLayout::COLUMN_MAJOR}) {
+    // the values of the test dataset are exactly representable as floats
+    for (BinaryDatasetPrecision precision :
+         {BinaryDatasetPrecision::DOUBLE, BinaryDatasetPrecision::FLOAT}) {
+      BinaryDatasetWriter::write(dataset, fileName, true, layout, precision);
+      BinaryDatasetReader reader(fileName);
+
+      BOOST_CHECK(reader.getLayout() == layout);
+      BOOST_CHECK(reader.getPrecision() == precision);
+      BOOST_CHECK(reader.containsTargets());
+      BOOST_CHECK_EQUAL(reader.getNumberInstances(), 101);
+      BOOST_CHECK_EQUAL(reader.getDimension(), 5);
+      checkEqual(reader.readAll(), dataset, range(101));
+
+      // random access in arbitrary order
+      const std::vector<size_t> instances = {100, 3, 57, 3, 0};
+      Dataset subset(instances.size(), 5);
+      reader.readInstances(instances, subset);
+      checkEqual(subset, dataset, instances);
+
+      BOOST_CHECK_THROW(reader.readInstances(100, 2, subset), sgpp::base::data_exception);
+    }
+  }
+
+  // batches appended one by one
+  {
+    BinaryDatasetWriter writer(fileName, 101, 5, false, BinaryDatasetLayout::COLUMN_MAJOR);
+    std::vector<size_t> sizes = {40, 60, 1};
+    size_t offset = 0;
+
+    for (size_t size : sizes) {
+      Dataset batch(size, 5);
+
+      for (size_t i = 0; i < size; i++) {
+        sgpp::base::DataVector row(5);
+        dataset.getData().getRow(offset + i, row);
+        batch.getData().setRow(i, row);
+      }
+
+      writer.append(batch);
+      offset += size;
+    }
+
+    writer.close();
+  }
+
+  BinaryDatasetReader reader(fileName);
+  BOOST_CHECK(!reader.containsTargets());
+  checkEqual(reader.readAll(), dataset, range(101), false);
+
+  // too many samples
+  {
+    BinaryDatasetWriter writer(fileName, 1, 5);
+    BOOST_CHECK_THROW(writer.append(dataset), sgpp::base::file_exception);
+  }
+
+  std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(testSelection) {
+  const Dataset dataset = createDataset(30, 4);
+  BinaryDatasetWriter::write(dataset, fileName, true, BinaryDatasetLayout::COLUMN_MAJOR);
+
+  // dimensions 3 and 1 of the samples with target 1, at most 5 samples
+  BinaryDatasetReader reader(fileName, 5, std::vector<size_t>{3, 1}, std::vector<double>{1.0});
+  BOOST_REQUIRE_EQUAL(reader.getNumberInstances(), 5);
+  BOOST_REQUIRE_EQUAL(reader.getDimension(), 2);
+
+  const Dataset selected = reader.readAll();
+
+  for (size_t i = 0; i < 5; i++) {
+    BOOST_CHECK_EQUAL(selected.getData().get(i, 0), dataset.getData().get(3 * i, 3));
+    BOOST_CHECK_EQUAL(selected.getData().get(i, 1), dataset.getData().get(3 * i, 1));
+    BOOST_CHECK_EQUAL(selected.getTargets()[i], 1.0);
+  }
+
+  BOOST_CHECK_THROW(BinaryDatasetReader(fileName, -1, std::vector<size_t>{4}),
+                    sgpp::base::file_exception);
+  std::remove(fileName);
+
+  // invalid files
+  {
+    std::ofstream file(fileName);
+    file << "x1,x2,class\n1,2,3\n";
+  }
+
+  BOOST_CHECK_THROW(BinaryDatasetReader{fileName}, sgpp::base::file_exception);
+  std::remove(fileName);
+  BOOST_CHECK_THROW(BinaryDatasetReader{fileName}, sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testConvert) {
+  const std::string csvFileName = "datadriven/datasets/dataread/simple.csv";
+  const Dataset expected = sgpp::datadriven::CSVTools::readCSVFromFile(csvFileName, true, true);
+  sgpp::datadriven::TextDataReader textReader(
+      csvFileName, sgpp::datadriven::TextDataFormat::CSV, true, true);
+
+  // tiny batches to test the batch-wise conversion
+  BinaryDatasetWriter::convert(textReader, fileName, BinaryDatasetLayout::ROW_MAJOR,
+                               BinaryDatasetPrecision::DOUBLE, 2);
+  BinaryDatasetReader reader(fileName);
+  checkEqual(reader.readAll(), expected, range(expected.getNumberInstances()));
+  std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(testSampleProvider) {
+  const size_t numberInstances = 1000;
+  const Dataset dataset = createDataset(numberInstances, 3);
+  BinaryDatasetWriter::write(dataset, fileName);
+
+  BOOST_CHECK(sgpp::datadriven::DataSourceFileTypeParser::parse("binary") ==
+              sgpp::datadriven::DataSourceFileType::BINARY);
+  BOOST_CHECK(sgpp::datadriven::DataSourceFileTypeParser::parse("BIN") ==
+              sgpp::datadriven::DataSourceFileType::BINARY);
+
+  sgpp::datadriven::DataShufflingFunctorRandom shuffling(42);
+  sgpp::datadriven::DataShufflingFunctorRandom reference(42);
+  BinaryFileSampleProvider sampleProvider(&shuffling);
+  sampleProvider.readFile(fileName, true);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), numberInstances);
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), 3);
+
+  size_t offset = 0;
+
+  while (offset < numberInstances) {
+    std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(300));
+    std::vector<size_t> instances(batch->getNumberInstances());
+
+    for (size_t i = 0; i < instances.size(); i++) {
+      instances[i] = reference(offset + i, numberInstances);
+    }
+
+    checkEqual(*batch, dataset, instances);
+    offset += instances.size();
+  }
+
+  BOOST_CHECK_EQUAL(offset, numberInstances);
+
+  // the same file read from memory
+  std::ifstream file(fileName, std::ios::binary);
+  std::ostringstream content;
+  content << file.rdbuf();
+
+  BinaryFileSampleProvider stringProvider;
+  stringProvider.readString(content.str(), true);
+  std::unique_ptr<Dataset> all(stringProvider.getAllSamples());
+  checkEqual(*all, dataset, range(numberInstances));
+
+  // targets requested, but not contained in the file
+  BinaryDatasetWriter::write(dataset, fileName, false);
+  BOOST_CHECK_THROW(sampleProvider.readFile(fileName, true), sgpp::base::data_exception);
+  std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
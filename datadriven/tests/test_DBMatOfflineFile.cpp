@@ -0,0 +1,210 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::datadriven::DBMatDatabase;
+using sgpp::datadriven::DBMatOffline;
+using sgpp::datadriven::DBMatOfflineFile;
+using sgpp::datadriven::MatrixDecompositionType;
+
+namespace {
+
+const char* const fileName = "test_DBMatOfflineFile.dbmat";
+
+/**
+ * Builds and decomposes a DenseIChol offline object (does not require GSL).
+ */
+DBMatOffline* createOfflineObject(sgpp::base::Grid& grid) {
+  sgpp::base::GeneralGridConfiguration gridConfig;
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.01;
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = MatrixDecompositionType::DenseIchol;
+
+  DBMatOffline* offline = sgpp::datadriven::DBMatOfflineFactory::buildOfflineObject(
+      gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig);
+  offline->interactions = {{0}, {1}, {0, 1}};
+  offline->buildMatrix(&grid, regularizationConfig);
+  offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+  return offline;
+}
+
+void checkEqual(DataMatrix& actual, DataMatrix& expected) {
+  BOOST_REQUIRE_EQUAL(actual.getNrows(), expected.getNrows());
+  BOOST_REQUIRE_EQUAL(actual.getNcols(), expected.getNcols());
+
+  for (size_t i = 0; i < expected.getSize(); i++) {
+    BOOST_CHECK_EQUAL(actual[i], expected[i]);
+  }
+}
+
+void flipByte(size_t position) {
+  std::fstream file(fileName, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekg(position);
+  char c = static_cast<char>(file.get());
+  file.seekp(position);
+  file.put(static_cast<char>(c ^ 0x10));
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestDBMatOfflineFile)
+
+BOOST_AUTO_TEST_CASE(testRoundTrip) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  std::unique_ptr<DBMatOffline> offline(createOfflineObject(*grid));
+  offline->store(fileName, grid.get(), "lambda=0.01");
+
+  BOOST_CHECK(DBMatOfflineFile::isBinaryFile(fileName));
+
+  DBMatOfflineFile file(fileName);
+  BOOST_CHECK(file.getDecompositionType() == MatrixDecompositionType::DenseIchol);
+  BOOST_REQUIRE_EQUAL(file.getNumberOfMatrices(), 1);
+  BOOST_CHECK_EQUAL(file.getConfiguration(), "lambda=0.01");
+  BOOST_CHECK(file.getInteractions() == offline->interactions);
+  BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(file.getMatrixData(0)) %
+                        DBMatOfflineFile::ALIGNMENT, 0);
+
+  std::unique_ptr<sgpp::base::Grid> loadedGrid(file.readGrid());
+  BOOST_REQUIRE(loadedGrid != nullptr);
+  BOOST_CHECK_EQUAL(loadedGrid->getSize(), grid->getSize());
+
+  std::unique_ptr<DBMatOffline> loaded(
+      sgpp::datadriven::DBMatOfflineFactory::buildFromFile(fileName));
+  BOOST_CHECK(loaded->getDecompositionType() == MatrixDecompositionType::DenseIchol);
+  BOOST_CHECK(loaded->interactions == offline->interactions);
+  checkEqual(loaded->getDecomposedMatrix(), offline->getDecomposedMatrix());
+
+  std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(testMultipleMatrices) {
+  DataMatrix first(3, 5);
+  DataMatrix empty(0, 0);
+  DataMatrix second(7, 1);
+
+  for (size_t i = 0; i < first.getSize(); i++) {
+    first[i] = 0.5 * static_cast<double>(i);
+  }
+
+  for (size_t i = 0; i < second.getSize(); i++) {
+    second[i] = -static_cast<double>(i);
+  }
+
+  DBMatOfflineFile::write(fileName, MatrixDecompositionType::OrthoAdapt,
+                          {&first, &empty, &second}, {});
+  DBMatOfflineFile file(fileName);
+  BOOST_REQUIRE_EQUAL(file.getNumberOfMatrices(), 3);
+  BOOST_CHECK(!file.containsGrid());
+  BOOST_CHECK(file.readGrid() == nullptr);
+  BOOST_CHECK(file.getInteractions().empty());
+  BOOST_CHECK_EQUAL(file.getMatrixRows(1), 0);
+  BOOST_CHECK_THROW(file.getMatrixRows(3), sgpp::base::file_exception);
+
+  DataMatrix matrix;
+  file.readMatrix(0, matrix);
+  checkEqual(matrix, first);
+  file.readMatrix(2, matrix);
+  checkEqual(matrix, second);
+
+  std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(testCorruptedFiles) {
+  DataMatrix matrix(10, 10, 1.0);
+  DBMatOfflineFile::write(fileName, MatrixDecompositionType::Chol, {&matrix}, {{0, 1}});
+  const size_t fileSize = DBMatOfflineFile(fileName).getFileSize();
+
+  // damaged matrix value
+  flipByte(fileSize - 3);
+  BOOST_CHECK_THROW(DBMatOfflineFile{fileName}, sgpp::base::file_exception);
+  BOOST_CHECK_NO_THROW(DBMatOfflineFile(fileName, false));
+  flipByte(fileSize - 3);
+  BOOST_CHECK_NO_THROW(DBMatOfflineFile{fileName});
+
+  // truncated file
+  {
+    std::ifstream input(fileName, std::ios::binary);
+    std::vector<char> content(fileSize);
+    input.read(content.data(), fileSize);
+    input.close();
+    std::ofstream output(fileName, std::ios::binary);
+    output.write(content.data(), fileSize - 8);
+  }
+
+  BOOST_CHECK_THROW(DBMatOfflineFile{fileName}, sgpp::base::file_exception);
+
+  // legacy text format
+  {
+    std::ofstream output(fileName);
+    output << "10,10,3,0\n";
+  }
+
+  BOOST_CHECK(!DBMatOfflineFile::isBinaryFile(fileName));
+  BOOST_CHECK_THROW(DBMatOfflineFile{fileName}, sgpp::base::file_exception);
+
+  std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(testCache) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(2);
+  std::unique_ptr<DBMatOffline> offline(createOfflineObject(*grid));
+  offline->store(fileName);
+  const size_t fileSize = DBMatOfflineFile(fileName).getFileSize();
+
+  DBMatDatabase::clearCache();
+  std::unique_ptr<DBMatOffline> first(DBMatDatabase::loadOfflineObject(fileName));
+  BOOST_CHECK_EQUAL(DBMatDatabase::getCacheSize(), fileSize);
+
+  // the cached object is copied, modifying the copy does not affect later loads
+  first->getDecomposedMatrix().setAll(0.0);
+  std::unique_ptr<DBMatOffline> second(DBMatDatabase::loadOfflineObject(fileName));
+  checkEqual(second->getDecomposedMatrix(), offline->getDecomposedMatrix());
+
+  // a changed file is loaded again
+  grid.reset(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  offline.reset(createOfflineObject(*grid));
+  offline->store(fileName);
+  std::unique_ptr<DBMatOffline> third(DBMatDatabase::loadOfflineObject(fileName));
+  checkEqual(third->getDecomposedMatrix(), offline->getDecomposedMatrix());
+  BOOST_CHECK_EQUAL(DBMatDatabase::getCacheSize(), DBMatOfflineFile(fileName).getFileSize());
+
+  // files larger than the capacity are not cached
+  DBMatDatabase::setCacheCapacity(fileSize);
+  BOOST_CHECK_EQUAL(DBMatDatabase::getCacheSize(), 0);
+  std::unique_ptr<DBMatOffline> fourth(DBMatDatabase::loadOfflineObject(fileName));
+  BOOST_CHECK_EQUAL(DBMatDatabase::getCacheSize(), 0);
+
+  DBMatDatabase::setCacheCapacity(size_t(2) << 30);
+  DBMatDatabase::clearCache();
+  std::remove(fileName);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
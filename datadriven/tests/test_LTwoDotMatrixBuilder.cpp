@@ -0,0 +1,138 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/datadriven/algorithm/LTwoDotMatrixBuilder.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::LTwoDotMatrixBuilder;
+
+namespace {
+
+/**
+ * Compares dense, packed and sparse results of the builder with the explicit operation of the
+ * pde module.
+ */
+void checkBuilder(Grid& grid) {
+  const size_t size = grid.getSize();
+  DataMatrix expected(size, size);
+  std::unique_ptr<sgpp::base::OperationMatrix> op(
+      sgpp::op_factory::createOperationLTwoDotExplicit(&expected, grid));
+
+  LTwoDotMatrixBuilder builder(grid);
+
+  DataMatrix dense;
+  builder.buildDense(dense);
+  BOOST_REQUIRE_EQUAL(dense.getNrows(), size);
+  BOOST_REQUIRE_EQUAL(dense.getNcols(), size);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      BOOST_CHECK_SMALL(dense.get(i, j) - expected.get(i, j), 1e-14);
+    }
+  }
+
+  std::vector<double> packed;
+  builder.buildPacked(packed);
+  BOOST_REQUIRE_EQUAL(packed.size(), size * (size + 1) / 2);
+  size_t position = 0;
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = i; j < size; j++) {
+      BOOST_CHECK_EQUAL(packed[position++], dense.get(i, j));
+    }
+  }
+
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columns;
+  std::vector<double> values;
+  builder.buildSparse(rowPointers, columns, values);
+  BOOST_REQUIRE_EQUAL(rowPointers.size(), size + 1);
+  DataMatrix fromSparse(size, size, 0.0);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+      BOOST_CHECK(columns[k] >= i);
+      BOOST_CHECK((k == rowPointers[i]) || (columns[k - 1] < columns[k]));
+      fromSparse.set(i, columns[k], values[k]);
+    }
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = i; j < size; j++) {
+      BOOST_CHECK_EQUAL(fromSparse.get(i, j), dense.get(i, j));
+    }
+  }
+}
+
+void refine(Grid& grid, size_t refinements) {
+  for (size_t r = 0; r < refinements; r++) {
+    DataVector alpha(grid.getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = static_cast<double>((7 * i) % 5);
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 3);
+    grid.getGenerator().refine(functor);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestLTwoDotMatrixBuilder)
+
+BOOST_AUTO_TEST_CASE(testRegularGrids) {
+  for (size_t dim = 1; dim <= 3; dim++) {
+    std::unique_ptr<Grid> linear(Grid::createLinearGrid(dim));
+    linear->getGenerator().regular(5 - dim);
+    checkBuilder(*linear);
+
+    std::unique_ptr<Grid> modLinear(Grid::createModLinearGrid(dim));
+    modLinear->getGenerator().regular(5 - dim);
+    checkBuilder(*modLinear);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testAdaptiveGrids) {
+  std::unique_ptr<Grid> linear(Grid::createLinearGrid(3));
+  linear->getGenerator().regular(2);
+  refine(*linear, 3);
+  checkBuilder(*linear);
+
+  std::unique_ptr<Grid> modLinear(Grid::createModLinearGrid(2));
+  modLinear->getGenerator().regular(2);
+  refine(*modLinear, 3);
+  checkBuilder(*modLinear);
+}
+
+BOOST_AUTO_TEST_CASE(testIncompleteGrid) {
+  // a grid point without its hierarchical ancestors
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(2);
+  sgpp::base::GridPoint point(2);
+  point.set(0, 4, 5);
+  point.set(1, 3, 1);
+  grid->getStorage().insert(point);
+  checkBuilder(*grid);
+
+  std::unique_ptr<Grid> bspline(Grid::createBsplineGrid(2, 3));
+  BOOST_CHECK(!LTwoDotMatrixBuilder::isSupported(*bspline));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef __AVX__
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::OperationMultipleEvalConfiguration;
+using sgpp::datadriven::OperationMultipleEvalSubType;
+using sgpp::datadriven::OperationMultipleEvalType;
+
+namespace {
+
+/**
+ * Compares multBlock() and multTransposeBlock() to mult() and multTranspose() applied to
+ * each column. The number of data points is not a multiple of the chunk sizes of the
+ * vectorized operations, so that their padding is tested, too.
+ */
+void compareToColumnwise(OperationMultipleEvalConfiguration configuration) {
+  const size_t dim = 3;
+  const size_t numData = 1001;
+  const size_t numColumns = 4;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  DataMatrix dataset(numData, dim);
+
+  for (size_t i = 0; i < numData; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      dataset(i, t) = distribution(generator);
+    }
+  }
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  const size_t gridSize = grid->getSize();
+
+  // the last column is zero
+  DataMatrix alpha(gridSize, numColumns, 0.0);
+  DataMatrix source(numData, numColumns, 0.0);
+
+  for (size_t j = 0; j + 1 < numColumns; j++) {
+    for (size_t i = 0; i < gridSize; i++) {
+      alpha(i, j) = distribution(generator) - 0.5;
+    }
+
+    for (size_t i = 0; i < numData; i++) {
+      source(i, j) = distribution(generator) - 0.5;
+    }
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+
+  DataMatrix result;
+  DataMatrix resultTranspose;
+  op->multBlock(alpha, result);
+  op->multTransposeBlock(source, resultTranspose);
+
+  BOOST_CHECK_EQUAL(result.getNrows(), numData);
+  BOOST_CHECK_EQUAL(result.getNcols(), numColumns);
+  BOOST_CHECK_EQUAL(resultTranspose.getNrows(), gridSize);
+  BOOST_CHECK_EQUAL(resultTranspose.getNcols(), numColumns);
+
+  for (size_t j = 0; j < numColumns; j++) {
+    DataVector alphaColumn(gridSize);
+    DataVector sourceColumn(numData);
+    DataVector resultColumn(numData);
+    DataVector resultTransposeColumn(gridSize);
+
+    alpha.getColumn(j, alphaColumn);
+    source.getColumn(j, sourceColumn);
+    op->mult(alphaColumn, resultColumn);
+    op->multTranspose(sourceColumn, resultTransposeColumn);
+
+    for (size_t i = 0; i < numData; i++) {
+      BOOST_CHECK_SMALL(result(i, j) - resultColumn[i], 1e-12);
+    }
+
+    for (size_t i = 0; i < gridSize; i++) {
+      BOOST_CHECK_SMALL(resultTranspose(i, j) - resultTransposeColumn[i], 1e-12);
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestOperationMultipleEvalBlock)
+
+BOOST_AUTO_TEST_CASE(testDefault) {
+  compareToColumnwise(OperationMultipleEvalConfiguration(OperationMultipleEvalType::DEFAULT,
+                                                         OperationMultipleEvalSubType::DEFAULT));
+}
+
+BOOST_AUTO_TEST_CASE(testStreaming) {
+  compareToColumnwise(OperationMultipleEvalConfiguration(OperationMultipleEvalType::STREAMING,
+                                                         OperationMultipleEvalSubType::DEFAULT));
+}
+
+BOOST_AUTO_TEST_CASE(testSubspaceCombined) {
+  compareToColumnwise(OperationMultipleEvalConfiguration(
+      OperationMultipleEvalType::SUBSPACELINEAR, OperationMultipleEvalSubType::COMBINED));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,191 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/TextDataReader.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::CSVFileSampleProvider;
+using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::TextDataFormat;
+using sgpp::datadriven::TextDataReader;
+
+namespace {
+
+double parse(const std::string& str) {
+  const char* pos = str.data();
+  return TextDataReader::parseDouble(pos, str.data() + str.size());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestTextDataReader)
+
+BOOST_AUTO_TEST_CASE(testParseDouble) {
+  const char* numbers[] = {"0",       "-0.0",     "42",         "+3.25",
+                           "1e3",     "-7E-01",   "7e+00",      ".5",
+                           "5.",      "0.1",      "0.3",        "123456.789e-2",
+                           "1e22",    "1e23",     "2.2250738585072014e-308",
+                           "4.9e-324", "1.7976931348623157e308", "3.141592653589793238462643",
+                           "0.000000000000000000000000000123456789012345678901234567890"};
+
+  for (const char* number : numbers) {
+    // must be exact for at most 19 significant digits and small exponents
+    BOOST_CHECK_CLOSE_FRACTION(parse(number), std::strtod(number, nullptr), 1e-15);
+  }
+
+  BOOST_CHECK_EQUAL(parse("0.1"), 0.1);
+  BOOST_CHECK_EQUAL(parse("-7e-01"), -0.7);
+  BOOST_CHECK_EQUAL(parse("  8.0"), 8.0);
+  BOOST_CHECK(std::isnan(parse("NaN")));
+  BOOST_CHECK(std::isinf(parse("-inf")));
+  BOOST_CHECK(std::isinf(parse("1e400")));
+  BOOST_CHECK_EQUAL(parse("1e-400"), 0.0);
+  BOOST_CHECK_EQUAL(parse("?"), 0.0);
+  BOOST_CHECK_EQUAL(parse(""), 0.0);
+
+  // random numbers printed with 17 significant digits must round-trip exactly
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e3, 1e3);
+
+  for (size_t i = 0; i < 10000; i++) {
+    const double value = distribution(generator);
+    std::ostringstream str;
+    str.precision(17);
+    str << value;
+    BOOST_CHECK_EQUAL(parse(str.str()), value);
+  }
+
+  // the position is advanced to the first character after the number
+  const std::string line = "1.5e2,x";
+  const char* pos = line.data();
+  TextDataReader::parseDouble(pos, line.data() + line.size());
+  BOOST_CHECK_EQUAL(*pos, ',');
+}
+
+BOOST_AUTO_TEST_CASE(testReadFile) {
+  const std::string fileName = "datadriven/datasets/dataread/simple.csv";
+  Dataset expected = CSVTools::readCSVFromFile(fileName, true, true);
+
+  // compare with the stream-based reader
+  std::ifstream stream(fileName);
+  Dataset reference = CSVTools::readCSV(stream, true, true);
+
+  BOOST_REQUIRE_EQUAL(expected.getNumberInstances(), reference.getNumberInstances());
+  BOOST_REQUIRE_EQUAL(expected.getDimension(), reference.getDimension());
+
+  for (size_t i = 0; i < reference.getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(expected.getTargets()[i], reference.getTargets()[i]);
+
+    for (size_t d = 0; d < reference.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(expected.getData().get(i, d), reference.getData().get(i, d));
+    }
+  }
+
+  // parse a permuted subset
+  TextDataReader reader(fileName, TextDataFormat::CSV, true, true);
+  std::vector<size_t> instances = {4, 0, 2};
+  Dataset subset(instances.size(), reader.getDimension());
+  reader.readInstances(instances, subset);
+
+  for (size_t i = 0; i < instances.size(); i++) {
+    BOOST_CHECK_EQUAL(subset.getTargets()[i], reference.getTargets()[instances[i]]);
+
+    for (size_t d = 0; d < reference.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(subset.getData().get(i, d), reference.getData().get(instances[i], d));
+    }
+  }
+
+  BOOST_CHECK_THROW(reader.readInstances(3, 3, subset), sgpp::base::data_exception);
+  BOOST_CHECK_THROW(TextDataReader("datadriven/datasets/dataread/doesNotExist.csv",
+                                   TextDataFormat::CSV, true, true),
+                    sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testSampleProviderFromString) {
+  std::ostringstream csv;
+  csv << "x0,x1,class\r\n";
+  const size_t numberInstances = 2500;
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    csv << 0.5 * static_cast<double>(i) << ", " << -static_cast<double>(i) << ","
+        << ((i % 2 == 0) ? "1" : "-1") << "\r\n";
+  }
+
+  CSVFileSampleProvider sampleProvider;
+  sampleProvider.readString(csv.str(), true);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), numberInstances);
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), 2);
+
+  size_t offset = 0;
+
+  while (offset < numberInstances) {
+    std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(1024));
+    BOOST_REQUIRE(batch->getNumberInstances() > 0);
+
+    for (size_t i = 0; i < batch->getNumberInstances(); i++) {
+      const size_t instance = offset + i;
+      BOOST_CHECK_EQUAL(batch->getData().get(i, 0), 0.5 * static_cast<double>(instance));
+      BOOST_CHECK_EQUAL(batch->getData().get(i, 1), -static_cast<double>(instance));
+      BOOST_CHECK_EQUAL(batch->getTargets()[i], (instance % 2 == 0) ? 1.0 : -1.0);
+    }
+
+    offset += batch->getNumberInstances();
+  }
+
+  BOOST_CHECK_EQUAL(offset, numberInstances);
+
+  // only the class 1 with cutoff
+  std::unique_ptr<TextDataReader> reader = TextDataReader::fromString(
+      csv.str(), TextDataFormat::CSV, true, true, 10, std::vector<size_t>{1},
+      std::vector<double>{1.0});
+  Dataset dataset = reader->readAll();
+  BOOST_REQUIRE_EQUAL(dataset.getNumberInstances(), 10);
+  BOOST_REQUIRE_EQUAL(dataset.getDimension(), 1);
+
+  for (size_t i = 0; i < 10; i++) {
+    BOOST_CHECK_EQUAL(dataset.getData().get(i, 0), -static_cast<double>(2 * i));
+    BOOST_CHECK_EQUAL(dataset.getTargets()[i], 1.0);
+  }
+
+  // repeated and reordered columns (as with ARFFTools)
+  reader = TextDataReader::fromString("1,2,3,1\n4,5,6,-1\n", TextDataFormat::CSV, false, true,
+                                      -1, std::vector<size_t>{2, 0, 2});
+  dataset = reader->readAll();
+  BOOST_REQUIRE_EQUAL(dataset.getNumberInstances(), 2);
+  BOOST_REQUIRE_EQUAL(dataset.getDimension(), 3);
+  BOOST_CHECK_EQUAL(dataset.getData().get(0, 0), 3.0);
+  BOOST_CHECK_EQUAL(dataset.getData().get(0, 1), 1.0);
+  BOOST_CHECK_EQUAL(dataset.getData().get(0, 2), 3.0);
+  BOOST_CHECK_EQUAL(dataset.getData().get(1, 0), 6.0);
+  BOOST_CHECK_EQUAL(dataset.getData().get(1, 1), 4.0);
+  BOOST_CHECK_EQUAL(dataset.getData().get(1, 2), 6.0);
+  BOOST_CHECK_EQUAL(dataset.getTargets()[1], -1.0);
+
+  // inconsistent number of columns
+  BOOST_CHECK_THROW(TextDataReader::fromString("1,2,3\n4,5\n", TextDataFormat::CSV, false, true),
+                    sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
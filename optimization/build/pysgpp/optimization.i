@@ -52,6 +52,7 @@ const bool UMFPACK_ENABLED;
 %rename(OptInterpolantScalarFunction)           sgpp::optimization::InterpolantScalarFunction;
 %rename(OptInterpolantScalarFunctionGradient)   sgpp::optimization::InterpolantScalarFunctionGradient;
 %rename(OptInterpolantScalarFunctionHessian)    sgpp::optimization::InterpolantScalarFunctionHessian;
+%rename(OptCachedScalarFunction)                sgpp::optimization::CachedScalarFunction;
 %rename(OptComponentScalarFunction)             sgpp::optimization::ComponentScalarFunction;
 %rename(OptComponentScalarFunctionGradient)     sgpp::optimization::ComponentScalarFunctionGradient;
 %rename(OptComponentScalarFunctionHessian)      sgpp::optimization::ComponentScalarFunctionHessian;
@@ -62,6 +63,7 @@ const bool UMFPACK_ENABLED;
 %rename(OptVectorFunction)                      sgpp::optimization::VectorFunction;
 %rename(OptVectorFunctionGradient)              sgpp::optimization::VectorFunctionGradient;
 %rename(OptVectorFunctionHessian)               sgpp::optimization::VectorFunctionHessian;
+%rename(OptCachedVectorFunction)                sgpp::optimization::CachedVectorFunction;
 %rename(OptEmptyVectorFunction)                 sgpp::optimization::EmptyVectorFunction;
 %rename(OptEmptyVectorFunctionGradient)         sgpp::optimization::EmptyVectorFunctionGradient;
 %rename(OptInterpolantVectorFunction)           sgpp::optimization::InterpolantVectorFunction;
@@ -228,6 +230,9 @@ const bool UMFPACK_ENABLED;
 %rename(OptMutexType)                       sgpp::optimization::MutexType;
 %rename(OptPrinter)                         sgpp::optimization::Printer;
 
+// futures are not wrapped
+%ignore sgpp::optimization::ScalarFunction::evalBatchAsync;
+
 // classes with director interface
 %feature("director") sgpp::optimization::ConstraintFunction;
 %feature("director") sgpp::optimization::ConstraintGradient;
@@ -344,6 +349,8 @@ const bool UMFPACK_ENABLED;
 %include "optimization/src/sgpp/optimization/function/vector/WrapperVectorFunctionHessian.hpp"
 %include "optimization/src/sgpp/optimization/function/vector/EmptyVectorFunction.hpp"
 %include "optimization/src/sgpp/optimization/function/vector/EmptyVectorFunctionGradient.hpp"
+%include "optimization/src/sgpp/optimization/function/scalar/CachedScalarFunction.hpp"
+%include "optimization/src/sgpp/optimization/function/vector/CachedVectorFunction.hpp"
 
 %include "optimization/src/sgpp/optimization/gridgen/HashRefinementMultiple.hpp"
 %include "optimization/src/sgpp/optimization/gridgen/IterativeGridGenerator.hpp"
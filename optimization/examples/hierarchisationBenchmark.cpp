@@ -0,0 +1,92 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_hierarchisationBenchmark_cpp hierarchisationBenchmark.cpp
+ * This example compares the hierarchisation of function values on a regular sparse grid with
+ * modified B-splines by
+ * - solving the assembled linear system (HierarchisationSLE and sle_solver::Auto) and
+ * - the matrix-free unidirectional principle (UnidirectionalHierarchisation).
+ *
+ * Usage: hierarchisationBenchmark [dimension] [level] [degree]
+ */
+#include <sgpp_base.hpp>
+#include <sgpp_optimization.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+double f(const sgpp::base::DataVector& x) {
+  double result = 1.0;
+
+  for (size_t t = 0; t < x.getSize(); t++) {
+    result *= std::sin(2.0 * x[t] + 0.3 * static_cast<double>(t)) + x[t] * x[t];
+  }
+
+  return result;
+}
+
+double secondsSince(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+  const size_t d = (argc > 1) ? std::atoi(argv[1]) : 3;
+  const size_t n = (argc > 2) ? std::atoi(argv[2]) : 5;
+  const size_t p = (argc > 3) ? std::atoi(argv[3]) : 3;
+
+  sgpp::optimization::Printer::getInstance().setVerbosity(-1);
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModBsplineGrid(d, p));
+  grid->getGenerator().regular(n);
+
+  sgpp::base::GridStorage& gridStorage = grid->getStorage();
+  const size_t N = gridStorage.getSize();
+  sgpp::base::DataVector functionValues(N);
+  sgpp::base::DataVector x(d);
+
+  for (size_t j = 0; j < N; j++) {
+    gridStorage.getCoordinates(gridStorage[j], x);
+    functionValues[j] = f(x);
+  }
+
+  std::cout << d << " dimensions, level " << n << ", degree " << p << ", " << N
+            << " grid points\n";
+
+  // assembled system
+  auto start = std::chrono::steady_clock::now();
+  sgpp::optimization::HierarchisationSLE system(*grid);
+  sgpp::optimization::sle_solver::Auto solver;
+  sgpp::base::DataVector b(functionValues);
+  sgpp::base::DataVector alphaAssembled(N);
+  solver.solve(system, b, alphaAssembled);
+  std::cout << "assembled system:          " << secondsSince(start) << " s\n";
+
+  // unidirectional principle
+  start = std::chrono::steady_clock::now();
+  sgpp::optimization::UnidirectionalHierarchisation op(*grid);
+  sgpp::base::DataVector alpha(functionValues);
+  op.doHierarchisation(alpha);
+  std::cout << "unidirectional principle:  " << secondsSince(start) << " s\n";
+
+  // dehierarchisation as check
+  sgpp::base::DataVector values(alpha);
+  op.doDehierarchisation(values);
+  double maxResidual = 0.0;
+  double maxDifference = 0.0;
+
+  for (size_t j = 0; j < N; j++) {
+    maxResidual = std::max(maxResidual, std::abs(values[j] - functionValues[j]));
+    maxDifference = std::max(maxDifference, std::abs(alpha[j] - alphaAssembled[j]));
+  }
+
+  std::cout << "max. residual: " << maxResidual << ", max. difference of coefficients: "
+            << maxDifference << "\n";
+
+  return 0;
+}
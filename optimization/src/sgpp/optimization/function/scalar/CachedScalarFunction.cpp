@@ -0,0 +1,90 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/optimization/function/scalar/CachedScalarFunction.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+CachedScalarFunction::CachedScalarFunction(const ScalarFunction& f, const std::string& filename)
+    : CachedScalarFunction(
+          f, std::make_shared<EvaluationCache>(f.getNumberOfParameters(), 1, filename)) {}
+
+CachedScalarFunction::CachedScalarFunction(const ScalarFunction& f,
+                                           std::shared_ptr<EvaluationCache> cache)
+    : ScalarFunction(f.getNumberOfParameters()), cache(cache), tmpValue(1) {
+  f.clone(this->f);
+  maxConcurrentEvaluations = f.getMaxConcurrentEvaluations();
+}
+
+double CachedScalarFunction::eval(const base::DataVector& x) {
+  if (cache->lookup(x, tmpValue)) {
+    return tmpValue[0];
+  }
+
+  tmpValue[0] = f->eval(x);
+  cache->insert(x, tmpValue);
+  return tmpValue[0];
+}
+
+void CachedScalarFunction::evalBatch(const base::DataMatrix& x, base::DataVector& fx) {
+  const size_t n = x.getNrows();
+  base::DataVector xi(d);
+  base::DataMatrix xMissing(0, d);
+  // rows of xMissing by point, to evaluate points occurring multiple times in x only once
+  std::unordered_map<std::string, size_t> missingRows;
+  // pairs of rows of x and xMissing
+  std::vector<std::pair<size_t, size_t>> missingIndices;
+
+  fx.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    x.getRow(i, xi);
+
+    if (cache->lookup(xi, tmpValue)) {
+      fx[i] = tmpValue[0];
+    } else {
+      const auto it =
+          missingRows.emplace(EvaluationCache::getKey(xi), xMissing.getNrows()).first;
+
+      if (it->second == xMissing.getNrows()) {
+        xMissing.appendRow(xi);
+      }
+
+      missingIndices.push_back(std::make_pair(i, it->second));
+    }
+  }
+
+  if (missingIndices.empty()) {
+    return;
+  }
+
+  base::DataVector fxMissing(xMissing.getNrows());
+  f->setMaxConcurrentEvaluations(maxConcurrentEvaluations);
+  f->evalBatch(xMissing, fxMissing);
+
+  for (size_t j = 0; j < xMissing.getNrows(); j++) {
+    xMissing.getRow(j, xi);
+    tmpValue[0] = fxMissing[j];
+    cache->insert(xi, tmpValue);
+  }
+
+  for (const std::pair<size_t, size_t>& indices : missingIndices) {
+    fx[indices.first] = fxMissing[indices.second];
+  }
+}
+
+void CachedScalarFunction::clone(std::unique_ptr<ScalarFunction>& clone) const {
+  clone = std::unique_ptr<ScalarFunction>(new CachedScalarFunction(*f, cache));
+  clone->setMaxConcurrentEvaluations(maxConcurrentEvaluations);
+}
+}  // namespace optimization
+}  // namespace sgpp
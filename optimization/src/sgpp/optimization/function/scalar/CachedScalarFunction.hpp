@@ -0,0 +1,92 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_FUNCTION_SCALAR_CACHEDSCALARFUNCTION_HPP
+#define SGPP_OPTIMIZATION_FUNCTION_SCALAR_CACHEDSCALARFUNCTION_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/optimization/function/scalar/ScalarFunction.hpp>
+#include <sgpp/optimization/tools/EvaluationCache.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Scalar-valued function that memoizes the values of another function
+ * \f$f\f$, i.e., \f$f\f$ is evaluated at most once per point.
+ * The function values can additionally be stored in a file, such that
+ * they are reused if the function is constructed again with the same file
+ * (see EvaluationCache).
+ *
+ * Clones share the cache (but evaluate clones of \f$f\f$), so it is
+ * safe to use the function in parallel computations.
+ */
+class CachedScalarFunction : public ScalarFunction {
+ public:
+  /**
+   * Constructor.
+   * The initial value of getMaxConcurrentEvaluations() is taken from f.
+   *
+   * @param f         function to be cached (will be cloned)
+   * @param filename  file to store the function values in
+   *                  (empty string for no file, the default)
+   */
+  explicit CachedScalarFunction(const ScalarFunction& f, const std::string& filename = "");
+
+  /**
+   * Destructor.
+   */
+  ~CachedScalarFunction() override {}
+
+  /**
+   * @param x     evaluation point \f$\vec{x} \in [0, 1]^d\f$
+   * @return      \f$f(\vec{x})\f$ (evaluated only if not cached)
+   */
+  double eval(const base::DataVector& x) override;
+
+  /**
+   * Only the points which are not cached are passed to the
+   * evalBatch() method of \f$f\f$ (each point once), which
+   * uses the getMaxConcurrentEvaluations() setting of this function.
+   *
+   * @param       x   evaluation points (one point per row)
+   * @param[out]  fx  function values at the rows of x
+   */
+  void evalBatch(const base::DataMatrix& x, base::DataVector& fx) override;
+
+  /**
+   * @return number of points in the cache
+   */
+  size_t getNumberOfCachedPoints() const { return cache->getSize(); }
+
+  /**
+   * @param[out] clone pointer to cloned object
+   */
+  void clone(std::unique_ptr<ScalarFunction>& clone) const override;
+
+ protected:
+  /// clone of the function to be cached
+  std::unique_ptr<ScalarFunction> f;
+  /// cache shared by all clones
+  std::shared_ptr<EvaluationCache> cache;
+  /// temporary vector for the cached value
+  base::DataVector tmpValue;
+
+  /**
+   * Constructor for clones.
+   *
+   * @param f     function to be cached (will be cloned)
+   * @param cache cache to be shared
+   */
+  CachedScalarFunction(const ScalarFunction& f, std::shared_ptr<EvaluationCache> cache);
+};
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_FUNCTION_SCALAR_CACHEDSCALARFUNCTION_HPP */
@@ -0,0 +1,74 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/optimization/function/scalar/ScalarFunction.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace optimization {
+
+void ScalarFunction::evalBatch(const base::DataMatrix& x, base::DataVector& fx) {
+  const size_t n = x.getNrows();
+  const int numThreads =
+      static_cast<int>(std::max(std::min(getNumberOfEvaluationThreads(), n), size_t(1)));
+
+  fx.resize(n);
+
+#pragma omp parallel num_threads(numThreads)
+  {
+    base::DataVector xi(d);
+    ScalarFunction* curFPtr = this;
+#ifdef _OPENMP
+    std::unique_ptr<ScalarFunction> curF;
+
+    if (omp_get_num_threads() > 1) {
+      clone(curF);
+      curFPtr = curF.get();
+    }
+
+#endif /* _OPENMP */
+
+#pragma omp for schedule(dynamic, 1)
+
+    for (size_t i = 0; i < n; i++) {
+      x.getRow(i, xi);
+      fx[i] = curFPtr->eval(xi);
+    }
+  }
+}
+
+std::future<base::DataVector> ScalarFunction::evalBatchAsync(const base::DataMatrix& x) {
+  // the new thread does not inherit the OpenMP settings of the calling thread
+  const size_t numThreads = getNumberOfEvaluationThreads();
+
+  return std::async(std::launch::async, [this, x, numThreads]() {
+#ifdef _OPENMP
+    omp_set_num_threads(static_cast<int>(numThreads));
+#endif /* _OPENMP */
+    base::DataVector fx(x.getNrows());
+    evalBatch(x, fx);
+    return fx;
+  });
+}
+
+size_t ScalarFunction::getNumberOfEvaluationThreads() const {
+  if (maxConcurrentEvaluations > 0) {
+    return maxConcurrentEvaluations;
+  }
+
+#ifdef _OPENMP
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif /* _OPENMP */
+}
+}  // namespace optimization
+}  // namespace sgpp
@@ -7,9 +7,11 @@
 #define SGPP_OPTIMIZATION_FUNCTION_SCALAR_SCALARFUNCTION_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <cstddef>
+#include <future>
 #include <memory>
 
 namespace sgpp {
@@ -27,7 +29,7 @@ class ScalarFunction {
    *
    * @param d     dimension of the domain
    */
-  explicit ScalarFunction(size_t d) : d(d) {}
+  explicit ScalarFunction(size_t d) : d(d), maxConcurrentEvaluations(0) {}
 
   /**
    * Destructor.
@@ -42,6 +44,57 @@ class ScalarFunction {
    */
   virtual double eval(const base::DataVector& x) = 0;
 
+  /**
+   * Evaluates the function at multiple points.
+   * The default implementation assigns the points one by one to at most
+   * getMaxConcurrentEvaluations() threads as soon as they become idle
+   * (the evaluation times may vary strongly), each thread evaluating a clone of
+   * the function.
+   * Functions that are able to evaluate whole batches on their own (e.g., by
+   * submitting them to a job scheduler) should override this method.
+   *
+   * @param       x   evaluation points (one point per row)
+   * @param[out]  fx  function values at the rows of x
+   */
+  virtual void evalBatch(const base::DataMatrix& x, base::DataVector& fx);
+
+  /**
+   * Starts the evaluation of the function at multiple points in the
+   * background. The default implementation calls evalBatch() in a new thread,
+   * i.e., the function must not be evaluated otherwise until the result
+   * is ready.
+   *
+   * @param x     evaluation points (one point per row)
+   * @return      future of the function values at the rows of x
+   */
+  virtual std::future<base::DataVector> evalBatchAsync(const base::DataMatrix& x);
+
+  /**
+   * @return maximal number of evaluations in progress at the same time
+   *         (zero means the maximal number of OpenMP threads)
+   */
+  size_t getMaxConcurrentEvaluations() const { return maxConcurrentEvaluations; }
+
+  /**
+   * Limits the number of evaluations in progress at the same time, for example
+   * if eval() is parallelized itself. The limit may also exceed the number of
+   * OpenMP threads if eval() waits for external resources most of the time.
+   *
+   * @param maxConcurrentEvaluations  maximal number of evaluations in progress
+   *                                  at the same time (zero means the maximal
+   *                                  number of OpenMP threads)
+   */
+  void setMaxConcurrentEvaluations(size_t maxConcurrentEvaluations) {
+    this->maxConcurrentEvaluations = maxConcurrentEvaluations;
+  }
+
+  /**
+   * @return number of threads that evaluate the function concurrently,
+   *         i.e., getMaxConcurrentEvaluations() if non-zero and
+   *         the maximal number of OpenMP threads otherwise
+   */
+  size_t getNumberOfEvaluationThreads() const;
+
   /**
    * @return dimension \f$d\f$ of the domain
    */
@@ -60,6 +113,8 @@ class ScalarFunction {
  protected:
   /// dimension of the domain
   size_t d;
+  /// maximal number of evaluations in progress at the same time
+  size_t maxConcurrentEvaluations;
 };
 }  // namespace optimization
 }  // namespace sgpp
@@ -0,0 +1,38 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/optimization/function/vector/CachedVectorFunction.hpp>
+
+#include <string>
+
+namespace sgpp {
+namespace optimization {
+
+CachedVectorFunction::CachedVectorFunction(const VectorFunction& g, const std::string& filename)
+    : CachedVectorFunction(g, std::make_shared<EvaluationCache>(g.getNumberOfParameters(),
+                                                                g.getNumberOfComponents(),
+                                                                filename)) {}
+
+CachedVectorFunction::CachedVectorFunction(const VectorFunction& g,
+                                           std::shared_ptr<EvaluationCache> cache)
+    : VectorFunction(g.getNumberOfParameters(), g.getNumberOfComponents()), cache(cache) {
+  g.clone(this->g);
+}
+
+void CachedVectorFunction::eval(const base::DataVector& x, base::DataVector& value) {
+  if (cache->lookup(x, value)) {
+    return;
+  }
+
+  g->eval(x, value);
+  cache->insert(x, value);
+}
+
+void CachedVectorFunction::clone(std::unique_ptr<VectorFunction>& clone) const {
+  clone = std::unique_ptr<VectorFunction>(new CachedVectorFunction(*g, cache));
+}
+}  // namespace optimization
+}  // namespace sgpp
@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_FUNCTION_VECTOR_CACHEDVECTORFUNCTION_HPP
+#define SGPP_OPTIMIZATION_FUNCTION_VECTOR_CACHEDVECTORFUNCTION_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/optimization/function/vector/VectorFunction.hpp>
+#include <sgpp/optimization/tools/EvaluationCache.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Vector-valued function that memoizes the values of another function
+ * \f$g\f$ (the vector-valued counterpart of CachedScalarFunction).
+ * Clones share the cache, which may be stored in a file
+ * (see EvaluationCache).
+ */
+class CachedVectorFunction : public VectorFunction {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param g         function to be cached (will be cloned)
+   * @param filename  file to store the function values in
+   *                  (empty string for no file, the default)
+   */
+  explicit CachedVectorFunction(const VectorFunction& g, const std::string& filename = "");
+
+  /**
+   * Destructor.
+   */
+  ~CachedVectorFunction() override {}
+
+  /**
+   * @param[in]  x      evaluation point \f$\vec{x} \in [0, 1]^d\f$
+   * @param[out] value  \f$g(\vec{x})\f$ (evaluated only if not cached)
+   */
+  void eval(const base::DataVector& x, base::DataVector& value) override;
+
+  /**
+   * @return number of points in the cache
+   */
+  size_t getNumberOfCachedPoints() const { return cache->getSize(); }
+
+  /**
+   * @param[out] clone pointer to cloned object
+   */
+  void clone(std::unique_ptr<VectorFunction>& clone) const override;
+
+ protected:
+  /// clone of the function to be cached
+  std::unique_ptr<VectorFunction> g;
+  /// cache shared by all clones
+  std::shared_ptr<EvaluationCache> cache;
+
+  /**
+   * Constructor for clones.
+   *
+   * @param g     function to be cached (will be cloned)
+   * @param cache cache to be shared
+   */
+  CachedVectorFunction(const VectorFunction& g, std::shared_ptr<EvaluationCache> cache);
+};
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_FUNCTION_VECTOR_CACHEDVECTORFUNCTION_HPP */
@@ -8,6 +8,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/optimization/function/scalar/ScalarFunction.hpp>
@@ -76,7 +77,7 @@ class IterativeGridGenerator {
   /**
    * Evaluates the objective function at grid points with indices
    * [oldGridSize, oldGridSize + 1, ..., grid.getSize() - 1]
-   * and saves values in functionValues.
+   * with ScalarFunction::evalBatch() and saves values in functionValues.
    *
    * @param oldGridSize   number of grid points already evaluated
    */
@@ -6,9 +6,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineBoundary.hpp>
-#include <sgpp/base/operation/hash/OperationEvalBsplineBoundaryNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
+#include <sgpp/optimization/operation/hash/UnidirectionalHierarchisation.hpp>
 
 namespace sgpp {
 namespace optimization {
@@ -22,54 +20,24 @@ OperationMultipleHierarchisationBsplineBoundary::
 
 bool OperationMultipleHierarchisationBsplineBoundary::doHierarchisation(
     base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  UnidirectionalHierarchisation op(grid);
+  return op.doHierarchisation(nodeValues);
 }
 
 void OperationMultipleHierarchisationBsplineBoundary::doDehierarchisation(base::DataVector& alpha) {
-  base::GridStorage& storage = grid.getStorage();
-  const size_t d = storage.getDimension();
-  base::OperationEvalBsplineBoundaryNaive opNaiveEval(storage, grid.getDegree());
-  base::DataVector nodeValues(storage.getSize());
-  base::DataVector x(d, 0.0);
-
-  for (size_t j = 0; j < storage.getSize(); j++) {
-    storage.getCoordinates(storage[j], x);
-    nodeValues[j] = opNaiveEval.eval(alpha, x);
-  }
-
-  alpha.resize(storage.getSize());
-  alpha = nodeValues;
+  UnidirectionalHierarchisation op(grid);
+  op.doDehierarchisation(alpha);
 }
 
 bool OperationMultipleHierarchisationBsplineBoundary::doHierarchisation(
     base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  UnidirectionalHierarchisation op(grid);
+  return op.doHierarchisation(nodeValues);
 }
 
 void OperationMultipleHierarchisationBsplineBoundary::doDehierarchisation(base::DataMatrix& alpha) {
-  base::GridStorage& storage = grid.getStorage();
-  const size_t d = storage.getDimension();
-  base::OperationEvalBsplineBoundaryNaive opNaiveEval(storage, grid.getDegree());
-  base::DataVector nodeValues(storage.getSize(), 0.0);
-  base::DataVector x(d, 0.0);
-  base::DataVector alpha1(storage.getSize(), 0.0);
-
-  for (size_t i = 0; i < alpha.getNcols(); i++) {
-    alpha.getColumn(i, alpha1);
-
-    for (size_t j = 0; j < storage.getSize(); j++) {
-      storage.getCoordinates(storage[j], x);
-      nodeValues[j] = opNaiveEval.eval(alpha1, x);
-    }
-
-    alpha.setColumn(i, nodeValues);
-  }
+  UnidirectionalHierarchisation op(grid);
+  op.doDehierarchisation(alpha);
 }
 }  // namespace optimization
 }  // namespace sgpp
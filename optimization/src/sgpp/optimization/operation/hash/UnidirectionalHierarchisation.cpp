@@ -0,0 +1,468 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/operation/hash/UnidirectionalHierarchisation.hpp>
+#include <sgpp/optimization/sle/solver/Auto.hpp>
+#include <sgpp/optimization/sle/solver/BiCGStab.hpp>
+#include <sgpp/optimization/tools/Printer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+namespace {
+
+/**
+ * Hierarchisation system whose matrix-vector product is computed matrix-free by
+ * UnidirectionalHierarchisation::multiply() (used by BiCGStab).
+ * If preconditioned is true, the system matrix is A * P instead of A, where P is the
+ * application of the UP (right preconditioning).
+ */
+class MatrixFreeHierarchisationSLE : public SLE {
+ public:
+  MatrixFreeHierarchisationSLE(UnidirectionalHierarchisation& op, bool preconditioned)
+      : SLE(), op(op), preconditioned(preconditioned) {}
+
+  bool isMatrixEntryNonZero(size_t i, size_t j) override {
+    return (preconditioned ? (getMatrixEntry(i, j) != 0.0)
+                           : op.getSystem().isMatrixEntryNonZero(i, j));
+  }
+
+  double getMatrixEntry(size_t i, size_t j) override {
+    if (!preconditioned) {
+      return op.getSystem().getMatrixEntry(i, j);
+    }
+
+    base::DataVector unitVector(getDimension(), 0.0);
+    base::DataVector column(getDimension());
+    unitVector[j] = 1.0;
+    matrixVectorMultiplication(unitVector, column);
+    return column[i];
+  }
+
+  void getMatrixRow(size_t i, std::vector<size_t>& columnIndices,
+                    std::vector<double>& entries) override {
+    if (preconditioned) {
+      SLE::getMatrixRow(i, columnIndices, entries);
+    } else {
+      op.getSystem().getMatrixRow(i, columnIndices, entries);
+    }
+  }
+
+  void matrixVectorMultiplication(const base::DataVector& x, base::DataVector& y) override {
+    base::DataMatrix X(x.getPointer(), x.getSize(), 1);
+    base::DataMatrix Y;
+
+    if (preconditioned) {
+      op.applyUnidirectionalPrinciple(X);
+    }
+
+    op.multiply(X, Y);
+    y.resize(x.getSize());
+    Y.getColumn(0, y);
+  }
+
+  size_t getDimension() const override { return op.getSystem().getDimension(); }
+
+ protected:
+  UnidirectionalHierarchisation& op;
+  bool preconditioned;
+};
+
+/**
+ * @return maximum norm of the matrix
+ */
+double maxAbs(const base::DataMatrix& A) {
+  double result = 0.0;
+
+  for (size_t i = 0; i < A.getSize(); i++) {
+    result = std::max(result, std::abs(A[i]));
+  }
+
+  return result;
+}
+
+}  // namespace
+
+UnidirectionalHierarchisation::UnidirectionalHierarchisation(base::Grid& grid)
+    : grid(grid),
+      dim(grid.getStorage().getDimension()),
+      numPoints(grid.getStorage().getSize()),
+      maxItCount(DEFAULT_MAX_IT_COUNT),
+      tolerance(DEFAULT_TOLERANCE),
+      system(grid),
+      matrix(system.getSparseMatrix()),
+      poles(dim),
+      hasSingularSystem(false) {
+  for (size_t t = 0; t < dim; t++) {
+    buildPoles(t);
+  }
+}
+
+void UnidirectionalHierarchisation::buildPoles(size_t t) {
+  const std::vector<uint32_t>& points1D = matrix.getPoints1D();
+  const std::vector<size_t>& basisStart = matrix.getBasisStart1D(t);
+  const std::vector<uint32_t>& basisIndices = matrix.getBasisIndices1D(t);
+  const std::vector<double>& basisValues = matrix.getBasisValues1D(t);
+  Poles& polesT = poles[t];
+  polesT.points.resize(numPoints);
+
+  for (size_t j = 0; j < numPoints; j++) {
+    polesT.points[j] = j;
+  }
+
+  // sort by the 1D points in the other dimensions, then by the 1D point in dimension t
+  std::sort(polesT.points.begin(), polesT.points.end(), [this, t, &points1D](size_t j1, size_t j2) {
+    for (size_t s = 0; s < dim; s++) {
+      if (s == t) {
+        continue;
+      }
+
+      const uint32_t p1 = points1D[j1 * dim + s];
+      const uint32_t p2 = points1D[j2 * dim + s];
+
+      if (p1 != p2) {
+        return p1 < p2;
+      }
+    }
+
+    return points1D[j1 * dim + t] < points1D[j2 * dim + t];
+  });
+
+  auto isSamePole = [this, t, &points1D](size_t j1, size_t j2) {
+    for (size_t s = 0; s < dim; s++) {
+      if ((s != t) && (points1D[j1 * dim + s] != points1D[j2 * dim + s])) {
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  std::map<std::vector<uint32_t>, size_t> factorizationIndices;
+  std::vector<int64_t> position(basisStart.size(), -1);
+
+  for (size_t begin = 0; begin < numPoints;) {
+    size_t end = begin + 1;
+
+    while ((end < numPoints) && isSamePole(polesT.points[begin], polesT.points[end])) {
+      end++;
+    }
+
+    std::vector<uint32_t> pole1D(end - begin);
+
+    for (size_t r = 0; r < pole1D.size(); r++) {
+      pole1D[r] = points1D[polesT.points[begin + r] * dim + t];
+    }
+
+    auto it = factorizationIndices.find(pole1D);
+
+    if (it == factorizationIndices.end()) {
+      // assemble and factorize the 1D system
+      const size_t m = pole1D.size();
+      Factorization factorization;
+      factorization.size = m;
+      factorization.lu.assign(m * m, 0.0);
+      factorization.pivots.resize(m);
+      factorization.singular = false;
+      std::vector<double>& A = factorization.lu;
+
+      for (size_t c = 0; c < m; c++) {
+        position[pole1D[c]] = static_cast<int64_t>(c);
+      }
+
+      for (size_t r = 0; r < m; r++) {
+        for (size_t q = basisStart[pole1D[r]]; q < basisStart[pole1D[r] + 1]; q++) {
+          const int64_t c = position[basisIndices[q]];
+
+          if (c >= 0) {
+            A[r * m + c] = basisValues[q];
+          }
+        }
+      }
+
+      for (size_t c = 0; c < m; c++) {
+        position[pole1D[c]] = -1;
+      }
+
+      for (size_t k = 0; k < m; k++) {
+        size_t pivot = k;
+
+        for (size_t r = k + 1; r < m; r++) {
+          if (std::abs(A[r * m + k]) > std::abs(A[pivot * m + k])) {
+            pivot = r;
+          }
+        }
+
+        factorization.pivots[k] = pivot;
+
+        if (A[pivot * m + k] == 0.0) {
+          factorization.singular = true;
+          hasSingularSystem = true;
+          break;
+        }
+
+        if (pivot != k) {
+          std::swap_ranges(A.begin() + k * m, A.begin() + (k + 1) * m, A.begin() + pivot * m);
+        }
+
+        for (size_t r = k + 1; r < m; r++) {
+          const double factor = A[r * m + k] / A[k * m + k];
+          A[r * m + k] = factor;
+
+          if (factor != 0.0) {
+            for (size_t c = k + 1; c < m; c++) {
+              A[r * m + c] -= factor * A[k * m + c];
+            }
+          }
+        }
+      }
+
+      it = factorizationIndices.emplace(pole1D, polesT.factorizations.size()).first;
+      polesT.factorizations.push_back(std::move(factorization));
+    }
+
+    polesT.start.push_back(begin);
+    polesT.factorization.push_back(it->second);
+    begin = end;
+  }
+
+  polesT.start.push_back(numPoints);
+}
+
+void UnidirectionalHierarchisation::multiply(const base::DataMatrix& alpha,
+                                             base::DataMatrix& result) const {
+  const size_t numColumns = alpha.getNcols();
+  result = base::DataMatrix(numPoints, numColumns, 0.0);
+
+  const double* alphaPointer = alpha.getPointer();
+  double* resultPointer = result.getPointer();
+
+#pragma omp parallel for schedule(dynamic, 64)
+  for (size_t j = 0; j < numPoints; j++) {
+    double* resultRow = resultPointer + j * numColumns;
+
+    matrix.forEachNonZeroEntry(j, [alphaPointer, numColumns, resultRow](size_t k, double entry) {
+      const double* alphaRow = alphaPointer + k * numColumns;
+
+      for (size_t c = 0; c < numColumns; c++) {
+        resultRow[c] += entry * alphaRow[c];
+      }
+    });
+  }
+}
+
+bool UnidirectionalHierarchisation::applyUnidirectionalPrinciple(base::DataMatrix& values) const {
+  if (hasSingularSystem) {
+    return false;
+  }
+
+  const size_t numColumns = values.getNcols();
+  double* valuesPointer = values.getPointer();
+
+  for (size_t t = 0; t < dim; t++) {
+    const Poles& polesT = poles[t];
+    const size_t numPoles = polesT.factorization.size();
+
+#pragma omp parallel
+    {
+      std::vector<double> buffer;
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t p = 0; p < numPoles; p++) {
+        const Factorization& factorization = polesT.factorizations[polesT.factorization[p]];
+        const size_t* pole = polesT.points.data() + polesT.start[p];
+        const size_t m = factorization.size;
+        const double* LU = factorization.lu.data();
+        buffer.resize(m * numColumns);
+
+        for (size_t r = 0; r < m; r++) {
+          std::copy(valuesPointer + pole[r] * numColumns,
+                    valuesPointer + (pole[r] + 1) * numColumns, buffer.begin() + r * numColumns);
+        }
+
+        for (size_t r = 0; r < m; r++) {
+          if (factorization.pivots[r] != r) {
+            std::swap_ranges(buffer.begin() + r * numColumns, buffer.begin() + (r + 1) * numColumns,
+                             buffer.begin() + factorization.pivots[r] * numColumns);
+          }
+        }
+
+        // forward substitution with L
+        for (size_t r = 1; r < m; r++) {
+          for (size_t k = 0; k < r; k++) {
+            const double factor = LU[r * m + k];
+
+            if (factor != 0.0) {
+              for (size_t c = 0; c < numColumns; c++) {
+                buffer[r * numColumns + c] -= factor * buffer[k * numColumns + c];
+              }
+            }
+          }
+        }
+
+        // backward substitution with U
+        for (size_t r = m; r-- > 0;) {
+          for (size_t k = r + 1; k < m; k++) {
+            const double factor = LU[r * m + k];
+
+            if (factor != 0.0) {
+              for (size_t c = 0; c < numColumns; c++) {
+                buffer[r * numColumns + c] -= factor * buffer[k * numColumns + c];
+              }
+            }
+          }
+
+          for (size_t c = 0; c < numColumns; c++) {
+            buffer[r * numColumns + c] /= LU[r * m + r];
+          }
+        }
+
+        for (size_t r = 0; r < m; r++) {
+          std::copy(buffer.begin() + r * numColumns, buffer.begin() + (r + 1) * numColumns,
+                    valuesPointer + pole[r] * numColumns);
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+double UnidirectionalHierarchisation::computeResidual(const base::DataMatrix& rhs,
+                                                      const base::DataMatrix& x,
+                                                      base::DataMatrix& residual) const {
+  multiply(x, residual);
+  residual.mult(-1.0);
+  residual.add(rhs);
+  return maxAbs(residual);
+}
+
+bool UnidirectionalHierarchisation::doHierarchisation(base::DataMatrix& nodeValues) {
+  Printer::getInstance().printStatusBegin("Hierarchization (unidirectional principle)...");
+
+  const base::DataMatrix rhs(nodeValues);
+  const double threshold = tolerance * maxAbs(rhs);
+  base::DataMatrix residual(numPoints, nodeValues.getNcols());
+
+  if (applyUnidirectionalPrinciple(nodeValues)) {
+    // residual interpolation, stopped as soon as the residual grows
+    base::DataMatrix lastNodeValues(nodeValues);
+    double lastResidualNorm = std::numeric_limits<double>::infinity();
+
+    for (size_t k = 0; k <= maxItCount; k++) {
+      const double residualNorm = computeResidual(rhs, nodeValues, residual);
+      Printer::getInstance().printStatusUpdate("k = " + std::to_string(k) +
+                                               ", residual norm = " + std::to_string(residualNorm));
+
+      if (residualNorm <= threshold) {
+        Printer::getInstance().printStatusEnd();
+        return true;
+      } else if (!(residualNorm < lastResidualNorm)) {
+        nodeValues = lastNodeValues;
+        break;
+      } else if (k == maxItCount) {
+        break;
+      }
+
+      lastNodeValues = nodeValues;
+      lastResidualNorm = residualNorm;
+      applyUnidirectionalPrinciple(residual);
+      nodeValues.add(residual);
+    }
+
+    Printer::getInstance().printStatusUpdate("residual interpolation did not converge");
+    Printer::getInstance().printStatusNewLine();
+  } else {
+    Printer::getInstance().printStatusUpdate("singular 1D system");
+    Printer::getInstance().printStatusNewLine();
+    nodeValues.setAll(0.0);
+  }
+
+  const bool result = solveIteratively(rhs, nodeValues);
+  Printer::getInstance().printStatusEnd(result ? "" : "error: Could not hierarchize!");
+  return result;
+}
+
+bool UnidirectionalHierarchisation::solveIteratively(const base::DataMatrix& rhs,
+                                                     base::DataMatrix& x) {
+  // solve A * P * y = rhs - A * x and correct x by P * y (if the UP is applicable)
+  const bool preconditioned = !hasSingularSystem;
+  MatrixFreeHierarchisationSLE matrixFreeSystem(*this, preconditioned);
+  base::DataMatrix residual;
+  computeResidual(rhs, x, residual);
+  base::DataMatrix correction(numPoints, rhs.getNcols());
+  base::DataVector b(numPoints);
+  base::DataVector y(numPoints);
+
+  for (size_t c = 0; c < rhs.getNcols(); c++) {
+    residual.getColumn(c, b);
+    rhs.getColumn(c, y);
+    // BiCGStab uses an absolute tolerance for the Euclidean norm, which bounds the maximum norm
+    sle_solver::BiCGStab solver(sle_solver::BiCGStab::DEFAULT_MAX_IT_COUNT,
+                                std::max(tolerance * y.maxNorm(), 1e-300),
+                                base::DataVector(numPoints, 0.0));
+
+    if (solver.solve(matrixFreeSystem, b, y)) {
+      correction.setColumn(c, y);
+    }
+  }
+
+  if (preconditioned) {
+    applyUnidirectionalPrinciple(correction);
+  }
+
+  x.add(correction);
+
+  if (computeResidual(rhs, x, residual) <= tolerance * maxAbs(rhs)) {
+    return true;
+  }
+
+  // last resort: solve the assembled system
+  sle_solver::Auto solver;
+  base::DataMatrix B(rhs);
+  return solver.solve(system, B, x);
+}
+
+bool UnidirectionalHierarchisation::doHierarchisation(base::DataVector& nodeValues) {
+  base::DataMatrix values(nodeValues.getPointer(), nodeValues.getSize(), 1);
+  const bool result = doHierarchisation(values);
+  values.getColumn(0, nodeValues);
+  return result;
+}
+
+void UnidirectionalHierarchisation::doDehierarchisation(base::DataMatrix& alpha) {
+  base::DataMatrix nodeValues;
+  multiply(alpha, nodeValues);
+  alpha = nodeValues;
+}
+
+void UnidirectionalHierarchisation::doDehierarchisation(base::DataVector& alpha) {
+  base::DataMatrix values(alpha.getPointer(), alpha.getSize(), 1);
+  doDehierarchisation(values);
+  values.getColumn(0, alpha);
+}
+
+HierarchisationSLE& UnidirectionalHierarchisation::getSystem() { return system; }
+
+size_t UnidirectionalHierarchisation::getMaxItCount() const { return maxItCount; }
+
+void UnidirectionalHierarchisation::setMaxItCount(size_t maxItCount) {
+  this->maxItCount = maxItCount;
+}
+
+double UnidirectionalHierarchisation::getTolerance() const { return tolerance; }
+
+void UnidirectionalHierarchisation::setTolerance(double tolerance) { this->tolerance = tolerance; }
+}  // namespace optimization
+}  // namespace sgpp
@@ -0,0 +1,200 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_OPERATION_HASH_UNIDIRECTIONALHIERARCHISATION_HPP
+#define SGPP_OPTIMIZATION_OPERATION_HASH_UNIDIRECTIONALHIERARCHISATION_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Matrix-free hierarchisation for sparse grids with tensor product basis functions.
+ *
+ * The interpolation matrix is never assembled. Instead, the hierarchical coefficients are
+ * computed with the unidirectional principle (UP): for each dimension, the grid points are
+ * grouped into poles (grid points that only differ in this dimension) and the 1D interpolation
+ * system of every pole is solved. The 1D system only depends on the 1D grid points of the pole,
+ * so its LU factorization is computed once and shared by all poles with the same 1D points.
+ * The poles are processed in parallel.
+ *
+ * The UP alone yields the interpolant only for bases that vanish at the grid points of coarser
+ * levels (e.g., piecewise linear functions and fundamental splines). For all other bases
+ * (e.g., B-splines), the UP is used for residual interpolation: the residual of the current
+ * coefficients is computed by a matrix-free matrix-vector product and hierarchised with the UP
+ * again. In low dimensions, this converges after a few iterations. Otherwise, BiCGStab with
+ * the matrix-free product is used, preconditioned by the UP from the right (unless a 1D system is
+ * singular). Only if this fails, too, the assembled system is solved (HierarchisationSLE).
+ */
+class UnidirectionalHierarchisation {
+ public:
+  /// default maximal number of residual interpolation iterations
+  static const size_t DEFAULT_MAX_IT_COUNT = 50;
+  /// default tolerance for the maximum norm of the residual (relative to the function values)
+  static constexpr double DEFAULT_TOLERANCE = 1e-10;
+
+  /**
+   * Constructor.
+   * Determines the poles and factorizes the 1D systems.
+   * Do not destruct or change the grid before this object!
+   * Throws std::invalid_argument if the grid type is not supported by HierarchisationSLE.
+   *
+   * @param grid      sparse grid
+   */
+  explicit UnidirectionalHierarchisation(base::Grid& grid);
+
+  /**
+   * @param[in,out] nodeValues before: vector of function values at
+   *                           the grid points,
+   *                           after: vector of hierarchical coefficients
+   * @return                   whether hierarchisation was successful
+   */
+  bool doHierarchisation(base::DataVector& nodeValues);
+
+  /**
+   * @param[in,out] alpha before: vector of hierarchical coefficients,
+   *                      after: vector of function values at
+   *                      the grid points
+   */
+  void doDehierarchisation(base::DataVector& alpha);
+
+  /**
+   * @param[in,out] nodeValues before: matrix of function values at
+   *                           the grid points (one column per function),
+   *                           after: matrix of hierarchical coefficients
+   * @return                   whether hierarchisation was successful
+   */
+  bool doHierarchisation(base::DataMatrix& nodeValues);
+
+  /**
+   * @param[in,out] alpha before: matrix of hierarchical coefficients
+   *                      (one column per function),
+   *                      after: matrix of function values at
+   *                      the grid points
+   */
+  void doDehierarchisation(base::DataMatrix& alpha);
+
+  /**
+   * Matrix-free multiplication with the interpolation matrix, i.e.,
+   * evaluation of sparse grid functions at all grid points.
+   * For every grid point, only the basis functions that do not vanish
+   * at the point are visited (see SparseHierarchisationMatrix).
+   *
+   * @param       alpha   hierarchical coefficients
+   *                      (one row per grid point, one column per function)
+   * @param[out]  result  function values at the grid points
+   */
+  void multiply(const base::DataMatrix& alpha, base::DataMatrix& result) const;
+
+  /**
+   * Applies the UP once, i.e., solves the 1D systems of all poles
+   * dimension by dimension.
+   *
+   * @param[in,out] values  before: function values,
+   *                        after: result of the UP
+   * @return                whether all 1D systems are regular
+   */
+  bool applyUnidirectionalPrinciple(base::DataMatrix& values) const;
+
+  /**
+   * @return  hierarchisation system, whose sparse representation is used for multiply()
+   */
+  HierarchisationSLE& getSystem();
+
+  /**
+   * @return  maximal number of residual interpolation iterations
+   */
+  size_t getMaxItCount() const;
+
+  /**
+   * @param maxItCount  maximal number of residual interpolation iterations
+   */
+  void setMaxItCount(size_t maxItCount);
+
+  /**
+   * @return  tolerance
+   */
+  double getTolerance() const;
+
+  /**
+   * @param tolerance   tolerance for the maximum norm of the residual
+   *                    (relative to the maximum norm of the function values)
+   */
+  void setTolerance(double tolerance);
+
+ protected:
+  /// LU factorization with partial pivoting of a 1D interpolation matrix
+  struct Factorization {
+    /// number of rows/columns
+    size_t size;
+    /// row-major L (below the diagonal, unit diagonal) and U
+    std::vector<double> lu;
+    /// row interchanges, row r has been swapped with row pivots[r]
+    std::vector<size_t> pivots;
+    /// whether the matrix is singular
+    bool singular;
+  };
+
+  /// poles of one dimension
+  struct Poles {
+    /// grid point indices, the points of a pole are contiguous and sorted by their 1D point
+    std::vector<size_t> points;
+    /// start of each pole in points (and points.size() at the end)
+    std::vector<size_t> start;
+    /// index of the factorization for each pole
+    std::vector<size_t> factorization;
+    /// factorizations of the distinct 1D systems
+    std::vector<Factorization> factorizations;
+  };
+
+  /// sparse grid
+  base::Grid& grid;
+  /// dimensionality
+  size_t dim;
+  /// number of grid points
+  size_t numPoints;
+  /// maximal number of residual interpolation iterations
+  size_t maxItCount;
+  /// tolerance
+  double tolerance;
+  /// hierarchisation system (1D grid points, 1D basis values and trie of the grid points)
+  HierarchisationSLE system;
+  /// sparse representation of the system matrix
+  const SparseHierarchisationMatrix& matrix;
+  /// poles for each dimension
+  std::vector<Poles> poles;
+  /// whether one of the 1D systems is singular
+  bool hasSingularSystem;
+
+  /**
+   * Computes the poles of dimension t and factorizes their 1D systems.
+   */
+  void buildPoles(size_t t);
+
+  /**
+   * Fallback if the residual interpolation does not converge.
+   * Corrects x by the solution of the (preconditioned) residual system.
+   */
+  bool solveIteratively(const base::DataMatrix& rhs, base::DataMatrix& x);
+
+  /**
+   * @return maximum norm of rhs - A * x, computed into residual
+   */
+  double computeResidual(const base::DataMatrix& rhs, const base::DataMatrix& x,
+                         base::DataMatrix& residual) const;
+};
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_OPERATION_HASH_UNIDIRECTIONALHIERARCHISATION_HPP */
@@ -68,12 +68,18 @@ void DifferentialEvolution::optimize() {
   base::DataVector fx(populationSize);
 
   // initial pseudorandom points
-  for (size_t i = 0; i < populationSize; i++) {
-    for (size_t t = 0; t < d; t++) {
-      (*xOld)[i][t] = RandomNumberGenerator::getInstance().getUniformRN();
+  {
+    base::DataMatrix x0(populationSize, d);
+
+    for (size_t i = 0; i < populationSize; i++) {
+      for (size_t t = 0; t < d; t++) {
+        (*xOld)[i][t] = RandomNumberGenerator::getInstance().getUniformRN();
+      }
+
+      x0.setRow(i, (*xOld)[i]);
     }
 
-    fx[i] = f->eval((*xOld)[i]);
+    f->evalBatch(x0, fx);
   }
 
   // smallest function value in the population
@@ -129,73 +135,64 @@ void DifferentialEvolution::optimize() {
     const std::vector<size_t>& j_k = j[k];
     const std::vector<base::DataVector>& prob_k = prob[k];
 
-#pragma omp parallel shared(k, a_k, b_k, c_k, j_k, prob_k, xOld, fx, fCurrentOpt, xOptIndex, \
-                            xNew) default(none)
-    {  // NOLINT(whitespace/braces)
-      base::DataVector y(d);
-      ScalarFunction* curFPtr = f.get();
-#ifdef _OPENMP
-      std::unique_ptr<ScalarFunction> curF;
-
-      if (omp_get_max_threads() > 1) {
-        f->clone(curF);
-        curFPtr = curF.get();
-      }
+    // mutated points that are in the domain
+    base::DataMatrix y(0, d);
+    // index of the mutated point in y or populationSize if it is out of bounds
+    std::vector<size_t> yIndex(populationSize, populationSize);
+    base::DataVector yi(d);
 
-#endif /* _OPENMP */
+    // for each point in the population
+    for (size_t i = 0; i < populationSize; i++) {
+      const size_t &cur_a = a_k[i], &cur_b = b_k[i], &cur_c = c_k[i];
+      const size_t& cur_j = j_k[i];
+      const base::DataVector& prob_ki = prob_k[i];
+      bool inDomain = true;
 
-// for each point in the population
-#pragma omp for schedule(dynamic)
+      // for each dimension
+      for (size_t t = 0; t < d; t++) {
+        const double& curProb = prob_ki[t];
 
-      for (size_t i = 0; i < populationSize; i++) {
-        const size_t &cur_a = a_k[i], &cur_b = b_k[i], &cur_c = c_k[i];
-        const size_t& cur_j = j_k[i];
-        const base::DataVector& prob_ki = prob_k[i];
-        bool inDomain = true;
+        if ((t == cur_j) || (curProb < crossoverProbability)) {
+          // mutate point in this dimension
+          yi[t] = (*xOld)[cur_a][t] + scalingFactor * ((*xOld)[cur_b][t] - (*xOld)[cur_c][t]);
+        } else {
+          // don't mutate point in this dimension
+          yi[t] = (*xOld)[i][t];
+        }
 
-        // for each dimension
-        for (size_t t = 0; t < d; t++) {
-          const double& curProb = prob_ki[t];
-
-          if ((t == cur_j) || (curProb < crossoverProbability)) {
-            // mutate point in this dimension
-            y[t] = (*xOld)[cur_a][t] + scalingFactor * ((*xOld)[cur_b][t] - (*xOld)[cur_c][t]);
-          } else {
-            // don't mutate point in this dimension
-            y[t] = (*xOld)[i][t];
-          }
-
-          // mutated point is out of bounds ==> discard
-          if ((y[t] < 0.0) || (y[t] > 1.0)) {
-            inDomain = false;
-            break;
-          }
+        // mutated point is out of bounds ==> discard
+        if ((yi[t] < 0.0) || (yi[t] > 1.0)) {
+          inDomain = false;
+          break;
         }
+      }
 
-        // evaluate mutated point (if not out of bounds)
-        const double fy = (inDomain ? curFPtr->eval(y) : INFINITY);
+      if (inDomain) {
+        yIndex[i] = y.appendRow(yi);
+      }
+    }
 
-        if (fy < fx[i]) {
-// function_value is better ==> replace point with mutated one
-#pragma omp critical
-          {
-            fx[i] = fy;
+    // evaluate mutated points (all at once, the evaluations may take
+    // very different amounts of time)
+    base::DataVector fy(y.getNrows());
+    f->evalBatch(y, fy);
 
-            if (fy < fCurrentOpt) {
-              xOptIndex = i;
-              fCurrentOpt = fy;
-            }
-          }
+    for (size_t i = 0; i < populationSize; i++) {
+      const double fyi = ((yIndex[i] < populationSize) ? fy[yIndex[i]] : INFINITY);
 
-          for (size_t t = 0; t < d; t++) {
-            (*xNew)[i][t] = y[t];
-          }
-        } else {
-          // function value not better ==> keep old point
-          for (size_t t = 0; t < d; t++) {
-            (*xNew)[i][t] = (*xOld)[i][t];
-          }
+      if (fyi < fx[i]) {
+        // function_value is better ==> replace point with mutated one
+        fx[i] = fyi;
+
+        if (fyi < fCurrentOpt) {
+          xOptIndex = i;
+          fCurrentOpt = fyi;
         }
+
+        y.getRow(yIndex[i], (*xNew)[i]);
+      } else {
+        // function value not better ==> keep old point
+        (*xNew)[i] = (*xOld)[i];
       }
     }
 
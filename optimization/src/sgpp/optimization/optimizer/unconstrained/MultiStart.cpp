@@ -145,13 +145,19 @@ void MultiStart::optimize() {
     Printer::getInstance().disableStatusPrinting();
   }
 
-#pragma omp parallel shared(x0, roundN, xCurrentOpt, fCurrentOpt) default(none)
+  // the local optimizations are distributed dynamically, at most as many
+  // of them run at the same time as f may be evaluated concurrently
+  const int numThreads = static_cast<int>(
+      std::max(std::min(f->getNumberOfEvaluationThreads(), populationSize), size_t(1)));
+
+#pragma omp parallel num_threads(numThreads) shared(x0, roundN, xCurrentOpt, fCurrentOpt) \
+    default(none)
   {
     UnconstrainedOptimizer* curOptimizerPtr = optimizer.get();
 #ifdef _OPENMP
     std::unique_ptr<UnconstrainedOptimizer> curOptimizer;
 
-    if (omp_get_max_threads() > 1) {
+    if (omp_get_num_threads() > 1) {
       optimizer->clone(curOptimizer);
       curOptimizerPtr = curOptimizer.get();
     }
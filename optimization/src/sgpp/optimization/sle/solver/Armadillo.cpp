@@ -19,6 +19,7 @@ typedef arma::mat ArmadilloMatrix;
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -45,7 +46,7 @@ bool Armadillo::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) con
   Printer::getInstance().printStatusBegin("Solving linear system (Armadillo)...");
 
   const arma::uword n = static_cast<arma::uword>(system.getDimension());
-  ArmadilloMatrix A(n, n);
+  ArmadilloMatrix A(n, n, arma::fill::zeros);
   size_t nnz = 0;
 
   A.zeros();
@@ -64,21 +65,22 @@ bool Armadillo::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) con
 
 #endif /* _OPENMP */
 
+    std::vector<size_t> rowIndices;
+    std::vector<double> rowEntries;
+
 // copy system matrix to Armadillo matrix object
 #pragma omp for ordered schedule(dynamic)
 
     for (arma::uword i = 0; i < n; i++) {
-      for (arma::uword j = 0; j < n; j++) {
-        A(i, j) = system2->getMatrixEntry(i, j);
+      system2->getMatrixRow(i, rowIndices, rowEntries);
 
-        // count nonzero entries
-        // (not necessary, you can also remove that if you like)
-        if (A(i, j) != 0) {
-#pragma omp atomic
-          nnz++;
-        }
+      for (size_t k = 0; k < rowIndices.size(); k++) {
+        A(i, static_cast<arma::uword>(rowIndices[k])) = rowEntries[k];
       }
 
+#pragma omp atomic
+      nnz += rowIndices.size();
+
       // status message
       if (i % 100 == 0) {
 #pragma omp ordered
@@ -109,14 +109,13 @@ bool Auto::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
 
     Printer::getInstance().printStatusUpdate("estimating sparsity pattern");
 
+    std::vector<size_t> rowIndices;
+    std::vector<double> rowEntries;
+
     for (size_t i = 0; i < n; i += inc) {
       nrows++;
-
-      for (size_t j = 0; j < n; j++) {
-        if (system.isMatrixEntryNonZero(i, j)) {
-          nnz++;
-        }
-      }
+      system.getMatrixRow(i, rowIndices, rowEntries);
+      nnz += rowIndices.size();
     }
 
     // calculate estimate ratio nonzero entries
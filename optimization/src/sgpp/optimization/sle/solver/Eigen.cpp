@@ -11,11 +11,13 @@
 
 #ifdef USE_EIGEN
 #include <eigen3/Eigen/Dense>
+#include <eigen3/Eigen/Sparse>
 #endif /* USE_EIGEN */
 
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -25,6 +27,11 @@ namespace sle_solver {
 
 typedef ::Eigen::VectorXd EigenVector;
 typedef ::Eigen::MatrixXd EigenMatrix;
+typedef ::Eigen::SparseMatrix<double> EigenSparseMatrix;
+typedef ::Eigen::Triplet<double> EigenTriplet;
+
+/// maximal ratio of non-zero entries for which the sparse LU factorization is used
+const double MAX_NNZ_RATIO_FOR_SPARSE = 0.1;
 
 /**
  * @param       A     coefficient matrix
@@ -72,11 +79,10 @@ bool Eigen::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
   Printer::getInstance().printStatusBegin("Solving linear system (Eigen)...");
 
   const size_t n = system.getDimension();
-  EigenMatrix A = EigenMatrix::Zero(n, n);
-  size_t nnz = 0;
+  std::vector<EigenTriplet> triplets;
 
 // parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz) default(none)
+#pragma omp parallel if (system.isCloneable()) shared(system, triplets) default(none)
   {
     SLE* system2 = &system;
 #ifdef _OPENMP
@@ -89,19 +95,20 @@ bool Eigen::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
 
 #endif /* _OPENMP */
 
-// copy system matrix to Eigen matrix object
+    // non-zero entries of this thread, merged at the end
+    std::vector<EigenTriplet> tripletsThread;
+    std::vector<size_t> rowIndices;
+    std::vector<double> rowEntries;
+
+// get indices and values of nonzero entries
 #pragma omp for ordered schedule(dynamic)
 
     for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < n; j++) {
-        A(i, j) = system2->getMatrixEntry(i, j);
-
-        // count nonzero entries
-        // (not necessary, you can also remove that if you like)
-        if (A(i, j) != 0) {
-#pragma omp atomic
-          nnz++;
-        }
+      system2->getMatrixRow(i, rowIndices, rowEntries);
+
+      for (size_t k = 0; k < rowIndices.size(); k++) {
+        tripletsThread.emplace_back(static_cast<int>(i), static_cast<int>(rowIndices[k]),
+                                    rowEntries[k]);
       }
 
       // status message
@@ -116,29 +123,85 @@ bool Eigen::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
         }
       }
     }
+
+#pragma omp critical
+    triplets.insert(triplets.end(), tripletsThread.begin(), tripletsThread.end());
   }
 
   Printer::getInstance().printStatusUpdate("constructing matrix (100.0%)");
   Printer::getInstance().printStatusNewLine();
 
+  const size_t nnz = triplets.size();
+  const double nnzRatio =
+      static_cast<double>(nnz) / (static_cast<double>(n) * static_cast<double>(n));
+
   // print ratio of nonzero entries
   {
     char str[10];
-    double nnz_ratio =
-        static_cast<double>(nnz) / (static_cast<double>(n) * static_cast<double>(n));
-    snprintf(str, sizeof(str), "%.1f%%", nnz_ratio * 100.0);
+    snprintf(str, sizeof(str), "%.1f%%", nnzRatio * 100.0);
     Printer::getInstance().printStatusUpdate("nnz ratio: " + std::string(str));
     Printer::getInstance().printStatusNewLine();
   }
 
-  // calculate QR factorization of system matrix
-  Printer::getInstance().printStatusUpdate("step 1: Householder QR factorization");
-  ::Eigen::HouseholderQR<EigenMatrix> A_QR = A.householderQr();
-
   base::DataVector x(n);
   base::DataVector b(n);
   X.resize(n, B.getNcols());
 
+  if (nnzRatio <= MAX_NNZ_RATIO_FOR_SPARSE) {
+    EigenSparseMatrix ASparse(n, n);
+    ASparse.setFromTriplets(triplets.begin(), triplets.end());
+    ASparse.makeCompressed();
+
+    // calculate sparse LU factorization of system matrix
+    Printer::getInstance().printStatusUpdate("step 1: sparse LU factorization");
+    ::Eigen::SparseLU<EigenSparseMatrix> A_LU;
+    A_LU.compute(ASparse);
+
+    if (A_LU.info() == ::Eigen::Success) {
+      const double tolerance = 1e-12;
+      bool success = true;
+
+      for (size_t i = 0; i < B.getNcols(); i++) {
+        B.getColumn(i, b);
+        EigenVector bEigen = EigenVector::Map(b.getPointer(), n);
+        EigenVector xEigen = A_LU.solve(bEigen);
+
+        // check solution
+        if ((A_LU.info() != ::Eigen::Success) ||
+            ((ASparse * xEigen - bEigen).norm() > tolerance * bEigen.norm())) {
+          success = false;
+          break;
+        }
+
+        X.setColumn(i, base::DataVector(xEigen.data(), n));
+      }
+
+      if (success) {
+        Printer::getInstance().printStatusUpdate("step 2: solved with sparse LU");
+        Printer::getInstance().printStatusEnd();
+        return true;
+      }
+    }
+
+    Printer::getInstance().printStatusNewLine();
+    Printer::getInstance().printStatusUpdate(
+        "sparse LU factorization failed, trying again with dense QR factorization");
+    Printer::getInstance().printStatusNewLine();
+  }
+
+  EigenMatrix A = EigenMatrix::Zero(n, n);
+
+  for (const EigenTriplet& triplet : triplets) {
+    A(triplet.row(), triplet.col()) = triplet.value();
+  }
+
+  triplets.clear();
+  triplets.shrink_to_fit();
+
+  // calculate QR factorization of system matrix
+  Printer::getInstance().printStatusUpdate("step 1: Householder QR factorization");
+  ::Eigen::HouseholderQR<EigenMatrix> A_QR = A.householderQr();
+
   // solve system for each RHS
   for (size_t i = 0; i < B.getNcols(); i++) {
     B.getColumn(i, b);
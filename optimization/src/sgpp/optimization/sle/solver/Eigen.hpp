@@ -16,7 +16,8 @@ namespace optimization {
 namespace sle_solver {
 
 /**
- * Linear system solver using Eigen (direct full solver).
+ * Linear system solver using Eigen (direct sparse LU solver for sparse matrices,
+ * direct full QR solver otherwise).
  */
 class Eigen : public SLESolver {
  public:
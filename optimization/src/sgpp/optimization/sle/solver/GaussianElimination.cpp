@@ -11,6 +11,7 @@
 
 #include <cmath>
 #include <numeric>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -24,12 +25,16 @@ bool GaussianElimination::solve(SLE& system, base::DataVector& b, base::DataVect
   // size of the system
   const size_t n = b.getSize();
   // working matrix
-  base::DataMatrix W(n, n + 1);
+  base::DataMatrix W(n, n + 1, 0.0);
+  std::vector<size_t> rowIndices;
+  std::vector<double> rowEntries;
 
   // set W := (A, b) at the beginning
   for (size_t i = 0; i < n; i++) {
-    for (size_t j = 0; j < n; j++) {
-      W(i, j) = system.getMatrixEntry(i, j);
+    system.getMatrixRow(i, rowIndices, rowEntries);
+
+    for (size_t k = 0; k < rowIndices.size(); k++) {
+      W(i, rowIndices[k]) = rowEntries[k];
     }
 
     W(i, n) = b[i];
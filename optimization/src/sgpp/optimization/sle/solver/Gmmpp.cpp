@@ -134,22 +134,23 @@ bool Gmmpp::solve(SLE& system, base::DataVector& b, base::DataVector& x) const {
 
 #endif /* _OPENMP */
 
+      std::vector<size_t> rowIndices;
+      std::vector<double> rowEntries;
+
 // copy system matrix to Gmm++ matrix object
+// (every row is written by exactly one thread)
 #pragma omp for ordered schedule(dynamic)
 
       for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          double entry = system2->getMatrixEntry(i, j);
-
-          if (entry != 0) {
-#pragma omp critical
-            {
-              A(i, j) = entry;
-              nnz++;
-            }
-          }
+        system2->getMatrixRow(i, rowIndices, rowEntries);
+
+        for (size_t k = 0; k < rowIndices.size(); k++) {
+          A(i, rowIndices[k]) = rowEntries[k];
         }
 
+#pragma omp atomic
+        nnz += rowIndices.size();
+
         // status message
         if (i % 100 == 0) {
 #pragma omp ordered
@@ -93,22 +93,23 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
 
 #endif /* _OPENMP */
 
+    // triplets of this thread, merged at the end
+    std::vector<uint32_t> TiThread;
+    std::vector<uint32_t> TjThread;
+    std::vector<double> TxThread;
+    std::vector<size_t> rowIndices;
+    std::vector<double> rowEntries;
+
 // get indices and values of nonzero entries
 #pragma omp for ordered schedule(dynamic)
 
     for (uint32_t i = 0; i < n; i++) {
-      for (uint32_t j = 0; j < n; j++) {
-        double entry = system2->getMatrixEntry(i, j);
+      system2->getMatrixRow(i, rowIndices, rowEntries);
 
-        if (entry != 0) {
-#pragma omp critical
-          {
-            Ti.push_back(i);
-            Tj.push_back(j);
-            Tx.push_back(entry);
-            nnz++;
-          }
-        }
+      for (size_t k = 0; k < rowIndices.size(); k++) {
+        TiThread.push_back(i);
+        TjThread.push_back(static_cast<uint32_t>(rowIndices[k]));
+        TxThread.push_back(rowEntries[k]);
       }
 
       // status message
@@ -124,6 +125,14 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
         }
       }
     }
+
+#pragma omp critical
+    {
+      Ti.insert(Ti.end(), TiThread.begin(), TiThread.end());
+      Tj.insert(Tj.end(), TjThread.begin(), TjThread.end());
+      Tx.insert(Tx.end(), TxThread.begin(), TxThread.end());
+      nnz += TxThread.size();
+    }
   }
 
   Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
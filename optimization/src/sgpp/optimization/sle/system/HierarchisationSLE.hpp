@@ -11,6 +11,7 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/optimization/sle/system/CloneableSLE.hpp>
+#include <sgpp/optimization/sle/system/SparseHierarchisationMatrix.hpp>
 
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
@@ -44,6 +45,7 @@
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -71,7 +73,122 @@ class HierarchisationSLE : public CloneableSLE {
    *                          grid points according to gridStorage)
    */
   HierarchisationSLE(base::Grid& grid, base::GridStorage& gridStorage)
-      : CloneableSLE(), grid(grid), gridStorage(gridStorage), basisType(INVALID) {
+      : HierarchisationSLE(grid, gridStorage, nullptr) {}
+
+  /**
+   * @param i     row index
+   * @param j     column index
+   * @return      whether the i-th grid point lies in the support of
+   *              the j-th basis function
+   */
+  inline bool isMatrixEntryNonZero(size_t i, size_t j) override {
+    return (evalBasisFunctionAtGridPoint(j, i) != 0.0);
+  }
+
+  /**
+   * @param i     row index
+   * @param j     column index
+   * @return      value of the j-th basis function at the i-th grid point
+   */
+  inline double getMatrixEntry(size_t i, size_t j) override {
+    return evalBasisFunctionAtGridPoint(j, i);
+  }
+
+  /**
+   * Only the basis functions whose support contains the i-th grid point
+   * are visited (see SparseHierarchisationMatrix).
+   *
+   * @param       i               row index
+   * @param[out]  columnIndices   indices of the basis functions that do not
+   *                              vanish at the i-th grid point
+   * @param[out]  entries         corresponding values of the basis functions
+   */
+  void getMatrixRow(size_t i, std::vector<size_t>& columnIndices,
+                    std::vector<double>& entries) override {
+    getSparseMatrix().getRow(i, columnIndices, entries);
+  }
+
+  /**
+   * Multiply the matrix with a vector with
+   * \f$\mathcal{O}(\mathrm{nnz} \cdot d)\f$ operations.
+   *
+   * @param       x   vector to be multiplied
+   * @param[out]  y   \f$y = Ax\f$
+   */
+  void matrixVectorMultiplication(const base::DataVector& x, base::DataVector& y) override {
+    const SparseHierarchisationMatrix& matrix = getSparseMatrix();
+    const size_t n = getDimension();
+    y.resize(n);
+
+#pragma omp parallel for schedule(dynamic, 64)
+    for (size_t i = 0; i < n; i++) {
+      double yi = 0.0;
+      matrix.forEachNonZeroEntry(i, [&x, &yi](size_t j, double entry) {
+        yi += entry * x[j];
+      });
+      y[i] = yi;
+    }
+  }
+
+  /**
+   * @return number of non-zero entries
+   */
+  size_t countNNZ() override { return getSparseMatrix().countNNZ(); }
+
+  /**
+   * @return          sparse grid
+   */
+  base::Grid& getGrid() { return grid; }
+
+  /**
+   * @return              grid storage
+   */
+  base::GridStorage& getGridStorage() { return gridStorage; }
+
+  /**
+   * The sparse representation is rebuilt if the number of grid points
+   * has changed since it was computed.
+   *
+   * @return              sparse representation of the matrix
+   */
+  const SparseHierarchisationMatrix& getSparseMatrix() {
+    if ((sparseMatrix == nullptr) || (sparseMatrix->getSize() != gridStorage.getSize())) {
+      sparseMatrix = std::make_shared<const SparseHierarchisationMatrix>(
+          gridStorage, [this](const base::GridPoint& gpBasis, const base::GridPoint& gpPoint,
+                              size_t t) { return evalBasisFunction1D(gpBasis, gpPoint, t); });
+    }
+
+    return *sparseMatrix;
+  }
+
+  size_t getDimension() const override { return gridStorage.getSize(); }
+
+  /**
+   * The clone shares the sparse representation of the matrix.
+   *
+   * @param[out] clone pointer to cloned object
+   */
+  void clone(std::unique_ptr<CloneableSLE>& clone) const override {
+    clone = std::unique_ptr<CloneableSLE>(new HierarchisationSLE(grid, gridStorage, sparseMatrix));
+  }
+
+ protected:
+  /**
+   * Constructor.
+   * Do not destruct the grid before this object!
+   *
+   * @param grid              sparse grid
+   * @param gridStorage       custom grid storage
+   * @param sparseMatrix      sparse representation of the matrix
+   *                          (computed if nullptr or out of date)
+   */
+  HierarchisationSLE(base::Grid& grid, base::GridStorage& gridStorage,
+                     std::shared_ptr<const SparseHierarchisationMatrix> sparseMatrix)
+      : CloneableSLE(),
+        grid(grid),
+        gridStorage(gridStorage),
+        sparseMatrix(sparseMatrix),
+        basisType(INVALID) {
     // initialize the correct basis (according to the grid)
     if (grid.getType() == base::GridType::Bspline) {
       bsplineBasis = std::unique_ptr<base::SBsplineBase>(
@@ -143,51 +260,16 @@ class HierarchisationSLE : public CloneableSLE {
     } else {
       throw std::invalid_argument("Grid type not supported.");
     }
-  }
-
-  /**
-   * @param i     row index
-   * @param j     column index
-   * @return      whether the i-th grid point lies in the support of
-   *              the j-th basis function
-   */
-  inline bool isMatrixEntryNonZero(size_t i, size_t j) override {
-    return (evalBasisFunctionAtGridPoint(j, i) != 0.0);
-  }
-
-  /**
-   * @param i     row index
-   * @param j     column index
-   * @return      value of the j-th basis function at the i-th grid point
-   */
-  inline double getMatrixEntry(size_t i, size_t j) override {
-    return evalBasisFunctionAtGridPoint(j, i);
-  }
-
-  /**
-   * @return          sparse grid
-   */
-  base::Grid& getGrid() { return grid; }
-
-  /**
-   * @return              grid storage
-   */
-  base::GridStorage& getGridStorage() { return gridStorage; }
-
-  size_t getDimension() const override { return gridStorage.getSize(); }
 
-  /**
-   * @param[out] clone pointer to cloned object
-   */
-  void clone(std::unique_ptr<CloneableSLE>& clone) const override {
-    clone = std::unique_ptr<CloneableSLE>(new HierarchisationSLE(grid, gridStorage));
+    getSparseMatrix();
   }
 
- protected:
   /// sparse grid
   base::Grid& grid;
   /// grid storage
   base::GridStorage& gridStorage;
+  /// sparse representation of the matrix (shared by clones)
+  std::shared_ptr<const SparseHierarchisationMatrix> sparseMatrix;
 
   /// B-spline basis
   std::unique_ptr<base::SBsplineBase> bsplineBasis;
@@ -287,6 +369,65 @@ class HierarchisationSLE : public CloneableSLE {
     }
   }
 
+  /**
+   * @param gpBasis   grid point of the basis function
+   * @param gpPoint   grid point
+   * @param t         dimension
+   * @return          value of the 1D basis function of gpBasis in
+   *                  dimension t at gpPoint
+   */
+  inline double evalBasisFunction1D(const base::GridPoint& gpBasis,
+                                    const base::GridPoint& gpPoint, size_t t) {
+    const base::GridPoint::level_type l = gpBasis.getLevel(t);
+    const base::GridPoint::index_type i = gpBasis.getIndex(t);
+    const double x = gridStorage.getUnitCoordinate(gpPoint, t);
+
+    switch (basisType) {
+      case BSPLINE:
+        return bsplineBasis->eval(l, i, x);
+      case BSPLINE_BOUNDARY:
+        return bsplineBoundaryBasis->eval(l, i, x);
+      case BSPLINE_CLENSHAW_CURTIS:
+        return bsplineClenshawCurtisBasis->eval(l, i, x);
+      case BSPLINE_MODIFIED:
+        return modBsplineBasis->eval(l, i, x);
+      case BSPLINE_MODIFIED_CLENSHAW_CURTIS:
+        return modBsplineClenshawCurtisBasis->eval(l, i, x);
+      case FUNDAMENTAL_SPLINE:
+      case FUNDAMENTAL_SPLINE_MODIFIED:
+        // fundamental splines vanish at all other grid points of the same or coarser levels
+        if (gpPoint.getLevel(t) < l) {
+          return 0.0;
+        } else if (gpPoint.getLevel(t) == l) {
+          return ((gpPoint.getIndex(t) == i) ? 1.0 : 0.0);
+        } else if (basisType == FUNDAMENTAL_SPLINE) {
+          return fundamentalSplineBasis->eval(l, i, x);
+        } else {
+          return modFundamentalSplineBasis->eval(l, i, x);
+        }
+      case LINEAR:
+        return linearBasis->eval(l, i, x);
+      case LINEAR_BOUNDARY:
+        return linearL0BoundaryBasis->eval(l, i, x);
+      case LINEAR_CLENSHAW_CURTIS:
+        return linearClenshawCurtisBasis->eval(l, i, x);
+      case LINEAR_CLENSHAW_CURTIS_BOUNDARY:
+        return linearClenshawCurtisBoundaryBasis->eval(l, i, x);
+      case LINEAR_MODIFIED:
+        return modLinearBasis->eval(l, i, x);
+      case WAVELET:
+        return waveletBasis->eval(l, i, x);
+      case WAVELET_BOUNDARY:
+        return waveletBoundaryBasis->eval(l, i, x);
+      case WAVELET_MODIFIED:
+        return modWaveletBasis->eval(l, i, x);
+      case NAK_BSPLINEBOUNDARY_COMBIGRID:
+        return nakBsplineBoundaryCombigridBasis->eval(l, i, gridStorage.getCoordinate(gpPoint, t));
+      default:
+        return 0.0;
+    }
+  }
+
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
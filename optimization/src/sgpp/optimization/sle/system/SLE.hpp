@@ -10,6 +10,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -48,6 +49,32 @@ class SLE {
    */
   virtual double getMatrixEntry(size_t i, size_t j) = 0;
 
+  /**
+   * Retrieve the non-zero entries of a row.
+   * Standard implementation with \f$\mathcal{O}(n)\f$ calls of getMatrixEntry(),
+   * systems that know their sparsity pattern should override this.
+   *
+   * @param       i               row index
+   * @param[out]  columnIndices   column indices of the non-zero entries
+   *                              of the i-th row (not necessarily sorted)
+   * @param[out]  entries         corresponding entries of the matrix
+   */
+  virtual void getMatrixRow(size_t i, std::vector<size_t>& columnIndices,
+                            std::vector<double>& entries) {
+    const size_t n = getDimension();
+    columnIndices.clear();
+    entries.clear();
+
+    for (size_t j = 0; j < n; j++) {
+      const double entry = getMatrixEntry(i, j);
+
+      if (entry != 0.0) {
+        columnIndices.push_back(j);
+        entries.push_back(entry);
+      }
+    }
+  }
+
   /**
    * Multiply the matrix with a vector.
    * Standard implementation with \f$\mathcal{O}(n^2)\f$ scalar
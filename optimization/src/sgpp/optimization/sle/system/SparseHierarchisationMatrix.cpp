@@ -0,0 +1,141 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/sle/system/SparseHierarchisationMatrix.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+SparseHierarchisationMatrix::SparseHierarchisationMatrix(base::GridStorage& gridStorage,
+                                                         const BasisFunction1D& basisFunction1D)
+    : dim(gridStorage.getDimension()),
+      numPoints(gridStorage.getSize()),
+      points1D(numPoints * dim),
+      basisStart(dim),
+      basisIndices(dim),
+      basisValues(dim),
+      trie(dim) {
+  for (size_t t = 0; t < dim; t++) {
+    // enumerate the distinct 1D grid points of dimension t,
+    // each is represented by the first grid point with this 1D grid point
+    std::unordered_map<uint64_t, uint32_t> ids;
+    std::vector<size_t> representatives;
+
+    for (size_t i = 0; i < numPoints; i++) {
+      const base::GridPoint& gp = gridStorage[i];
+      const uint64_t key = (static_cast<uint64_t>(gp.getLevel(t)) << 32) | gp.getIndex(t);
+      auto it = ids.find(key);
+
+      if (it == ids.end()) {
+        it = ids.emplace(key, static_cast<uint32_t>(representatives.size())).first;
+        representatives.push_back(i);
+      }
+
+      points1D[i * dim + t] = it->second;
+    }
+
+    // tabulate the non-vanishing 1D basis functions
+    const size_t numPoints1D = representatives.size();
+    basisStart[t].resize(numPoints1D + 1);
+
+    for (size_t a = 0; a < numPoints1D; a++) {
+      const base::GridPoint& point = gridStorage[representatives[a]];
+      basisStart[t][a] = basisValues[t].size();
+
+      for (size_t b = 0; b < numPoints1D; b++) {
+        const double value = basisFunction1D(gridStorage[representatives[b]], point, t);
+
+        if (value != 0.0) {
+          basisIndices[t].push_back(static_cast<uint32_t>(b));
+          basisValues[t].push_back(value);
+        }
+      }
+    }
+
+    basisStart[t][numPoints1D] = basisValues[t].size();
+  }
+
+  if (dim > 0) {
+    std::vector<size_t> sortedPoints(numPoints);
+
+    for (size_t i = 0; i < numPoints; i++) {
+      sortedPoints[i] = i;
+    }
+
+    std::sort(sortedPoints.begin(), sortedPoints.end(), [this](size_t i1, size_t i2) {
+      return std::lexicographical_compare(
+          points1D.begin() + i1 * dim, points1D.begin() + (i1 + 1) * dim,
+          points1D.begin() + i2 * dim, points1D.begin() + (i2 + 1) * dim);
+    });
+
+    buildTrie(sortedPoints, 0, 0, numPoints);
+  }
+}
+
+void SparseHierarchisationMatrix::buildTrie(const std::vector<size_t>& sortedPoints,
+                                            size_t depth, size_t begin, size_t end) {
+  const size_t firstNode = trie[depth].size();
+
+  // one node per run of equal 1D grid points, first and count temporarily describe the run
+  for (size_t runBegin = begin; runBegin < end;) {
+    const uint32_t point1D = points1D[sortedPoints[runBegin] * dim + depth];
+    size_t runEnd = runBegin + 1;
+
+    while ((runEnd < end) && (points1D[sortedPoints[runEnd] * dim + depth] == point1D)) {
+      runEnd++;
+    }
+
+    trie[depth].push_back(TrieNode{point1D, runBegin, runEnd - runBegin});
+    runBegin = runEnd;
+  }
+
+  const size_t lastNode = trie[depth].size();
+
+  for (size_t n = firstNode; n < lastNode; n++) {
+    const size_t runBegin = trie[depth][n].first;
+    const size_t runEnd = runBegin + trie[depth][n].count;
+
+    if (depth + 1 == dim) {
+      // leaf, the run consists of exactly one grid point
+      trie[depth][n].first = sortedPoints[runBegin];
+      trie[depth][n].count = 0;
+    } else {
+      const size_t firstChild = trie[depth + 1].size();
+      buildTrie(sortedPoints, depth + 1, runBegin, runEnd);
+      trie[depth][n].first = firstChild;
+      trie[depth][n].count = trie[depth + 1].size() - firstChild;
+    }
+  }
+}
+
+void SparseHierarchisationMatrix::getRow(size_t i, std::vector<size_t>& columnIndices,
+                                         std::vector<double>& entries) const {
+  columnIndices.clear();
+  entries.clear();
+
+  forEachNonZeroEntry(i, [&columnIndices, &entries](size_t j, double entry) {
+    columnIndices.push_back(j);
+    entries.push_back(entry);
+  });
+}
+
+size_t SparseHierarchisationMatrix::countNNZ() const {
+  size_t nnz = 0;
+
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : nnz)
+  for (size_t i = 0; i < numPoints; i++) {
+    forEachNonZeroEntry(i, [&nnz](size_t, double) { nnz++; });
+  }
+
+  return nnz;
+}
+}  // namespace optimization
+}  // namespace sgpp
@@ -0,0 +1,184 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_SLE_SYSTEM_SPARSEHIERARCHISATIONMATRIX_HPP
+#define SGPP_OPTIMIZATION_SLE_SYSTEM_SPARSEHIERARCHISATIONMATRIX_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Sparse representation of the matrix \f$(\varphi_j(\vec{x}_i))_{i,j}\f$ of the hierarchisation
+ * system, which exploits the tensor product structure of the basis functions.
+ *
+ * For each dimension, the distinct 1D grid points are enumerated and the values of the 1D basis
+ * functions that do not vanish at the 1D grid points are tabulated (CSR format). In addition, the
+ * grid points are stored in a trie, whose depth t corresponds to the 1D grid point in
+ * dimension t. The non-zero entries of a row are enumerated by descending the trie and
+ * intersecting the children of each node with the 1D basis functions that do not vanish at the
+ * 1D grid point of the row, i.e., only the supports of the basis functions are visited.
+ */
+class SparseHierarchisationMatrix {
+ public:
+  /**
+   * Function that evaluates the 1D basis function of a grid point in dimension t at another
+   * grid point, i.e., basisFunction1D(basisPoint, point, t).
+   */
+  typedef std::function<double(const base::GridPoint&, const base::GridPoint&, size_t)>
+      BasisFunction1D;
+
+  /**
+   * Constructor.
+   * The grid storage is only needed during construction.
+   *
+   * @param gridStorage       grid points
+   * @param basisFunction1D   1D basis functions
+   */
+  SparseHierarchisationMatrix(base::GridStorage& gridStorage,
+                              const BasisFunction1D& basisFunction1D);
+
+  /**
+   * @return  number of rows/columns (number of grid points)
+   */
+  size_t getSize() const { return numPoints; }
+
+  /**
+   * @return  dimensionality of the grid
+   */
+  size_t getNumberOfDimensions() const { return dim; }
+
+  /**
+   * Calls f(j, entry) for all non-zero entries of the i-th row.
+   * The column indices are not sorted.
+   *
+   * @param i   row index
+   * @param f   callback
+   */
+  template <class F>
+  void forEachNonZeroEntry(size_t i, F&& f) const {
+    if (dim > 0) {
+      forEachNonZeroEntryInSubtree(i, 0, 0, trie[0].size(), 1.0, f);
+    }
+  }
+
+  /**
+   * @param       i               row index
+   * @param[out]  columnIndices   column indices of the non-zero entries of the i-th row
+   * @param[out]  entries         corresponding entries
+   */
+  void getRow(size_t i, std::vector<size_t>& columnIndices, std::vector<double>& entries) const;
+
+  /**
+   * @return  number of non-zero entries
+   */
+  size_t countNNZ() const;
+
+  /**
+   * @return  1D grid points of all grid points
+   *          (number of grid points times dimensionality, row-major)
+   */
+  const std::vector<uint32_t>& getPoints1D() const { return points1D; }
+
+  /**
+   * @param t   dimension
+   * @return    for each 1D grid point: start of the non-vanishing 1D basis functions in
+   *            getBasisIndices1D(t) and getBasisValues1D(t) (with an additional end entry)
+   */
+  const std::vector<size_t>& getBasisStart1D(size_t t) const { return basisStart[t]; }
+
+  /**
+   * @param t   dimension
+   * @return    1D basis functions (as 1D grid points) that do not vanish at the 1D grid points,
+   *            sorted for each 1D grid point
+   */
+  const std::vector<uint32_t>& getBasisIndices1D(size_t t) const { return basisIndices[t]; }
+
+  /**
+   * @param t   dimension
+   * @return    corresponding values of the 1D basis functions
+   */
+  const std::vector<double>& getBasisValues1D(size_t t) const { return basisValues[t]; }
+
+ protected:
+  /// node of the trie of all grid points
+  struct TrieNode {
+    /// 1D grid point in the dimension of the depth of the node
+    uint32_t point1D;
+    /// first child in the next depth (or grid point index for leaves)
+    size_t first;
+    /// number of children
+    size_t count;
+  };
+
+  /// dimensionality
+  size_t dim;
+  /// number of grid points
+  size_t numPoints;
+  /// 1D grid points of all grid points
+  std::vector<uint32_t> points1D;
+  /// for each dimension: CSR row starts of the 1D basis values
+  std::vector<std::vector<size_t>> basisStart;
+  /// for each dimension: CSR column indices of the 1D basis values
+  std::vector<std::vector<uint32_t>> basisIndices;
+  /// for each dimension: CSR entries of the 1D basis values
+  std::vector<std::vector<double>> basisValues;
+  /// trie nodes for each depth
+  std::vector<std::vector<TrieNode>> trie;
+
+  /**
+   * Builds the trie level for the points in sortedPoints[begin, end).
+   */
+  void buildTrie(const std::vector<size_t>& sortedPoints, size_t depth, size_t begin, size_t end);
+
+  /**
+   * Calls f for all grid points in the subtree of the given trie nodes whose basis function
+   * does not vanish at the i-th grid point.
+   */
+  template <class F>
+  void forEachNonZeroEntryInSubtree(size_t i, size_t depth, size_t first, size_t count,
+                                    double product, F& f) const {
+    const TrieNode* nodes = trie[depth].data() + first;
+    const uint32_t point1D = points1D[i * dim + depth];
+    const uint32_t* indices = basisIndices[depth].data();
+    const double* values = basisValues[depth].data();
+    size_t lower = 0;
+
+    // the children and the non-vanishing 1D basis functions are both sorted
+    for (size_t q = basisStart[depth][point1D];
+         (q < basisStart[depth][point1D + 1]) && (lower < count); q++) {
+      const TrieNode* node =
+          std::lower_bound(nodes + lower, nodes + count, indices[q],
+                           [](const TrieNode& n, uint32_t p) { return n.point1D < p; });
+      lower = node - nodes;
+
+      if ((lower == count) || (node->point1D != indices[q])) {
+        continue;
+      }
+
+      lower++;
+
+      if (depth + 1 == dim) {
+        f(node->first, product * values[q]);
+      } else {
+        forEachNonZeroEntryInSubtree(i, depth + 1, node->first, node->count, product * values[q],
+                                     f);
+      }
+    }
+  }
+};
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_SLE_SYSTEM_SPARSEHIERARCHISATIONMATRIX_HPP */
@@ -0,0 +1,130 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/FileReplacement.hpp>
+#include <sgpp/optimization/tools/EvaluationCache.hpp>
+#include <sgpp/optimization/tools/ScopedLock.hpp>
+
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+EvaluationCache::EvaluationCache(size_t d, size_t m, const std::string& filename)
+    : d(d), m(m), filename(filename) {
+  if (!filename.empty()) {
+    openFile();
+  }
+}
+
+bool EvaluationCache::lookup(const base::DataVector& x, base::DataVector& value) {
+  const std::string key = getKey(x);
+  ScopedLock lock(mutex);
+  const auto it = entries.find(key);
+
+  if (it == entries.end()) {
+    return false;
+  }
+
+  value.resize(m);
+
+  for (size_t k = 0; k < m; k++) {
+    value[k] = it->second[k];
+  }
+
+  return true;
+}
+
+void EvaluationCache::insert(const base::DataVector& x, const base::DataVector& value) {
+  if ((x.getSize() != d) || (value.getSize() != m)) {
+    throw std::invalid_argument("EvaluationCache::insert(): Invalid entry size.");
+  }
+
+  std::vector<double> record(x.getPointer(), x.getPointer() + d);
+  record.insert(record.end(), value.getPointer(), value.getPointer() + m);
+
+  ScopedLock lock(mutex);
+
+  if (!entries.emplace(getKey(x), std::vector<double>(record.begin() + d, record.end()))
+           .second) {
+    return;
+  }
+
+  if (file.is_open()) {
+    // flush every record, as the file is meant to survive crashes
+    file.write(reinterpret_cast<const char*>(record.data()), record.size() * sizeof(double));
+    file.flush();
+  }
+}
+
+size_t EvaluationCache::getSize() {
+  ScopedLock lock(mutex);
+  return entries.size();
+}
+
+std::string EvaluationCache::getKey(const base::DataVector& x) {
+  return std::string(reinterpret_cast<const char*>(x.getPointer()),
+                     x.getSize() * sizeof(double));
+}
+
+void EvaluationCache::openFile() {
+  // pick up the repaired file if the last run was interrupted while replacing it
+  base::FileReplacement::recover(filename);
+
+  std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+  bool isFileValid = false;
+
+  if (in.is_open()) {
+    size_t fileD, fileM;
+    in.read(reinterpret_cast<char*>(&fileD), sizeof(fileD));
+    in.read(reinterpret_cast<char*>(&fileM), sizeof(fileM));
+
+    if (in) {
+      if ((fileD != d) || (fileM != m)) {
+        throw std::invalid_argument(
+            "EvaluationCache::openFile(): "
+            "The dimensions of the file do not match.");
+      }
+
+      std::vector<double> record(d + m);
+      const std::streamsize recordSize =
+          static_cast<std::streamsize>(record.size() * sizeof(double));
+
+      while (in.read(reinterpret_cast<char*>(record.data()), recordSize)) {
+        entries.emplace(
+            std::string(reinterpret_cast<const char*>(record.data()), d * sizeof(double)),
+            std::vector<double>(record.begin() + d, record.end()));
+      }
+
+      // the file can be appended to if there is no incomplete record
+      isFileValid = (in.gcount() == 0);
+    }
+
+    in.close();
+  }
+
+  if (!isFileValid) {
+    // rewrite the file with the complete records only, such that the old file is not lost
+    // if the process is interrupted meanwhile
+    base::FileReplacement::replace(filename, [this](std::ostream& out) {
+      out.write(reinterpret_cast<const char*>(&d), sizeof(d));
+      out.write(reinterpret_cast<const char*>(&m), sizeof(m));
+
+      for (const auto& entry : entries) {
+        out.write(entry.first.data(), entry.first.size());
+        out.write(reinterpret_cast<const char*>(entry.second.data()), m * sizeof(double));
+      }
+    });
+  }
+
+  file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  file.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+}
+}  // namespace optimization
+}  // namespace sgpp
@@ -0,0 +1,114 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_TOOLS_EVALUATIONCACHE_HPP
+#define SGPP_OPTIMIZATION_TOOLS_EVALUATIONCACHE_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/optimization/tools/MutexType.hpp>
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Thread-safe map from evaluation points \f$\vec{x} \in [0, 1]^d\f$ to
+ * function values \f$\vec{y} \in \mathbb{R}^m\f$ (used by
+ * CachedScalarFunction and CachedVectorFunction).
+ * Points are compared bitwise, i.e., only evaluations at exactly the same
+ * coordinates are reused.
+ *
+ * If a file name is given, the cache is loaded from the file (if it exists)
+ * and every new entry is appended to it immediately. Hence, a run that was
+ * interrupted can be restarted without repeating the completed evaluations.
+ * The file consists of a header with \f$d\f$ and \f$m\f$ (as size_t),
+ * followed by one record of \f$d + m\f$ doubles per entry.
+ * An incomplete last record (e.g., due to a crash while writing) is discarded
+ * by replacing the file with a copy of the complete records
+ * (see base::FileReplacement).
+ */
+class EvaluationCache {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param d         dimension of the domain
+   * @param m         number of function values per point
+   * @param filename  file to store the entries in
+   *                  (empty string for no file, the default)
+   */
+  EvaluationCache(size_t d, size_t m, const std::string& filename = "");
+
+  /**
+   * @param       x       evaluation point
+   * @param[out]  value   cached function value(s) at x (if found)
+   * @return              whether x is in the cache
+   */
+  bool lookup(const base::DataVector& x, base::DataVector& value);
+
+  /**
+   * Inserts a new entry (and appends it to the file, if any).
+   * If x is already in the cache, nothing happens.
+   *
+   * @param x     evaluation point
+   * @param value function value(s) at x
+   */
+  void insert(const base::DataVector& x, const base::DataVector& value);
+
+  /**
+   * @return number of cached entries
+   */
+  size_t getSize();
+
+  /**
+   * @return dimension \f$d\f$ of the domain
+   */
+  size_t getNumberOfParameters() const { return d; }
+
+  /**
+   * @return number \f$m\f$ of function values per point
+   */
+  size_t getNumberOfComponents() const { return m; }
+
+  /**
+   * @return file the entries are stored in (empty if none)
+   */
+  const std::string& getFilename() const { return filename; }
+
+  /**
+   * @param x     evaluation point
+   * @return      bytes of x, which identify x in the cache
+   */
+  static std::string getKey(const base::DataVector& x);
+
+ protected:
+  /// dimension of the domain
+  size_t d;
+  /// number of function values per point
+  size_t m;
+  /// file the entries are stored in
+  std::string filename;
+  /// map from the bytes of the points to the function values
+  std::unordered_map<std::string, std::vector<double>> entries;
+  /// stream for appending new entries to the file
+  std::ofstream file;
+  /// mutex for entries and file
+  MutexType mutex;
+
+  /**
+   * Reads the entries of the file, if it exists, and opens it for appending.
+   */
+  void openFile();
+};
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_TOOLS_EVALUATIONCACHE_HPP */
@@ -6,6 +6,7 @@
 #ifndef SGPP_OPTIMIZATION_HPP
 #define SGPP_OPTIMIZATION_HPP
 
+#include <sgpp/optimization/function/scalar/CachedScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/ComponentScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/ComponentScalarFunctionGradient.hpp>
 #include <sgpp/optimization/function/scalar/ComponentScalarFunctionHessian.hpp>
@@ -19,6 +20,7 @@
 #include <sgpp/optimization/function/scalar/WrapperScalarFunctionGradient.hpp>
 #include <sgpp/optimization/function/scalar/WrapperScalarFunctionHessian.hpp>
 
+#include <sgpp/optimization/function/vector/CachedVectorFunction.hpp>
 #include <sgpp/optimization/function/vector/EmptyVectorFunction.hpp>
 #include <sgpp/optimization/function/vector/EmptyVectorFunctionGradient.hpp>
 #include <sgpp/optimization/function/vector/InterpolantVectorFunction.hpp>
@@ -51,6 +53,7 @@
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationWaveletBoundary.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModWavelet.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationWavelet.hpp>
+#include <sgpp/optimization/operation/hash/UnidirectionalHierarchisation.hpp>
 
 #include <sgpp/optimization/optimizer/constrained/AugmentedLagrangian.hpp>
 #include <sgpp/optimization/optimizer/constrained/ConstrainedOptimizer.hpp>
@@ -86,6 +89,7 @@
 #include <sgpp/optimization/sle/system/FullSLE.hpp>
 #include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/optimization/sle/system/SLE.hpp>
+#include <sgpp/optimization/sle/system/SparseHierarchisationMatrix.hpp>
 
 #include <sgpp/optimization/test_problems/TestScalarFunction.hpp>
 #include <sgpp/optimization/test_problems/TestVectorFunction.hpp>
@@ -130,6 +134,7 @@
 #include <sgpp/optimization/test_problems/constrained/Simionescu.hpp>
 #include <sgpp/optimization/test_problems/constrained/Soland.hpp>
 
+#include <sgpp/optimization/tools/EvaluationCache.hpp>
 #include <sgpp/optimization/tools/FileIO.hpp>
 #include <sgpp/optimization/tools/Math.hpp>
 #include <sgpp/optimization/tools/MutexType.hpp>
@@ -6,12 +6,14 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/optimization/function/scalar/CachedScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/ComponentScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/ComponentScalarFunctionGradient.hpp>
 #include <sgpp/optimization/function/scalar/ComponentScalarFunctionHessian.hpp>
 #include <sgpp/optimization/function/scalar/WrapperScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/WrapperScalarFunctionGradient.hpp>
 #include <sgpp/optimization/function/scalar/WrapperScalarFunctionHessian.hpp>
+#include <sgpp/optimization/function/vector/CachedVectorFunction.hpp>
 #include <sgpp/optimization/function/vector/WrapperVectorFunction.hpp>
 #include <sgpp/optimization/function/vector/WrapperVectorFunctionGradient.hpp>
 #include <sgpp/optimization/function/vector/WrapperVectorFunctionHessian.hpp>
@@ -19,12 +21,23 @@
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "CheckEqualFunction.hpp"
 
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
+using sgpp::optimization::CachedScalarFunction;
+using sgpp::optimization::CachedVectorFunction;
 using sgpp::optimization::ComponentScalarFunction;
 using sgpp::optimization::ComponentScalarFunctionGradient;
 using sgpp::optimization::ComponentScalarFunctionHessian;
@@ -58,6 +71,46 @@ class ScalarTestFunction : public ScalarFunction {
   }
 };
 
+/**
+ * Scalar function whose evaluations take different amounts of time,
+ * counts the number of evaluations running at the same time
+ * (shared by all clones).
+ */
+class SlowScalarTestFunction : public ScalarFunction {
+ public:
+  explicit SlowScalarTestFunction(size_t d)
+      : ScalarFunction(d),
+        running(std::make_shared<std::atomic<size_t>>(0)),
+        maxRunning(std::make_shared<std::atomic<size_t>>(0)) {}
+
+  ~SlowScalarTestFunction() override {}
+
+  double eval(const DataVector& x) override {
+    const size_t curRunning = ++(*running);
+    size_t curMaxRunning = *maxRunning;
+
+    while ((curRunning > curMaxRunning) &&
+           !maxRunning->compare_exchange_weak(curMaxRunning, curRunning)) {
+    }
+
+    std::this_thread::sleep_for(
+        std::chrono::microseconds(static_cast<int>(1000.0 * x[0])));
+    (*running)--;
+    return x.sum();
+  }
+
+  void clone(std::unique_ptr<ScalarFunction>& clone) const override {
+    clone = std::unique_ptr<ScalarFunction>(
+              new SlowScalarTestFunction(*this));
+  }
+
+  size_t getMaxRunning() const { return *maxRunning; }
+
+ protected:
+  std::shared_ptr<std::atomic<size_t>> running;
+  std::shared_ptr<std::atomic<size_t>> maxRunning;
+};
+
 class ScalarTestGradient : public ScalarFunctionGradient {
  public:
   explicit ScalarTestGradient(size_t d) : ScalarFunctionGradient(d) {}
@@ -331,6 +384,189 @@ BOOST_AUTO_TEST_CASE(TestComponentScalarFunctionHessian) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestScalarFunctionEvalBatch) {
+  // Test sgpp::optimization::ScalarFunction::evalBatch and evalBatchAsync.
+  const size_t d = 3;
+  const size_t n = 40;
+  RandomNumberGenerator::getInstance().setSeed(42);
+  DataMatrix x(n, d);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t t = 0; t < d; t++) {
+      x(i, t) = RandomNumberGenerator::getInstance().getUniformRN();
+    }
+  }
+
+  for (size_t maxConcurrentEvaluations : {0, 1, 3}) {
+    SlowScalarTestFunction f(d);
+    f.setMaxConcurrentEvaluations(maxConcurrentEvaluations);
+    BOOST_CHECK_EQUAL(f.getMaxConcurrentEvaluations(), maxConcurrentEvaluations);
+
+    DataVector fx;
+    f.evalBatch(x, fx);
+    BOOST_CHECK_EQUAL(fx.getSize(), n);
+
+    DataVector fxAsync = f.evalBatchAsync(x).get();
+    BOOST_CHECK_EQUAL(fxAsync.getSize(), n);
+
+    for (size_t i = 0; i < n; i++) {
+      DataVector xi(d);
+      x.getRow(i, xi);
+      BOOST_CHECK_EQUAL(fx[i], xi.sum());
+      BOOST_CHECK_EQUAL(fxAsync[i], xi.sum());
+    }
+
+    BOOST_CHECK_LE(f.getMaxRunning(), f.getNumberOfEvaluationThreads());
+
+    if (maxConcurrentEvaluations > 0) {
+      BOOST_CHECK_EQUAL(f.getNumberOfEvaluationThreads(), maxConcurrentEvaluations);
+    }
+  }
+
+  // empty batch
+  ScalarTestFunction f(d);
+  DataVector fx(1);
+  f.evalBatch(DataMatrix(0, d), fx);
+  BOOST_CHECK_EQUAL(fx.getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestCachedFunction) {
+  // Test sgpp::optimization::CachedScalarFunction and CachedVectorFunction.
+  const size_t d = 3;
+  const size_t m = 4;
+  const size_t n = 20;
+  const std::string fileName = "testFunctions_cache.tmp";
+  RandomNumberGenerator::getInstance().setSeed(42);
+  DataMatrix x(n, d);
+  DataVector xi(d);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t t = 0; t < d; t++) {
+      x(i, t) = RandomNumberGenerator::getInstance().getUniformRN();
+    }
+  }
+
+  std::shared_ptr<std::atomic<size_t>> numberOfEvals =
+      std::make_shared<std::atomic<size_t>>(0);
+  WrapperScalarFunction fCounting(d, [numberOfEvals](const DataVector & x) {
+    (*numberOfEvals)++;
+    return x.sum();
+  });
+  fCounting.setMaxConcurrentEvaluations(2);
+  std::remove(fileName.c_str());
+
+  {
+    CachedScalarFunction f(fCounting, fileName);
+    BOOST_CHECK_EQUAL(f.getMaxConcurrentEvaluations(), 2);
+
+    for (size_t i = 0; i < n / 2; i++) {
+      x.getRow(i, xi);
+      BOOST_CHECK_EQUAL(f.eval(xi), xi.sum());
+    }
+
+    BOOST_CHECK_EQUAL(*numberOfEvals, n / 2);
+
+    // only the second half has to be evaluated
+    DataVector fx;
+    f.evalBatch(x, fx);
+    BOOST_CHECK_EQUAL(*numberOfEvals, n);
+
+    for (size_t i = 0; i < n; i++) {
+      x.getRow(i, xi);
+      BOOST_CHECK_EQUAL(fx[i], xi.sum());
+    }
+
+    // clones share the cache
+    std::unique_ptr<ScalarFunction> fClone;
+    f.clone(fClone);
+    x.getRow(0, xi);
+    BOOST_CHECK_EQUAL(fClone->eval(xi), xi.sum());
+    BOOST_CHECK_EQUAL(*numberOfEvals, n);
+    BOOST_CHECK_EQUAL(f.getNumberOfCachedPoints(), n);
+  }
+
+  {
+    // simulate a crash while writing the last record
+    std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+    file.write("abc", 3);
+  }
+
+  {
+    CachedScalarFunction f(fCounting, fileName);
+    BOOST_CHECK_EQUAL(f.getNumberOfCachedPoints(), n);
+    // the repaired copy has replaced the original file
+    BOOST_CHECK(!std::ifstream((fileName + ".tmp").c_str()).good());
+
+    DataVector fx;
+    f.evalBatch(x, fx);
+    BOOST_CHECK_EQUAL(*numberOfEvals, n);
+
+    xi.setAll(0.5);
+    BOOST_CHECK_EQUAL(f.eval(xi), xi.sum());
+    BOOST_CHECK_EQUAL(*numberOfEvals, n + 1);
+  }
+
+  // simulate a crash after removing the old file, but before renaming the repaired copy
+  std::rename(fileName.c_str(), (fileName + ".tmp").c_str());
+
+  {
+    CachedScalarFunction f(fCounting, fileName);
+    BOOST_CHECK_EQUAL(f.getNumberOfCachedPoints(), n + 1);
+    BOOST_CHECK(!std::ifstream((fileName + ".tmp").c_str()).good());
+    BOOST_CHECK_THROW(CachedScalarFunction(ScalarTestFunction(d + 1), fileName),
+                      std::invalid_argument);
+  }
+
+  std::remove(fileName.c_str());
+
+  VectorTestFunction g1(d, m);
+  CachedVectorFunction g2(g1);
+  std::unique_ptr<VectorFunction> g2Clone;
+  g2.clone(g2Clone);
+  checkEqualFunction(g1, *g2Clone);
+  // same points as before (fixed seed), i.e., the cached values are compared
+  checkEqualFunction(g1, g2);
+  BOOST_CHECK_GT(g2.getNumberOfCachedPoints(), 0);
+
+  ScalarTestFunction f1(d);
+  CachedScalarFunction f2(f1);
+  checkEqualFunction(f1, f2);
+
+  {
+    // points occurring multiple times are evaluated once
+    CachedScalarFunction f(fCounting);
+    DataMatrix xDuplicates(0, d);
+    x.getRow(0, xi);
+    xDuplicates.appendRow(xi);
+    x.getRow(1, xi);
+    xDuplicates.appendRow(xi);
+    x.getRow(0, xi);
+    xDuplicates.appendRow(xi);
+    *numberOfEvals = 0;
+
+    DataVector fx;
+    f.evalBatch(xDuplicates, fx);
+    BOOST_CHECK_EQUAL(*numberOfEvals, 2);
+    BOOST_CHECK_EQUAL(fx[0], xi.sum());
+    BOOST_CHECK_EQUAL(fx[2], xi.sum());
+  }
+
+  // the concurrency limit of the cached function applies to its clones and batches
+  for (size_t maxConcurrentEvaluations : {1, 3}) {
+    SlowScalarTestFunction fSlow(d);
+    CachedScalarFunction f(fSlow);
+    f.setMaxConcurrentEvaluations(maxConcurrentEvaluations);
+
+    std::unique_ptr<ScalarFunction> fClone;
+    f.clone(fClone);
+    BOOST_CHECK_EQUAL(fClone->getMaxConcurrentEvaluations(), maxConcurrentEvaluations);
+
+    DataVector fx;
+    fClone->evalBatch(x, fx);
+    BOOST_CHECK_LE(fSlow.getMaxRunning(), maxConcurrentEvaluations);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(TestWrapperScalarFunction) {
   // Test sgpp::optimization::TestWrapperScalarFunction.
   const size_t d = 3;
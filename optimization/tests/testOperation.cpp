@@ -8,6 +8,9 @@
 
 #include <sgpp/optimization/test_problems/unconstrained/Sphere.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
+#include <sgpp/optimization/operation/hash/UnidirectionalHierarchisation.hpp>
+#include <sgpp/optimization/sle/solver/GaussianElimination.hpp>
+#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
@@ -15,10 +18,12 @@
 
 #include "GridCreator.hpp"
 
+using sgpp::optimization::HierarchisationSLE;
 using sgpp::optimization::OperationMultipleHierarchisation;
 using sgpp::optimization::Printer;
 using sgpp::optimization::RandomNumberGenerator;
 using sgpp::optimization::ScalarFunction;
+using sgpp::optimization::UnidirectionalHierarchisation;
 using sgpp::optimization::test_problems::Sphere;
 
 BOOST_AUTO_TEST_CASE(TestOperationMultipleHierarchisation) {
@@ -75,3 +80,62 @@ BOOST_AUTO_TEST_CASE(TestOperationMultipleHierarchisation) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestUnidirectionalHierarchisation) {
+  Printer::getInstance().setVerbosity(-1);
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t d = 3;
+  const size_t p = 3;
+  const size_t l = 3;
+  const size_t m = 2;
+  const double tol = 1e-8;
+
+  Sphere testProblem(d);
+  ScalarFunction& f = testProblem.getObjectiveFunction();
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  createSupportedGrids(d, p, grids);
+
+  for (auto& grid : grids) {
+    sgpp::base::DataVector column(0);
+    testProblem.generateDisplacement();
+    createSampleGrid(*grid, l, f, column);
+    const size_t n = grid->getSize();
+    sgpp::base::DataMatrix functionValues(n, m);
+    functionValues.setColumn(0, column);
+
+    for (size_t j = 1; j < m; j++) {
+      testProblem.generateDisplacement();
+      createSampleGrid(*grid, l, f, column);
+      functionValues.setColumn(j, column);
+    }
+
+    UnidirectionalHierarchisation op(*grid);
+    sgpp::base::DataMatrix alpha(functionValues);
+    BOOST_CHECK(op.doHierarchisation(alpha));
+
+    sgpp::base::DataMatrix product;
+    op.multiply(alpha, product);
+
+    // compare with the assembled system
+    HierarchisationSLE system(*grid);
+    sgpp::optimization::sle_solver::GaussianElimination solver;
+    sgpp::base::DataVector b(n);
+    sgpp::base::DataVector x(n);
+    sgpp::base::DataVector y(n);
+
+    for (size_t j = 0; j < m; j++) {
+      functionValues.getColumn(j, b);
+      BOOST_CHECK(solver.solve(system, b, x));
+      alpha.getColumn(j, y);
+      system.matrixVectorMultiplication(y, b);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(alpha(i, j) - x[i], tol);
+        BOOST_CHECK_SMALL(product(i, j) - b[i], tol);
+        BOOST_CHECK_SMALL(product(i, j) - functionValues(i, j), tol);
+      }
+    }
+  }
+}
@@ -19,6 +19,7 @@
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
+#include <cmath>
 #include <vector>
 
 #include "ObjectiveFunctions.hpp"
@@ -35,12 +36,14 @@ using sgpp::optimization::SLE;
 void testSLESystem(SLE& system, const sgpp::base::DataVector& x,
                    const sgpp::base::DataVector& b,
                    sgpp::base::DataMatrix& A) {
-  // Test sgpp::optimization::SLE::getMatrixEntry, isMatrixEntryNonZero and
-  // matrixVectorMultiplication. Returns system matrix as pysgpp.DataMatrix.
+  // Test sgpp::optimization::SLE::getMatrixEntry, isMatrixEntryNonZero,
+  // getMatrixRow, countNNZ and matrixVectorMultiplication.
+  // Returns system matrix as pysgpp.DataMatrix.
   const size_t n = x.getSize();
   BOOST_CHECK_EQUAL(system.getDimension(), n);
   A.resize(n, n);
   sgpp::base::DataVector Ax(n, 0.0);
+  sgpp::base::DataVector absAx(n, 0.0);
 
   // A*x calculated directly
   for (size_t i = 0; i < n; i++) {
@@ -48,18 +51,47 @@ void testSLESystem(SLE& system, const sgpp::base::DataVector& x,
       const double Aij = system.getMatrixEntry(i, j);
       A(i, j) = Aij;
       Ax[i] += Aij * x[j];
+      absAx[i] += std::abs(Aij * x[j]);
 
       // test isMatrixEntryNonZero
       BOOST_CHECK_EQUAL(system.isMatrixEntryNonZero(i, j), Aij != 0);
     }
   }
 
+  // test getMatrixRow and countNNZ
+  std::vector<size_t> columnIndices;
+  std::vector<double> entries;
+  size_t nnz = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    size_t rowNNZ = 0;
+
+    for (size_t j = 0; j < n; j++) {
+      if (A(i, j) != 0) {
+        rowNNZ++;
+      }
+    }
+
+    system.getMatrixRow(i, columnIndices, entries);
+    BOOST_CHECK_EQUAL(columnIndices.size(), rowNNZ);
+    BOOST_CHECK_EQUAL(entries.size(), rowNNZ);
+
+    for (size_t k = 0; k < columnIndices.size(); k++) {
+      BOOST_CHECK_CLOSE(entries[k], A(i, columnIndices[k]), 1e-10);
+    }
+
+    nnz += rowNNZ;
+  }
+
+  BOOST_CHECK_EQUAL(system.countNNZ(), nnz);
+
   // A*x calculated by sgpp::optimization
   sgpp::base::DataVector Ax2(0);
   system.matrixVectorMultiplication(x, Ax2);
 
+  // the summation order may differ, so the error is bounded by |A|*|x|
   for (size_t i = 0; i < n; i++) {
-    BOOST_CHECK_CLOSE(Ax[i], Ax2[i], 1e-10);
+    BOOST_CHECK_SMALL(Ax[i] - Ax2[i], 1e-12 * absAx[i]);
   }
 }
 
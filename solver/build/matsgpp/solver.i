@@ -7,6 +7,10 @@
 %include "solver/src/sgpp/solver/SGSolver.hpp"
 %include "solver/src/sgpp/solver/SLESolver.hpp"
 %include "solver/src/sgpp/solver/ODESolver.hpp"
+%feature("director") Preconditioner;
+%include "solver/src/sgpp/solver/sle/precond/Preconditioner.hpp"
+%include "solver/src/sgpp/solver/sle/precond/JacobiPreconditioner.hpp"
+%include "solver/src/sgpp/solver/sle/precond/HierarchicalPreconditioner.hpp"
 %feature("director") ConjugateGradients;
 %include "solver/src/sgpp/solver/sle/ConjugateGradients.hpp"
 %include "solver/src/sgpp/solver/sle/BiCGStab.hpp"
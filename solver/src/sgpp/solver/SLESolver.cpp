@@ -0,0 +1,47 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/SLESolver.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+namespace {
+
+/// minimal number of matrix entries for which the dot products are parallelized
+const size_t minParallelSize = 1 << 14;
+
+}  // namespace
+
+void SLESolver::columnDotProducts(const sgpp::base::DataMatrix& A,
+                                  const sgpp::base::DataMatrix& B, std::vector<double>& result) {
+  const size_t numRows = A.getNrows();
+  const size_t numCols = A.getNcols();
+  result.assign(numCols, 0.0);
+
+#pragma omp parallel if (numRows * numCols >= minParallelSize)
+  {
+    std::vector<double> localResult(numCols, 0.0);
+
+#pragma omp for
+    for (size_t i = 0; i < numRows; i++) {
+      for (size_t j = 0; j < numCols; j++) {
+        localResult[j] += A(i, j) * B(i, j);
+      }
+    }
+
+#pragma omp critical
+    for (size_t j = 0; j < numCols; j++) {
+      result[j] += localResult[j];
+    }
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
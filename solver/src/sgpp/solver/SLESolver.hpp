@@ -6,6 +6,7 @@
 #ifndef SLESOLVER_HPP
 #define SLESOLVER_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 
@@ -17,6 +18,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace sgpp {
 namespace solver {
 
@@ -49,6 +53,59 @@ class SLESolver : public SGSolver {
   virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = DEFAULT_RES_THRESHOLD) = 0;
+
+  /**
+   * Solves the system for several right hand sides, i.e., \f$A X = B\f$.
+   * The default implementation solves the systems one after another.
+   * Afterwards, getNumberIterations() returns the maximal number of iterations and
+   * getResiduum() the maximal residuum of all systems.
+   *
+   * @param SystemMatrix reference to an sgpp::base::OperationMatrix Object that implements the
+   * matrix vector multiplication
+   * @param alpha the coefficients which have to be determined (one column per right hand side)
+   * @param b the right hand sides of the systems of linear equations (one per column)
+   * @param reuse identifies if the alphas, stored in alpha at calling time, should be reused
+   * @param verbose prints information during execution of the solver
+   * @param max_threshold additional abort criteria for solver
+   */
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+                     double max_threshold = DEFAULT_RES_THRESHOLD) {
+    const size_t numRHS = b.getNcols();
+    sgpp::base::DataVector alphaColumn(b.getNrows());
+    sgpp::base::DataVector bColumn(b.getNrows());
+    size_t maxIterations = 0;
+    double maxResiduum = 0.0;
+
+    if (!reuse || (alpha.getNrows() != b.getNrows()) || (alpha.getNcols() != numRHS)) {
+      alpha.resizeRowsCols(b.getNrows(), numRHS);
+      alpha.setAll(0.0);
+    }
+
+    for (size_t j = 0; j < numRHS; j++) {
+      alpha.getColumn(j, alphaColumn);
+      b.getColumn(j, bColumn);
+      solve(SystemMatrix, alphaColumn, bColumn, reuse, verbose, max_threshold);
+      alpha.setColumn(j, alphaColumn);
+      maxIterations = std::max(maxIterations, this->nIterations);
+      maxResiduum = std::max(maxResiduum, this->residuum);
+    }
+
+    this->nIterations = maxIterations;
+    this->residuum = maxResiduum;
+  }
+
+ protected:
+  /**
+   * Column-wise dot products of two matrices of the same shape
+   * (used by the block solvers for several right hand sides).
+   *
+   * @param A first matrix
+   * @param B second matrix
+   * @param[out] result dot products of the columns of A and B
+   */
+  static void columnDotProducts(const sgpp::base::DataMatrix& A,
+                                const sgpp::base::DataMatrix& B, std::vector<double>& result);
 };
 
 }  // namespace solver
@@ -6,7 +6,9 @@
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace sgpp {
 namespace solver {
@@ -119,5 +121,141 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
   }
 }
 
+void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& b, bool reuse, bool verbose, double max_threshold) {
+  const size_t size = b.getNrows();
+  const size_t numRHS = b.getNcols();
+  this->nIterations = 1;
+  double epsilonSqd = this->myEpsilon * this->myEpsilon;
+
+  if ((reuse == false) || (alpha.getNrows() != size) || (alpha.getNcols() != numRHS)) {
+    // Choose x0
+    alpha.resizeRowsCols(size, numRHS);
+    alpha.setAll(0.0);
+  }
+
+  // Calculate r0 (one column per right hand side)
+  sgpp::base::DataMatrix r(size, numRHS);
+  SystemMatrix.multBlock(alpha, r);
+  r.sub(b);
+
+  std::vector<double> delta_0;
+  std::vector<double> delta;
+  columnDotProducts(r, r, delta_0);
+
+  for (size_t j = 0; j < numRHS; j++) {
+    delta_0[j] *= epsilonSqd;
+  }
+
+  if (verbose == true) {
+    std::cout << "max. delta_0 "
+              << ((numRHS > 0) ? *std::max_element(delta_0.begin(), delta_0.end()) : 0.0)
+              << std::endl;
+  }
+
+  // Choose r0 as r
+  sgpp::base::DataMatrix rZero(r);
+  // Set p as r0
+  sgpp::base::DataMatrix p(rZero);
+
+  std::vector<double> rho;
+  std::vector<double> rho_new;
+  std::vector<double> sigma;
+  std::vector<double> vw;
+  std::vector<double> vv;
+  std::vector<double> a(numRHS, 0.0);
+  std::vector<double> omega(numRHS, 0.0);
+  std::vector<double> beta(numRHS, 0.0);
+  std::vector<char> active(numRHS, 1);
+  columnDotProducts(rZero, r, rho);
+
+  sgpp::base::DataMatrix s(size, numRHS, 0.0);
+  sgpp::base::DataMatrix v(size, numRHS, 0.0);
+  sgpp::base::DataMatrix w(size, numRHS, 0.0);
+
+  this->residuum = 0.0;
+  bool anyActive = (numRHS > 0);
+
+  while ((this->nIterations < this->nMaxIterations) && anyActive) {
+    // s  = Ap
+    SystemMatrix.multBlock(p, s);
+    columnDotProducts(s, rZero, sigma);
+
+    for (size_t j = 0; j < numRHS; j++) {
+      if (active[j] && (fabs(sigma[j]) == 0.0)) {
+        active[j] = false;
+      }
+
+      a[j] = (active[j] ? (rho[j] / sigma[j]) : 0.0);
+    }
+
+    // w = r - a*s
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < numRHS; j++) {
+        w(i, j) = (active[j] ? (r(i, j) - a[j] * s(i, j)) : 0.0);
+      }
+    }
+
+    // v = Aw
+    SystemMatrix.multBlock(w, v);
+    columnDotProducts(v, w, vw);
+    columnDotProducts(v, v, vv);
+
+    for (size_t j = 0; j < numRHS; j++) {
+      omega[j] = ((active[j] && (vv[j] != 0.0)) ? (vw[j] / vv[j]) : 0.0);
+    }
+
+    // x = x - a*p - omega*w, r = r - a*s - omega*v
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < numRHS; j++) {
+        if (active[j]) {
+          alpha(i, j) -= a[j] * p(i, j);
+          alpha(i, j) -= omega[j] * w(i, j);
+          r(i, j) -= a[j] * s(i, j);
+          r(i, j) -= omega[j] * v(i, j);
+        }
+      }
+    }
+
+    columnDotProducts(r, rZero, rho_new);
+    columnDotProducts(r, r, delta);
+
+    this->residuum = *std::max_element(delta.begin(), delta.end());
+
+    if (verbose == true) {
+      std::cout << "max. delta: " << this->residuum << std::endl;
+    }
+
+    // Stop in case of better accuracy
+    anyActive = false;
+
+    for (size_t j = 0; j < numRHS; j++) {
+      if ((delta[j] < delta_0[j]) || (delta[j] < max_threshold) || (omega[j] == 0.0)) {
+        active[j] = false;
+      }
+
+      anyActive = anyActive || active[j];
+    }
+
+    if (!anyActive) {
+      break;
+    }
+
+    for (size_t j = 0; j < numRHS; j++) {
+      beta[j] = (active[j] ? ((rho_new[j] / rho[j]) * (a[j] / omega[j])) : 0.0);
+      rho[j] = rho_new[j];
+    }
+
+    // p = r + beta*(p - omega*s)
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < numRHS; j++) {
+        p(i, j) = (active[j] ? (r(i, j) + beta[j] * (p(i, j) - omega[j] * s(i, j))) : 0.0);
+      }
+    }
+
+    this->nIterations++;
+  }
+}
+
 }  // namespace solver
 }  // namespace sgpp
@@ -8,6 +8,7 @@
 
 #include <sgpp/solver/SLESolver.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -40,6 +41,17 @@ class BiCGStab : public SLESolver {
   virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = -1.0);
+
+  /**
+   * Solves the systems for all right hand sides (columns of b) simultaneously, with the
+   * BiCGStab recurrences of the columns in lockstep. Each iteration applies the system matrix
+   * twice to a block of vectors (see base::OperationMatrix::multBlock). A column is no longer
+   * updated once it has converged (or broken down).
+   * Afterwards, getResiduum() returns the maximal residuum of all columns.
+   */
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+                     double max_threshold = -1.0);
 };
 
 }  // namespace solver
@@ -10,12 +10,25 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cstdio>
+#include <vector>
 
 namespace sgpp {
 namespace solver {
 
-ConjugateGradients::ConjugateGradients(size_t imax, double epsilon) : SLESolver(imax, epsilon) {}
+namespace {
+
+/// number of iterations after which the residual is recomputed from scratch
+const size_t residualReplacementInterval = 50;
+
+/// minimal number of unknowns for which the vector updates are parallelized
+const size_t minParallelSize = 1 << 14;
+
+}  // namespace
+
+ConjugateGradients::ConjugateGradients(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon), preconditioner(nullptr), pipelined(false) {}
 
 ConjugateGradients::~ConjugateGradients() {}
 
@@ -28,100 +41,117 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
     std::cout << "Starting Conjugated Gradients" << std::endl;
   }
 
-  // needed for residuum calculation
-  double epsilonSquared = this->myEpsilon * this->myEpsilon;
   // number off current iterations
   this->nIterations = 0;
 
-  // define temporal vectors
-  sgpp::base::DataVector temp(alpha.getSize());
-  sgpp::base::DataVector q(alpha.getSize());
-  sgpp::base::DataVector r(b);
+  if (reuse == false) {
+    alpha.setAll(0.0);
+  }
+
+  if (pipelined) {
+    solvePipelined(SystemMatrix, alpha, b, verbose, max_threshold);
+  } else {
+    solveStandard(SystemMatrix, alpha, b, verbose, max_threshold);
+  }
 
-  double delta_0 = 0.0;
-  double delta_old = 0.0;
-  double delta_new = 0.0;
-  double beta = 0.0;
-  double a = 0.0;
+  this->complete();
 
   if (verbose == true) {
-    std::cout << "All temp variables used in CG have been initialized" << std::endl;
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << this->residuum << std::endl;
   }
+}
 
-  if (reuse == true) {
-    q.setAll(0.0);
-    SystemMatrix.mult(q, temp);
-    r.sub(temp);
-    delta_0 = r.dotProduct(r) * epsilonSquared;
-    // delta_0 = r.dotProduct(r);
-  } else {
-    alpha.setAll(0.0);
-  }
+void ConjugateGradients::solveStandard(sgpp::base::OperationMatrix& SystemMatrix,
+                                       sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                       bool verbose, double max_threshold) {
+  const size_t size = alpha.getSize();
+  // needed for residuum calculation
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // the target is relative to the residuum of the zero vector
+  const double delta_0 = b.dotProduct(b) * epsilonSquared;
+
+  temp.resize(size);
+  q.resize(size);
+  r.resize(size);
 
   // calculate the starting residuum
   SystemMatrix.mult(alpha, temp);
 
-  r.sub(temp);
-
-  sgpp::base::DataVector d(r);
+  for (size_t i = 0; i < size; i++) {
+    r[i] = b[i] - temp[i];
+  }
 
-  delta_old = 0.0;
-  delta_new = r.dotProduct(r);
+  // without preconditioner, the preconditioned residual is the residual itself
+  sgpp::base::DataVector& zr = ((preconditioner != nullptr) ? z : r);
 
-  if (reuse == false) {
-    delta_0 = delta_new * epsilonSquared;
-    // delta_0 = delta_new;
+  if (preconditioner != nullptr) {
+    preconditioner->mult(r, z);
   }
 
-  this->residuum = (delta_0 / epsilonSquared);
-  // this->residuum = delta_0;
+  d = zr;
+
+  double delta_new = r.dotProduct(r);
+  double rho = zr.dotProduct(r);
+
+  this->residuum = delta_0 / epsilonSquared;
   this->calcStarting();
 
   if (verbose == true) {
     std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
-    std::cout << "Target norm:               " << (delta_0) << std::endl;
+    std::cout << "Target norm:               " << delta_0 << std::endl;
   }
 
+  double* const x = alpha.getPointer();
+  double* const rp = r.getPointer();
+  double* const dp = d.getPointer();
+
   while ((this->nIterations < this->nMaxIterations) && (delta_new > delta_0) &&
          (delta_new > max_threshold)) {
-    //          //sgpp::base::DataVector *myAlpha = this->myLearner->alpha_;
-    //        if (this->nIterations == 42) {
-    //          for (size_t j = 0; j < d.getSize();j++) {
-    //            std::cout << "d[ " << j << "]=" << d[j] << ", ";
-    //          }
-    //          std::cout << std::endl;
-    //        }
-
     // q = A*d
     SystemMatrix.mult(d, q);
 
-    double dq = d.dotProduct(q);
+    const double dq = d.dotProduct(q);
 
     if (dq == 0.0) {
       break;
     }
 
-    // a = d_new / d.q
-    a = delta_new / d.dotProduct(q);
+    // a = rho / d.q
+    const double a = rho / dq;
+    const double* const qp = q.getPointer();
+    delta_new = 0.0;
 
-    // x = x + a*d
-    alpha.axpy(a, d);
-
-    // Why ????
-    if ((this->nIterations % 50) == 0 && this->nIterations > 0) {
-      // r = b - A*x
+    if (((this->nIterations % residualReplacementInterval) == 0) && (this->nIterations > 0)) {
+      // x = x + a*d, r = b - A*x (to avoid the accumulation of rounding errors)
+      alpha.axpy(a, d);
       SystemMatrix.mult(alpha, temp);
-      r.copyFrom(b);
-      r.sub(temp);
+
+      for (size_t i = 0; i < size; i++) {
+        rp[i] = b[i] - temp[i];
+        delta_new += rp[i] * rp[i];
+      }
     } else {
-      // r = r - a*q
-      r.axpy(-a, q);
+      // x = x + a*d, r = r - a*q, delta_new = r.r in one pass
+#pragma omp parallel for reduction(+ : delta_new) if (size >= minParallelSize)
+      for (size_t i = 0; i < size; i++) {
+        x[i] += a * dp[i];
+        rp[i] -= a * qp[i];
+        delta_new += rp[i] * rp[i];
+      }
     }
 
     // calculate new deltas and determine beta
-    delta_old = delta_new;
-    delta_new = r.dotProduct(r);
-    beta = delta_new / delta_old;
+    double rho_new = delta_new;
+
+    if (preconditioner != nullptr) {
+      preconditioner->mult(r, z);
+      rho_new = z.dotProduct(r);
+    }
+
+    const double beta = rho_new / rho;
+    rho = rho_new;
 
 #ifdef X86_MIC_SYMMETRIC
     MPI_Bcast(&delta_new, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
@@ -134,22 +164,349 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
       std::cout << "delta: " << delta_new << std::endl;
     }
 
-    d.mult(beta);
-    d.add(r);
+    // d = z + beta*d
+    const double* const zp = zr.getPointer();
+
+#pragma omp parallel for if (size >= minParallelSize)
+    for (size_t i = 0; i < size; i++) {
+      dp[i] = zp[i] + beta * dp[i];
+    }
 
     this->nIterations++;
   }
 
   this->residuum = delta_new;
+}
+
+void ConjugateGradients::solvePipelined(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool verbose, double max_threshold) {
+  const size_t size = alpha.getSize();
+  const bool preconditioned = (preconditioner != nullptr);
+  // needed for residuum calculation
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // the target is relative to the residuum of the zero vector
+  const double delta_0 = b.dotProduct(b) * epsilonSquared;
+
+  // without preconditioner, the preconditioned vectors u, m, q coincide with r, w, s
+  sgpp::base::DataVector& ur = (preconditioned ? u : r);
+  sgpp::base::DataVector& mw = (preconditioned ? m : w);
+  sgpp::base::DataVector& qs = (preconditioned ? q : s);
+
+  temp.resize(size);
+  r.resize(size);
+  w.resize(size);
+  n.resize(size);
+
+  if (preconditioned) {
+    u.resize(size);
+    m.resize(size);
+  }
+
+  // r = b - A*x, u = M^{-1} r, w = A*u
+  SystemMatrix.mult(alpha, temp);
+
+  for (size_t i = 0; i < size; i++) {
+    r[i] = b[i] - temp[i];
+  }
+
+  if (preconditioned) {
+    preconditioner->mult(r, u);
+  }
+
+  SystemMatrix.mult(ur, w);
+
+  // search direction d and the auxiliary vectors s = A*d, q = M^{-1} s, z = A*q
+  d.resize(size);
+  d.setAll(0.0);
+  s.resize(size);
+  s.setAll(0.0);
+  z.resize(size);
+  z.setAll(0.0);
+
+  if (preconditioned) {
+    q.resize(size);
+    q.setAll(0.0);
+  }
+
+  double delta_new = r.dotProduct(r);
+  double gamma = ur.dotProduct(r);
+  double delta = ur.dotProduct(w);
+  double gamma_old = 0.0;
+  double a_old = 0.0;
+
+  this->residuum = delta_0 / epsilonSquared;
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
+    std::cout << "Target norm:               " << delta_0 << std::endl;
+  }
+
+  while ((this->nIterations < this->nMaxIterations) && (delta_new > delta_0) &&
+         (delta_new > max_threshold)) {
+    // m = M^{-1} w, n = A*m
+    if (preconditioned) {
+      preconditioner->mult(w, m);
+    }
+
+    SystemMatrix.mult(mw, n);
+
+    double beta = 0.0;
+    double denominator = delta;
+
+    if (this->nIterations > 0) {
+      beta = gamma / gamma_old;
+      denominator = delta - beta * gamma / a_old;
+    }
+
+    if (denominator == 0.0) {
+      break;
+    }
+
+    const double a = gamma / denominator;
+
+    double* const x = alpha.getPointer();
+    double* const rp = r.getPointer();
+    double* const up = ur.getPointer();
+    double* const wp = w.getPointer();
+    double* const dp = d.getPointer();
+    double* const sp = s.getPointer();
+    double* const qp = qs.getPointer();
+    double* const zp = z.getPointer();
+    const double* const mp = mw.getPointer();
+    const double* const np = n.getPointer();
+
+    double gamma_new = 0.0;
+    double delta_next = 0.0;
+    delta_new = 0.0;
+
+    // all vector updates and dot products in one pass
+#pragma omp parallel for reduction(+ : gamma_new, delta_next, delta_new) \
+    if (size >= minParallelSize)
+    for (size_t i = 0; i < size; i++) {
+      zp[i] = np[i] + beta * zp[i];
+      sp[i] = wp[i] + beta * sp[i];
+      dp[i] = up[i] + beta * dp[i];
+      x[i] += a * dp[i];
+      rp[i] -= a * sp[i];
+
+      if (preconditioned) {
+        qp[i] = mp[i] + beta * qp[i];
+        up[i] -= a * qp[i];
+      }
+
+      wp[i] -= a * zp[i];
+      gamma_new += rp[i] * up[i];
+      delta_next += wp[i] * up[i];
+      delta_new += rp[i] * rp[i];
+    }
+
+    if (((this->nIterations % residualReplacementInterval) == 0) && (this->nIterations > 0)) {
+      // recompute the recurrences from scratch (to avoid the accumulation of rounding errors)
+      SystemMatrix.mult(alpha, temp);
+
+      for (size_t i = 0; i < size; i++) {
+        r[i] = b[i] - temp[i];
+      }
+
+      SystemMatrix.mult(d, s);
+
+      if (preconditioned) {
+        preconditioner->mult(r, u);
+        preconditioner->mult(s, q);
+      }
+
+      SystemMatrix.mult(ur, w);
+      SystemMatrix.mult(qs, z);
+
+      delta_new = r.dotProduct(r);
+      gamma_new = ur.dotProduct(r);
+      delta_next = ur.dotProduct(w);
+    }
+
+    gamma_old = gamma;
+    gamma = gamma_new;
+    delta = delta_next;
+    a_old = a;
+
+#ifdef X86_MIC_SYMMETRIC
+    MPI_Bcast(&delta_new, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+#endif
+
+    this->residuum = delta_new;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << delta_new << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  this->residuum = delta_new;
+}
+
+void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                               sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& b,
+                               bool reuse, bool verbose, double max_threshold) {
+  const size_t size = b.getNrows();
+  const size_t numRHS = b.getNcols();
+  // needed for residuum calculation
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Conjugated Gradients for " << numRHS << " right hand sides"
+              << std::endl;
+  }
+
+  this->nIterations = 0;
+
+  if ((reuse == false) || (alpha.getNrows() != size) || (alpha.getNcols() != numRHS)) {
+    alpha.resizeRowsCols(size, numRHS);
+    alpha.setAll(0.0);
+  }
+
+  // one column per right hand side
+  sgpp::base::DataMatrix R(b);
+  sgpp::base::DataMatrix Q(size, numRHS);
+  sgpp::base::DataMatrix Z;
+
+  // calculate the starting residuals
+  SystemMatrix.multBlock(alpha, Q);
+  R.sub(Q);
+
+  // without preconditioner, the preconditioned residuals are the residuals themselves
+  sgpp::base::DataMatrix& ZR = ((preconditioner != nullptr) ? Z : R);
+
+  if (preconditioner != nullptr) {
+    preconditioner->multBlock(R, Z);
+  }
+
+  sgpp::base::DataMatrix D(ZR);
+
+  std::vector<double> delta_0;
+  std::vector<double> delta_new;
+  std::vector<double> rho;
+  std::vector<double> rho_new;
+  std::vector<double> dq;
+  std::vector<double> a(numRHS, 0.0);
+  std::vector<double> beta(numRHS, 0.0);
+  std::vector<char> active(numRHS);
+
+  // the targets are relative to the residua of the zero vectors
+  columnDotProducts(b, b, delta_0);
+  columnDotProducts(R, R, delta_new);
+  columnDotProducts(ZR, R, rho);
+
+  bool anyActive = false;
+
+  for (size_t j = 0; j < numRHS; j++) {
+    delta_0[j] *= epsilonSquared;
+    active[j] = ((delta_new[j] > delta_0[j]) && (delta_new[j] > max_threshold));
+    anyActive = anyActive || active[j];
+  }
+
+  this->residuum = (numRHS > 0) ? *std::max_element(delta_new.begin(), delta_new.end()) : 0.0;
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting max. norm of residua: " << this->residuum << std::endl;
+  }
+
+  while ((this->nIterations < this->nMaxIterations) && anyActive) {
+    // Q = A*D
+    SystemMatrix.multBlock(D, Q);
+    columnDotProducts(D, Q, dq);
+
+    for (size_t j = 0; j < numRHS; j++) {
+      if (active[j] && (dq[j] == 0.0)) {
+        active[j] = false;
+      }
+
+      a[j] = (active[j] ? (rho[j] / dq[j]) : 0.0);
+    }
+
+    const bool replaceResidual =
+        ((this->nIterations % residualReplacementInterval) == 0) && (this->nIterations > 0);
+
+    // X = X + a*D, R = R - a*Q (column-wise coefficients)
+#pragma omp parallel for if (size * numRHS >= minParallelSize)
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < numRHS; j++) {
+        alpha(i, j) += a[j] * D(i, j);
+        R(i, j) -= a[j] * Q(i, j);
+      }
+    }
+
+    if (replaceResidual) {
+      // R = B - A*X (to avoid the accumulation of rounding errors)
+      SystemMatrix.multBlock(alpha, Q);
+      R.copyFrom(b);
+      R.sub(Q);
+    }
+
+    columnDotProducts(R, R, delta_new);
+
+    if (preconditioner != nullptr) {
+      preconditioner->multBlock(R, Z);
+      columnDotProducts(Z, R, rho_new);
+    } else {
+      rho_new = delta_new;
+    }
+
+    anyActive = false;
+
+    for (size_t j = 0; j < numRHS; j++) {
+      beta[j] = (active[j] ? (rho_new[j] / rho[j]) : 0.0);
+      rho[j] = rho_new[j];
+      active[j] = (active[j] && (delta_new[j] > delta_0[j]) && (delta_new[j] > max_threshold));
+      anyActive = anyActive || active[j];
+    }
+
+    this->residuum = *std::max_element(delta_new.begin(), delta_new.end());
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "max. delta: " << this->residuum << std::endl;
+    }
+
+    // D = Z + beta*D for the columns that have not converged yet
+#pragma omp parallel for if (size * numRHS >= minParallelSize)
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < numRHS; j++) {
+        if (active[j]) {
+          D(i, j) = ZR(i, j) + beta[j] * D(i, j);
+        } else {
+          D(i, j) = 0.0;
+        }
+      }
+    }
+
+    this->nIterations++;
+  }
+
   this->complete();
 
   if (verbose == true) {
     std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
               << ")" << std::endl;
-    std::cout << "Final norm of residuum: " << delta_new << std::endl;
+    std::cout << "Final max. norm of residua: " << this->residuum << std::endl;
   }
 }
 
+void ConjugateGradients::setPreconditioner(Preconditioner* preconditioner) {
+  this->preconditioner = preconditioner;
+}
+
+Preconditioner* ConjugateGradients::getPreconditioner() const { return preconditioner; }
+
+void ConjugateGradients::setPipelined(bool pipelined) { this->pipelined = pipelined; }
+
+bool ConjugateGradients::isPipelined() const { return pipelined; }
+
 void ConjugateGradients::starting() {}
 
 void ConjugateGradients::calcStarting() {}
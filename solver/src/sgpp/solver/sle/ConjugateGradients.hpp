@@ -7,6 +7,8 @@
 #define CONJUGATEGRADIENTS_HPP
 
 #include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/solver/sle/precond/Preconditioner.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -16,6 +18,19 @@
 namespace sgpp {
 namespace solver {
 
+/**
+ * Conjugate gradients method for symmetric positive definite systems.
+ *
+ * Optionally, a (symmetric positive definite) preconditioner can be set, e.g.,
+ * JacobiPreconditioner or HierarchicalPreconditioner.
+ * In the pipelined variant (P. Ghysels, W. Vanroose: Hiding global synchronization latency in
+ * the preconditioned Conjugate Gradient algorithm, Parallel Computing 40(7), 2014), the
+ * recurrences are rearranged such that all vector updates and dot products of an iteration are
+ * carried out in a single pass over the vectors, at the cost of more vectors in memory and one
+ * additional matrix-vector multiplication at the beginning.
+ * In both variants, the residual is recomputed from scratch every 50 iterations.
+ * The stopping criterion always uses the Euclidean norm of the unpreconditioned residual.
+ */
 class ConjugateGradients : public SLESolver {
  public:
   /**
@@ -32,6 +47,39 @@ class ConjugateGradients : public SLESolver {
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = -1.0);
 
+  /**
+   * Solves the systems for all right hand sides (columns of b) simultaneously.
+   * The CG recurrences of the columns run in lockstep, such that the system matrix and the
+   * preconditioner are applied once per iteration to the block of all search directions
+   * (see base::OperationMatrix::multBlock). A column is no longer updated once its residuum
+   * satisfies the stopping criterion. The pipelined variant is not available for several
+   * right hand sides, the standard variant is used instead.
+   * Afterwards, getResiduum() returns the maximal residuum of all columns.
+   */
+  virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                     sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+                     double max_threshold = -1.0);
+
+  /**
+   * @param preconditioner preconditioner (not owned, nullptr for no preconditioning)
+   */
+  void setPreconditioner(Preconditioner* preconditioner);
+
+  /**
+   * @return preconditioner (nullptr if none is used)
+   */
+  Preconditioner* getPreconditioner() const;
+
+  /**
+   * @param pipelined whether to use the pipelined variant
+   */
+  void setPipelined(bool pipelined);
+
+  /**
+   * @return whether the pipelined variant is used
+   */
+  bool isPipelined() const;
+
   // Define functions for observer pattern in python
 
   /**
@@ -54,6 +102,38 @@ class ConjugateGradients : public SLESolver {
    * function that signals the finish of the cg method (used in python)
    */
   virtual void complete();
+
+ protected:
+  /// preconditioner (nullptr if none is used)
+  Preconditioner* preconditioner;
+  /// whether the pipelined variant is used
+  bool pipelined;
+
+  // work vectors, kept between calls of solve() to avoid reallocations
+  /// residual
+  sgpp::base::DataVector r;
+  /// search direction
+  sgpp::base::DataVector d;
+  /// product of the system matrix and the search direction
+  sgpp::base::DataVector q;
+  /// preconditioned residual
+  sgpp::base::DataVector z;
+  /// temporary vector
+  sgpp::base::DataVector temp;
+  /// additional vectors of the pipelined variant
+  sgpp::base::DataVector u, w, m, n, s;
+
+  /**
+   * Standard (preconditioned) CG with fused vector updates.
+   */
+  void solveStandard(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+                     sgpp::base::DataVector& b, bool verbose, double max_threshold);
+
+  /**
+   * Pipelined (preconditioned) CG.
+   */
+  void solvePipelined(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+                      sgpp::base::DataVector& b, bool verbose, double max_threshold);
 };
 
 }  // namespace solver
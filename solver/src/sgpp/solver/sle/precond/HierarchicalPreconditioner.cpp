@@ -0,0 +1,44 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/precond/HierarchicalPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+namespace sgpp {
+namespace solver {
+
+HierarchicalPreconditioner::HierarchicalPreconditioner(base::GridStorage* gridStorage,
+                                                       double levelBase, double shift)
+    : gridStorage(gridStorage), levelBase(levelBase), shift(shift), inverseDiagonal(0) {}
+
+HierarchicalPreconditioner::~HierarchicalPreconditioner() {}
+
+void HierarchicalPreconditioner::mult(base::DataVector& alpha, base::DataVector& result) {
+  const size_t size = alpha.getSize();
+
+  // reuse the diagonal if the grid size hasn't changed
+  if (inverseDiagonal.getSize() != size) {
+    const double dimensions = static_cast<double>(gridStorage->getDimension());
+    inverseDiagonal.resize(size);
+
+    for (size_t i = 0; i < size; i++) {
+      const double levelSum = static_cast<double>(gridStorage->getPoint(i).getLevelSum());
+      inverseDiagonal[i] = 1.0 / (std::pow(levelBase, dimensions - levelSum) + shift);
+    }
+  }
+
+  result.resize(size);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < size; i++) {
+    result[i] = inverseDiagonal[i] * alpha[i];
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef HIERARCHICALPRECONDITIONER_HPP
+#define HIERARCHICALPRECONDITIONER_HPP
+
+#include <sgpp/solver/sle/precond/Preconditioner.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Level-based diagonal preconditioner for hierarchical bases.
+ * The diagonal entries of mass-type matrices (e.g., the \f$L^2\f$ dot product matrix or
+ * \f$B^T B\f$ for uniformly distributed data) decay like
+ * \f$c^{-(\vert \mathbf{l} \vert_1 - d)}\f$ with the level \f$\mathbf{l}\f$ of the basis
+ * function (\f$c = 2\f$ for piecewise linear functions). This preconditioner uses
+ * \f$m_i = c^{-(\vert \mathbf{l}_i \vert_1 - d)} + \mathrm{shift}\f$, where the shift
+ * accounts for an identity-like regularization term. In contrast to JacobiPreconditioner,
+ * no operation has to be evaluated to obtain the diagonal.
+ * Note that for mass-type matrices of piecewise linear bases, the diagonal scaling alone does
+ * not remove the ill-conditioning caused by the hierarchical basis; it pays off mainly for
+ * systems whose diagonal spans many orders of magnitude (e.g., a level-dependent regularization,
+ * which corresponds to a levelBase smaller than one for Laplacian-type operators).
+ * The diagonal is recomputed whenever the number of grid points changes.
+ */
+class HierarchicalPreconditioner : public Preconditioner {
+ public:
+  /**
+   * Constructor
+   *
+   * @param gridStorage the grid storage (not owned)
+   * @param levelBase the base \f$c\f$ of the level-dependent decay
+   * @param shift constant that is added to all diagonal entries
+   */
+  explicit HierarchicalPreconditioner(base::GridStorage* gridStorage, double levelBase = 2.0,
+                                      double shift = 0.0);
+
+  /**
+   * Std-Destructor
+   */
+  ~HierarchicalPreconditioner() override;
+
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+ protected:
+  /// the grid storage
+  base::GridStorage* gridStorage;
+  /// base of the level-dependent decay
+  double levelBase;
+  /// constant added to the diagonal entries
+  double shift;
+  /// inverses of the diagonal entries
+  base::DataVector inverseDiagonal;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* HIERARCHICALPRECONDITIONER_HPP */
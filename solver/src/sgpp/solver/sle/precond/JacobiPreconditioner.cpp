@@ -0,0 +1,69 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/precond/JacobiPreconditioner.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+JacobiPreconditioner::JacobiPreconditioner(const base::DataVector& diagonal)
+    : diagonalOperation(nullptr), factor(1.0), shift(0.0), inverseDiagonal(0) {
+  setDiagonal(diagonal);
+}
+
+JacobiPreconditioner::JacobiPreconditioner(base::OperationMatrix& diagonalOperation,
+                                           double factor, double shift)
+    : diagonalOperation(&diagonalOperation),
+      factor(factor),
+      shift(shift),
+      inverseDiagonal(0) {}
+
+JacobiPreconditioner::~JacobiPreconditioner() {}
+
+void JacobiPreconditioner::mult(base::DataVector& alpha, base::DataVector& result) {
+  const size_t size = alpha.getSize();
+
+  // (re-)compute the diagonal if the number of unknowns has changed
+  if ((diagonalOperation != nullptr) && (inverseDiagonal.getSize() != size)) {
+    base::DataVector ones(size, 1.0);
+    base::DataVector diagonal(size);
+    diagonalOperation->mult(ones, diagonal);
+
+    for (size_t i = 0; i < size; i++) {
+      diagonal[i] = factor * diagonal[i] + shift;
+    }
+
+    setDiagonal(diagonal);
+  } else if (inverseDiagonal.getSize() != size) {
+    throw base::solver_exception(
+        "JacobiPreconditioner::mult : Size of the vector does not match the diagonal!");
+  }
+
+  result.resize(size);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < size; i++) {
+    result[i] = inverseDiagonal[i] * alpha[i];
+  }
+}
+
+const base::DataVector& JacobiPreconditioner::getInverseDiagonal() const {
+  return inverseDiagonal;
+}
+
+void JacobiPreconditioner::setDiagonal(const base::DataVector& diagonal) {
+  const size_t size = diagonal.getSize();
+  inverseDiagonal.resize(size);
+
+  for (size_t i = 0; i < size; i++) {
+    inverseDiagonal[i] = ((diagonal[i] != 0.0) ? (1.0 / diagonal[i]) : 1.0);
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
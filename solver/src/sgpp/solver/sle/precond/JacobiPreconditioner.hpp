@@ -0,0 +1,83 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef JACOBIPRECONDITIONER_HPP
+#define JACOBIPRECONDITIONER_HPP
+
+#include <sgpp/solver/sle/precond/Preconditioner.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Jacobi (diagonal) preconditioner, i.e., \f$M = \mathrm{diag}(m_1, \dots, m_n)\f$.
+ * The diagonal is either given explicitly or taken from a diagonal operation like
+ * base::OperationDiagonal or datadriven::OperationRegularizationDiagonal
+ * (by applying it to the vector of ones). In the latter case, the diagonal is
+ * recomputed whenever the number of unknowns changes (e.g., after refining the grid).
+ * Vanishing diagonal entries are replaced by one.
+ */
+class JacobiPreconditioner : public Preconditioner {
+ public:
+  /**
+   * Constructor for a given diagonal.
+   *
+   * @param diagonal diagonal entries \f$m_i\f$ of the preconditioner
+   */
+  explicit JacobiPreconditioner(const base::DataVector& diagonal);
+
+  /**
+   * Constructor for a diagonal operation.
+   * The diagonal is \f$m_i = \mathrm{factor} \cdot d_i + \mathrm{shift}\f$, where \f$d_i\f$
+   * are the diagonal entries of the operation. For instance, the regression system
+   * \f$B^T B + M\lambda C\f$ with a diagonal regularization operator \f$C\f$ can be
+   * preconditioned with factor \f$M\lambda\f$ and shift (an estimate of) the mean of the
+   * diagonal entries of \f$B^T B\f$.
+   *
+   * @param diagonalOperation diagonal operation (not owned, has to outlive this object)
+   * @param factor factor for the diagonal entries of the operation
+   * @param shift constant that is added to all diagonal entries
+   */
+  explicit JacobiPreconditioner(base::OperationMatrix& diagonalOperation, double factor = 1.0,
+                                double shift = 0.0);
+
+  /**
+   * Std-Destructor
+   */
+  ~JacobiPreconditioner() override;
+
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+  /**
+   * @return inverses \f$1/m_i\f$ of the diagonal entries (of the last application)
+   */
+  const base::DataVector& getInverseDiagonal() const;
+
+ protected:
+  /// diagonal operation (nullptr if the diagonal was given explicitly)
+  base::OperationMatrix* diagonalOperation;
+  /// factor for the diagonal entries of the operation
+  double factor;
+  /// constant added to the diagonal entries of the operation
+  double shift;
+  /// inverses of the diagonal entries
+  base::DataVector inverseDiagonal;
+
+  /**
+   * Computes inverseDiagonal from the given diagonal entries.
+   *
+   * @param diagonal diagonal entries
+   */
+  void setDiagonal(const base::DataVector& diagonal);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* JACOBIPRECONDITIONER_HPP */
@@ -0,0 +1,42 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PRECONDITIONER_HPP
+#define PRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Preconditioner \f$M \approx A\f$ for the iterative solution of \f$A\alpha = b\f$.
+ * mult() applies the inverse of the preconditioner, i.e., result = \f$M^{-1}\f$ alpha.
+ * The preconditioner has to be symmetric positive definite if it is used with
+ * ConjugateGradients.
+ */
+class Preconditioner : public base::OperationMatrix {
+ public:
+  /**
+   * Std-Destructor
+   */
+  ~Preconditioner() override {}
+
+  /**
+   * Applies the inverse of the preconditioner.
+   *
+   * @param alpha vector the inverse is applied to (e.g., the residual)
+   * @param result \f$M^{-1}\f$ alpha, resized if necessary
+   */
+  void mult(base::DataVector& alpha, base::DataVector& result) override = 0;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PRECONDITIONER_HPP */
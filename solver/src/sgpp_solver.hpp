@@ -6,6 +6,9 @@
 #ifndef SOLVER_HPP
 #define SOLVER_HPP
 
+#include <sgpp/solver/sle/precond/Preconditioner.hpp>
+#include <sgpp/solver/sle/precond/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/precond/HierarchicalPreconditioner.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/ode/Euler.hpp>
@@ -0,0 +1,367 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/precond/HierarchicalPreconditioner.hpp>
+#include <sgpp/solver/sle/precond/JacobiPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+BOOST_AUTO_TEST_SUITE(TestConjugateGradients)
+
+/**
+ * Regularized least squares system \f$(B^T B + \lambda M I) \alpha = B^T y\f$.
+ */
+class RidgeRegressionSystem : public sgpp::base::OperationMatrix {
+ public:
+  RidgeRegressionSystem(sgpp::base::OperationMultipleEval& B, size_t numData, double lambda)
+      : B(B), numData(numData), lambda(lambda) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    DataVector temp(numData);
+    B.mult(alpha, temp);
+    result.resize(alpha.getSize());
+    B.multTranspose(temp, result);
+    result.axpy(lambda * static_cast<double>(numData), alpha);
+  }
+
+ private:
+  sgpp::base::OperationMultipleEval& B;
+  size_t numData;
+  double lambda;
+};
+
+/**
+ * Diagonally scaled system \f$S A S\f$.
+ */
+class ScaledSystem : public sgpp::base::OperationMatrix {
+ public:
+  ScaledSystem(sgpp::base::OperationMatrix& A, const DataVector& scaling)
+      : A(A), scaling(scaling) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    DataVector scaledAlpha(alpha);
+    scaledAlpha.componentwise_mult(scaling);
+    A.mult(scaledAlpha, result);
+    result.componentwise_mult(scaling);
+  }
+
+ private:
+  sgpp::base::OperationMatrix& A;
+  DataVector scaling;
+};
+
+struct RegressionFixture {
+  RegressionFixture() : grid(sgpp::base::Grid::createLinearGrid(2)), numData(500) {
+    grid->getGenerator().regular(5);
+    const size_t n = grid->getSize();
+
+    dataset = DataMatrix(numData, 2);
+    DataVector y(numData);
+
+    for (size_t k = 0; k < numData; k++) {
+      const double x1 = std::abs(std::sin(static_cast<double>(k)));
+      const double x2 = std::abs(std::cos(1.3 * static_cast<double>(k)));
+      dataset.set(k, 0, x1);
+      dataset.set(k, 1, x2);
+      y[k] = std::sinh(x1) * std::cos(3.0 * x2);
+    }
+
+    B.reset(sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    system.reset(new RidgeRegressionSystem(*B, numData, 1e-3));
+
+    b = DataVector(n);
+    B->multTranspose(y, b);
+
+    // exact diagonal of the system matrix
+    diagonal = DataVector(n);
+    DataVector unitVector(n, 0.0);
+    DataVector column(n);
+
+    for (size_t i = 0; i < n; i++) {
+      unitVector[i] = 1.0;
+      system->mult(unitVector, column);
+      diagonal[i] = column[i];
+      unitVector[i] = 0.0;
+    }
+  }
+
+  double relativeResidual(DataVector& alpha) {
+    DataVector residual(alpha.getSize());
+    system->mult(alpha, residual);
+    residual.sub(b);
+    return residual.l2Norm() / b.l2Norm();
+  }
+
+  std::unique_ptr<sgpp::base::Grid> grid;
+  size_t numData;
+  DataMatrix dataset;
+  std::unique_ptr<sgpp::base::OperationMultipleEval> B;
+  std::unique_ptr<RidgeRegressionSystem> system;
+  DataVector b;
+  DataVector diagonal;
+};
+
+BOOST_FIXTURE_TEST_CASE(testPreconditionedAndPipelined, RegressionFixture) {
+  const size_t n = grid->getSize();
+  const double epsilon = 1e-10;
+
+  sgpp::solver::JacobiPreconditioner jacobi(diagonal);
+  sgpp::solver::HierarchicalPreconditioner hierarchical(&grid->getStorage(), 2.0, 0.0);
+  std::vector<sgpp::solver::Preconditioner*> preconditioners = {nullptr, &jacobi, &hierarchical};
+
+  DataVector reference(n);
+  sgpp::solver::ConjugateGradients referenceSolver(10000, epsilon);
+  referenceSolver.solve(*system, reference, b, false, false);
+  BOOST_CHECK_SMALL(relativeResidual(reference), 10.0 * epsilon);
+
+  for (bool pipelined : {false, true}) {
+    for (sgpp::solver::Preconditioner* preconditioner : preconditioners) {
+      sgpp::solver::ConjugateGradients solver(10000, epsilon);
+      solver.setPipelined(pipelined);
+      solver.setPreconditioner(preconditioner);
+      BOOST_CHECK_EQUAL(solver.isPipelined(), pipelined);
+      BOOST_CHECK_EQUAL(solver.getPreconditioner(), preconditioner);
+
+      DataVector alpha(n);
+      solver.solve(*system, alpha, b, false, false);
+
+      BOOST_CHECK_SMALL(relativeResidual(alpha), 10.0 * epsilon);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(alpha[i] - reference[i], 1e-6 * reference.maxNorm());
+      }
+
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(testJacobiRemovesScaling, RegressionFixture) {
+  const size_t n = grid->getSize();
+  DataVector scaling(n);
+
+  for (size_t i = 0; i < n; i++) {
+    scaling[i] = std::pow(10.0, static_cast<double>(i % 4));
+  }
+
+  // S A S with a badly scaled diagonal S
+  ScaledSystem scaledSystem(*system, scaling);
+  DataVector scaledDiagonal(diagonal);
+  DataVector scaledB(b);
+  scaledDiagonal.componentwise_mult(scaling);
+  scaledDiagonal.componentwise_mult(scaling);
+  scaledB.componentwise_mult(scaling);
+
+  sgpp::solver::JacobiPreconditioner jacobi(scaledDiagonal);
+
+  for (bool pipelined : {false, true}) {
+    sgpp::solver::ConjugateGradients plainSolver(100000, 1e-8);
+    sgpp::solver::ConjugateGradients jacobiSolver(100000, 1e-8);
+    plainSolver.setPipelined(pipelined);
+    jacobiSolver.setPipelined(pipelined);
+    jacobiSolver.setPreconditioner(&jacobi);
+
+    DataVector alphaPlain(n);
+    DataVector alphaJacobi(n);
+    plainSolver.solve(scaledSystem, alphaPlain, scaledB, false, false);
+    jacobiSolver.solve(scaledSystem, alphaJacobi, scaledB, false, false);
+
+    BOOST_CHECK_LT(2 * jacobiSolver.getNumberIterations(), plainSolver.getNumberIterations());
+
+    // S alpha solves the unscaled system
+    alphaJacobi.componentwise_mult(scaling);
+    BOOST_CHECK_SMALL(relativeResidual(alphaJacobi), 1e-6);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(testReuse, RegressionFixture) {
+  const size_t n = grid->getSize();
+  sgpp::solver::JacobiPreconditioner jacobi(diagonal);
+
+  for (bool pipelined : {false, true}) {
+    sgpp::solver::ConjugateGradients solver(10000, 1e-10);
+    solver.setPipelined(pipelined);
+    solver.setPreconditioner(&jacobi);
+
+    DataVector alpha(n);
+    solver.solve(*system, alpha, b, false, false);
+
+    // restarting at the solution should stop immediately
+    solver.solve(*system, alpha, b, true, false);
+    BOOST_CHECK_LE(solver.getNumberIterations(), 1);
+    BOOST_CHECK_SMALL(relativeResidual(alpha), 1e-9);
+  }
+}
+
+/**
+ * Counts the block multiplications of an operation.
+ */
+class CountingSystem : public sgpp::base::OperationMatrix {
+ public:
+  explicit CountingSystem(sgpp::base::OperationMatrix& A) : A(A), numMultBlock(0) {}
+
+  void mult(DataVector& alpha, DataVector& result) override { A.mult(alpha, result); }
+
+  void multBlock(DataMatrix& alpha, DataMatrix& result) override {
+    numMultBlock++;
+    A.multBlock(alpha, result);
+  }
+
+  sgpp::base::OperationMatrix& A;
+  size_t numMultBlock;
+};
+
+BOOST_FIXTURE_TEST_CASE(testMultipleRightHandSides, RegressionFixture) {
+  const size_t n = grid->getSize();
+  const size_t numRHS = 4;
+  const double epsilon = 1e-10;
+
+  // right hand sides b, b^2, 0 and a constant
+  DataMatrix B(n, numRHS);
+
+  for (size_t i = 0; i < n; i++) {
+    B.set(i, 0, b[i]);
+    B.set(i, 1, b[i] * b[i]);
+    B.set(i, 2, 0.0);
+    B.set(i, 3, 1.0);
+  }
+
+  sgpp::solver::JacobiPreconditioner jacobi(diagonal);
+  CountingSystem countingSystem(*system);
+
+  for (size_t k = 0; k < 3; k++) {
+    std::unique_ptr<sgpp::solver::SLESolver> solver;
+
+    if (k < 2) {
+      auto cg = new sgpp::solver::ConjugateGradients(10000, epsilon);
+      cg->setPreconditioner((k == 1) ? &jacobi : nullptr);
+      solver.reset(cg);
+    } else {
+      solver.reset(new sgpp::solver::BiCGStab(10000, epsilon));
+    }
+
+    DataMatrix X;
+    countingSystem.numMultBlock = 0;
+    solver->solve(countingSystem, X, B, false, false);
+    const size_t blockIterations = solver->getNumberIterations();
+
+    BOOST_CHECK_EQUAL(X.getNrows(), n);
+    BOOST_CHECK_EQUAL(X.getNcols(), numRHS);
+    BOOST_CHECK_GT(countingSystem.numMultBlock, 0);
+
+    if (k < 2) {
+      // one block multiplication per iteration (plus the initial residual and
+      // the residual replacements)
+      BOOST_CHECK_LE(countingSystem.numMultBlock, blockIterations + 1 + blockIterations / 50);
+    }
+
+    size_t maxIterations = 0;
+
+    for (size_t j = 0; j < numRHS; j++) {
+      DataVector bColumn(n);
+      DataVector xColumn(n);
+      DataVector xSingle(n);
+      B.getColumn(j, bColumn);
+      X.getColumn(j, xColumn);
+
+      solver->solve(*system, xSingle, bColumn, false, false);
+      maxIterations = std::max(maxIterations, solver->getNumberIterations());
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(xColumn[i] - xSingle[i], 1e-6 * (xSingle.maxNorm() + 1e-12));
+      }
+
+      if (j == 2) {
+        BOOST_CHECK_EQUAL(xColumn.maxNorm(), 0.0);
+      } else {
+        DataVector residual(n);
+        system->mult(xColumn, residual);
+        residual.sub(bColumn);
+        BOOST_CHECK_SMALL(residual.l2Norm() / bColumn.l2Norm(), 1e-6);
+      }
+    }
+
+    // the lockstep iteration runs until the slowest column has converged
+    // (up to rounding differences)
+    BOOST_CHECK_LE(blockIterations, maxIterations + 2);
+    BOOST_CHECK_GE(blockIterations + 2, maxIterations);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testJacobiPreconditioner) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(3));
+  grid->getGenerator().regular(3);
+  const size_t n = grid->getSize();
+  sgpp::base::GridStorage& gridStorage = grid->getStorage();
+
+  // diagonal from an operation: m_i = 2 * 4^(|l|_1 - d) + 0.5
+  std::unique_ptr<sgpp::base::OperationMatrix> opDiagonal(
+      sgpp::op_factory::createOperationDiagonal(*grid, 0.25));
+  sgpp::solver::JacobiPreconditioner jacobi(*opDiagonal, 2.0, 0.5);
+  sgpp::solver::HierarchicalPreconditioner hierarchical(&gridStorage, 4.0, 2.0);
+
+  DataVector residual(n);
+
+  for (size_t i = 0; i < n; i++) {
+    residual[i] = 1.0 + static_cast<double>(i);
+  }
+
+  DataVector result;
+  DataVector resultHierarchical;
+  jacobi.mult(residual, result);
+  hierarchical.mult(residual, resultHierarchical);
+  BOOST_CHECK_EQUAL(result.getSize(), n);
+  BOOST_CHECK_EQUAL(resultHierarchical.getSize(), n);
+
+  for (size_t i = 0; i < n; i++) {
+    const double levelSum = static_cast<double>(gridStorage.getPoint(i).getLevelSum());
+    const double m = 2.0 * std::pow(4.0, levelSum - 3.0) + 0.5;
+    BOOST_CHECK_CLOSE(result[i], residual[i] / m, 1e-12);
+    BOOST_CHECK_CLOSE(jacobi.getInverseDiagonal()[i], 1.0 / m, 1e-12);
+    BOOST_CHECK_CLOSE(resultHierarchical[i],
+                      residual[i] / (std::pow(4.0, 3.0 - levelSum) + 2.0), 1e-12);
+  }
+
+  // the diagonal is adapted to a refined grid
+  gridStorage.clear();
+  grid->getGenerator().regular(4);
+  const size_t nRefined = grid->getSize();
+  DataVector residualRefined(nRefined, 1.0);
+  jacobi.mult(residualRefined, result);
+  hierarchical.mult(residualRefined, resultHierarchical);
+  BOOST_CHECK_EQUAL(result.getSize(), nRefined);
+  BOOST_CHECK_EQUAL(resultHierarchical.getSize(), nRefined);
+
+  // explicit diagonal with vanishing entries
+  DataVector diagonal(n, 4.0);
+  diagonal[0] = 0.0;
+  sgpp::solver::JacobiPreconditioner explicitJacobi(diagonal);
+  explicitJacobi.mult(residual, result);
+  BOOST_CHECK_EQUAL(result[0], residual[0]);
+  BOOST_CHECK_EQUAL(result[1], residual[1] / 4.0);
+
+  BOOST_CHECK_THROW(explicitJacobi.mult(residualRefined, result), sgpp::base::solver_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()